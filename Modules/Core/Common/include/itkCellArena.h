@@ -0,0 +1,196 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkCellArena_h
+#define itkCellArena_h
+
+#include "itkIntTypes.h"
+
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <typeinfo>
+#include <vector>
+
+namespace itk
+{
+/** \class CellArena
+ * \brief Allocates cells in contiguous blocks and owns them.
+ *
+ * Cells of a given type are allocated from arrays of that type, which grow
+ * geometrically as cells are requested. Creating many cells therefore costs
+ * a few large allocations instead of one allocation per cell, the cells of a
+ * mesh are stored next to each other, and all of them are destroyed at once
+ * when the arena is cleared or deleted. The arrays are left uninitialized
+ * and each cell is only constructed when it is requested.
+ *
+ * Cells allocated elsewhere can be handed over to the arena with Adopt(), so
+ * that an arena can own all the cells of a mesh even when some of them are
+ * created by code that allocates cells one by one.
+ *
+ * TCellInterface is the base class of the cells, typically
+ * CellInterface<TPixel, TCellTraits>.
+ *
+ * \sa Mesh
+ * \ingroup MeshObjects
+ * \ingroup ITKCommon
+ */
+template <typename TCellInterface>
+class CellArena
+{
+public:
+  using Self = CellArena;
+  using CellInterfaceType = TCellInterface;
+
+  /** Smallest and largest number of cells in an array. */
+  static constexpr SizeValueType MinimumBlockSize = 64;
+  static constexpr SizeValueType MaximumBlockSize = 65536;
+
+  CellArena() = default;
+  CellArena(const Self &) = delete;
+  Self &
+  operator=(const Self &) = delete;
+  ~CellArena() = default;
+
+  /** Returns a default constructed cell of type TCell, owned by the arena. */
+  template <typename TCell>
+  TCell *
+  New()
+  {
+    Block<TCell> * block = this->GetOpenBlock<TCell>();
+    if (block == nullptr || block->m_Size == block->m_Capacity)
+    {
+      const SizeValueType capacity = (block == nullptr)
+                                       ? SizeValueType{ MinimumBlockSize }
+                                       : std::min(2 * block->m_Capacity, SizeValueType{ MaximumBlockSize });
+      block = this->AddBlock<TCell>(capacity);
+    }
+    TCell * cell = new (block->m_Cells + block->m_Size) TCell;
+    ++block->m_Size;
+    ++m_NumberOfCells;
+    return cell;
+  }
+
+  /** Take ownership of a cell allocated with new. */
+  void
+  Adopt(CellInterfaceType * cell)
+  {
+    m_AdoptedCells.emplace_back(cell);
+    ++m_NumberOfCells;
+  }
+
+  /** Destroy all the cells of the arena. */
+  void
+  Clear()
+  {
+    m_Blocks.clear();
+    m_OpenBlocks.clear();
+    m_AdoptedCells.clear();
+    m_NumberOfCells = 0;
+  }
+
+  /** Number of cells owned by the arena. */
+  SizeValueType
+  GetNumberOfCells() const
+  {
+    return m_NumberOfCells;
+  }
+
+private:
+  struct BlockBase
+  {
+    virtual ~BlockBase() = default;
+
+    const std::type_info * m_Type{ nullptr };
+    SizeValueType          m_Size{ 0 };
+    SizeValueType          m_Capacity{ 0 };
+  };
+
+  /** Array of cells of type TCell, of which the first m_Size are
+   * constructed. */
+  template <typename TCell>
+  struct Block : public BlockBase
+  {
+    explicit Block(SizeValueType capacity)
+    {
+      this->m_Type = &typeid(TCell);
+      this->m_Capacity = capacity;
+      m_Cells = std::allocator<TCell>().allocate(capacity);
+    }
+
+    ~Block() override
+    {
+      for (SizeValueType i = 0; i < this->m_Size; ++i)
+      {
+        m_Cells[i].~TCell();
+      }
+      std::allocator<TCell>().deallocate(m_Cells, this->m_Capacity);
+    }
+
+    Block(const Block &) = delete;
+    Block &
+    operator=(const Block &) = delete;
+
+    TCell * m_Cells{ nullptr };
+  };
+
+  /** Array from which the cells of type TCell are currently allocated. */
+  template <typename TCell>
+  Block<TCell> *
+  GetOpenBlock() const
+  {
+    for (BlockBase * block : m_OpenBlocks)
+    {
+      if (*block->m_Type == typeid(TCell))
+      {
+        return static_cast<Block<TCell> *>(block);
+      }
+    }
+    return nullptr;
+  }
+
+  template <typename TCell>
+  Block<TCell> *
+  AddBlock(SizeValueType capacity)
+  {
+    std::unique_ptr<Block<TCell>> block(new Block<TCell>(capacity));
+
+    Block<TCell> * result = block.get();
+    m_Blocks.push_back(std::move(block));
+
+    auto open = std::find_if(m_OpenBlocks.begin(), m_OpenBlocks.end(), [](const BlockBase * b) {
+      return *b->m_Type == typeid(TCell);
+    });
+    if (open == m_OpenBlocks.end())
+    {
+      m_OpenBlocks.push_back(result);
+    }
+    else
+    {
+      *open = result;
+    }
+    return result;
+  }
+
+  std::vector<std::unique_ptr<BlockBase>>         m_Blocks;
+  std::vector<BlockBase *>                        m_OpenBlocks;
+  std::vector<std::unique_ptr<CellInterfaceType>> m_AdoptedCells;
+  SizeValueType                                   m_NumberOfCells{ 0 };
+};
+} // end namespace itk
+
+#endif
@@ -0,0 +1,84 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkCellArenaContainer_h
+#define itkCellArenaContainer_h
+
+#include "itkCellArena.h"
+#include "itkObjectFactory.h"
+
+#include <type_traits>
+
+namespace itk
+{
+/** \class CellArenaContainer
+ * \brief Cells container which owns its cells through a CellArena.
+ *
+ * TCellsContainer is the cells container type of a mesh, e.g.
+ * MapContainer<CellIdentifier, CellType *> or
+ * VectorContainer<CellIdentifier, CellType *>. This subclass stores the cell
+ * pointers the same way, and also holds the arena in which the cells are
+ * allocated. The cells are therefore destroyed with the container, whichever
+ * mesh releases it last.
+ *
+ * \sa CellArena Mesh
+ * \ingroup MeshObjects
+ * \ingroup ITKCommon
+ */
+template <typename TCellsContainer>
+class ITK_TEMPLATE_EXPORT CellArenaContainer : public TCellsContainer
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(CellArenaContainer);
+
+  /** Standard class type aliases. */
+  using Self = CellArenaContainer;
+  using Superclass = TCellsContainer;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(CellArenaContainer, TCellsContainer);
+
+  /** Arena owning the cells of the container. */
+  using CellArenaType = CellArena<std::remove_pointer_t<typename TCellsContainer::Element>>;
+
+  /** Get the arena owning the cells of the container. */
+  CellArenaType &
+  GetCellArena()
+  {
+    return m_CellArena;
+  }
+  const CellArenaType &
+  GetCellArena() const
+  {
+    return m_CellArena;
+  }
+
+protected:
+  CellArenaContainer() = default;
+  ~CellArenaContainer() override = default;
+
+private:
+  CellArenaType m_CellArena;
+};
+} // end namespace itk
+
+#endif
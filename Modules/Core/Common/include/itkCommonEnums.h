@@ -199,7 +199,8 @@ public:
     CellsAllocationMethodUndefined,
     CellsAllocatedAsStaticArray,
     CellsAllocatedAsADynamicArray,
-    CellsAllocatedDynamicallyCellByCell
+    CellsAllocatedDynamicallyCellByCell,
+    CellsAllocatedInAnArena
   };
 };
 extern ITKCommon_EXPORT std::ostream &
@@ -0,0 +1,419 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkVectorMapContainer_h
+#define itkVectorMapContainer_h
+
+#include "itkObject.h"
+#include "itkObjectFactory.h"
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+namespace itk
+{
+/** \class VectorMapContainer
+ * \brief A container with the interface of MapContainer, stored in a vector.
+ *
+ * Elements are stored in a std::vector indexed by their identifier, along
+ * with a flag telling whether each identifier is in use. Identifiers can be
+ * deleted and created in any order like in a MapContainer, but accessing an
+ * element costs one indexing operation instead of a search in a tree, and
+ * the elements are stored contiguously.
+ *
+ * Iterators visit the identifiers in use in increasing order, skipping
+ * deleted ones. Deleting an element keeps its slot, so that End() does not
+ * move while iterating; the slots after the largest identifier in use are
+ * skipped at once, and only released by Squeeze(). Memory is proportional
+ * to the largest identifier ever used since the last Squeeze(),
+ * so this container is meant for identifiers that are mostly contiguous,
+ * for instance when deleted identifiers are reused, as QuadEdgeMesh does.
+ *
+ * \tparam TElementIdentifier An unsigned integral type used to index the
+ * container.
+ *
+ * \tparam TElement The element type stored in the container.
+ *
+ * \sa MapContainer
+ * \sa VectorContainer
+ *
+ * \ingroup DataRepresentation
+ * \ingroup ITKCommon
+ */
+template <typename TElementIdentifier, typename TElement>
+class ITK_TEMPLATE_EXPORT VectorMapContainer : public Object
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(VectorMapContainer);
+
+  /** Standard class type aliases. */
+  using Self = VectorMapContainer;
+  using Superclass = Object;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Standard part of every itk Object. */
+  itkTypeMacro(VectorMapContainer, Object);
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Save the template parameters. */
+  using ElementIdentifier = TElementIdentifier;
+  using Element = TElement;
+
+  /** Declare iterators to container. */
+  class Iterator;
+  class ConstIterator;
+  friend class Iterator;
+  friend class ConstIterator;
+
+  /** \class Iterator
+   * \brief The non-const iterator type for the container.
+   * \ingroup ITKCommon
+   */
+  class Iterator
+  {
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Element;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Element *;
+    using reference = Element &;
+
+    Iterator() = default;
+    Iterator(Self * container, ElementIdentifier position)
+      : m_Container(container)
+      , m_Position(position)
+    {}
+
+    Iterator & operator*() { return *this; }
+
+    Iterator * operator->() { return this; }
+
+    Iterator &
+    operator++()
+    {
+      m_Position = m_Container->NextPosition(m_Position);
+      return *this;
+    }
+
+    Iterator
+    operator++(int)
+    {
+      Iterator temp(*this);
+      ++(*this);
+      return temp;
+    }
+
+    Iterator &
+    operator--()
+    {
+      m_Position = m_Container->PreviousPosition(m_Position);
+      return *this;
+    }
+
+    Iterator
+    operator--(int)
+    {
+      Iterator temp(*this);
+      --(*this);
+      return temp;
+    }
+
+    bool
+    operator==(const Iterator & r) const
+    {
+      return m_Position == r.m_Position;
+    }
+
+    ITK_UNEQUAL_OPERATOR_MEMBER_FUNCTION(Iterator);
+
+    bool
+    operator==(const ConstIterator & r) const
+    {
+      return m_Position == r.m_Position;
+    }
+
+    ITK_UNEQUAL_OPERATOR_MEMBER_FUNCTION(ConstIterator);
+
+    /** Get the index into the container associated with this iterator. */
+    ElementIdentifier
+    Index() const
+    {
+      return m_Position;
+    }
+
+    /** Get the value at this iterator's location in the container. */
+    Element &
+    Value()
+    {
+      return m_Container->m_Elements[m_Position];
+    }
+
+  private:
+    Self *            m_Container{ nullptr };
+    ElementIdentifier m_Position{ 0 };
+    friend class ConstIterator;
+  };
+
+  /** \class ConstIterator
+   * \brief The const iterator type for the container.
+   * \ingroup ITKCommon
+   */
+  class ConstIterator
+  {
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Element;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Element *;
+    using reference = const Element &;
+
+    ConstIterator() = default;
+    ConstIterator(const Self * container, ElementIdentifier position)
+      : m_Container(container)
+      , m_Position(position)
+    {}
+    ConstIterator(const Iterator & r)
+      : m_Container(r.m_Container)
+      , m_Position(r.m_Position)
+    {}
+
+    ConstIterator & operator*() { return *this; }
+
+    ConstIterator * operator->() { return this; }
+
+    ConstIterator &
+    operator++()
+    {
+      m_Position = m_Container->NextPosition(m_Position);
+      return *this;
+    }
+
+    ConstIterator
+    operator++(int)
+    {
+      ConstIterator temp(*this);
+      ++(*this);
+      return temp;
+    }
+
+    ConstIterator &
+    operator--()
+    {
+      m_Position = m_Container->PreviousPosition(m_Position);
+      return *this;
+    }
+
+    ConstIterator
+    operator--(int)
+    {
+      ConstIterator temp(*this);
+      --(*this);
+      return temp;
+    }
+
+    bool
+    operator==(const Iterator & r) const
+    {
+      return m_Position == r.m_Position;
+    }
+
+    ITK_UNEQUAL_OPERATOR_MEMBER_FUNCTION(Iterator);
+
+    bool
+    operator==(const ConstIterator & r) const
+    {
+      return m_Position == r.m_Position;
+    }
+
+    ITK_UNEQUAL_OPERATOR_MEMBER_FUNCTION(ConstIterator);
+
+    /** Get the index into the container associated with this iterator. */
+    ElementIdentifier
+    Index() const
+    {
+      return m_Position;
+    }
+
+    /** Get the value at this iterator's location in the container. */
+    const Element &
+    Value() const
+    {
+      return m_Container->m_Elements[m_Position];
+    }
+
+  private:
+    const Self *      m_Container{ nullptr };
+    ElementIdentifier m_Position{ 0 };
+    friend class Iterator;
+  };
+
+  /* Declare the public interface routines. */
+
+  /**
+   * Get a reference to the element at the given index.
+   * If the index does not exist, it is created automatically.
+   *
+   * It is assumed that the value of the element is modified through the
+   * reference.
+   */
+  Element & ElementAt(ElementIdentifier);
+
+  /**
+   * Get a reference to the element at the given index.
+   */
+  const Element & ElementAt(ElementIdentifier) const;
+
+  /**
+   * Get a reference to the element at the given index.
+   * If the index does not exist, it is created automatically.
+   *
+   * It is assumed that the value of the element is modified through the
+   * reference.
+   */
+  Element & CreateElementAt(ElementIdentifier);
+
+  /**
+   * Get the element at the specified index.  There is no check for
+   * existence performed.
+   */
+  Element GetElement(ElementIdentifier) const;
+
+  /**
+   * Set the given index value to the given element.  If the index doesn't
+   * exist, it is automatically created.
+   */
+  void SetElement(ElementIdentifier, Element);
+
+  /**
+   * Set the given index value to the given element.  If the index doesn't
+   * exist, it is automatically created.
+   */
+  void InsertElement(ElementIdentifier, Element);
+
+  /**
+   * Check if the container has an entry corresponding to the given index.
+   */
+  bool IndexExists(ElementIdentifier) const;
+
+  /**
+   * If the given index doesn't exist in the container, return false.
+   * Otherwise, set the element through the pointer (if it isn't null), and
+   * return true.
+   */
+  bool
+  GetElementIfIndexExists(ElementIdentifier, Element *) const;
+
+  /**
+   * Create an entry for the given index, or reset it, to the default
+   * element.
+   */
+  void CreateIndex(ElementIdentifier);
+
+  /**
+   * Delete the entry corresponding to the given identifier.
+   * If the entry does not exist, nothing happens. The memory of the entry
+   * is kept, and iterators other than those pointing to it remain valid.
+   */
+  void DeleteIndex(ElementIdentifier);
+
+  /**
+   * Get a begin const iterator for the container.
+   */
+  ConstIterator
+  Begin() const;
+
+  /**
+   * Get an end const iterator for the container.
+   */
+  ConstIterator
+  End() const;
+
+  /**
+   * Get a begin iterator for the container.
+   */
+  Iterator
+  Begin();
+
+  /**
+   * Get an end iterator for the container.
+   */
+  Iterator
+  End();
+
+  /**
+   * Get the number of elements currently stored in the container.
+   */
+  ElementIdentifier
+  Size() const;
+
+  /**
+   * Make sure that the indexes from zero to size - 1 exist, like
+   * MapContainer::Reserve(), and allocate the memory to store them.
+   */
+  void Reserve(ElementIdentifier);
+
+  /**
+   * Tell the container to try to minimize its memory usage for storage of
+   * the current number of elements, releasing the slots after the largest
+   * identifier in use. This invalidates End().
+   */
+  void
+  Squeeze();
+
+  /**
+   * Tell the container to release any memory it may have allocated and
+   * return itself to its initial state.
+   */
+  void
+  Initialize();
+
+protected:
+  VectorMapContainer() = default;
+  ~VectorMapContainer() override = default;
+
+private:
+  /** Make the given index exist, keeping its current element if it does. */
+  Element &
+  Allocate(ElementIdentifier);
+
+  /** Position of the first index in use after the given position, or the
+   * end position. */
+  ElementIdentifier
+  NextPosition(ElementIdentifier) const;
+
+  /** Position of the last index in use before the given position. */
+  ElementIdentifier
+  PreviousPosition(ElementIdentifier) const;
+
+  std::vector<Element> m_Elements;
+  std::vector<bool>    m_InUse;
+  ElementIdentifier    m_Size{ 0 };
+
+  /** One past the largest identifier in use, zero if none is. */
+  ElementIdentifier m_UsedSize{ 0 };
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkVectorMapContainer.hxx"
+#endif
+
+#endif
@@ -0,0 +1,255 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkVectorMapContainer_hxx
+#define itkVectorMapContainer_hxx
+
+
+namespace itk
+{
+
+template <typename TElementIdentifier, typename TElement>
+auto
+VectorMapContainer<TElementIdentifier, TElement>::Allocate(ElementIdentifier id) -> Element &
+{
+  if (id >= m_Elements.size())
+  {
+    m_Elements.resize(id + 1);
+    m_InUse.resize(id + 1, false);
+  }
+  if (!m_InUse[id])
+  {
+    m_InUse[id] = true;
+    ++m_Size;
+    m_UsedSize = std::max(m_UsedSize, id + 1);
+  }
+  return m_Elements[id];
+}
+
+template <typename TElementIdentifier, typename TElement>
+auto
+VectorMapContainer<TElementIdentifier, TElement>::NextPosition(ElementIdentifier position) const -> ElementIdentifier
+{
+  // No index is in use from m_UsedSize on, so the iteration ends at once
+  do
+  {
+    ++position;
+  } while (position < m_UsedSize && !m_InUse[position]);
+  return (position < m_UsedSize) ? position : static_cast<ElementIdentifier>(m_InUse.size());
+}
+
+template <typename TElementIdentifier, typename TElement>
+auto
+VectorMapContainer<TElementIdentifier, TElement>::PreviousPosition(ElementIdentifier position) const
+  -> ElementIdentifier
+{
+  position = std::min(position, m_UsedSize);
+  do
+  {
+    --position;
+  } while (position > 0 && !m_InUse[position]);
+  return position;
+}
+
+template <typename TElementIdentifier, typename TElement>
+auto
+VectorMapContainer<TElementIdentifier, TElement>::ElementAt(ElementIdentifier id) -> Element &
+{
+  this->Modified();
+  return this->Allocate(id);
+}
+
+template <typename TElementIdentifier, typename TElement>
+auto
+VectorMapContainer<TElementIdentifier, TElement>::ElementAt(ElementIdentifier id) const -> const Element &
+{
+  return m_Elements[id];
+}
+
+template <typename TElementIdentifier, typename TElement>
+auto
+VectorMapContainer<TElementIdentifier, TElement>::CreateElementAt(ElementIdentifier id) -> Element &
+{
+  this->Modified();
+  return this->Allocate(id);
+}
+
+template <typename TElementIdentifier, typename TElement>
+auto
+VectorMapContainer<TElementIdentifier, TElement>::GetElement(ElementIdentifier id) const -> Element
+{
+  return m_Elements[id];
+}
+
+template <typename TElementIdentifier, typename TElement>
+void
+VectorMapContainer<TElementIdentifier, TElement>::SetElement(ElementIdentifier id, Element element)
+{
+  this->Allocate(id) = element;
+  this->Modified();
+}
+
+template <typename TElementIdentifier, typename TElement>
+void
+VectorMapContainer<TElementIdentifier, TElement>::InsertElement(ElementIdentifier id, Element element)
+{
+  this->Allocate(id) = element;
+  this->Modified();
+}
+
+template <typename TElementIdentifier, typename TElement>
+bool
+VectorMapContainer<TElementIdentifier, TElement>::IndexExists(ElementIdentifier id) const
+{
+  return id < m_InUse.size() && m_InUse[id];
+}
+
+template <typename TElementIdentifier, typename TElement>
+bool
+VectorMapContainer<TElementIdentifier, TElement>::GetElementIfIndexExists(ElementIdentifier id,
+                                                                          Element *         element) const
+{
+  if (this->IndexExists(id))
+  {
+    if (element)
+    {
+      *element = m_Elements[id];
+    }
+    return true;
+  }
+  return false;
+}
+
+template <typename TElementIdentifier, typename TElement>
+void
+VectorMapContainer<TElementIdentifier, TElement>::CreateIndex(ElementIdentifier id)
+{
+  this->Allocate(id) = Element();
+  this->Modified();
+}
+
+/**
+ * The element is reset to its default value, so that it does not hold
+ * resources. Its slot is kept, so that End() does not move.
+ */
+template <typename TElementIdentifier, typename TElement>
+void
+VectorMapContainer<TElementIdentifier, TElement>::DeleteIndex(ElementIdentifier id)
+{
+  if (this->IndexExists(id))
+  {
+    m_Elements[id] = Element();
+    m_InUse[id] = false;
+    --m_Size;
+
+    while (m_UsedSize > 0 && !m_InUse[m_UsedSize - 1])
+    {
+      --m_UsedSize;
+    }
+  }
+  this->Modified();
+}
+
+template <typename TElementIdentifier, typename TElement>
+auto
+VectorMapContainer<TElementIdentifier, TElement>::Begin() const -> ConstIterator
+{
+  ElementIdentifier position = 0;
+  while (position < m_UsedSize && !m_InUse[position])
+  {
+    ++position;
+  }
+  if (position == m_UsedSize)
+  {
+    position = static_cast<ElementIdentifier>(m_InUse.size());
+  }
+  return ConstIterator(this, position);
+}
+
+template <typename TElementIdentifier, typename TElement>
+auto
+VectorMapContainer<TElementIdentifier, TElement>::End() const -> ConstIterator
+{
+  return ConstIterator(this, static_cast<ElementIdentifier>(m_InUse.size()));
+}
+
+template <typename TElementIdentifier, typename TElement>
+auto
+VectorMapContainer<TElementIdentifier, TElement>::Begin() -> Iterator
+{
+  ElementIdentifier position = 0;
+  while (position < m_UsedSize && !m_InUse[position])
+  {
+    ++position;
+  }
+  if (position == m_UsedSize)
+  {
+    position = static_cast<ElementIdentifier>(m_InUse.size());
+  }
+  return Iterator(this, position);
+}
+
+template <typename TElementIdentifier, typename TElement>
+auto
+VectorMapContainer<TElementIdentifier, TElement>::End() -> Iterator
+{
+  return Iterator(this, static_cast<ElementIdentifier>(m_InUse.size()));
+}
+
+template <typename TElementIdentifier, typename TElement>
+auto
+VectorMapContainer<TElementIdentifier, TElement>::Size() const -> ElementIdentifier
+{
+  return m_Size;
+}
+
+template <typename TElementIdentifier, typename TElement>
+void
+VectorMapContainer<TElementIdentifier, TElement>::Reserve(ElementIdentifier sz)
+{
+  m_Elements.reserve(sz);
+  m_InUse.reserve(sz);
+  for (ElementIdentifier id = 0; id < sz; ++id)
+  {
+    this->Allocate(id);
+  }
+  this->Modified();
+}
+
+template <typename TElementIdentifier, typename TElement>
+void
+VectorMapContainer<TElementIdentifier, TElement>::Squeeze()
+{
+  m_Elements.resize(m_UsedSize);
+  m_InUse.resize(m_UsedSize);
+  m_Elements.shrink_to_fit();
+  m_InUse.shrink_to_fit();
+}
+
+template <typename TElementIdentifier, typename TElement>
+void
+VectorMapContainer<TElementIdentifier, TElement>::Initialize()
+{
+  m_Elements = std::vector<Element>();
+  m_InUse = std::vector<bool>();
+  m_Size = 0;
+  m_UsedSize = 0;
+}
+
+} // end namespace itk
+
+#endif
@@ -214,6 +214,8 @@ operator<<(std::ostream & out, const MeshEnums::MeshClassCellsAllocationMethod v
         return "itk::MeshEnums::MeshClassCellsAllocationMethod::CellsAllocatedAsADynamicArray";
       case MeshEnums::MeshClassCellsAllocationMethod::CellsAllocatedDynamicallyCellByCell:
         return "itk::MeshEnums::MeshClassCellsAllocationMethod::CellsAllocatedDynamicallyCellByCell";
+      case MeshEnums::MeshClassCellsAllocationMethod::CellsAllocatedInAnArena:
+        return "itk::MeshEnums::MeshClassCellsAllocationMethod::CellsAllocatedInAnArena";
       default:
         return "INVALID VALUE FOR itk::MeshEnums::MeshClassCellsAllocationMethod";
     }
@@ -217,7 +217,8 @@ itkLoggerTest(int argc, char * argv[])
     itk::MeshEnums::MeshClassCellsAllocationMethod::CellsAllocationMethodUndefined,
     itk::MeshEnums::MeshClassCellsAllocationMethod::CellsAllocatedAsStaticArray,
     itk::MeshEnums::MeshClassCellsAllocationMethod::CellsAllocatedAsADynamicArray,
-    itk::MeshEnums::MeshClassCellsAllocationMethod::CellsAllocatedDynamicallyCellByCell
+    itk::MeshEnums::MeshClassCellsAllocationMethod::CellsAllocatedDynamicallyCellByCell,
+    itk::MeshEnums::MeshClassCellsAllocationMethod::CellsAllocatedInAnArena
   };
   for (const auto & ee : allMeshClassCellsAllocationMethod)
   {
@@ -25,6 +25,10 @@
 #include "itkCovariantVector.h"
 #include "itkDefaultStaticMeshTraits.h"
 #include "itkImageRegionConstIterator.h"
+#include "itkMath.h"
+
+#include <array>
+#include <vector>
 
 namespace itk
 {
@@ -53,11 +57,30 @@ namespace itk
  * to construct elements within each voxel. We then merge all these mesh elements into
  * one 3D mesh.
  *
+ * \par
+ * When UseParallelSlabs is on, the volume is instead split in slabs of frames
+ * that are processed in parallel. Each slab keeps the nodes of the edges of
+ * its last two frames in tables indexed by the position of the edges, so that
+ * the nodes shared by neighbouring voxels are created once. The nodes on the
+ * first frame of a slab are then stitched to the nodes on the last frame of
+ * the previous slab. The nodes and cells are numbered in the order of the
+ * voxels, whatever the number of slabs. This mesh differs from the default
+ * one: the default voxel walk creates some nodes several times, and its last
+ * voxel of each row reads the pixels at the start of the next row. The
+ * parallel slabs never duplicate nodes, and consider the pixels past the
+ * region of interest to be outside of the object.
+ *
  * \par PARAMETERS
  * The ObjectValue parameter is used to identify the object. In most applications,
  * pixels in the object region are assigned to "1", so the default value of ObjectValue is
  * set to "1"
  *
+ * \par
+ * When UseIsoValue is on, the pixels whose value is greater than or equal to
+ * IsoValue are in the object instead, and the nodes are placed on the edges
+ * of the voxels by linear interpolation of the pixel values, rather than at
+ * the middle of the edges. This extracts an iso-surface of a grayscale image.
+ *
  * \par REFERENCE
  * W. Lorensen and H. Cline, "Marching Cubes: A High Resolution 3D Surface Construction Algorithm",
  * Computer Graphics 21, pp. 163-169, 1987.
@@ -127,6 +150,24 @@ public:
 
   itkSetMacro(ObjectValue, InputPixelType);
 
+  /** Set/Get whether the pixels greater than or equal to IsoValue are in the
+   * object, with the nodes interpolated along the edges of the voxels,
+   * rather than the pixels equal to ObjectValue. Off by default. */
+  itkSetMacro(UseIsoValue, bool);
+  itkGetConstMacro(UseIsoValue, bool);
+  itkBooleanMacro(UseIsoValue);
+
+  /** Set/Get the iso-value of the surface, used when UseIsoValue is on. */
+  itkSetMacro(IsoValue, double);
+  itkGetConstMacro(IsoValue, double);
+
+  /** Set/Get whether the mesh is generated by slabs of frames in parallel.
+   * The mesh then has no duplicated nodes, and differs from the default
+   * mesh on the last column and row of voxels. Off by default. */
+  itkSetMacro(UseParallelSlabs, bool);
+  itkGetConstMacro(UseParallelSlabs, bool);
+  itkBooleanMacro(UseParallelSlabs);
+
   itkGetConstMacro(NumberOfNodes, SizeValueType);
   itkGetConstMacro(NumberOfCells, SizeValueType);
 
@@ -168,9 +209,40 @@ protected:
 private:
   using InputImageSizeType = typename InputImageType::SizeType;
 
+  /** Nodes and cells generated from a slab of frames, with node ids local to
+   * the slab. */
+  struct SlabType
+  {
+    int m_BeginFrame;
+    int m_EndFrame;
+
+    std::vector<OPointType>     m_Points;
+    std::vector<IdentifierType> m_Cells;
+
+    /** Local ids of the nodes on the edges of the first and last frames of
+     * the slab, indexed by the position of the edges. */
+    std::vector<IdentifierType> m_FirstFrameNodes;
+    std::vector<IdentifierType> m_LastFrameNodes;
+
+    /** Pairs of local ids of nodes that are on the last frame of the previous
+     * slab, and local ids of the same nodes in the previous slab. */
+    std::vector<IdentifierType> m_SharedNodes;
+
+    /** Ids of the nodes in the output mesh. */
+    std::vector<IdentifierType> m_NodeIds;
+  };
+
   void
   CreateMesh();
 
+  /** Generate the mesh by walking through the voxels one by one. */
+  void
+  CreateMeshVoxelByVoxel();
+
+  /** Generate the mesh by slabs of frames in parallel. */
+  void
+  CreateMeshInParallel();
+
   void
   XFlip(unsigned char * x); // 7 kinds of transformation
 
@@ -196,15 +268,20 @@ private:
   InitializeLUT(); // initialize the look up table before the mesh
                    // construction
 
+  /** Initialize the triangles of each combination of the nodes of a voxel
+   * from the look up table. */
+  void
+  InitializeTriangles();
+
   void
-  AddCells(unsigned char celltype, unsigned char celltran, int index);
+  AddCells(int vertexindex, int index);
 
   void
-  AddNodes(int               index,
-           unsigned char *   nodesid,
-           IdentifierType *  globalnodesid,
-           IdentifierType ** currentrowtmp,
-           IdentifierType ** currentframetmp);
+  AddNodes(int              index,
+           unsigned char *  nodesid,
+           IdentifierType * globalnodesid,
+           IdentifierType   currentrowtmp[4][2],
+           IdentifierType   currentframetmp[4][2]);
 
   void
   CellTransfer(unsigned char * nodesid, unsigned char celltran);
@@ -215,31 +292,52 @@ private:
   IdentifierType
   SearchThroughLastFrame(int index, int start, int end);
 
+  /** Returns true if the pixel value belongs to the object. */
+  bool
+  IsInObject(const InputPixelType & value) const
+  {
+    return m_UseIsoValue ? (static_cast<double>(value) >= m_IsoValue) : Math::ExactlyEquals(value, m_ObjectValue);
+  }
+
+  /** Computes the continuous index of a node of the voxel whose first pixel
+   * is at (x, y, z) in the region of interest. */
+  template <typename TContinuousIndex>
+  void
+  ComputeNodeIndex(int x, int y, int z, unsigned char node, TContinuousIndex & nodeIndex) const;
+
+  /** Generate the nodes and cells of the voxels of a slab. */
+  void
+  GenerateSlab(SlabType & slab) const;
+
+  /** Set mask to 1 for the pixels of a frame of the region of interest that
+   * belong to the object, and to 0 for the other pixels. */
+  void
+  ReadFrame(int frame, std::vector<unsigned char> & mask) const;
+
   unsigned char m_LUT[256][2]; // the two lookup tables
 
+  /** Nodes of the current and last voxels, and nodes of the current and
+   * last rows and frames of voxels, as pairs of a position key and a node id,
+   * used by the voxel by voxel walk. */
   IdentifierType m_LastVoxel[14];
   IdentifierType m_CurrentVoxel[14];
 
-  IdentifierType ** m_LastRow{ nullptr };
-  IdentifierType ** m_LastFrame{ nullptr };
-  IdentifierType ** m_CurrentRow{ nullptr };
-  IdentifierType ** m_CurrentFrame{ nullptr };
-
-  int           m_CurrentRowIndex{ 0 };
-  int           m_CurrentFrameIndex{ 0 };
-  int           m_LastRowNum{ 0 };
-  int           m_LastFrameNum{ 0 };
-  int           m_CurrentRowNum{ 200 };
-  int           m_CurrentFrameNum{ 2000 };
+  std::vector<std::array<IdentifierType, 2>> m_LastRow;
+  std::vector<std::array<IdentifierType, 2>> m_LastFrame;
+  std::vector<std::array<IdentifierType, 2>> m_CurrentRow;
+  std::vector<std::array<IdentifierType, 2>> m_CurrentFrame;
+
   unsigned char m_AvailableNodes[14];
 
+  /** Number of triangles, followed by their nodes, for each combination of
+   * the nodes of a voxel. */
+  unsigned char m_Triangles[256][22];
+
   double m_LocationOffset[14][3];
 
   SizeValueType m_NumberOfNodes{ 0 };
   SizeValueType m_NumberOfCells{ 0 };
 
-  int m_NodeLimit{ 2000 };
-  int m_CellLimit{ 4000 };
   int m_ImageWidth{ 0 };
   int m_ImageHeight{ 0 };
   int m_ImageDepth{ 0 };
@@ -253,6 +351,10 @@ private:
   unsigned char  m_PointFound{ 0 };
   InputPixelType m_ObjectValue;
 
+  bool   m_UseIsoValue{ false };
+  double m_IsoValue{ 0.0 };
+  bool   m_UseParallelSlabs{ false };
+
   /** temporary variables used in CreateMesh to avoid thousands of
    *  calls to GetInput() and GetOutput()
    */
@@ -21,6 +21,9 @@
 #include "itkContinuousIndex.h"
 #include "itkNumericTraits.h"
 #include "itkMath.h"
+#include "itkMultiThreaderBase.h"
+
+#include <algorithm>
 
 namespace itk
 {
@@ -36,49 +39,10 @@ BinaryMask3DMeshSource<TInputImage, TOutputMesh>::BinaryMask3DMeshSource()
   SizeType size;
   size.Fill(0);
   m_RegionOfInterest.SetSize(size);
-
-  this->GetOutput()->GetPoints()->Reserve(m_NodeLimit);
-  this->GetOutput()->GetCells()->Reserve(m_CellLimit);
 }
 
 template <typename TInputImage, typename TOutputMesh>
-BinaryMask3DMeshSource<TInputImage, TOutputMesh>::~BinaryMask3DMeshSource()
-{
-  int i;
-
-  if (m_CurrentFrame)
-  {
-    for (i = 0; i < 2000; ++i)
-    {
-      free(m_CurrentFrame[i]);
-    }
-    free(m_CurrentFrame);
-  }
-  if (m_CurrentRow)
-  {
-    for (i = 0; i < 200; ++i)
-    {
-      free(m_CurrentRow[i]);
-    }
-    free(m_CurrentRow);
-  }
-  if (m_LastFrame)
-  {
-    for (i = 0; i < m_LastFrameNum; ++i)
-    {
-      free(m_LastFrame[i]);
-    }
-    free(m_LastFrame);
-  }
-  if (m_LastRow)
-  {
-    for (i = 0; i < m_LastRowNum; ++i)
-    {
-      free(m_LastRow[i]);
-    }
-    free(m_LastRow);
-  }
-}
+BinaryMask3DMeshSource<TInputImage, TOutputMesh>::~BinaryMask3DMeshSource() = default;
 
 template <typename TInputImage, typename TOutputMesh>
 void
@@ -102,6 +66,7 @@ BinaryMask3DMeshSource<TInputImage, TOutputMesh>::GenerateData()
   }
 
   this->InitializeLUT();
+  this->InitializeTriangles();
   this->CreateMesh();
 }
 
@@ -998,40 +963,96 @@ BinaryMask3DMeshSource<TInputImage, TOutputMesh>::InitializeLUT()
   m_LocationOffset[13][2] = 0.5;
 }
 
+template <typename TInputImage, typename TOutputMesh>
+void
+BinaryMask3DMeshSource<TInputImage, TOutputMesh>::InitializeTriangles()
+{
+  // Triangles of the final combinations of the nodes, as the number of
+  // triangles followed by the nodes of the triangles
+  static const unsigned char finalTriangles[17][22] = {
+    { 0 },
+    { 1, 1, 9, 4 },
+    { 2, 4, 2, 9, 10, 9, 2 },
+    { 2, 1, 9, 4, 2, 3, 11 },
+    { 2, 1, 9, 4, 6, 11, 7 },
+    { 5, 1, 2, 13, 1, 13, 9, 9, 13, 8, 13, 2, 6, 13, 6, 8 },
+    { 3, 10, 9, 2, 4, 2, 9, 6, 11, 7 },
+    { 3, 1, 2, 10, 6, 11, 7, 3, 4, 12 },
+    { 4, 13, 2, 6, 13, 6, 8, 13, 8, 4, 13, 4, 2 },
+    { 6, 1, 10, 13, 10, 6, 13, 6, 7, 13, 7, 12, 13, 12, 4, 13, 1, 13, 4 },
+    { 4, 1, 9, 3, 9, 12, 3, 5, 10, 7, 10, 11, 7 },
+    { 6, 1, 10, 13, 13, 10, 11, 7, 13, 11, 7, 8, 13, 13, 8, 4, 1, 13, 4 },
+    { 6, 1, 2, 13, 1, 13, 9, 9, 13, 8, 13, 2, 6, 13, 6, 8, 3, 4, 12 },
+    { 4, 1, 9, 4, 5, 10, 6, 2, 3, 11, 8, 7, 12 },
+    { 7, 1, 10, 13, 10, 6, 13, 6, 7, 13, 7, 12, 13, 12, 4, 13, 1, 13, 4, 2, 3, 11 },
+    { 6, 1, 10, 13, 2, 13, 10, 2, 3, 13, 3, 12, 13, 4, 13, 12, 1, 13, 4 },
+    { 7, 13, 1, 5, 5, 6, 13, 13, 6, 2, 2, 3, 13, 3, 12, 13, 4, 13, 12, 1, 13, 4 },
+  };
+
+  for (unsigned int vertexindex = 0; vertexindex < 256; ++vertexindex)
+  {
+    const unsigned char * triangles = finalTriangles[m_LUT[vertexindex][0]];
+    m_Triangles[vertexindex][0] = triangles[0];
+    for (unsigned int i = 0; i < triangles[0]; ++i)
+    {
+      unsigned char * tp = &m_Triangles[vertexindex][1 + 3 * i];
+      tp[0] = triangles[1 + 3 * i];
+      tp[1] = triangles[2 + 3 * i];
+      tp[2] = triangles[3 + 3 * i];
+      this->CellTransfer(tp, m_LUT[vertexindex][1]);
+    }
+  }
+}
+
 template <typename TInputImage, typename TOutputMesh>
 void
 BinaryMask3DMeshSource<TInputImage, TOutputMesh>::CreateMesh()
 {
-  // NOTE ALEX: this is checked by the new pipeline
-  // through SetNumberOfRequiredInput
-  // if (this->GetNumberOfInputs() < 1)
-  //  {
-  //  std::cout << "BinaryMask3DMeshSource : Binary image mask not set";
-  //  std::cout << std::endl;
-  //  return;
-  //  }
-
-  // Initialize variables
   m_NumberOfCells = 0;
   m_NumberOfNodes = 0;
-  m_NodeLimit = 2000;
-  m_CellLimit = 4000;
+  m_OutputMesh = this->GetOutput();
+  m_InputImage = static_cast<const InputImageType *>(this->ProcessObject::GetInput(0));
+
+  InputImageSizeType inputImageSize = m_RegionOfInterest.GetSize();
+  m_ImageWidth = inputImageSize[0];
+  m_ImageHeight = inputImageSize[1];
+  m_ImageDepth = inputImageSize[2];
+
+  m_OutputMesh->SetPoints(PointsContainer::New());
+  m_OutputMesh->SetCells(CellsContainer::New());
+  m_OutputMesh->SetCellData(OutputMeshType::CellDataContainer::New());
+
+  // The voxels are made of the pixels of two consecutive frames
+  if (m_ImageWidth >= 1 && m_ImageHeight >= 1 && m_ImageDepth >= 2)
+  {
+    if (m_UseParallelSlabs)
+    {
+      this->CreateMeshInParallel();
+    }
+    else
+    {
+      this->CreateMeshVoxelByVoxel();
+    }
+  }
+
+  // This indicates that the current BufferedRegion is equal to the
+  // requested region. This action prevents useless rexecutions of
+  // the pipeline.
+  this->m_OutputMesh->SetBufferedRegion(this->GetOutput()->GetRequestedRegion());
+}
+
+template <typename TInputImage, typename TOutputMesh>
+void
+BinaryMask3DMeshSource<TInputImage, TOutputMesh>::CreateMeshVoxelByVoxel()
+{
   m_LastRowIndex = 0;
   m_LastVoxelIndex = 0;
   m_LastFrameIndex = 0;
-  m_CurrentRowIndex = 0;
-  m_CurrentFrameIndex = 0;
-  m_CurrentFrame = nullptr;
-  m_CurrentRow = nullptr;
-  m_LastRow = nullptr;
-  m_LastRowNum = 0;
-  m_LastFrameNum = 0;
-  m_LastFrame = nullptr;
-  m_CurrentRowNum = 200;
-  m_CurrentFrameNum = 2000;
-  m_OutputMesh = this->GetOutput();
-  m_InputImage = this->GetInput();
-  m_InputImage = static_cast<const InputImageType *>(this->ProcessObject::GetInput(0));
+  m_LastRow.clear();
+  m_LastFrame.clear();
+  m_CurrentRow.clear();
+  m_CurrentFrame.clear();
+  std::fill_n(m_LastVoxel, 14, 0);
 
   InputImageIterator it1(m_InputImage, m_RegionOfInterest);
   InputImageIterator it2(m_InputImage, m_RegionOfInterest);
@@ -1043,83 +1064,40 @@ BinaryMask3DMeshSource<TInputImage, TOutputMesh>::CreateMesh()
   it3.GoToBegin();
   it4.GoToBegin();
 
-  InputImageSizeType inputImageSize = m_RegionOfInterest.GetSize();
-  m_ImageWidth = inputImageSize[0];
-  m_ImageHeight = inputImageSize[1];
-  m_ImageDepth = inputImageSize[2];
-  int frame = m_ImageWidth * m_ImageHeight;
-  int row = m_ImageWidth;
-
-  int i = 0;
-  int j;
+  const int frame = m_ImageWidth * m_ImageHeight;
+  const int row = m_ImageWidth;
 
-  while (i < frame)
+  for (int i = 0; i < frame; ++i)
   {
     ++it3;
     ++it4;
-    i++;
   }
-
-  i = 0;
-
-  while (i < row)
+  for (int i = 0; i < row; ++i)
   {
     ++it2;
     ++it4;
-    i++;
   }
 
-  unsigned char vertexindex;
-
-  if (m_CurrentRow)
-  {
-    for (i = 0; i < 200; ++i)
-    {
-      free(m_CurrentRow[i]);
-    }
-    free(m_CurrentRow);
-  }
-  m_CurrentRow = (IdentifierType **)malloc(200 * sizeof(IdentifierType *));
-  for (i = 0; i < 200; ++i)
-  {
-    m_CurrentRow[i] = (IdentifierType *)malloc(2 * sizeof(IdentifierType));
-  }
-
-  if (m_CurrentFrame)
-  {
-    for (i = 0; i < 2000; ++i)
-    {
-      free(m_CurrentFrame[i]);
-    }
-    free(m_CurrentFrame);
-  }
-
-  m_CurrentFrame = (IdentifierType **)malloc(2000 * sizeof(IdentifierType *));
-
-  for (i = 0; i < 2000; ++i)
-  {
-    m_CurrentFrame[i] = (IdentifierType *)malloc(2 * sizeof(IdentifierType));
-  }
-
-  i = 0;
-
+  // The last voxel of a row reads the pixels at the start of the next row,
+  // and the voxels of the last row ignore the pixels of the next frame
+  int i = 0;
   while (!it4.IsAtEnd())
   {
-    vertexindex = 0;
+    unsigned char vertexindex = 0;
 
-    if (Math::ExactlyEquals(it1.Value(), m_ObjectValue))
+    if (this->IsInObject(it1.Value()))
     {
       vertexindex += 1;
     }
-    if (Math::ExactlyEquals(it2.Value(), m_ObjectValue))
+    if (this->IsInObject(it2.Value()))
     {
       vertexindex += 8;
     }
-    if (Math::ExactlyEquals(it3.Value(), m_ObjectValue))
+    if (this->IsInObject(it3.Value()))
     {
       vertexindex += 16;
     }
-    if (Math::ExactlyEquals(it4.Value(), m_ObjectValue))
+    if (this->IsInObject(it4.Value()))
     {
       vertexindex += 128;
     }
@@ -1128,109 +1106,362 @@ BinaryMask3DMeshSource<TInputImage, TOutputMesh>::CreateMesh()
     ++it3;
     ++it4;
 
-    if ((i % m_ImageWidth < m_ImageWidth - 1) &&
-        ((i % (m_ImageWidth * m_ImageHeight)) / m_ImageWidth < m_ImageHeight - 1))
+    if ((i % m_ImageWidth < m_ImageWidth - 1) && ((i % frame) / m_ImageWidth < m_ImageHeight - 1))
     {
-      if (Math::ExactlyEquals(it1.Value(), m_ObjectValue))
+      if (this->IsInObject(it1.Value()))
       {
         vertexindex += 2;
       }
-      if (Math::ExactlyEquals(it2.Value(), m_ObjectValue))
+      if (this->IsInObject(it2.Value()))
       {
         vertexindex += 4;
       }
-      if (Math::ExactlyEquals(it3.Value(), m_ObjectValue))
+      if (this->IsInObject(it3.Value()))
       {
         vertexindex += 32;
       }
-      if (Math::ExactlyEquals(it4.Value(), m_ObjectValue))
+      if (this->IsInObject(it4.Value()))
       {
         vertexindex += 64;
       }
     }
-    else
+    else if ((i % frame) / m_ImageWidth == m_ImageHeight - 1)
     {
-      if ((i % (m_ImageWidth * m_ImageHeight)) / m_ImageWidth == m_ImageHeight - 1)
+      if (vertexindex > 50)
       {
-        if (vertexindex > 50)
-        {
-          vertexindex -= 128;
-        }
-        if (((vertexindex > 7) && (vertexindex < 10)) || (vertexindex > 17))
-        {
-          vertexindex -= 8;
-        }
-        if (Math::ExactlyEquals(it1.Value(), m_ObjectValue))
+        vertexindex -= 128;
+      }
+      if (((vertexindex > 7) && (vertexindex < 10)) || (vertexindex > 17))
+      {
+        vertexindex -= 8;
+      }
+      if (this->IsInObject(it1.Value()))
+      {
+        vertexindex += 2;
+      }
+      if (this->IsInObject(it3.Value()))
+      {
+        vertexindex += 32;
+      }
+    }
+
+    std::fill_n(m_CurrentVoxel, 14, 0);
+
+    if ((vertexindex != 0) && (vertexindex != 255))
+    {
+      this->AddCells(vertexindex, i);
+    }
+    ++i;
+  }
+}
+
+template <typename TInputImage, typename TOutputMesh>
+void
+BinaryMask3DMeshSource<TInputImage, TOutputMesh>::CreateMeshInParallel()
+{
+  const int numberOfVoxelFrames = m_ImageDepth - 1;
+
+  // Generate the nodes and cells of each slab in parallel
+  this->GetMultiThreader()->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+  const int numberOfSlabs = std::min(numberOfVoxelFrames, static_cast<int>(this->GetNumberOfWorkUnits()));
+  std::vector<SlabType> slabs(numberOfSlabs);
+  for (int i = 0; i < numberOfSlabs; ++i)
+  {
+    slabs[i].m_BeginFrame = numberOfVoxelFrames * i / numberOfSlabs;
+    slabs[i].m_EndFrame = numberOfVoxelFrames * (i + 1) / numberOfSlabs;
+  }
+
+  this->GetMultiThreader()->ParallelizeArray(
+    0, numberOfSlabs, [this, &slabs](SizeValueType i) { this->GenerateSlab(slabs[i]); }, nullptr);
+
+  // The nodes on the first frame of a slab that are on the last frame of the
+  // previous slab are shared with it
+  constexpr IdentifierType noNode = NumericTraits<IdentifierType>::max();
+  std::vector<IdentifierType> firstNodeIds(numberOfSlabs, 0);
+  std::vector<IdentifierType> firstCellIds(numberOfSlabs, 0);
+  for (int i = 0; i < numberOfSlabs; ++i)
+  {
+    SlabType & slab = slabs[i];
+    slab.m_NodeIds.assign(slab.m_Points.size(), noNode);
+    if (i > 0)
+    {
+      const std::vector<IdentifierType> & previousNodes = slabs[i - 1].m_LastFrameNodes;
+      for (size_t j = 0; j < slab.m_FirstFrameNodes.size(); ++j)
+      {
+        if (slab.m_FirstFrameNodes[j] != noNode && previousNodes[j] != noNode)
         {
-          vertexindex += 2;
+          slab.m_SharedNodes.push_back(slab.m_FirstFrameNodes[j]);
+          slab.m_SharedNodes.push_back(previousNodes[j]);
+          slab.m_NodeIds[slab.m_FirstFrameNodes[j]] = 0;
         }
-        if (Math::ExactlyEquals(it3.Value(), m_ObjectValue))
+      }
+      slabs[i - 1].m_LastFrameNodes = std::vector<IdentifierType>();
+    }
+    slab.m_FirstFrameNodes = std::vector<IdentifierType>();
+
+    firstNodeIds[i] = m_NumberOfNodes;
+    firstCellIds[i] = m_NumberOfCells;
+    m_NumberOfNodes += slab.m_Points.size() - slab.m_SharedNodes.size() / 2;
+    m_NumberOfCells += slab.m_Cells.size() / 3;
+  }
+
+  // Number the nodes in the order of the slabs, and then the shared nodes
+  this->GetMultiThreader()->ParallelizeArray(
+    0,
+    numberOfSlabs,
+    [&slabs, &firstNodeIds](SizeValueType i) {
+      IdentifierType nodeId = firstNodeIds[i];
+      for (IdentifierType & id : slabs[i].m_NodeIds)
+      {
+        if (id == NumericTraits<IdentifierType>::max())
         {
-          vertexindex += 32;
+          id = nodeId++;
         }
       }
+    },
+    nullptr);
+  for (int i = 1; i < numberOfSlabs; ++i)
+  {
+    const std::vector<IdentifierType> & shared = slabs[i].m_SharedNodes;
+    for (size_t j = 0; j < shared.size(); j += 2)
+    {
+      slabs[i].m_NodeIds[shared[j]] = slabs[i - 1].m_NodeIds[shared[j + 1]];
     }
+  }
 
-    for (j = 0; j < 14; ++j)
+  // Fill the output mesh. The cells container is not preallocated, as some
+  // meshes, like QuadEdgeMesh, choose the identifiers of the cells.
+  PointsContainer * points = m_OutputMesh->GetPoints();
+  points->Reserve(m_NumberOfNodes);
+  m_OutputMesh->GetCellData()->Reserve(m_NumberOfCells);
+  typename OutputMeshType::PointIdentifier tripoints[3];
+  for (int i = 0; i < numberOfSlabs; ++i)
+  {
+    SlabType & slab = slabs[i];
+    for (size_t j = 0; j < slab.m_Points.size(); ++j)
     {
-      m_CurrentVoxel[j] = 0;
+      points->SetElement(slab.m_NodeIds[j], slab.m_Points[j]);
     }
 
-    if ((vertexindex == 0) || (vertexindex == 255))
+    IdentifierType cellId = firstCellIds[i];
+    for (size_t j = 0; j < slab.m_Cells.size(); j += 3)
+    {
+      tripoints[0] = slab.m_NodeIds[slab.m_Cells[j]];
+      tripoints[1] = slab.m_NodeIds[slab.m_Cells[j + 1]];
+      tripoints[2] = slab.m_NodeIds[slab.m_Cells[j + 2]];
+      typename OutputMeshType::CellAutoPointer insertCell;
+      m_OutputMesh->template AllocateCell<TriCell>(insertCell)->SetPointIds(tripoints);
+      m_OutputMesh->SetCell(cellId, insertCell);
+      m_OutputMesh->SetCellData(cellId, 0.0);
+      ++cellId;
+    }
+    slab = SlabType();
+  }
+}
+
+template <typename TInputImage, typename TOutputMesh>
+void
+BinaryMask3DMeshSource<TInputImage, TOutputMesh>::GenerateSlab(SlabType & slab) const
+{
+  constexpr IdentifierType noNode = NumericTraits<IdentifierType>::max();
+
+  // Location of the nodes: the edges along x and y are indexed by the
+  // position of their first end in the frame below or above the voxels, and
+  // the edges along z by the position of their first end in the frame
+  const int gridWidth = m_ImageWidth + 1;
+  const int gridSize = gridWidth * (m_ImageHeight + 1);
+  int       nodeFrame[14];
+  int       nodeOffset[14];
+  for (int node = 1; node < 14; ++node)
+  {
+    const double * offset = m_LocationOffset[node];
+    const int      position = static_cast<int>(offset[1]) * gridWidth + static_cast<int>(offset[0]);
+    if (Math::ExactlyEquals(offset[2], 0.5))
     {
-      //      for ( j=0; j<13; j++ ) m_LastVoxel[j] = 0;
+      // Along z, or at the center of the voxel
+      nodeFrame[node] = Math::ExactlyEquals(offset[0], 0.5) ? 3 : 2;
+      nodeOffset[node] = position;
     }
     else
     {
-      this->AddCells(m_LUT[vertexindex][0], m_LUT[vertexindex][1], i);
+      nodeFrame[node] = static_cast<int>(offset[2]);
+      nodeOffset[node] = 2 * position + (Math::ExactlyEquals(offset[0], 0.5) ? 0 : 1);
     }
-    i++;
   }
 
-  // This indicates that the current BufferedRegion is equal to the
-  // requested region. This action prevents useless rexecutions of
-  // the pipeline.
-  this->m_OutputMesh->SetBufferedRegion(this->GetOutput()->GetRequestedRegion());
+  std::vector<IdentifierType> nodes[3] = { std::vector<IdentifierType>(2 * gridSize, noNode),
+                                           std::vector<IdentifierType>(2 * gridSize, noNode),
+                                           std::vector<IdentifierType>(gridSize, noNode) };
+  std::vector<unsigned char>  lowerFrame(m_ImageWidth * m_ImageHeight);
+  std::vector<unsigned char>  upperFrame(m_ImageWidth * m_ImageHeight);
+  this->ReadFrame(slab.m_BeginFrame, lowerFrame);
+
+  using PointValueType = typename OPointType::ValueType;
+  using ContinuousIndexType = ContinuousIndex<PointValueType, 3>;
+  ContinuousIndexType indTemp;
+  OPointType          new_p;
+
+  for (int z = slab.m_BeginFrame; z < slab.m_EndFrame; ++z)
+  {
+    this->ReadFrame(z + 1, upperFrame);
+    std::fill(nodes[1].begin(), nodes[1].end(), noNode);
+    std::fill(nodes[2].begin(), nodes[2].end(), noNode);
+
+    for (int y = 0; y < m_ImageHeight; ++y)
+    {
+      const unsigned char * lower = &lowerFrame[y * m_ImageWidth];
+      const unsigned char * upper = &upperFrame[y * m_ImageWidth];
+      const bool            lastRow = (y == m_ImageHeight - 1);
+      for (int x = 0; x < m_ImageWidth; ++x)
+      {
+        // The pixels after the last column and row are outside of the object
+        const bool lastColumn = (x == m_ImageWidth - 1);
+        int        vertexindex = lower[x] + 16 * upper[x];
+        if (!lastColumn)
+        {
+          vertexindex += 2 * lower[x + 1] + 32 * upper[x + 1];
+        }
+        if (!lastRow)
+        {
+          vertexindex += 8 * lower[x + m_ImageWidth] + 128 * upper[x + m_ImageWidth];
+          if (!lastColumn)
+          {
+            vertexindex += 4 * lower[x + m_ImageWidth + 1] + 64 * upper[x + m_ImageWidth + 1];
+          }
+        }
+        if ((vertexindex == 0) || (vertexindex == 255))
+        {
+          continue;
+        }
+
+        const unsigned char * triangles = m_Triangles[vertexindex];
+        const int             position = y * gridWidth + x;
+        IdentifierType        centerNode = noNode;
+        IdentifierType        tpl[3];
+        for (unsigned int i = 0; i < triangles[0]; ++i)
+        {
+          for (unsigned int j = 0; j < 3; ++j)
+          {
+            const unsigned char node = triangles[1 + 3 * i + j];
+            IdentifierType &    nodeId = (nodeFrame[node] == 3)
+                                        ? centerNode
+                                        : nodes[nodeFrame[node]][nodeOffset[node] +
+                                                                 (nodeFrame[node] == 2 ? position : 2 * position)];
+            if (nodeId == noNode)
+            {
+              this->ComputeNodeIndex(x, y, z, node, indTemp);
+
+              // We transform the point to the physical space since the mesh
+              // does not have the notion of spacing and origin
+              m_InputImage->TransformContinuousIndexToPhysicalPoint(indTemp, new_p);
+              nodeId = slab.m_Points.size();
+              slab.m_Points.push_back(new_p);
+            }
+            tpl[j] = nodeId;
+          }
+          slab.m_Cells.push_back(tpl[0]);
+          slab.m_Cells.push_back(tpl[2]);
+          slab.m_Cells.push_back(tpl[1]);
+        }
+      }
+    }
+
+    if (z == slab.m_BeginFrame)
+    {
+      slab.m_FirstFrameNodes = nodes[0];
+    }
+    std::swap(nodes[0], nodes[1]);
+    std::swap(lowerFrame, upperFrame);
+  }
+  slab.m_LastFrameNodes = std::move(nodes[0]);
 }
 
 template <typename TInputImage, typename TOutputMesh>
 void
-BinaryMask3DMeshSource<TInputImage, TOutputMesh>::AddCells(unsigned char celltype, unsigned char celltran, int index)
+BinaryMask3DMeshSource<TInputImage, TOutputMesh>::ReadFrame(int frame, std::vector<unsigned char> & mask) const
 {
+  RegionType region = m_RegionOfInterest;
+  region.SetIndex(2, m_RegionOfInterest.GetIndex(2) + frame);
+  region.SetSize(2, 1);
 
-  int               i;
-  IdentifierType ** currentrowtmp;
-  IdentifierType ** currentframetmp;
+  InputImageIterator it(m_InputImage, region);
+  for (unsigned char & inside : mask)
+  {
+    inside = this->IsInObject(it.Get()) ? 1 : 0;
+    ++it;
+  }
+}
 
-  currentrowtmp = (IdentifierType **)malloc(4 * sizeof(IdentifierType *));
-  for (i = 0; i < 4; ++i)
+template <typename TInputImage, typename TOutputMesh>
+template <typename TContinuousIndex>
+void
+BinaryMask3DMeshSource<TInputImage, TOutputMesh>::ComputeNodeIndex(int                x,
+                                                                   int                y,
+                                                                   int                z,
+                                                                   unsigned char      node,
+                                                                   TContinuousIndex & nodeIndex) const
+{
+  const InputImageIndexType & regionIndex = m_RegionOfInterest.GetIndex();
+  const double *              offset = m_LocationOffset[node];
+  const int                   voxel[3] = { x, y, z };
+  for (unsigned int i = 0; i < 3; ++i)
+  {
+    nodeIndex[i] = offset[i] + voxel[i] + regionIndex[i];
+  }
+
+  // The node is on the edge along the only axis of offset 0.5, except for the
+  // node at the center of the voxel, which stays there
+  if (!m_UseIsoValue || node == 13)
+  {
+    return;
+  }
+  unsigned int axis = 0;
+  while (!Math::ExactlyEquals(offset[axis], 0.5))
+  {
+    ++axis;
+  }
+
+  InputImageIndexType first;
+  for (unsigned int i = 0; i < 3; ++i)
   {
-    currentrowtmp[i] = (IdentifierType *)malloc(2 * sizeof(IdentifierType));
-    currentrowtmp[i][0] = 0;
-    currentrowtmp[i][1] = 0;
+    first[i] = regionIndex[i] + voxel[i] + static_cast<IndexValueType>(offset[i]);
   }
-  currentframetmp = (IdentifierType **)malloc(4 * sizeof(IdentifierType *));
-  for (i = 0; i < 4; ++i)
+  InputImageIndexType second = first;
+  ++second[axis];
+  if (!m_RegionOfInterest.IsInside(first) || !m_RegionOfInterest.IsInside(second))
   {
-    currentframetmp[i] = (IdentifierType *)malloc(2 * sizeof(IdentifierType));
-    currentframetmp[i][0] = 0;
-    currentframetmp[i][1] = 0;
+    return;
   }
 
+  const double firstValue = static_cast<double>(m_InputImage->GetPixel(first));
+  const double secondValue = static_cast<double>(m_InputImage->GetPixel(second));
+  if (Math::ExactlyEquals(firstValue, secondValue))
+  {
+    return;
+  }
+  const double t = std::min(std::max((m_IsoValue - firstValue) / (secondValue - firstValue), 0.0), 1.0);
+  nodeIndex[axis] = first[axis] + t;
+}
+
+template <typename TInputImage, typename TOutputMesh>
+void
+BinaryMask3DMeshSource<TInputImage, TOutputMesh>::AddCells(int vertexindex, int index)
+{
+  IdentifierType currentrowtmp[4][2] = { { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } };
+  IdentifierType currentframetmp[4][2] = { { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } };
+  const int      frame = m_ImageWidth * m_ImageHeight;
+
   if ((index % m_ImageWidth == 0) || (index > m_LastVoxelIndex + 1))
   {
     m_ColFlag = 0;
-    for (i = 0; i < 14; ++i)
-    {
-      m_LastVoxel[i] = 0;
-    }
+    std::fill_n(m_LastVoxel, 14, 0);
   }
   else
   {
     m_ColFlag = 1;
   }
 
-  if (((index % (m_ImageWidth * m_ImageHeight)) < m_ImageWidth) || ((index / m_ImageWidth) > m_LastRowIndex + 1))
+  if (((index % frame) < m_ImageWidth) || ((index / m_ImageWidth) > m_LastRowIndex + 1))
   {
     m_RowFlag = 0;
   }
@@ -1239,7 +1470,7 @@ BinaryMask3DMeshSource<TInputImage, TOutputMesh>::AddCells(unsigned char celltyp
     m_RowFlag = 1;
   }
 
-  if ((index < m_ImageWidth * m_ImageHeight) || ((index / (m_ImageWidth * m_ImageHeight)) > m_LastFrameIndex + 1))
+  if ((index < frame) || ((index / frame) > m_LastFrameIndex + 1))
   {
     m_FrameFlag = 0;
   }
@@ -1248,104 +1479,36 @@ BinaryMask3DMeshSource<TInputImage, TOutputMesh>::AddCells(unsigned char celltyp
     m_FrameFlag = 1;
   }
 
-  /** allocate memory */
+  // The nodes of the current row and frame become the nodes of the last ones
   if (m_RowFlag == 1)
   {
     if ((index / m_ImageWidth) != m_LastRowIndex)
     {
-      if (m_LastRowNum == 0)
-      {
-        m_LastRow = (IdentifierType **)malloc(m_CurrentRowIndex * sizeof(IdentifierType *));
-      }
-      else
-      {
-        if (m_LastRowNum > m_CurrentRowIndex)
-        {
-          for (i = m_CurrentRowIndex; i < m_LastRowNum; ++i)
-          {
-            free(m_LastRow[i]);
-          }
-        }
-        m_LastRow = (IdentifierType **)realloc(m_LastRow, m_CurrentRowIndex * sizeof(IdentifierType *));
-      }
-      for (i = 0; i < m_CurrentRowIndex; ++i)
-      {
-        if (i > m_LastRowNum - 1)
-        {
-          m_LastRow[i] = (IdentifierType *)malloc(2 * sizeof(IdentifierType));
-        }
-        m_LastRow[i][0] = m_CurrentRow[i][0];
-        m_LastRow[i][1] = m_CurrentRow[i][1];
-      }
-      m_LastRowNum = m_CurrentRowIndex;
-      m_CurrentRowIndex = 0;
+      m_LastRow.swap(m_CurrentRow);
+      m_CurrentRow.clear();
     }
   }
-  else
+  else if (m_ColFlag == 0)
   {
-    if (m_ColFlag == 0)
-    {
-      if (m_LastRowNum > 0)
-      {
-        for (i = 0; i < m_LastRowNum; ++i)
-        {
-          free(m_LastRow[i]);
-        }
-        free(m_LastRow);
-        m_LastRow = nullptr;
-      }
-      m_LastRowNum = 0;
-    }
+    m_LastRow.clear();
   }
 
   if (m_FrameFlag == 1)
   {
-    if ((index / (m_ImageWidth * m_ImageHeight)) != m_LastFrameIndex)
+    if ((index / frame) != m_LastFrameIndex)
     {
-      if (m_LastFrameNum == 0)
-      {
-        m_LastFrame = (IdentifierType **)malloc(m_CurrentFrameIndex * sizeof(IdentifierType *));
-      }
-      else
-      {
-        if (m_LastFrameNum > m_CurrentFrameIndex)
-        {
-          for (i = m_CurrentFrameIndex; i < m_LastFrameNum; ++i)
-          {
-            free(m_LastFrame[i]);
-          }
-        }
-        m_LastFrame = (IdentifierType **)realloc(m_LastFrame, m_CurrentFrameIndex * sizeof(IdentifierType *));
-      }
-      for (i = 0; i < m_CurrentFrameIndex; ++i)
-      {
-        if (i > m_LastFrameNum - 1)
-        {
-          m_LastFrame[i] = (IdentifierType *)malloc(2 * sizeof(IdentifierType));
-        }
-        m_LastFrame[i][0] = m_CurrentFrame[i][0];
-        m_LastFrame[i][1] = m_CurrentFrame[i][1];
-      }
-      m_LastFrameNum = m_CurrentFrameIndex;
-      m_CurrentFrameIndex = 0;
+      m_LastFrame.swap(m_CurrentFrame);
+      m_CurrentFrame.clear();
     }
   }
-  else
+  else if (index % frame == 0)
   {
-    if (index % (m_ImageWidth * m_ImageHeight) == 0)
-    {
-      for (i = 0; i < m_LastFrameNum; ++i)
-      {
-        free(m_LastFrame[i]);
-      }
-      free(m_LastFrame);
-      m_LastFrame = nullptr;
-    }
+    m_LastFrame.clear();
   }
 
   m_LastVoxelIndex = index;
   m_LastRowIndex = index / m_ImageWidth;
-  m_LastFrameIndex = index / (m_ImageWidth * m_ImageHeight);
+  m_LastFrameIndex = index / frame;
 
   m_AvailableNodes[1] = 0;
   m_AvailableNodes[2] = 0;
@@ -1385,1047 +1548,80 @@ BinaryMask3DMeshSource<TInputImage, TOutputMesh>::AddCells(unsigned char celltyp
     m_AvailableNodes[4] = 1;
   }
 
-  typename TriCell::CellAutoPointer        insertCell;
   typename OutputMeshType::PointIdentifier tripoints[3];
-  unsigned char *                          tp;
-  tp = (unsigned char *)malloc(3 * sizeof(unsigned char));
+  IdentifierType                           tpl[3];
+  unsigned char                            tp[3];
 
-  IdentifierType * tpl;
-  tpl = (IdentifierType *)malloc(3 * sizeof(IdentifierType));
-
-  switch (static_cast<int>(celltype))
+  const unsigned char * triangles = m_Triangles[vertexindex];
+  for (unsigned int i = 0; i < triangles[0]; ++i)
   {
-    case 1:
-      tp[0] = 1;
-      tp[1] = 9;
-      tp[2] = 4;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      break;
-    case 2:
-      tp[0] = 4;
-      tp[1] = 2;
-      tp[2] = 9;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 10;
-      tp[1] = 9;
-      tp[2] = 2;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      break;
-    case 3:
-      tp[0] = 1;
-      tp[1] = 9;
-      tp[2] = 4;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 2;
-      tp[1] = 3;
-      tp[2] = 11;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      break;
-    case 4:
-      tp[0] = 1;
-      tp[1] = 9;
-      tp[2] = 4;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 6;
-      tp[1] = 11;
-      tp[2] = 7;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      break;
-    case 5:
-      tp[0] = 1;
-      tp[1] = 2;
-      tp[2] = 13;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 1;
-      tp[1] = 13;
-      tp[2] = 9;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 9;
-      tp[1] = 13;
-      tp[2] = 8;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 13;
-      tp[1] = 2;
-      tp[2] = 6;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 13;
-      tp[1] = 6;
-      tp[2] = 8;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      break;
-    case 6:
-      tp[0] = 10;
-      tp[1] = 9;
-      tp[2] = 2;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 4;
-      tp[1] = 2;
-      tp[2] = 9;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 6;
-      tp[1] = 11;
-      tp[2] = 7;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      break;
-    case 7:
-      tp[0] = 1;
-      tp[1] = 2;
-      tp[2] = 10;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 6;
-      tp[1] = 11;
-      tp[2] = 7;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 3;
-      tp[1] = 4;
-      tp[2] = 12;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      break;
-    case 8:
-      tp[0] = 13;
-      tp[1] = 2;
-      tp[2] = 6;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 13;
-      tp[1] = 6;
-      tp[2] = 8;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 13;
-      tp[1] = 8;
-      tp[2] = 4;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 13;
-      tp[1] = 4;
-      tp[2] = 2;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      break;
-    case 9:
-      tp[0] = 1;
-      tp[1] = 10;
-      tp[2] = 13;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 10;
-      tp[1] = 6;
-      tp[2] = 13;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 6;
-      tp[1] = 7;
-      tp[2] = 13;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 7;
-      tp[1] = 12;
-      tp[2] = 13;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 12;
-      tp[1] = 4;
-      tp[2] = 13;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 1;
-      tp[1] = 13;
-      tp[2] = 4;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      break;
-    case 10:
-      tp[0] = 1;
-      tp[1] = 9;
-      tp[2] = 3;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 9;
-      tp[1] = 12;
-      tp[2] = 3;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 5;
-      tp[1] = 10;
-      tp[2] = 7;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 10;
-      tp[1] = 11;
-      tp[2] = 7;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      break;
-    case 11:
-      tp[0] = 1;
-      tp[1] = 10;
-      tp[2] = 13;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 13;
-      tp[1] = 10;
-      tp[2] = 11;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 7;
-      tp[1] = 13;
-      tp[2] = 11;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 7;
-      tp[1] = 8;
-      tp[2] = 13;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 13;
-      tp[1] = 8;
-      tp[2] = 4;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 1;
-      tp[1] = 13;
-      tp[2] = 4;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      break;
-    case 12:
-      tp[0] = 1;
-      tp[1] = 2;
-      tp[2] = 13;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 1;
-      tp[1] = 13;
-      tp[2] = 9;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 9;
-      tp[1] = 13;
-      tp[2] = 8;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 13;
-      tp[1] = 2;
-      tp[2] = 6;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 13;
-      tp[1] = 6;
-      tp[2] = 8;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 3;
-      tp[1] = 4;
-      tp[2] = 12;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      break;
-    case 13:
-      tp[0] = 1;
-      tp[1] = 9;
-      tp[2] = 4;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 5;
-      tp[1] = 10;
-      tp[2] = 6;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 2;
-      tp[1] = 3;
-      tp[2] = 11;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 8;
-      tp[1] = 7;
-      tp[2] = 12;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      break;
-    case 14:
-      tp[0] = 1;
-      tp[1] = 10;
-      tp[2] = 13;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 10;
-      tp[1] = 6;
-      tp[2] = 13;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 6;
-      tp[1] = 7;
-      tp[2] = 13;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 7;
-      tp[1] = 12;
-      tp[2] = 13;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 12;
-      tp[1] = 4;
-      tp[2] = 13;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 1;
-      tp[1] = 13;
-      tp[2] = 4;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 2;
-      tp[1] = 3;
-      tp[2] = 11;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      break;
-    case 15:
-      tp[0] = 1;
-      tp[1] = 10;
-      tp[2] = 13;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 2;
-      tp[1] = 13;
-      tp[2] = 10;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 2;
-      tp[1] = 3;
-      tp[2] = 13;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 3;
-      tp[1] = 12;
-      tp[2] = 13;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 4;
-      tp[1] = 13;
-      tp[2] = 12;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 1;
-      tp[1] = 13;
-      tp[2] = 4;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      break;
-    case 16:
-      tp[0] = 13;
-      tp[1] = 1;
-      tp[2] = 5;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 5;
-      tp[1] = 6;
-      tp[2] = 13;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 13;
-      tp[1] = 6;
-      tp[2] = 2;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 2;
-      tp[1] = 3;
-      tp[2] = 13;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 3;
-      tp[1] = 12;
-      tp[2] = 13;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 4;
-      tp[1] = 13;
-      tp[2] = 12;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      tp[0] = 1;
-      tp[1] = 13;
-      tp[2] = 4;
-      CellTransfer(tp, celltran);
-      AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
-      tripoints[0] = tpl[0];
-      tripoints[1] = tpl[2];
-      tripoints[2] = tpl[1];
-      insertCell.TakeOwnership(new TriCell);
-      insertCell->SetPointIds(tripoints);
-      this->m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
-      this->m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
-      m_NumberOfCells++;
-      break;
+    std::copy_n(&triangles[1 + 3 * i], 3, tp);
+    this->AddNodes(index, tp, tpl, currentrowtmp, currentframetmp);
+    tripoints[0] = tpl[0];
+    tripoints[1] = tpl[2];
+    tripoints[2] = tpl[1];
+    typename OutputMeshType::CellAutoPointer insertCell;
+    m_OutputMesh->template AllocateCell<TriCell>(insertCell)->SetPointIds(tripoints);
+    m_OutputMesh->SetCell(m_NumberOfCells, insertCell);
+    m_OutputMesh->SetCellData(m_NumberOfCells, 0.0);
+    m_NumberOfCells++;
   }
 
-  i = 0;
-  int j;
-  while (i < 4)
+  for (unsigned int i = 0; i < 4; ++i)
   {
     if (currentrowtmp[i][0] != 0)
     {
-      m_CurrentRow[m_CurrentRowIndex][1] = currentrowtmp[i][1];
-      m_CurrentRow[m_CurrentRowIndex++][0] = currentrowtmp[i][0];
-      if (m_CurrentRowIndex == m_CurrentRowNum)
-      {
-        m_CurrentRowNum += 100;
-        m_CurrentRow = (IdentifierType **)realloc(m_CurrentRow, sizeof(IdentifierType *) * m_CurrentRowNum);
-        for (j = m_CurrentRowIndex; j < m_CurrentRowNum; ++j)
-        {
-          m_CurrentRow[j] = (IdentifierType *)malloc(sizeof(IdentifierType) * 2);
-        }
-      }
+      m_CurrentRow.push_back({ { currentrowtmp[i][0], currentrowtmp[i][1] } });
     }
-
     if (currentframetmp[i][0] != 0)
     {
-      m_CurrentFrame[m_CurrentFrameIndex][1] = currentframetmp[i][1];
-      m_CurrentFrame[m_CurrentFrameIndex++][0] = currentframetmp[i][0];
-      if (m_CurrentFrameIndex == m_CurrentFrameNum)
-      {
-        m_CurrentFrameNum += 1000;
-        m_CurrentFrame = (IdentifierType **)realloc(m_CurrentFrame, sizeof(IdentifierType *) * m_CurrentFrameNum);
-        for (j = m_CurrentFrameIndex; j < m_CurrentFrameNum; ++j)
-        {
-          m_CurrentFrame[j] = (IdentifierType *)malloc(sizeof(IdentifierType) * 2);
-        }
-      }
+      m_CurrentFrame.push_back({ { currentframetmp[i][0], currentframetmp[i][1] } });
     }
-
-    i++;
   }
 
-  for (i = 0; i < 4; ++i)
-  {
-    free(currentrowtmp[i]);
-  }
-  free(currentrowtmp);
-
-  for (i = 0; i < 4; ++i)
-  {
-    free(currentframetmp[i]);
-  }
-
-  free(currentframetmp);
-
-  free(tp);
-  free(tpl);
-
   m_LastVoxel[4] = m_CurrentVoxel[2];
   m_LastVoxel[9] = m_CurrentVoxel[10];
   m_LastVoxel[8] = m_CurrentVoxel[6];
   m_LastVoxel[12] = m_CurrentVoxel[11];
-  for (i = 1; i < 14; ++i)
-  {
-    m_CurrentVoxel[i] = 0;
-  }
+  std::fill_n(m_CurrentVoxel, 14, 0);
 }
 
 template <typename TInputImage, typename TOutputMesh>
 void
-BinaryMask3DMeshSource<TInputImage, TOutputMesh>::AddNodes(int               index,
-                                                           unsigned char *   nodesid,
-                                                           IdentifierType *  globalnodesid,
-                                                           IdentifierType ** currentrowtmp,
-                                                           IdentifierType ** currentframetmp)
+BinaryMask3DMeshSource<TInputImage, TOutputMesh>::AddNodes(int              index,
+                                                           unsigned char *  nodesid,
+                                                           IdentifierType * globalnodesid,
+                                                           IdentifierType   currentrowtmp[4][2],
+                                                           IdentifierType   currentframetmp[4][2])
 {
-  int        i;
-  OPointType new_p;
+  using PointValueType = typename OPointType::ValueType;
+  using ContinuousIndexType = ContinuousIndex<PointValueType, 3>;
 
-  for (i = 0; i < 3; ++i)
+  const int           frame = m_ImageWidth * m_ImageHeight;
+  ContinuousIndexType indTemp;
+  OPointType          new_p;
+
+  for (int i = 0; i < 3; ++i)
   {
     m_PointFound = 0;
     if (m_AvailableNodes[nodesid[i]] != 0)
     {
       m_PointFound = 1;
 
-      using PointValueType = typename OPointType::ValueType;
-      using ContinuousIndexType = ContinuousIndex<PointValueType, 3>;
-
-      ContinuousIndexType indTemp;
-      indTemp[0] = m_LocationOffset[nodesid[i]][0] + (index % m_ImageWidth) + m_RegionOfInterest.GetIndex()[0];
-      indTemp[1] = m_LocationOffset[nodesid[i]][1] + ((index % (m_ImageWidth * m_ImageHeight)) / m_ImageWidth) +
-                   m_RegionOfInterest.GetIndex()[1];
-      indTemp[2] =
-        m_LocationOffset[nodesid[i]][2] + (index / (m_ImageWidth * m_ImageHeight)) + m_RegionOfInterest.GetIndex()[2];
-
+      this->ComputeNodeIndex(index % m_ImageWidth, (index % frame) / m_ImageWidth, index / frame, nodesid[i], indTemp);
 
       // We transform the point to the physical space since the mesh does not
-      // have the notion
-      // of spacing and origin
-      this->m_InputImage->TransformContinuousIndexToPhysicalPoint(indTemp, new_p);
-      this->m_OutputMesh->SetPoint(m_NumberOfNodes, new_p);
+      // have the notion of spacing and origin
+      m_InputImage->TransformContinuousIndexToPhysicalPoint(indTemp, new_p);
+      m_OutputMesh->SetPoint(m_NumberOfNodes, new_p);
 
       switch (nodesid[i])
       {
-        case 2:
-          m_CurrentVoxel[2] = m_NumberOfNodes;
-          break;
         case 6:
-          m_CurrentVoxel[6] = m_NumberOfNodes;
           currentframetmp[1][1] = m_NumberOfNodes;
-          currentframetmp[1][0] = (index % (m_ImageWidth * m_ImageHeight)) * 13 + 2;
-          break;
-        case 10:
-          m_CurrentVoxel[10] = m_NumberOfNodes;
+          currentframetmp[1][0] = (index % frame) * 13 + 2;
           break;
         case 11:
-          m_CurrentVoxel[11] = m_NumberOfNodes;
           currentrowtmp[3][1] = m_NumberOfNodes;
           currentrowtmp[3][0] = (index % m_ImageWidth) * 13 + 10;
           break;
@@ -2437,7 +1633,7 @@ BinaryMask3DMeshSource<TInputImage, TOutputMesh>::AddNodes(int               ind
           currentrowtmp[1][1] = m_NumberOfNodes;
           currentrowtmp[1][0] = (index % m_ImageWidth) * 13 + 5;
           currentframetmp[2][1] = m_NumberOfNodes;
-          currentframetmp[2][0] = (index % (m_ImageWidth * m_ImageHeight)) * 13 + 3;
+          currentframetmp[2][0] = (index % frame) * 13 + 3;
           break;
         case 12:
           currentrowtmp[2][1] = m_NumberOfNodes;
@@ -2445,23 +1641,13 @@ BinaryMask3DMeshSource<TInputImage, TOutputMesh>::AddNodes(int               ind
           break;
         case 5:
           currentframetmp[0][1] = m_NumberOfNodes;
-          currentframetmp[0][0] = (index % (m_ImageWidth * m_ImageHeight)) * 13 + 1;
+          currentframetmp[0][0] = (index % frame) * 13 + 1;
           break;
         case 8:
           currentframetmp[3][1] = m_NumberOfNodes;
-          currentframetmp[3][0] = (index % (m_ImageWidth * m_ImageHeight)) * 13 + 4;
+          currentframetmp[3][0] = (index % frame) * 13 + 4;
           break;
-        case 1:
-          m_CurrentVoxel[1] = m_NumberOfNodes;
-          break;
-        case 4:
-          m_CurrentVoxel[4] = m_NumberOfNodes;
-          break;
-        case 9:
-          m_CurrentVoxel[9] = m_NumberOfNodes;
-          break;
-        case 13:
-          m_CurrentVoxel[13] = m_NumberOfNodes;
+        default:
           break;
       }
       globalnodesid[i] = m_NumberOfNodes;
@@ -2474,68 +1660,58 @@ BinaryMask3DMeshSource<TInputImage, TOutputMesh>::AddNodes(int               ind
       if (m_CurrentVoxel[nodesid[i]] != 0)
       {
         globalnodesid[i] = m_CurrentVoxel[nodesid[i]];
-        m_PointFound = 1;
-
         continue;
       }
       if (m_LastVoxel[nodesid[i]] != 0)
       {
         globalnodesid[i] = m_LastVoxel[nodesid[i]];
-        m_PointFound = 1;
-
         continue;
       }
-      if ((m_LastRowNum != 0) && ((nodesid[i] == 1) || (nodesid[i] == 5) || (nodesid[i] == 9) || (nodesid[i] == 10)))
+      const int lastRowNum = static_cast<int>(m_LastRow.size());
+      if ((lastRowNum != 0) && ((nodesid[i] == 1) || (nodesid[i] == 5) || (nodesid[i] == 9) || (nodesid[i] == 10)))
       {
-        globalnodesid[i] = this->SearchThroughLastRow((index % m_ImageWidth) * 13 + nodesid[i], 0, m_LastRowNum - 1);
+        globalnodesid[i] = this->SearchThroughLastRow((index % m_ImageWidth) * 13 + nodesid[i], 0, lastRowNum - 1);
         if (m_PointFound != 0)
         {
           continue;
         }
-        else
+        if (nodesid[i] == 9)
         {
-          if (nodesid[i] == 9)
-          {
-            globalnodesid[i] = this->SearchThroughLastRow((index % m_ImageWidth) * 13 - 3, 0, m_LastRowNum - 1);
-          }
-          if (nodesid[i] == 10)
-          {
-            globalnodesid[i] = this->SearchThroughLastRow((index % m_ImageWidth) * 13 + 22, 0, m_LastRowNum - 1);
-          }
-          if (m_PointFound != 0)
-          {
-            continue;
-          }
+          globalnodesid[i] = this->SearchThroughLastRow((index % m_ImageWidth) * 13 - 3, 0, lastRowNum - 1);
+        }
+        if (nodesid[i] == 10)
+        {
+          globalnodesid[i] = this->SearchThroughLastRow((index % m_ImageWidth) * 13 + 22, 0, lastRowNum - 1);
+        }
+        if (m_PointFound != 0)
+        {
+          continue;
         }
       }
-      if ((m_LastFrameNum != 0) && ((nodesid[i] == 1) || (nodesid[i] == 2) || (nodesid[i] == 3) || (nodesid[i] == 4)))
+      const int lastFrameNum = static_cast<int>(m_LastFrame.size());
+      if ((lastFrameNum != 0) && ((nodesid[i] == 1) || (nodesid[i] == 2) || (nodesid[i] == 3) || (nodesid[i] == 4)))
       {
-        globalnodesid[i] = this->SearchThroughLastFrame(
-          (index % (m_ImageWidth * m_ImageHeight)) * 13 + nodesid[i], 0, m_LastFrameNum - 1);
+        globalnodesid[i] = this->SearchThroughLastFrame((index % frame) * 13 + nodesid[i], 0, lastFrameNum - 1);
         if (m_PointFound != 0)
         {
           continue;
         }
-        else
+        if (nodesid[i] == 4)
         {
-          if (nodesid[i] == 4)
-          {
-            globalnodesid[i] =
-              this->SearchThroughLastFrame((index % (m_ImageWidth * m_ImageHeight)) * 13 - 11, 0, m_LastFrameNum - 1);
-          }
-          if (nodesid[i] == 1)
-          {
-            globalnodesid[i] = this->SearchThroughLastFrame(
-              (index % (m_ImageWidth * m_ImageHeight) - m_ImageWidth) * 13 + 3, 0, m_LastFrameNum - 1);
-          }
-          if (m_PointFound != 0)
-          {
-            continue;
-          }
+          globalnodesid[i] = this->SearchThroughLastFrame((index % frame) * 13 - 11, 0, lastFrameNum - 1);
+        }
+        if (nodesid[i] == 1)
+        {
+          globalnodesid[i] = this->SearchThroughLastFrame((index % frame - m_ImageWidth) * 13 + 3, 0, lastFrameNum - 1);
+        }
+        if (m_PointFound != 0)
+        {
+          continue;
         }
       }
     }
 
+    // The node was not found in the neighbouring voxels, create it
     if (m_PointFound == 0)
     {
       m_AvailableNodes[nodesid[i]] = 1;
@@ -2606,41 +1782,31 @@ template <typename TInputImage, typename TOutputMesh>
 IdentifierType
 BinaryMask3DMeshSource<TInputImage, TOutputMesh>::SearchThroughLastRow(int index, int start, int end)
 {
-  int  mid;
-  auto lindex = static_cast<IdentifierType>(index);
+  const auto lindex = static_cast<IdentifierType>(index);
 
   if ((end - start) > 1)
   {
-    mid = static_cast<int>(std::floor(static_cast<float>((start + end) / 2)));
+    const int mid = (start + end) / 2;
     if (lindex == m_LastRow[mid][0])
     {
       m_PointFound = 1;
       return m_LastRow[mid][1];
     }
-    else
+    if (lindex > m_LastRow[mid][0])
     {
-      if (lindex > m_LastRow[mid][0])
-      {
-        return this->SearchThroughLastRow(index, mid + 1, end);
-      }
-      else
-      {
-        return this->SearchThroughLastRow(index, start, mid);
-      }
+      return this->SearchThroughLastRow(index, mid + 1, end);
     }
+    return this->SearchThroughLastRow(index, start, mid);
   }
-  else
+  if (lindex == m_LastRow[start][0])
   {
-    if (lindex == m_LastRow[start][0])
-    {
-      m_PointFound = 1;
-      return m_LastRow[start][1];
-    }
-    if (lindex == m_LastRow[end][0])
-    {
-      m_PointFound = 1;
-      return m_LastRow[end][1];
-    }
+    m_PointFound = 1;
+    return m_LastRow[start][1];
+  }
+  if (lindex == m_LastRow[end][0])
+  {
+    m_PointFound = 1;
+    return m_LastRow[end][1];
   }
   return 0;
 }
@@ -2649,28 +1815,24 @@ template <typename TInputImage, typename TOutputMesh>
 IdentifierType
 BinaryMask3DMeshSource<TInputImage, TOutputMesh>::SearchThroughLastFrame(int index, int start, int end)
 {
-  int            mid;
-  auto           lindex = static_cast<IdentifierType>(index);
+  const auto     lindex = static_cast<IdentifierType>(index);
   IdentifierType result = 0;
 
   if ((end - start) > 1)
   {
-    mid = static_cast<int>(std::floor(static_cast<float>((start + end) / 2)));
+    const int mid = (start + end) / 2;
     if (lindex == m_LastFrame[mid][0])
     {
       m_PointFound = 1;
       result = m_LastFrame[mid][1];
     }
+    else if (lindex > m_LastFrame[mid][0])
+    {
+      result = this->SearchThroughLastFrame(index, mid + 1, end);
+    }
     else
     {
-      if (lindex > m_LastFrame[mid][0])
-      {
-        result = this->SearchThroughLastFrame(index, mid + 1, end);
-      }
-      else
-      {
-        result = this->SearchThroughLastFrame(index, start, mid);
-      }
+      result = this->SearchThroughLastFrame(index, start, mid);
     }
   }
   else
@@ -2698,6 +1860,12 @@ BinaryMask3DMeshSource<TInputImage, TOutputMesh>::PrintSelf(std::ostream & os, I
 
   os << indent << "ObjectValue: " << static_cast<NumericTraits<unsigned char>::PrintType>(m_ObjectValue) << std::endl;
 
+  os << indent << "UseIsoValue: " << (m_UseIsoValue ? "On" : "Off") << std::endl;
+
+  os << indent << "IsoValue: " << m_IsoValue << std::endl;
+
+  os << indent << "UseParallelSlabs: " << (m_UseParallelSlabs ? "On" : "Off") << std::endl;
+
   os << indent << "NumberOfNodes: " << m_NumberOfNodes << std::endl;
 
   os << indent << "NumberOfCells: " << m_NumberOfCells << std::endl;
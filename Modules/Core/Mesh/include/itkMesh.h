@@ -32,10 +32,12 @@
 #include "itkPointSet.h"
 
 #include "itkBoundingBox.h"
+#include "itkCellArenaContainer.h"
 #include "itkCellInterface.h"
 #include "itkMapContainer.h"
 #include "itkCommonEnums.h"
 #include "ITKMeshExport.h"
+#include <memory>
 #include <vector>
 #include <set>
 #include "itkVectorContainer.h"
@@ -100,6 +102,16 @@ namespace itk
  * inserted to a mesh should have MeshTraits::CellTraits as its second
  * template parameter.
  *
+ * By default, the mesh deletes its cells one by one. When the cells
+ * allocation method is CellsAllocatedInAnArena, the cells created with
+ * AllocateCell() are instead allocated in contiguous blocks of an arena,
+ * which is much faster to build and destroy for large meshes. The arena is
+ * a member of the cells container, a CellArenaContainer created by the mesh
+ * when it allocates its first cell, so that the cells live as long as the
+ * container, whichever mesh releases it last and whatever the allocation
+ * method of that mesh. Only the allocation of the cells changes: they
+ * remain CellInterface objects, accessed through the cells container.
+ *
  * Template parameters for Mesh:
  *
  * TPixelType =
@@ -228,6 +240,11 @@ public:
   using OutputQuadraticTriangleCellType = itk::QuadraticTriangleCell<CellType>;
   using CellAutoPointer = typename CellType::CellAutoPointer;
 
+  /** Cells container owning its cells through an arena, used with the
+   * CellsAllocatedInAnArena method. */
+  using CellArenaContainerType = CellArenaContainer<CellsContainer>;
+  using CellArenaType = typename CellArenaContainerType::CellArenaType;
+
   /** Visiting cells. */
   using CellMultiVisitorType = typename CellType::MultiVisitor;
 
@@ -441,7 +458,8 @@ public:
    *  does not exist, it will be created automatically. If used to overwrite a
    *  cell currently in the mesh, it is the caller's responsibility to release
    *  the memory for the cell currently at the CellIdentifier position prior to
-   *  calling this method. */
+   *  calling this method. A cell owned by cellPointer is handed over to the
+   *  arena of the cells container, if it has one. */
   void
   SetCell(CellIdentifier, CellAutoPointer &);
 
@@ -570,6 +588,30 @@ public:
   itkSetMacro(CellsAllocationMethod, MeshClassCellsAllocationMethodEnum);
   itkGetConstReferenceMacro(CellsAllocationMethod, MeshClassCellsAllocationMethodEnum);
 
+  /** Allocate a cell of type TCell, and make cellPointer point to it so that
+   * it can be passed to SetCell(). With the CellsAllocatedInAnArena method,
+   * the cell is allocated in the arena of the cells container, which owns it.
+   * The mesh replaces an empty cells container without an arena by a
+   * CellArenaContainer. Otherwise the cell is allocated with new and owned
+   * by cellPointer. */
+  template <typename TCell>
+  TCell *
+  AllocateCell(CellAutoPointer & cellPointer)
+  {
+    CellArenaType * arena = (m_CellsAllocationMethod == MeshClassCellsAllocationMethodEnum::CellsAllocatedInAnArena)
+                              ? this->GetCellArena()
+                              : nullptr;
+    if (arena != nullptr)
+    {
+      TCell * cell = arena->template New<TCell>();
+      cellPointer.TakeNoOwnership(cell);
+      return cell;
+    }
+    auto * cell = new TCell;
+    cellPointer.TakeOwnership(cell);
+    return cell;
+  }
+
 protected:
   /** Constructor for use by New() method. */
   Mesh();
@@ -591,6 +633,21 @@ protected:
 private:
   MeshClassCellsAllocationMethodEnum m_CellsAllocationMethod;
 
+  /** Arena of the cells container, and the container it was looked up
+   *  for. The cache is reset whenever the container is released. */
+  CellArenaType *        m_CellArena{ nullptr };
+  const CellsContainer * m_CellArenaContainer{ nullptr };
+
+  /** Get the arena of the cells container. An empty cells container without
+   *  an arena is first replaced by a CellArenaContainer. Returns nullptr if
+   *  the container holds cells but no arena. */
+  CellArenaType *
+  GetCellArena();
+
+  /** Get the arena of the cells container, or nullptr if it has none. */
+  CellArenaType *
+  FindCellArena();
+
   /** Create a new cell of a given type. */
   void
   CreateCell(int cellType, CellAutoPointer &);
@@ -51,6 +51,9 @@ Mesh<TPixelType, VDimension, TMeshTraits>::PrintSelf(std::ostream & os, Indent i
   os << indent << "Number of explicit cell boundary assignments: "
      << static_cast<CellIdentifier>(m_BoundaryAssignmentsContainers.size()) << std::endl;
   os << indent << "CellsAllocationMethod: " << m_CellsAllocationMethod << std::endl;
+  const auto * cellArenaContainer = dynamic_cast<const CellArenaContainerType *>(m_CellsContainer.GetPointer());
+  os << indent << "Number Of Cells In Arena: "
+     << ((cellArenaContainer) ? cellArenaContainer->GetCellArena().GetNumberOfCells() : 0) << std::endl;
 }
 
 template <typename TPixelType, unsigned int VDimension, typename TMeshTraits>
@@ -141,34 +144,34 @@ Mesh<TPixelType, VDimension, TMeshTraits>::CreateCell(int cellType, CellAutoPoin
   switch (cellTypeEnum)
   {
     case CellGeometryEnum::VERTEX_CELL:
-      cellPointer.TakeOwnership(new OutputVertexCellType);
+      this->template AllocateCell<OutputVertexCellType>(cellPointer);
       break;
     case CellGeometryEnum::LINE_CELL:
-      cellPointer.TakeOwnership(new OutputLineCellType);
+      this->template AllocateCell<OutputLineCellType>(cellPointer);
       break;
     case CellGeometryEnum::POLYLINE_CELL:
-      cellPointer.TakeOwnership(new OutputPolyLineCellType);
+      this->template AllocateCell<OutputPolyLineCellType>(cellPointer);
       break;
     case CellGeometryEnum::TRIANGLE_CELL:
-      cellPointer.TakeOwnership(new OutputTriangleCellType);
+      this->template AllocateCell<OutputTriangleCellType>(cellPointer);
       break;
     case CellGeometryEnum::QUADRILATERAL_CELL:
-      cellPointer.TakeOwnership(new OutputQuadrilateralCellType);
+      this->template AllocateCell<OutputQuadrilateralCellType>(cellPointer);
       break;
     case CellGeometryEnum::POLYGON_CELL:
-      cellPointer.TakeOwnership(new OutputPolygonCellType);
+      this->template AllocateCell<OutputPolygonCellType>(cellPointer);
       break;
     case CellGeometryEnum::TETRAHEDRON_CELL:
-      cellPointer.TakeOwnership(new OutputTetrahedronCellType);
+      this->template AllocateCell<OutputTetrahedronCellType>(cellPointer);
       break;
     case CellGeometryEnum::HEXAHEDRON_CELL:
-      cellPointer.TakeOwnership(new OutputHexahedronCellType);
+      this->template AllocateCell<OutputHexahedronCellType>(cellPointer);
       break;
     case CellGeometryEnum::QUADRATIC_EDGE_CELL:
-      cellPointer.TakeOwnership(new OutputQuadraticEdgeCellType);
+      this->template AllocateCell<OutputQuadraticEdgeCellType>(cellPointer);
       break;
     case CellGeometryEnum::QUADRATIC_TRIANGLE_CELL:
-      cellPointer.TakeOwnership(new OutputQuadraticTriangleCellType);
+      this->template AllocateCell<OutputQuadraticTriangleCellType>(cellPointer);
       break;
     default:
       itkExceptionMacro(<< "Unknown mesh cell");
@@ -338,12 +341,54 @@ Mesh<TPixelType, VDimension, TMeshTraits>::SetCell(CellIdentifier cellId, CellAu
     this->SetCells(CellsContainer::New());
   }
 
+  if (cellPointer.IsOwner())
+  {
+    // A container with an arena releases its cells with the arena, so the
+    // arena has to own all of them.
+    CellArenaType * arena =
+      (m_CellsAllocationMethod == MeshClassCellsAllocationMethodEnum::CellsAllocatedInAnArena)
+        ? this->GetCellArena()
+        : this->FindCellArena();
+    if (arena != nullptr)
+    {
+      arena->Adopt(cellPointer.GetPointer());
+    }
+  }
+
   /**
    * Insert the cell into the container with the given identifier.
    */
   m_CellsContainer->InsertElement(cellId, cellPointer.ReleaseOwnership());
 }
 
+template <typename TPixelType, unsigned int VDimension, typename TMeshTraits>
+auto
+Mesh<TPixelType, VDimension, TMeshTraits>::GetCellArena() -> CellArenaType *
+{
+  CellArenaType * arena = this->FindCellArena();
+  if (arena == nullptr && (!m_CellsContainer || (m_CellsContainer->Size() == 0 &&
+                                                 m_CellsContainer->GetReferenceCount() == 1)))
+  {
+    // Nobody else sees the empty container, so it can be replaced.
+    this->SetCells(CellArenaContainerType::New());
+    arena = this->FindCellArena();
+  }
+  return arena;
+}
+
+template <typename TPixelType, unsigned int VDimension, typename TMeshTraits>
+auto
+Mesh<TPixelType, VDimension, TMeshTraits>::FindCellArena() -> CellArenaType *
+{
+  if (m_CellArenaContainer != m_CellsContainer)
+  {
+    auto * cellArenaContainer = dynamic_cast<CellArenaContainerType *>(m_CellsContainer.GetPointer());
+    m_CellArena = (cellArenaContainer) ? &cellArenaContainer->GetCellArena() : nullptr;
+    m_CellArenaContainer = m_CellsContainer;
+  }
+  return m_CellArena;
+}
+
 template <typename TPixelType, unsigned int VDimension, typename TMeshTraits>
 bool
 Mesh<TPixelType, VDimension, TMeshTraits>::GetCell(CellIdentifier cellId, CellAutoPointer & cellPointer) const
@@ -1036,7 +1081,13 @@ Mesh<TPixelType, VDimension, TMeshTraits>::ReleaseCellsMemory()
   //    the first cell in the array and calling "delete[] cells"
   // 3) the user allocated the Cells on a cell-by-cell basis
   //    so every cell has to be deleted using   "delete cell"
+  // 4) the cells were allocated with AllocateCell() in the arena of a
+  //    CellArenaContainer, so they are all released with the container,
+  //    whatever the allocation method of this mesh
   //
+  m_CellArena = nullptr;
+  m_CellArenaContainer = nullptr;
+
   if (!m_CellsContainer)
   {
     itkDebugMacro("m_CellsContainer is null");
@@ -1047,6 +1098,17 @@ Mesh<TPixelType, VDimension, TMeshTraits>::ReleaseCellsMemory()
 
   if (m_CellsContainer->GetReferenceCount() == 1)
   {
+    if (this->FindCellArena() != nullptr)
+    {
+      // The cells are destroyed with the arena.
+      m_CellsContainer->Initialize();
+      m_CellArena->Clear();
+      m_CellArena = nullptr;
+      m_CellArenaContainer = nullptr;
+      itkDebugMacro("CellsAllocatedInAnArena");
+      return;
+    }
+
     switch (m_CellsAllocationMethod)
     {
       case MeshClassCellsAllocationMethodEnum::CellsAllocationMethodUndefined:
@@ -1075,7 +1137,10 @@ Mesh<TPixelType, VDimension, TMeshTraits>::ReleaseCellsMemory()
         break;
       }
       case MeshEnums::MeshClassCellsAllocationMethod::CellsAllocatedDynamicallyCellByCell:
+      case MeshEnums::MeshClassCellsAllocationMethod::CellsAllocatedInAnArena:
       {
+        // Without an arena, AllocateCell() and SetCell() keep the cells
+        // allocated with new, as in the cell-by-cell method.
         itkDebugMacro("CellsAllocatedDynamicallyCellByCell start");
         // It is assumed that every cell was allocated independently.
         // A Cell iterator is created for going through the cells
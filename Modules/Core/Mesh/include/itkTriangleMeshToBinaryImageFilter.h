@@ -43,11 +43,9 @@ public:
     m_Sign = s;
   }
 
-  Point1D(const Point1D & point)
-  {
-    m_X = point.m_X;
-    m_Sign = point.m_Sign;
-  }
+  Point1D(const Point1D & point) = default;
+  Point1D &
+  operator=(const Point1D & point) = default;
 
   double
   getX() const
@@ -227,6 +225,26 @@ protected:
   static int
   PolygonToImageRaster(PointVector coords, Point1DArray & zymatrix, int extent[6]);
 
+  /** Intersection of a polygon with the ray parallel to the x axis that
+   * passes through row m_Ray of a (y,z) extent. */
+  struct RayCrossing
+  {
+    int     m_Ray;
+    Point1D m_Point;
+  };
+
+  /** Rasterize the polygon made of the \a numberOfCoords points starting at
+   * \a coords within \a extent, appending its ray crossings to \a crossings
+   * in the order PolygonToImageRaster(PointVector, ...) would store them.
+   * \a matrix is scratch space that is left empty on return, so it can be
+   * reused for the next polygon without reallocating. */
+  static int
+  PolygonToImageRaster(const PointType *           coords,
+                       int                         numberOfCoords,
+                       const int                   extent[6],
+                       Point2DArray &              matrix,
+                       std::vector<RayCrossing> & crossings);
+
   OutputImageType * m_InfoImage;
 
   IndexType m_Index;
@@ -20,7 +20,10 @@
 
 #include "itkImageRegionIteratorWithIndex.h"
 #include "itkNumericTraits.h"
+#include "itkMultiThreaderBase.h"
+#include <algorithm>
 #include <cstdlib>
+#include <numeric>
 
 namespace itk
 {
@@ -192,17 +195,45 @@ int
 TriangleMeshToBinaryImageFilter<TInputMesh, TOutputImage>::PolygonToImageRaster(PointVector    coords,
                                                                                 Point1DArray & zymatrix,
                                                                                 int            extent[6])
+{
+  Point2DArray             matrix;
+  std::vector<RayCrossing> crossings;
+
+  const int sign =
+    PolygonToImageRaster(coords.data(), static_cast<int>(coords.size()), extent, matrix, crossings);
+  for (const RayCrossing & crossing : crossings)
+  {
+    zymatrix[crossing.m_Ray].push_back(crossing.m_Point);
+  }
+  return sign;
+}
+
+template <typename TInputMesh, typename TOutputImage>
+int
+TriangleMeshToBinaryImageFilter<TInputMesh, TOutputImage>::PolygonToImageRaster(
+  const PointType *          coords,
+  int                        numberOfCoords,
+  const int                  extent[6],
+  Point2DArray &             matrix,
+  std::vector<RayCrossing> & crossings)
 {
   // convert the polgon into a rasterizable form by finding its
   // intersection with each z plane, and store the (x,y) coords
   // of each intersection in a vector called "matrix"
-  int          zSize = extent[5] - extent[4] + 1;
-  int          zInc = extent[3] - extent[2] + 1;
-  Point2DArray matrix(zSize);
+  const int zSize = extent[5] - extent[4] + 1;
+  const int zInc = extent[3] - extent[2] + 1;
+  if (matrix.size() < static_cast<size_t>(zSize))
+  {
+    matrix.resize(zSize);
+  }
+
+  // range of the z planes crossed by the polygon
+  int zFirst = extent[5] + 1;
+  int zLast = extent[4] - 1;
 
   // each iteration of the following loop examines one edge of the
   // polygon, where the endpoints of the edge are p1 and p2
-  auto      n = static_cast<int>(coords.size());
+  int       n = numberOfCoords;
   PointType p0 = coords[0];
   PointType p1 = coords[n - 1];
   double    area = 0.0;
@@ -237,6 +268,7 @@ TriangleMeshToBinaryImageFilter<TInputMesh, TOutputImage>::PolygonToImageRaster(
 
     if (zmin > extent[5] || zmax < extent[4])
     {
+      p1 = coords[i];
       continue;
     }
 
@@ -245,10 +277,13 @@ TriangleMeshToBinaryImageFilter<TInputMesh, TOutputImage>::PolygonToImageRaster(
     {
       zmin = extent[4];
     }
-    if (zmax >= extent[5])
+    if (zmax > extent[5])
     {
       zmax = extent[5] + 1;
     }
+    zFirst = std::min(zFirst, zmin);
+    zLast = std::max(zLast, zmax - 1);
+
     double temp = 1.0 / (p2[2] - p1[2]);
     for (int z = zmin; z < zmax; ++z)
     {
@@ -264,7 +299,7 @@ TriangleMeshToBinaryImageFilter<TInputMesh, TOutputImage>::PolygonToImageRaster(
   } // end of for loop
 
   // area is not really needed, we just need the sign
-  int sign;
+  int sign = 0;
   if (area < 0.0)
   {
     sign = -1;
@@ -273,22 +308,19 @@ TriangleMeshToBinaryImageFilter<TInputMesh, TOutputImage>::PolygonToImageRaster(
   {
     sign = 1;
   }
-  else
-  {
-    return 0;
-  }
 
   // rasterize the polygon and store the x coord for each (y,z)
   // point that we rasterize, kind of like using a depth buffer
   // except that 'x' is our depth value and we can store multiple
   // 'x' values per (y,z) value.
 
-  for (int z = extent[4]; z <= extent[5]; ++z)
+  for (int z = zFirst; z <= zLast; ++z)
   {
     Point2DVector & xylist = matrix[z - extent[4]];
 
-    if (xylist.empty())
+    if (xylist.empty() || sign == 0)
     {
+      xylist.clear();
       continue;
     }
 
@@ -320,10 +352,11 @@ TriangleMeshToBinaryImageFilter<TInputMesh, TOutputImage>::PolygonToImageRaster(
         if (extent[2] <= y && y <= extent[3])
         {
           int zyidx = (z - extent[4]) * zInc + (y - extent[2]);
-          zymatrix[zyidx].push_back(Point1D(X, sign));
+          crossings.push_back({ zyidx, Point1D(X, sign) });
         }
       }
     }
+    xylist.clear();
   }
 
   return sign;
@@ -336,8 +369,7 @@ TriangleMeshToBinaryImageFilter<TInputMesh, TOutputImage>::RasterizeTriangles()
 {
   InputMeshPointer input = this->GetInput(0);
 
-  InputPointsContainerPointer  myPoints = input->GetPoints();
-  InputPointsContainerIterator points = myPoints->Begin();
+  InputPointsContainerPointer myPoints = input->GetPoints();
 
   int extent[6];
 
@@ -349,43 +381,28 @@ TriangleMeshToBinaryImageFilter<TInputMesh, TOutputImage>::RasterizeTriangles()
   extent[4] = m_Index[2];
   extent[5] = m_Size[2] - 1;
 
-  OutputImagePointer OutputImage = this->GetOutput();
+  OutputImagePointer outputImage = this->GetOutput();
 
   // need to transform points from physical to index coordinates
-  auto                    NewPoints = PointsContainer::New();
-  auto                    NewPointSet = PointSetType::New();
-  PointSetType::PointType newpoint;
-
-  unsigned int pointId = 0;
-
-  while (points != myPoints->End())
+  PointVector indexPoints;
+  indexPoints.reserve(myPoints->Size());
+  for (InputPointsContainerIterator points = myPoints->Begin(); points != myPoints->End(); ++points)
   {
     PointType p = points.Value();
     // the index value type must match the point value type
-    const ContinuousIndex<PointType::ValueType, 3> ind =
-      OutputImage->template TransformPhysicalPointToContinuousIndex<PointType::ValueType>(p);
-    NewPoints->InsertElement(pointId++, ind);
-
-    ++points;
+    indexPoints.push_back(outputImage->template TransformPhysicalPointToContinuousIndex<PointType::ValueType>(p));
   }
-  NewPointSet->SetPoints(NewPoints);
-
-  // the stencil is kept in 'zymatrix' that provides
-  // the x extents for each (y,z) coordinate for which a ray
-  // parallel to the x axis intersects the polydata
-  int          zInc = extent[3] - extent[2] + 1;
-  int          zSize = extent[5] - extent[4] + 1;
-  Point1DArray zymatrix(zInc * zSize);
-  PointVector  coords;
 
-  CellsContainerPointer  cells = input->GetCells();
-  CellsContainerIterator cellIt = cells->Begin();
+  // gather the vertices of the polygons one after the other, with the
+  // range of z planes that each polygon can cross
+  PointVector                polygonCoords;
+  std::vector<SizeValueType> polygonOffsets(1, 0);
+  std::vector<int>           polygonZRanges;
 
-  while (cellIt != cells->End())
+  CellsContainerPointer cells = input->GetCells();
+  for (CellsContainerIterator cellIt = cells->Begin(); cellIt != cells->End(); ++cellIt)
   {
-    CellType *                         nextCell = cellIt->Value();
-    typename CellType::PointIdIterator pointIt = nextCell->PointIdsBegin();
-    PointType                          p;
+    CellType * nextCell = cellIt->Value();
 
     switch (nextCell->GetType())
     {
@@ -395,113 +412,222 @@ TriangleMeshToBinaryImageFilter<TInputMesh, TOutputImage>::RasterizeTriangles()
       case CellGeometryEnum::TRIANGLE_CELL:
       case CellGeometryEnum::POLYGON_CELL:
       {
-        coords.clear();
-        while (pointIt != nextCell->PointIdsEnd())
+        double minZ = NumericTraits<double>::max();
+        double maxZ = NumericTraits<double>::NonpositiveMin();
+        for (auto pointIt = nextCell->PointIdsBegin(); pointIt != nextCell->PointIdsEnd(); ++pointIt)
         {
-          if (!NewPointSet->GetPoint(*pointIt++, &newpoint))
+          if (*pointIt >= indexPoints.size())
           {
-            itkExceptionMacro("Point with id " << *pointIt - 1 << " does not exist in the new pointset");
+            itkExceptionMacro("Point with id " << *pointIt << " does not exist in the new pointset");
           }
-          p[0] = newpoint[0];
-          p[1] = newpoint[1];
-          p[2] = newpoint[2];
-          coords.push_back(p);
+          const PointType & p = indexPoints[*pointIt];
+          polygonCoords.push_back(p);
+          minZ = std::min(minZ, p[2]);
+          maxZ = std::max(maxZ, p[2]);
+        }
+        if (polygonCoords.size() == polygonOffsets.back())
+        {
+          break;
         }
-        this->PolygonToImageRaster(coords, zymatrix, extent);
+        polygonOffsets.push_back(polygonCoords.size());
+
+        // planes z with minZ <= z < maxZ, capped to the extent
+        const double zFirst = std::max(static_cast<double>(extent[4]), std::ceil(minZ));
+        const double zLast = std::min(static_cast<double>(extent[5]), std::ceil(maxZ) - 1.0);
+        polygonZRanges.push_back(zFirst <= zLast ? static_cast<int>(zFirst) : 0);
+        polygonZRanges.push_back(zFirst <= zLast ? static_cast<int>(zLast) : -1);
       }
       break;
       default:
         itkExceptionMacro(<< "Need Triangle or Polygon cells ONLY");
     }
-    ++cellIt;
   }
 
-  OutputImagePointer outputImage = this->GetOutput();
   outputImage->FillBuffer(m_OutsideValue);
 
-  for (int z = extent[4]; z <= extent[5]; ++z)
+  const int zInc = extent[3] - extent[2] + 1;
+  const int zSize = extent[5] - extent[4] + 1;
+  if (zInc <= 0 || zSize <= 0)
   {
-    for (int y = extent[2]; y <= extent[3]; ++y)
-    {
-      int           zyidx = (z - extent[4]) * zInc + (y - extent[2]);
-      Point1DVector xlist = zymatrix[zyidx];
+    return;
+  }
+
+  // split the z extent into slabs of consecutive planes, and bin each
+  // polygon into all the slabs that it crosses, keeping the polygons of
+  // a slab in their original order
+  const auto numberOfSlabs =
+    static_cast<int>(std::min<SizeValueType>(zSize, std::max(this->GetNumberOfWorkUnits(), 1u)));
+  std::vector<int> slabStarts(numberOfSlabs + 1);
+  std::vector<int> slabOfPlane(zSize);
+  for (int slab = 0; slab <= numberOfSlabs; ++slab)
+  {
+    slabStarts[slab] = extent[4] + static_cast<int>(static_cast<SizeValueType>(zSize) * slab / numberOfSlabs);
+  }
+  for (int slab = 0; slab < numberOfSlabs; ++slab)
+  {
+    std::fill(slabOfPlane.begin() + (slabStarts[slab] - extent[4]),
+              slabOfPlane.begin() + (slabStarts[slab + 1] - extent[4]),
+              slab);
+  }
 
-      if (xlist.size() <= 1)
+  const SizeValueType        numberOfPolygons = polygonOffsets.size() - 1;
+  std::vector<SizeValueType> binOffsets(numberOfSlabs + 1, 0);
+  for (SizeValueType polygon = 0; polygon < numberOfPolygons; ++polygon)
+  {
+    if (polygonZRanges[2 * polygon] <= polygonZRanges[2 * polygon + 1])
+    {
+      for (int slab = slabOfPlane[polygonZRanges[2 * polygon] - extent[4]];
+           slab <= slabOfPlane[polygonZRanges[2 * polygon + 1] - extent[4]];
+           ++slab)
       {
-        continue; // this is a peripheral point in the zy projection plane
+        ++binOffsets[slab + 1];
       }
-      else
+    }
+  }
+  std::partial_sum(binOffsets.begin(), binOffsets.end(), binOffsets.begin());
+  std::vector<SizeValueType> bins(binOffsets.back());
+  {
+    std::vector<SizeValueType> binEnds(binOffsets.begin(), binOffsets.end() - 1);
+    for (SizeValueType polygon = 0; polygon < numberOfPolygons; ++polygon)
+    {
+      if (polygonZRanges[2 * polygon] <= polygonZRanges[2 * polygon + 1])
       {
-        std::sort(xlist.begin(), xlist.end(), ComparePoints1D);
+        for (int slab = slabOfPlane[polygonZRanges[2 * polygon] - extent[4]];
+             slab <= slabOfPlane[polygonZRanges[2 * polygon + 1] - extent[4]];
+             ++slab)
+        {
+          bins[binEnds[slab]++] = polygon;
+        }
       }
-      // get the first entry
-      double lastx = xlist[0].m_X;
-      int    lastSign = xlist[0].m_Sign;
-      int    signproduct = 1;
-
-      // if adjacent x values are within tolerance of each
-      // other, check whether the number of 'exits' and
-      // 'entrances' are equal (via signproduct) and if so,
-      // ignore all x values, but if not, then count
-      // them as a single intersection of the ray with the
-      // surface
+    }
+  }
 
-      std::vector<double> nlist;
-      size_t              m = xlist.size();
-      for (size_t j = 1; j < m; ++j)
+  // each slab owns its own (y,z) rows of the output, so the slabs are
+  // rasterized and filled independently
+  ValueType * const buffer = outputImage->GetBufferPointer();
+  const double      tolerance = m_Tolerance;
+  const ValueType   insideValue = m_InsideValue;
+
+  this->GetMultiThreader()->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+  this->GetMultiThreader()->ParallelizeArray(
+    0,
+    numberOfSlabs,
+    [&](SizeValueType slab) {
+      int slabExtent[6] = { extent[0], extent[1], extent[2], extent[3], slabStarts[slab], slabStarts[slab + 1] - 1 };
+
+      // the stencil is kept in 'crossings' that provides
+      // the x extents for each (y,z) coordinate for which a ray
+      // parallel to the x axis intersects the polydata
+      Point2DArray             matrix;
+      std::vector<RayCrossing> crossings;
+      for (SizeValueType bin = binOffsets[slab]; bin < binOffsets[slab + 1]; ++bin)
       {
-        Point1D p1D = xlist[j];
-        double  x = p1D.m_X;
-        int     sign = p1D.m_Sign;
+        const SizeValueType polygon = bins[bin];
+        PolygonToImageRaster(polygonCoords.data() + polygonOffsets[polygon],
+                             static_cast<int>(polygonOffsets[polygon + 1] - polygonOffsets[polygon]),
+                             slabExtent,
+                             matrix,
+                             crossings);
+      }
 
-        // check absolute distance from lastx to x
-        if (itk::Math::abs(x - lastx) > m_Tolerance)
+      // group the crossings by ray, preserving the order of the polygons
+      const int                  numberOfRays = (slabExtent[5] - slabExtent[4] + 1) * zInc;
+      std::vector<SizeValueType> rayOffsets(numberOfRays + 1, 0);
+      for (const RayCrossing & crossing : crossings)
+      {
+        ++rayOffsets[crossing.m_Ray + 1];
+      }
+      std::partial_sum(rayOffsets.begin(), rayOffsets.end(), rayOffsets.begin());
+      Point1DVector xlists(crossings.size());
+      {
+        std::vector<SizeValueType> rayEnds(rayOffsets.begin(), rayOffsets.end() - 1);
+        for (const RayCrossing & crossing : crossings)
         {
-          signproduct = sign * lastSign;
-          if (signproduct < 0)
-          {
-            nlist.push_back(lastx);
-          }
+          xlists[rayEnds[crossing.m_Ray]++] = crossing.m_Point;
         }
-        lastx = x;
-        lastSign = sign;
       }
 
-      nlist.push_back(lastx);
+      std::vector<double> nlist;
+      for (int z = slabExtent[4]; z <= slabExtent[5]; ++z)
+      {
+        for (int y = extent[2]; y <= extent[3]; ++y)
+        {
+          const int zyidx = (z - slabExtent[4]) * zInc + (y - extent[2]);
+          auto      xlist = xlists.begin() + rayOffsets[zyidx];
+          auto      xlistEnd = xlists.begin() + rayOffsets[zyidx + 1];
 
-      // create the stencil extents
-      int minx1 = extent[0]; // minimum allowable x1 value
-      int n = static_cast<int>(nlist.size()) / 2;
+          if (xlistEnd - xlist <= 1)
+          {
+            continue; // this is a peripheral point in the zy projection plane
+          }
+          else
+          {
+            std::sort(xlist, xlistEnd, ComparePoints1D);
+          }
+          // get the first entry
+          double lastx = xlist->m_X;
+          int    lastSign = xlist->m_Sign;
+          int    signproduct = 1;
+
+          // if adjacent x values are within tolerance of each
+          // other, check whether the number of 'exits' and
+          // 'entrances' are equal (via signproduct) and if so,
+          // ignore all x values, but if not, then count
+          // them as a single intersection of the ray with the
+          // surface
+
+          nlist.clear();
+          for (++xlist; xlist != xlistEnd; ++xlist)
+          {
+            double x = xlist->m_X;
+            int    sign = xlist->m_Sign;
+
+            // check absolute distance from lastx to x
+            if (itk::Math::abs(x - lastx) > tolerance)
+            {
+              signproduct = sign * lastSign;
+              if (signproduct < 0)
+              {
+                nlist.push_back(lastx);
+              }
+            }
+            lastx = x;
+            lastSign = sign;
+          }
 
-      for (int i = 0; i < n; ++i)
-      {
-        auto x1 = static_cast<int>(std::ceil(nlist[2 * i]));
-        auto x2 = static_cast<int>(std::floor(nlist[2 * i + 1]));
+          nlist.push_back(lastx);
 
-        if (x2 < extent[0] || x1 > (extent[1]))
-        {
-          continue;
-        }
-        x1 = (x1 > minx1) ? (x1) : (minx1);         // max(x1,minx1)
-        x2 = (x2 < extent[1]) ? (x2) : (extent[1]); // min(x2,extent[1])
+          // create the stencil extents
+          int minx1 = extent[0]; // minimum allowable x1 value
+          int n = static_cast<int>(nlist.size()) / 2;
 
-        if (x2 >= x1)
-        {
-          IndexType ind;
-          ind[1] = y;
-          ind[2] = z;
-          for (int idX = x1; idX <= x2; ++idX)
+          for (int i = 0; i < n; ++i)
           {
-            // TODO: check whether replacing this for loop by ImageScanlineIterator is faster
-            ind[0] = idX;
-            outputImage->SetPixel(ind, m_InsideValue);
+            auto x1 = static_cast<int>(std::ceil(nlist[2 * i]));
+            auto x2 = static_cast<int>(std::floor(nlist[2 * i + 1]));
+
+            if (x2 < extent[0] || x1 > (extent[1]))
+            {
+              continue;
+            }
+            x1 = (x1 > minx1) ? (x1) : (minx1);         // max(x1,minx1)
+            x2 = (x2 < extent[1]) ? (x2) : (extent[1]); // min(x2,extent[1])
+
+            if (x2 >= x1)
+            {
+              IndexType ind;
+              ind[0] = x1;
+              ind[1] = y;
+              ind[2] = z;
+              std::fill_n(buffer + outputImage->ComputeOffset(ind), x2 - x1 + 1, insideValue);
+            }
+            // next x1 value must be at least x2+1
+            minx1 = x2 + 1;
           }
         }
-        // next x1 value must be at least x2+1
-        minx1 = x2 + 1;
       }
-    }
-  }
+    },
+    nullptr);
 }
 
 template <typename TInputMesh, typename TOutputImage>
@@ -16,6 +16,8 @@
  *
  *=========================================================================*/
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 
 #include "itkBinaryMask3DMeshSource.h"
@@ -127,6 +129,109 @@ itkBinaryMask3DMeshSourceTest(int argc, char * argv[])
   std::cout << "NumberOfNodes: " << meshSource->GetNumberOfNodes() << std::endl;
   std::cout << "NumberOfCells: " << meshSource->GetNumberOfCells() << std::endl;
 
+  ITK_TEST_SET_GET_BOOLEAN(meshSource, UseIsoValue, false);
+  ITK_TEST_SET_GET_BOOLEAN(meshSource, UseParallelSlabs, false);
+
+  // Compare the mesh to the one generated before the parallel slabs were
+  // introduced, through weighted sums of the coordinates of its points and of
+  // the identifiers of the points of its cells
+  const MeshType * mesh = meshSource->GetOutput();
+  double           pointSum = 0.0;
+  for (auto it = mesh->GetPoints()->Begin(); it != mesh->GetPoints()->End(); ++it)
+  {
+    pointSum += (it.Index() % 7 + 1) * (it.Value()[0] + 3 * it.Value()[1] + 5 * it.Value()[2]);
+  }
+  itk::SizeValueType cellSum = 0;
+  for (auto it = mesh->GetCells()->Begin(); it != mesh->GetCells()->End(); ++it)
+  {
+    const MeshType::PointIdentifier * pointIds = it.Value()->GetPointIds();
+    cellSum += (it.Index() % 7 + 1) * (pointIds[0] + 3 * pointIds[1] + 5 * pointIds[2]);
+  }
+
+  ITK_TEST_EXPECT_EQUAL(meshSource->GetNumberOfNodes(), useRegion ? 337 : 6071);
+  ITK_TEST_EXPECT_EQUAL(meshSource->GetNumberOfCells(), useRegion ? 396 : 9088);
+  ITK_TEST_EXPECT_EQUAL(mesh->GetNumberOfPoints(), meshSource->GetNumberOfNodes());
+  ITK_TEST_EXPECT_EQUAL(mesh->GetNumberOfCells(), meshSource->GetNumberOfCells());
+  ITK_TEST_EXPECT_TRUE(itk::Math::FloatAlmostEqual(pointSum, useRegion ? 48564.5 : 3915346.5));
+  ITK_TEST_EXPECT_EQUAL(cellSum, useRegion ? 2453427u : 1005548046u);
+
+  // The mesh generated by slabs in parallel does not depend on the number of
+  // slabs
+  auto parallelMeshSource = MeshSourceType::New();
+  parallelMeshSource->SetInput(image);
+  parallelMeshSource->SetObjectValue(internalValue);
+  parallelMeshSource->UseParallelSlabsOn();
+  auto serialMeshSource = MeshSourceType::New();
+  serialMeshSource->SetInput(image);
+  serialMeshSource->SetObjectValue(internalValue);
+  serialMeshSource->UseParallelSlabsOn();
+  serialMeshSource->SetNumberOfWorkUnits(1);
+  if (useRegion)
+  {
+    parallelMeshSource->SetRegionOfInterest(region);
+    serialMeshSource->SetRegionOfInterest(region);
+  }
+  ITK_TRY_EXPECT_NO_EXCEPTION(parallelMeshSource->Update());
+  ITK_TRY_EXPECT_NO_EXCEPTION(serialMeshSource->Update());
+
+  std::cout << "NumberOfNodes with parallel slabs: " << parallelMeshSource->GetNumberOfNodes() << std::endl;
+  std::cout << "NumberOfCells with parallel slabs: " << parallelMeshSource->GetNumberOfCells() << std::endl;
+
+  ITK_TEST_EXPECT_EQUAL(serialMeshSource->GetNumberOfNodes(), parallelMeshSource->GetNumberOfNodes());
+  ITK_TEST_EXPECT_EQUAL(serialMeshSource->GetNumberOfCells(), parallelMeshSource->GetNumberOfCells());
+  ITK_TEST_EXPECT_TRUE(parallelMeshSource->GetNumberOfNodes() <= meshSource->GetNumberOfNodes());
+
+  const MeshType * parallelMesh = parallelMeshSource->GetOutput();
+  const MeshType * serialMesh = serialMeshSource->GetOutput();
+  for (MeshType::CellIdentifier cellId = 0; cellId < parallelMesh->GetNumberOfCells(); ++cellId)
+  {
+    MeshType::CellAutoPointer cell;
+    MeshType::CellAutoPointer serialCell;
+    parallelMesh->GetCell(cellId, cell);
+    serialMesh->GetCell(cellId, serialCell);
+    for (unsigned int i = 0; i < cell->GetNumberOfPoints(); ++i)
+    {
+      if (parallelMesh->GetPoint(cell->GetPointIds()[i]) != serialMesh->GetPoint(serialCell->GetPointIds()[i]))
+      {
+        std::cerr << "Test failed!" << std::endl;
+        std::cerr << "Error in cell " << cellId << " generated with one work unit" << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  // An iso-value half way between the background and the object gives the
+  // same mesh, while a lower iso-value moves the nodes towards the background
+  for (const double isoValue : { 0.5, 0.25 })
+  {
+    auto isoMeshSource = MeshSourceType::New();
+    isoMeshSource->SetInput(image);
+    isoMeshSource->UseIsoValueOn();
+    isoMeshSource->SetIsoValue(isoValue);
+    ITK_TEST_SET_GET_VALUE(isoValue, isoMeshSource->GetIsoValue());
+    if (useRegion)
+    {
+      isoMeshSource->SetRegionOfInterest(region);
+    }
+    ITK_TRY_EXPECT_NO_EXCEPTION(isoMeshSource->Update());
+
+    ITK_TEST_EXPECT_EQUAL(isoMeshSource->GetNumberOfNodes(), meshSource->GetNumberOfNodes());
+    ITK_TEST_EXPECT_EQUAL(isoMeshSource->GetNumberOfCells(), meshSource->GetNumberOfCells());
+
+    const MeshType * isoMesh = isoMeshSource->GetOutput();
+    double           maximumDistance = 0.0;
+    for (MeshType::PointIdentifier pointId = 0; pointId < mesh->GetNumberOfPoints(); ++pointId)
+    {
+      const MeshType::PointType point = mesh->GetPoint(pointId);
+      const MeshType::PointType isoPoint = isoMesh->GetPoint(pointId);
+      for (unsigned int i = 0; i < Dimension; ++i)
+      {
+        maximumDistance = std::max(maximumDistance, static_cast<double>(std::abs(isoPoint[i] - point[i])));
+      }
+    }
+    ITK_TEST_EXPECT_TRUE(itk::Math::FloatAlmostEqual(maximumDistance, 0.5 - isoValue));
+  }
+
   return EXIT_SUCCESS;
 }
 
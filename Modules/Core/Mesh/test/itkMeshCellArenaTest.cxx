@@ -0,0 +1,244 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkMesh.h"
+#include "itkTestingMacros.h"
+
+int
+itkMeshCellArenaTest(int, char *[])
+{
+  constexpr unsigned int Dimension = 3;
+  using PixelType = float;
+  using MeshType = itk::Mesh<PixelType, Dimension>;
+  using CellType = MeshType::CellType;
+  using CellAutoPointer = MeshType::CellAutoPointer;
+  using TriangleType = MeshType::OutputTriangleCellType;
+  using TetrahedronType = MeshType::OutputTetrahedronCellType;
+
+  // A strip of triangles, with more cells than fit in the first blocks of
+  // the arena
+  constexpr unsigned int numberOfTriangles = 1000;
+
+  auto mesh = MeshType::New();
+  mesh->SetCellsAllocationMethod(itk::MeshEnums::MeshClassCellsAllocationMethod::CellsAllocatedInAnArena);
+  ITK_TEST_SET_GET_VALUE(itk::MeshEnums::MeshClassCellsAllocationMethod::CellsAllocatedInAnArena,
+                         mesh->GetCellsAllocationMethod());
+
+  for (unsigned int i = 0; i < numberOfTriangles + 2; ++i)
+  {
+    MeshType::PointType point;
+    point[0] = i / 2;
+    point[1] = i % 2;
+    point[2] = 0.0;
+    mesh->SetPoint(i, point);
+  }
+
+  for (unsigned int i = 0; i < numberOfTriangles; ++i)
+  {
+    CellAutoPointer cell;
+    TriangleType *  triangle = mesh->AllocateCell<TriangleType>(cell);
+    ITK_TEST_EXPECT_TRUE(!cell.IsOwner());
+    ITK_TEST_EXPECT_TRUE(cell.GetPointer() == triangle);
+    triangle->SetPointId(0, i);
+    triangle->SetPointId(1, i + 1);
+    triangle->SetPointId(2, i + 2);
+    mesh->SetCell(i, cell);
+  }
+
+  // A cell allocated with new is handed over to the arena
+  {
+    CellAutoPointer cell;
+    cell.TakeOwnership(new TetrahedronType);
+    for (unsigned int j = 0; j < TetrahedronType::NumberOfPoints; ++j)
+    {
+      cell->SetPointId(j, j);
+    }
+    mesh->SetCell(numberOfTriangles, cell);
+    ITK_TEST_EXPECT_TRUE(!cell.IsOwner());
+  }
+
+  ITK_TEST_EXPECT_EQUAL(mesh->GetNumberOfCells(), numberOfTriangles + 1);
+
+  for (unsigned int i = 0; i < numberOfTriangles; ++i)
+  {
+    CellAutoPointer cell;
+    ITK_TEST_EXPECT_TRUE(mesh->GetCell(i, cell));
+    ITK_TEST_EXPECT_EQUAL(cell->GetType(), itk::CellGeometryEnum::TRIANGLE_CELL);
+    ITK_TEST_EXPECT_EQUAL(cell->GetPointIds()[0], i);
+    ITK_TEST_EXPECT_EQUAL(cell->GetPointIds()[2], i + 2);
+  }
+
+  mesh->BuildCellLinks();
+  ITK_TEST_EXPECT_EQUAL(mesh->GetCellLinks()->GetElement(numberOfTriangles / 2).size(), 3);
+
+  // The arena is a member of the cells container, not of its meta data
+  using CellArenaContainerType = MeshType::CellArenaContainerType;
+  const auto * cellArenaContainer = dynamic_cast<const CellArenaContainerType *>(mesh->GetCells());
+  ITK_TEST_EXPECT_TRUE(cellArenaContainer != nullptr);
+  ITK_TEST_EXPECT_EQUAL(cellArenaContainer->GetCellArena().GetNumberOfCells(), numberOfTriangles + 1);
+  mesh->GetCells()->SetMetaDataDictionary(itk::MetaDataDictionary());
+  mesh->GetCells()->GetMetaDataDictionary().Clear();
+  ITK_TEST_EXPECT_EQUAL(cellArenaContainer->GetCellArena().GetNumberOfCells(), numberOfTriangles + 1);
+
+  // The cells are shared with a grafted mesh, and remain valid when the
+  // original mesh is destroyed
+  auto graftedMesh = MeshType::New();
+  graftedMesh->Graft(mesh);
+  mesh = nullptr;
+
+  ITK_TEST_EXPECT_EQUAL(graftedMesh->GetNumberOfCells(), numberOfTriangles + 1);
+  {
+    CellAutoPointer cell;
+    ITK_TEST_EXPECT_TRUE(graftedMesh->GetCell(numberOfTriangles, cell));
+    ITK_TEST_EXPECT_EQUAL(cell->GetType(), itk::CellGeometryEnum::TETRAHEDRON_CELL);
+    ITK_TEST_EXPECT_EQUAL(cell->GetPointIds()[3], 3);
+  }
+
+  // Round trip through the cells array
+  MeshType::CellsVectorContainer::Pointer cellsArray = graftedMesh->GetCellsArray();
+
+  auto arrayMesh = MeshType::New();
+  arrayMesh->SetCellsAllocationMethod(itk::MeshEnums::MeshClassCellsAllocationMethod::CellsAllocatedInAnArena);
+  arrayMesh->SetCellsArray(cellsArray);
+  ITK_TEST_EXPECT_EQUAL(arrayMesh->GetNumberOfCells(), numberOfTriangles + 1);
+
+  for (unsigned int i = 0; i <= numberOfTriangles; ++i)
+  {
+    CellAutoPointer expected;
+    CellAutoPointer cell;
+    graftedMesh->GetCell(i, expected);
+    arrayMesh->GetCell(i, cell);
+    ITK_TEST_EXPECT_EQUAL(cell->GetType(), expected->GetType());
+    ITK_TEST_EXPECT_TRUE(std::equal(cell->PointIdsBegin(), cell->PointIdsEnd(), expected->PointIdsBegin()));
+  }
+
+  // Releasing the cells destroys the arena
+  arrayMesh->Initialize();
+  ITK_TEST_EXPECT_EQUAL(arrayMesh->GetNumberOfCells(), 0);
+
+  // The cells container is shared with a mesh that allocates its cells one
+  // by one, without grafting. The cells remain valid when the original mesh
+  // is destroyed, and are released by the arena held by the container.
+  {
+    auto arenaMesh = MeshType::New();
+    arenaMesh->SetCellsAllocationMethod(itk::MeshEnums::MeshClassCellsAllocationMethod::CellsAllocatedInAnArena);
+    for (unsigned int i = 0; i < numberOfTriangles; ++i)
+    {
+      CellAutoPointer cell;
+      TriangleType *  triangle = arenaMesh->AllocateCell<TriangleType>(cell);
+      triangle->SetPointId(0, i);
+      triangle->SetPointId(1, i + 1);
+      triangle->SetPointId(2, i + 2);
+      arenaMesh->SetCell(i, cell);
+    }
+
+    auto sharingMesh = MeshType::New();
+    ITK_TEST_SET_GET_VALUE(itk::MeshEnums::MeshClassCellsAllocationMethod::CellsAllocatedDynamicallyCellByCell,
+                           sharingMesh->GetCellsAllocationMethod());
+    sharingMesh->SetCells(arenaMesh->GetCells());
+    arenaMesh = nullptr;
+
+    ITK_TEST_EXPECT_EQUAL(sharingMesh->GetNumberOfCells(), numberOfTriangles);
+    for (unsigned int i = 0; i < numberOfTriangles; ++i)
+    {
+      CellAutoPointer cell;
+      ITK_TEST_EXPECT_TRUE(sharingMesh->GetCell(i, cell));
+      ITK_TEST_EXPECT_EQUAL(cell->GetType(), itk::CellGeometryEnum::TRIANGLE_CELL);
+      ITK_TEST_EXPECT_EQUAL(cell->GetPointIds()[2], i + 2);
+    }
+
+    // A cell allocated with new by the sharing mesh is handed over to the
+    // arena too, since the container is released with the arena
+    CellAutoPointer cell;
+    cell.TakeOwnership(new TetrahedronType);
+    sharingMesh->SetCell(numberOfTriangles, cell);
+    ITK_TEST_EXPECT_TRUE(!cell.IsOwner());
+    ITK_TEST_EXPECT_EQUAL(sharingMesh->GetNumberOfCells(), numberOfTriangles + 1);
+
+    // The destruction of the sharing mesh releases the cells with the arena,
+    // not one by one
+  }
+
+  // The same, with a mesh that keeps a reference to the container after the
+  // original mesh is destroyed
+  {
+    auto arenaMesh = MeshType::New();
+    arenaMesh->SetCellsAllocationMethod(itk::MeshEnums::MeshClassCellsAllocationMethod::CellsAllocatedInAnArena);
+    CellAutoPointer cell;
+    arenaMesh->AllocateCell<TriangleType>(cell)->SetPointId(1, 7);
+    arenaMesh->SetCell(0, cell);
+
+    MeshType::CellsContainer::Pointer cells = arenaMesh->GetCells();
+    arenaMesh = nullptr;
+
+    ITK_TEST_EXPECT_EQUAL(cells->Size(), 1);
+    ITK_TEST_EXPECT_EQUAL(cells->GetElement(0)->GetPointIds()[1], 7);
+
+    auto sharingMesh = MeshType::New();
+    sharingMesh->SetCells(cells);
+    cells = nullptr;
+    sharingMesh->Initialize();
+    ITK_TEST_EXPECT_EQUAL(sharingMesh->GetNumberOfCells(), 0);
+  }
+
+  // A cells container which already holds cells allocated with new is kept,
+  // and the new cells are owned by the auto pointer as with the cell-by-cell
+  // method
+  {
+    auto cells = MeshType::CellsContainer::New();
+    cells->InsertElement(0, new TriangleType);
+
+    auto plainMesh = MeshType::New();
+    plainMesh->SetCellsAllocationMethod(itk::MeshEnums::MeshClassCellsAllocationMethod::CellsAllocatedInAnArena);
+    plainMesh->SetCells(cells);
+    CellAutoPointer cell;
+    plainMesh->AllocateCell<TetrahedronType>(cell);
+    ITK_TEST_EXPECT_TRUE(cell.IsOwner());
+    plainMesh->SetCell(1, cell);
+    ITK_TEST_EXPECT_TRUE(plainMesh->GetCells() == cells);
+    ITK_TEST_EXPECT_EQUAL(plainMesh->GetNumberOfCells(), 2);
+    cells = nullptr;
+  }
+
+  // Cells allocated with the default method are owned by the auto pointer
+  auto defaultMesh = MeshType::New();
+  {
+    CellAutoPointer cell;
+    defaultMesh->AllocateCell<TriangleType>(cell);
+    ITK_TEST_EXPECT_TRUE(cell.IsOwner());
+    defaultMesh->SetCell(0, cell);
+  }
+  ITK_TEST_EXPECT_EQUAL(defaultMesh->GetNumberOfCells(), 1);
+
+  // The arena can also be used on its own
+  {
+    itk::CellArena<CellType> arena;
+    for (unsigned int i = 0; i < 100; ++i)
+    {
+      arena.New<TriangleType>()->SetPointId(0, i);
+      arena.New<TetrahedronType>();
+    }
+    arena.Adopt(new TriangleType);
+    ITK_TEST_EXPECT_EQUAL(arena.GetNumberOfCells(), 201);
+    arena.Clear();
+    ITK_TEST_EXPECT_EQUAL(arena.GetNumberOfCells(), 0);
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
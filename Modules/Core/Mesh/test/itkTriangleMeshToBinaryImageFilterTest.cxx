@@ -27,6 +27,7 @@
 #include "itkRegularSphereMeshSource.h"
 #include "itkDefaultDynamicMeshTraits.h"
 #include "itkImageFileWriter.h"
+#include "itkImageRegionConstIterator.h"
 #include "itkTriangleMeshToBinaryImageFilter.h"
 
 int
@@ -87,6 +88,31 @@ itkTriangleMeshToBinaryImageFilterTest(int argc, char * argv[])
 
   imageFilter->Update();
 
+  // The rasterization does not depend on the number of slabs processed in parallel
+  for (itk::ThreadIdType numberOfWorkUnits : { 1, 7 })
+  {
+    auto slabFilter = TriangleMeshToBinaryImageFilterType::New();
+    slabFilter->SetInput(mySphereMeshSource->GetOutput());
+    slabFilter->SetSize(size);
+    slabFilter->SetNumberOfWorkUnits(numberOfWorkUnits);
+    slabFilter->Update();
+
+    itk::ImageRegionConstIterator<ImageType> it(imageFilter->GetOutput(),
+                                                imageFilter->GetOutput()->GetBufferedRegion());
+    itk::ImageRegionConstIterator<ImageType> slabIt(slabFilter->GetOutput(),
+                                                    slabFilter->GetOutput()->GetBufferedRegion());
+    for (; !it.IsAtEnd(); ++it, ++slabIt)
+    {
+      if (it.Get() != slabIt.Get())
+      {
+        std::cerr << "Test failed!" << std::endl;
+        std::cerr << "Error at index " << it.GetIndex() << " rasterized with " << numberOfWorkUnits << " work units"
+                  << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
   auto                im = ImageType::New();
   ImageType::SizeType imSize;
   imSize[0] = imSize[1] = imSize[2] = 100;
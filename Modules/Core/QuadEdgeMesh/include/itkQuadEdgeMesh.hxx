@@ -54,7 +54,7 @@ QuadEdgeMesh<TPixel, VDimension, TTraits>::Clear()
   if (this->GetEdgeCells())
   {
     CellsContainerIterator cellIterator = this->GetEdgeCells()->Begin();
-    while (!this->GetEdgeCells()->empty())
+    while (this->GetEdgeCells()->Size() != 0)
     {
       auto * edgeToDelete = dynamic_cast<EdgeCellType *>(cellIterator.Value());
       this->LightWeightDeleteEdge(edgeToDelete);
@@ -65,7 +65,7 @@ QuadEdgeMesh<TPixel, VDimension, TTraits>::Clear()
   // Clear the points potentialy left behind by LightWeightDeleteEdge():
   if (this->GetPoints())
   {
-    this->GetPoints()->clear();
+    this->GetPoints()->Initialize();
   }
   this->ClearFreePointAndCellIndexesLists(); // to start at index 0
 }
@@ -725,7 +725,7 @@ QuadEdgeMesh<TPixel, VDimension, TTraits>::PushOnContainer(EdgeCellType * newEdg
 {
   CellIdentifier eid = 0;
 
-  if (!this->GetEdgeCells()->empty())
+  if (this->GetEdgeCells()->Size() != 0)
   {
     CellsContainerConstIterator last = this->GetEdgeCells()->End();
     --last;
@@ -1071,7 +1071,7 @@ template <typename TPixel, unsigned int VDimension, typename TTraits>
 auto
 QuadEdgeMesh<TPixel, VDimension, TTraits>::GetEdge() const -> QEPrimal *
 {
-  if (this->GetEdgeCells()->empty())
+  if (this->GetEdgeCells()->Size() == 0)
   {
     return ((QEPrimal *)nullptr);
   }
@@ -1476,7 +1476,7 @@ template <typename TPixel, unsigned int VDimension, typename TTraits>
 auto
 QuadEdgeMesh<TPixel, VDimension, TTraits>::ComputeNumberOfEdges() const -> CellIdentifier
 {
-  return static_cast<CellIdentifier>(this->GetEdgeCells()->size());
+  return static_cast<CellIdentifier>(this->GetEdgeCells()->Size());
 }
 } // namespace itk
 
@@ -232,7 +232,15 @@ private:
    * In order to have constant time access at the itk level instead of
    * of doing a search in the Mesh::Cell container.
    */
-  CellIdentifier          m_Identifier;
+  CellIdentifier m_Identifier;
+
+  /**
+   * The four quad-edges of the edge are stored in the cell, so that an edge
+   * costs a single allocation: the primal edge and its symmetric, followed
+   * by the two dual edges.
+   */
+  QEType                  m_PrimalEdges[2];
+  QEDual                  m_DualEdges[2];
   QEType *                m_QuadEdgeGeom;
   mutable PointIdentifier m_PointIds[2];
 };
@@ -0,0 +1,116 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkQuadEdgeMeshVectorTraits_h
+#define itkQuadEdgeMeshVectorTraits_h
+
+#include <set>
+#include "itkCellInterface.h"
+#include "itkQuadEdgeCellTraitsInfo.h"
+#include "itkVectorMapContainer.h"
+
+namespace itk
+{
+/**
+ *\class QuadEdgeMeshVectorTraits
+ *  \brief Traits of a QuadEdgeMesh storing its points and cells in vectors.
+ *
+ *  This class defines the same types as QuadEdgeMeshTraits, except that the
+ *  points, cells, cell links and data containers are VectorMapContainer
+ *  instead of MapContainer. Accessing a point or a cell by identifier is then
+ *  an indexing operation instead of a search in a tree, and traversing the
+ *  mesh visits elements stored next to each other in memory.
+ *
+ *  QuadEdgeMesh reuses the identifiers of deleted points and cells when new
+ *  ones are added, so the vectors stay dense while the mesh is edited.
+ *  Call SqueezePointsIds() after deleting many points to make the point
+ *  identifiers contiguous again.
+ *
+ *  \sa QuadEdgeMeshTraits
+ *  \sa VectorMapContainer
+ * \ingroup ITKQuadEdgeMesh
+ */
+template <typename TPixel,
+          unsigned int VPointDimension,
+          typename TPData,
+          typename TDData,
+          typename TCoordRep = float,
+          typename TInterpolationWeight = float>
+class QuadEdgeMeshVectorTraits
+{
+public:
+  /** Basic types for a mesh trait class. */
+  using Self = QuadEdgeMeshVectorTraits;
+  using PixelType = TPixel;
+  using CellPixelType = TPixel;
+  using CoordRepType = TCoordRep;
+  using InterpolationWeightType = TInterpolationWeight;
+
+  static constexpr unsigned int PointDimension = VPointDimension;
+  static constexpr unsigned int MaxTopologicalDimension = VPointDimension;
+
+  using PointIdentifier = itk::IdentifierType;
+  using CellIdentifier = itk::IdentifierType;
+
+  using CellFeatureIdentifier = unsigned char; // made small in purpose
+
+  using UsingCellsContainer = std::set<CellIdentifier>;
+  using PointCellLinksContainer = std::set<CellIdentifier>;
+
+  /** Quad edge type alias. */
+  using PrimalDataType = TPData;
+  using DualDataType = TDData;
+  using QEPrimal = GeometricalQuadEdge<PointIdentifier, CellIdentifier, PrimalDataType, DualDataType>;
+  using QEDual = typename QEPrimal::DualType;
+  using VertexRefType = typename QEPrimal::OriginRefType;
+  using FaceRefType = typename QEPrimal::DualOriginRefType;
+
+  /** The type of point used for hashing.  This should never change from
+   * this setting, regardless of the mesh type. */
+  using PointHashType = Point<CoordRepType, VPointDimension>;
+
+  /** Points have an entry in the Onext ring */
+  using PointType = QuadEdgeMeshPoint<CoordRepType, VPointDimension, QEPrimal>;
+  using PointsContainer = VectorMapContainer<PointIdentifier, PointType>;
+
+  /** Standard cell interface. */
+  using CellTraits = QuadEdgeMeshCellTraitsInfo<VPointDimension,
+                                                CoordRepType,
+                                                InterpolationWeightType,
+                                                PointIdentifier,
+                                                CellIdentifier,
+                                                CellFeatureIdentifier,
+                                                PointType,
+                                                PointsContainer,
+                                                UsingCellsContainer,
+                                                QEPrimal>;
+
+  using CellType = CellInterface<CellPixelType, CellTraits>;
+  using CellAutoPointer = typename CellType::CellAutoPointer;
+
+  /** Containers types. */
+  using CellLinksContainer = VectorMapContainer<PointIdentifier, PointCellLinksContainer>;
+  using CellsContainer = VectorMapContainer<CellIdentifier, CellType *>;
+  using PointDataContainer = VectorMapContainer<PointIdentifier, PixelType>;
+  using CellDataContainer = VectorMapContainer<CellIdentifier, CellPixelType>;
+
+  /** Other useful types. */
+  using VectorType = typename PointType::VectorType;
+};
+} // namespace itk
+
+#endif
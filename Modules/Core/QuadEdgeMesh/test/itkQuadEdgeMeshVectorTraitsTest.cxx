@@ -0,0 +1,158 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkQuadEdgeMeshEulerOperatorFlipEdgeFunction.h"
+#include "itkQuadEdgeMeshEulerOperatorsTestHelper.h"
+#include "itkQuadEdgeMeshVectorTraits.h"
+#include "itkTestingMacros.h"
+
+namespace
+{
+// Build the same mesh with both containers, then edit it so that points and
+// cells are deleted and their identifiers reused.
+template <typename TMesh>
+typename TMesh::Pointer
+CreateAndEditMesh()
+{
+  using QEType = typename TMesh::QEType;
+  using FlipEdge = itk::QuadEdgeMeshEulerOperatorFlipEdgeFunction<TMesh, QEType>;
+
+  auto mesh = TMesh::New();
+  CreateSquareTriangularMesh<TMesh>(mesh);
+  for (typename TMesh::PointIdentifier i = 0; i < mesh->GetNumberOfPoints(); ++i)
+  {
+    mesh->SetPointData(i, static_cast<typename TMesh::PixelType>(i));
+  }
+
+  auto flipEdge = FlipEdge::New();
+  flipEdge->SetInput(mesh);
+  flipEdge->Evaluate(mesh->FindEdge(6, 12));
+
+  // The faces get the identifiers of the deleted ones when added back
+  mesh->DeleteFace(mesh->FindEdge(0, 1)->GetLeft());
+  mesh->DeleteFace(mesh->FindEdge(0, 5)->GetRight());
+  mesh->AddFaceTriangle(0, 1, 6);
+  mesh->AddFaceTriangle(0, 6, 5);
+
+  // Leave a hole in the point identifiers
+  typename TMesh::PointType point;
+  point[0] = -1.0;
+  point[1] = -1.0;
+  point[2] = 0.0;
+  const typename TMesh::PointIdentifier pid = mesh->AddPoint(point);
+  mesh->AddPoint(point);
+  mesh->DeletePoint(pid);
+  mesh->SqueezePointsIds();
+  return mesh;
+}
+} // namespace
+
+int
+itkQuadEdgeMeshVectorTraitsTest(int, char *[])
+{
+  constexpr unsigned int Dimension = 3;
+  using PixelType = double;
+  using MapMeshType = itk::QuadEdgeMesh<PixelType, Dimension>;
+  using VectorTraits = itk::QuadEdgeMeshVectorTraits<PixelType, Dimension, bool, bool>;
+  using VectorMeshType = itk::QuadEdgeMesh<PixelType, Dimension, VectorTraits>;
+
+  MapMeshType::Pointer    mapMesh = CreateAndEditMesh<MapMeshType>();
+  VectorMeshType::Pointer vectorMesh = CreateAndEditMesh<VectorMeshType>();
+
+  ITK_TEST_EXPECT_EQUAL(vectorMesh->GetNumberOfPoints(), 26);
+  ITK_TEST_EXPECT_EQUAL(vectorMesh->GetNumberOfFaces(), 32);
+  ITK_TEST_EXPECT_EQUAL(vectorMesh->GetNumberOfEdges(), 56);
+  ITK_TEST_EXPECT_TRUE(vectorMesh->GetPoints()->IndexExists(25));
+  ITK_TEST_EXPECT_EQUAL(vectorMesh->GetNumberOfPoints(), mapMesh->GetNumberOfPoints());
+  ITK_TEST_EXPECT_EQUAL(vectorMesh->GetNumberOfCells(), mapMesh->GetNumberOfCells());
+  ITK_TEST_EXPECT_EQUAL(vectorMesh->GetNumberOfFaces(), mapMesh->GetNumberOfFaces());
+  ITK_TEST_EXPECT_EQUAL(vectorMesh->GetNumberOfEdges(), mapMesh->GetNumberOfEdges());
+
+  // Both meshes hold the same points and cells under the same identifiers
+  auto mapPointIt = mapMesh->GetPoints()->Begin();
+  auto vectorPointIt = vectorMesh->GetPoints()->Begin();
+  for (; mapPointIt != mapMesh->GetPoints()->End(); ++mapPointIt, ++vectorPointIt)
+  {
+    ITK_TEST_EXPECT_EQUAL(vectorPointIt.Index(), mapPointIt.Index());
+    ITK_TEST_EXPECT_TRUE(vectorPointIt.Value() == mapPointIt.Value());
+    PixelType vectorData = -1.0;
+    PixelType mapData = -1.0;
+    ITK_TEST_EXPECT_EQUAL(vectorMesh->GetPointData(vectorPointIt.Index(), &vectorData),
+                          mapMesh->GetPointData(mapPointIt.Index(), &mapData));
+    ITK_TEST_EXPECT_EQUAL(vectorData, mapData);
+  }
+  ITK_TEST_EXPECT_TRUE(vectorPointIt == vectorMesh->GetPoints()->End());
+
+  auto mapCellIt = mapMesh->GetCells()->Begin();
+  auto vectorCellIt = vectorMesh->GetCells()->Begin();
+  for (; mapCellIt != mapMesh->GetCells()->End(); ++mapCellIt, ++vectorCellIt)
+  {
+    ITK_TEST_EXPECT_EQUAL(vectorCellIt.Index(), mapCellIt.Index());
+    ITK_TEST_EXPECT_EQUAL(vectorCellIt.Value()->GetType(), mapCellIt.Value()->GetType());
+    ITK_TEST_EXPECT_EQUAL(vectorCellIt.Value()->GetNumberOfPoints(), mapCellIt.Value()->GetNumberOfPoints());
+
+    // The point identifiers of polygon cells are computed by PointIdsBegin()
+    auto vectorPointIdIt = vectorCellIt.Value()->PointIdsBegin();
+    auto mapPointIdIt = mapCellIt.Value()->PointIdsBegin();
+    ITK_TEST_EXPECT_TRUE(std::equal(vectorPointIdIt, vectorCellIt.Value()->PointIdsEnd(), mapPointIdIt));
+  }
+  ITK_TEST_EXPECT_TRUE(vectorCellIt == vectorMesh->GetCells()->End());
+
+  // Deleted identifiers are skipped by the iterators and reused first
+  using CellsContainer = VectorMeshType::CellsContainer;
+  auto cells = CellsContainer::New();
+  cells->InsertElement(1, nullptr);
+  cells->InsertElement(4, nullptr);
+  cells->InsertElement(6, nullptr);
+  cells->DeleteIndex(4);
+  ITK_TEST_EXPECT_EQUAL(cells->Size(), 2);
+  ITK_TEST_EXPECT_TRUE(!cells->IndexExists(4));
+  ITK_TEST_EXPECT_EQUAL(cells->Begin().Index(), 1);
+  ITK_TEST_EXPECT_EQUAL((++cells->Begin()).Index(), 6);
+  ITK_TEST_EXPECT_EQUAL((--cells->End()).Index(), 6);
+  cells->DeleteIndex(6);
+  ITK_TEST_EXPECT_EQUAL((--cells->End()).Index(), 1);
+  cells->Reserve(3);
+  ITK_TEST_EXPECT_EQUAL(cells->Size(), 3);
+
+  // Deleting the last element while iterating does not move End()
+  cells->InsertElement(6, nullptr);
+  cells->InsertElement(9, nullptr);
+  const CellsContainer::Iterator cellsEnd = cells->End();
+  unsigned int                   numberOfVisitedCells = 0;
+  for (CellsContainer::Iterator it = cells->Begin(); it != cellsEnd; ++it)
+  {
+    if (it.Index() == 6)
+    {
+      cells->DeleteIndex(9);
+    }
+    ++numberOfVisitedCells;
+  }
+  ITK_TEST_EXPECT_EQUAL(numberOfVisitedCells, 4);
+  ITK_TEST_EXPECT_TRUE(cellsEnd == cells->End());
+  ITK_TEST_EXPECT_EQUAL((--cells->End()).Index(), 6);
+
+  // Squeeze() releases the unused slots at the end
+  cells->Squeeze();
+  ITK_TEST_EXPECT_EQUAL(cells->Size(), 4);
+  ITK_TEST_EXPECT_EQUAL((--cells->End()).Index(), 6);
+  ITK_TEST_EXPECT_TRUE(++(--cells->End()) == cells->End());
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -21,6 +21,10 @@
 #include "itkImageSpatialObject.h"
 #include "itkImageSliceConstIteratorWithIndex.h"
 
+#include <atomic>
+#include <mutex>
+#include <vector>
+
 namespace itk
 {
 /**
@@ -66,6 +70,16 @@ public:
 
   using SliceIteratorType = itk::ImageSliceConstIteratorWithIndex<ImageType>;
 
+  /** A run is a line of consecutive non-zero pixels along the first
+   * dimension of the image, given by the index of its first pixel and its
+   * number of pixels. */
+  struct RunType
+  {
+    IndexType     m_Index;
+    SizeValueType m_Length;
+  };
+  using RunListType = std::vector<RunType>;
+
   /** Method for creation through the object factory. */
   itkNewMacro(Self);
 
@@ -80,6 +94,28 @@ public:
   /* Avoid hiding the overload that supports depth and name arguments */
   using Superclass::IsInsideInObjectSpace;
 
+  /** Returns true if the pixel at the index is within the buffered region
+   * and non-zero. This is the test done by IsInsideInObjectSpace() once the
+   * point has been mapped to its nearest pixel. */
+  bool
+  IsInsideInIndexSpace(const IndexType & index) const
+  {
+    const ImageType * const image = this->GetImage();
+
+    return image->GetBufferedRegion().IsInside(index) &&
+           Math::NotExactlyEquals(image->GetPixel(index), NumericTraits<PixelType>::ZeroValue());
+  }
+
+  /** Computes the runs of non-zero pixels that are inside a region of the
+   * index space, clipped to that region, in the order of the pixels in the
+   * image buffer. Iterating over these runs visits exactly the pixels of the
+   * region for which IsInsideInIndexSpace() is true, without testing the
+   * other ones. The run-length encoding of the whole buffered region is
+   * computed on the first call after the image or the mask is modified,
+   * and can be shared by concurrent calls. */
+  void
+  ComputeRunsInIndexSpace(const RegionType & region, RunListType & runs) const;
+
   /** Computes the bounding box of the image mask, in the index space of the image.
    * The bounding box is returned as an image region. Each call to this function
    * will recompute the region.
@@ -116,6 +152,19 @@ protected:
 
   typename LightObject::Pointer
   InternalClone() const override;
+
+private:
+  /** Run-length encode the buffered region if the image or the mask was
+   * modified since it was last encoded. */
+  void
+  UpdateRuns() const;
+
+  /** Runs of the buffered region, and for each of its scanlines, the
+   * position of its first run. */
+  mutable RunListType                   m_Runs;
+  mutable std::vector<SizeValueType>    m_ScanlineRunOffsets;
+  mutable std::atomic<ModifiedTimeType> m_RunsMTime{ 0 };
+  mutable std::mutex                    m_RunsMutex;
 };
 } // end of namespace itk
 
@@ -20,7 +20,9 @@
 
 #include "itkMath.h"
 #include "itkImageRegionRange.h"
+#include "itkIndexRange.h"
 
+#include <algorithm>
 #include <cstdint> // For uintmax_t.
 
 namespace itk
@@ -38,13 +40,132 @@ ImageMaskSpatialObject<TDimension, TPixel>::ImageMaskSpatialObject()
 template <unsigned int TDimension, typename TPixel>
 bool
 ImageMaskSpatialObject<TDimension, TPixel>::IsInsideInObjectSpace(const PointType & point) const
+{
+  return this->IsInsideInIndexSpace(this->GetImage()->TransformPhysicalPointToIndex(point));
+}
+
+
+template <unsigned int TDimension, typename TPixel>
+void
+ImageMaskSpatialObject<TDimension, TPixel>::ComputeRunsInIndexSpace(const RegionType & region, RunListType & runs) const
+{
+  runs.clear();
+
+  this->UpdateRuns();
+
+  const RegionType & bufferedRegion = this->GetImage()->GetBufferedRegion();
+  RegionType         croppedRegion = region;
+  if (!croppedRegion.Crop(bufferedRegion))
+  {
+    return;
+  }
+
+  const IndexValueType croppedBegin = croppedRegion.GetIndex(0);
+  const IndexValueType croppedEnd = croppedBegin + static_cast<IndexValueType>(croppedRegion.GetSize(0));
+
+  // Visit the first pixel of each scanline of the cropped region
+  RegionType scanlineStarts = croppedRegion;
+  scanlineStarts.SetSize(0, 1);
+  for (const IndexType & scanlineStart : ImageRegionIndexRange<TDimension>(scanlineStarts))
+  {
+    SizeValueType scanline = 0;
+    for (int dim = TDimension - 1; dim > 0; --dim)
+    {
+      scanline = scanline * bufferedRegion.GetSize(dim) +
+                 static_cast<SizeValueType>(scanlineStart[dim] - bufferedRegion.GetIndex(dim));
+    }
+
+    for (SizeValueType r = m_ScanlineRunOffsets[scanline]; r < m_ScanlineRunOffsets[scanline + 1]; ++r)
+    {
+      const IndexValueType runBegin = std::max(m_Runs[r].m_Index[0], croppedBegin);
+      const IndexValueType runEnd =
+        std::min(m_Runs[r].m_Index[0] + static_cast<IndexValueType>(m_Runs[r].m_Length), croppedEnd);
+      if (runBegin < runEnd)
+      {
+        RunType run;
+        run.m_Index = scanlineStart;
+        run.m_Index[0] = runBegin;
+        run.m_Length = static_cast<SizeValueType>(runEnd - runBegin);
+        runs.push_back(run);
+      }
+    }
+  }
+}
+
+
+template <unsigned int TDimension, typename TPixel>
+void
+ImageMaskSpatialObject<TDimension, TPixel>::UpdateRuns() const
 {
   const ImageType * const image = this->GetImage();
+  itkAssertOrThrowMacro(image != nullptr, "Ensure that SetImage has been called!");
+
+  if (m_RunsMTime == std::max(this->GetMyMTime(), image->GetMTime()))
+  {
+    return;
+  }
+
+  const std::lock_guard<std::mutex> lock(m_RunsMutex);
+  const ModifiedTimeType            mtime = std::max(this->GetMyMTime(), image->GetMTime());
+  if (m_RunsMTime == mtime)
+  {
+    return;
+  }
+
+  const RegionType &  bufferedRegion = image->GetBufferedRegion();
+  const SizeValueType scanlineLength = bufferedRegion.GetSize(0);
+  const SizeValueType numberOfScanlines =
+    scanlineLength > 0 ? bufferedRegion.GetNumberOfPixels() / scanlineLength : 0;
+
+  m_Runs.clear();
+  m_ScanlineRunOffsets.assign(numberOfScanlines + 1, 0);
+
+  // The buffered region is stored scanline after scanline
+  const PixelType * pixel = image->GetBufferPointer();
+  const IndexType   upperIndex = bufferedRegion.GetUpperIndex();
+  IndexType         scanlineStart = bufferedRegion.GetIndex();
+  for (SizeValueType scanline = 0; scanline < numberOfScanlines; ++scanline)
+  {
+    m_ScanlineRunOffsets[scanline] = m_Runs.size();
+
+    SizeValueType x = 0;
+    while (x < scanlineLength)
+    {
+      while (x < scanlineLength && Math::ExactlyEquals(pixel[x], NumericTraits<PixelType>::ZeroValue()))
+      {
+        ++x;
+      }
+      if (x == scanlineLength)
+      {
+        break;
+      }
+      RunType run;
+      run.m_Index = scanlineStart;
+      run.m_Index[0] += static_cast<IndexValueType>(x);
+      const SizeValueType runBegin = x;
+      while (x < scanlineLength && Math::NotExactlyEquals(pixel[x], NumericTraits<PixelType>::ZeroValue()))
+      {
+        ++x;
+      }
+      run.m_Length = x - runBegin;
+      m_Runs.push_back(run);
+    }
+    pixel += scanlineLength;
 
-  const IndexType index = image->TransformPhysicalPointToIndex(point);
+    // Move to the start of the next scanline
+    for (unsigned int dim = 1; dim < TDimension; ++dim)
+    {
+      ++scanlineStart[dim];
+      if (scanlineStart[dim] <= upperIndex[dim])
+      {
+        break;
+      }
+      scanlineStart[dim] = bufferedRegion.GetIndex(dim);
+    }
+  }
+  m_ScanlineRunOffsets[numberOfScanlines] = m_Runs.size();
 
-  return image->GetBufferedRegion().IsInside(index) &&
-         Math::NotExactlyEquals(image->GetPixel(index), NumericTraits<PixelType>::ZeroValue());
+  m_RunsMTime = mtime;
 }
 
 
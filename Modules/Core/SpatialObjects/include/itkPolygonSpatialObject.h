@@ -20,6 +20,9 @@
 
 #include "itkPointBasedSpatialObject.h"
 
+#include <atomic>
+#include <mutex>
+
 namespace itk
 {
 /**
@@ -109,10 +112,11 @@ protected:
   InternalClone() const override;
 
 private:
-  mutable bool             m_IsClosed;
-  mutable int              m_OrientationInObjectSpace;
-  mutable ModifiedTimeType m_OrientationInObjectSpaceMTime;
-  double                   m_ThicknessInObjectSpace;
+  mutable bool                          m_IsClosed;
+  mutable int                           m_OrientationInObjectSpace;
+  mutable std::atomic<ModifiedTimeType> m_OrientationInObjectSpaceMTime;
+  mutable std::mutex                    m_OrientationInObjectSpaceMutex;
+  double                                m_ThicknessInObjectSpace;
 };
 
 } // namespace itk
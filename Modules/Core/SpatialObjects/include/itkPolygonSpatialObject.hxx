@@ -55,7 +55,15 @@ PolygonSpatialObject<TDimension>::GetOrientationInObjectSpace() const
   {
     return m_OrientationInObjectSpace;
   }
-  m_OrientationInObjectSpaceMTime = this->GetMyMTime();
+
+  // IsInsideInObjectSpace() may be called concurrently, for example by
+  // SpatialObjectToImageFilter, so the cache is filled by a single thread
+  const std::lock_guard<std::mutex> lock(m_OrientationInObjectSpaceMutex);
+  const ModifiedTimeType            mtime = this->GetMyMTime();
+  if (m_OrientationInObjectSpaceMTime == mtime)
+  {
+    return m_OrientationInObjectSpace;
+  }
 
   const PolygonPointListType & points = this->GetPoints();
   auto                         it = points.begin();
@@ -80,16 +88,21 @@ PolygonSpatialObject<TDimension>::GetOrientationInObjectSpace() const
     }
     it++;
   }
-  m_OrientationInObjectSpace = -1;
+  int orientation = -1;
   for (unsigned int i = 0; i < TDimension; ++i)
   {
     if (Math::ExactlyEquals(minPnt[i], maxPnt[i]))
     {
-      m_OrientationInObjectSpace = i;
+      orientation = i;
       break;
     }
   }
-  return m_OrientationInObjectSpace;
+
+  // Only mark the cached orientation as valid once it is computed, so that
+  // the threads that do not take the lock never read a partial result
+  m_OrientationInObjectSpace = orientation;
+  m_OrientationInObjectSpaceMTime = mtime;
+  return orientation;
 }
 
 template <unsigned int TDimension>
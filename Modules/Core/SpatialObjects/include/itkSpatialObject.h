@@ -22,7 +22,9 @@
 
 #include "itkCovariantVector.h"
 #include "itkMacro.h"
+#include <atomic>
 #include <list>
+#include <mutex>
 #include "itkSpatialObjectProperty.h"
 #include "itkProcessObject.h"
 #include "itkIndex.h"
@@ -30,6 +32,7 @@
 #include "itkAffineTransform.h"
 #include "itkVectorContainer.h"
 #include "itkBoundingBox.h"
+#include "itkSpatialObjectBoundingVolumeHierarchy.h"
 
 namespace itk
 {
@@ -280,6 +283,18 @@ public:
                                      unsigned int        depth = 0,
                                      const std::string & name = "") const;
 
+  /** Set/Get whether the queries through the children only visit the
+   *  children whose bounding box, including the boxes of their own children,
+   *  contains the point. The hierarchy of these boxes is built on the first
+   *  query after this object is modified, e.g., by Update(), AddChild() or
+   *  RemoveChild(), so Update() must be called on this object after the
+   *  geometry or the transform of a child has changed. This is only valid if
+   *  no child is inside or evaluable outside of its bounding box.
+   *  Default is false. */
+  itkSetMacro(UseChildrenBoundingVolumeHierarchy, bool);
+  itkGetConstMacro(UseChildrenBoundingVolumeHierarchy, bool);
+  itkBooleanMacro(UseChildrenBoundingVolumeHierarchy);
+
 
   /**************************/
   /* Values and derivatives */
@@ -665,6 +680,25 @@ private:
 
   ChildrenListType m_ChildrenList;
 
+  using ChildrenHierarchyType = SpatialObjectBoundingVolumeHierarchy<VDimension>;
+
+  /** Build the hierarchy of the children bounding boxes if this object was
+   *  modified since it was last built. */
+  void
+  UpdateChildrenHierarchy() const;
+
+  /** Compute the box, in the space of the parent, that bounds this object
+   *  and all its children. */
+  void
+  ComputeFamilyBoundsInParentSpace(PointType & minimum, PointType & maximum) const;
+
+  bool m_UseChildrenBoundingVolumeHierarchy{ false };
+
+  mutable ChildrenHierarchyType         m_ChildrenHierarchy;
+  mutable std::vector<const Self *>     m_ChildrenHierarchyObjects;
+  mutable std::atomic<ModifiedTimeType> m_ChildrenHierarchyMTime{ 0 };
+  mutable std::mutex                    m_ChildrenHierarchyMutex;
+
   /** Default inside value for the ValueAtInWorldSpace() */
   double m_DefaultInsideValue{ 1.0 };
 
@@ -200,6 +200,16 @@ SpatialObject<TDimension>::IsInsideChildrenInObjectSpace(const PointType &   poi
                                                          unsigned int        depth,
                                                          const std::string & name) const
 {
+  if (m_UseChildrenBoundingVolumeHierarchy)
+  {
+    this->UpdateChildrenHierarchy();
+    return m_ChildrenHierarchy.VisitBoxesContaining(point, [&](SizeValueType childId) {
+      const Self * child = m_ChildrenHierarchyObjects[childId];
+      return child->IsInsideInObjectSpace(
+        child->GetObjectToParentTransformInverse()->TransformPoint(point), depth, name);
+    });
+  }
+
   auto it = m_ChildrenList.begin();
 
   PointType pnt;
@@ -259,6 +269,16 @@ SpatialObject<TDimension>::IsEvaluableAtChildrenInObjectSpace(const PointType &
                                                               unsigned int        depth,
                                                               const std::string & name) const
 {
+  if (m_UseChildrenBoundingVolumeHierarchy)
+  {
+    this->UpdateChildrenHierarchy();
+    return m_ChildrenHierarchy.VisitBoxesContaining(point, [&](SizeValueType childId) {
+      const Self * child = m_ChildrenHierarchyObjects[childId];
+      return child->IsEvaluableAtInObjectSpace(
+        child->GetObjectToParentTransformInverse()->TransformPoint(point), depth, name);
+    });
+  }
+
   auto it = m_ChildrenList.begin();
 
   PointType pnt;
@@ -332,6 +352,35 @@ SpatialObject<TDimension>::ValueAtChildrenInObjectSpace(const PointType &   poin
                                                         unsigned int        depth,
                                                         const std::string & name) const
 {
+  if (m_UseChildrenBoundingVolumeHierarchy)
+  {
+    this->UpdateChildrenHierarchy();
+
+    // The value is the one of the first evaluable child in the list
+    const auto numberOfChildren = static_cast<SizeValueType>(m_ChildrenHierarchyObjects.size());
+    SizeValueType firstChildId = numberOfChildren;
+    m_ChildrenHierarchy.VisitBoxesContaining(point, [&](SizeValueType childId) {
+      const Self * child = m_ChildrenHierarchyObjects[childId];
+      if (childId < firstChildId &&
+          child->IsEvaluableAtInObjectSpace(
+            child->GetObjectToParentTransformInverse()->TransformPoint(point), depth, name))
+      {
+        firstChildId = childId;
+      }
+      return false;
+    });
+    if (firstChildId < numberOfChildren)
+    {
+      const Self * child = m_ChildrenHierarchyObjects[firstChildId];
+      child->ValueAtInObjectSpace(
+        child->GetObjectToParentTransformInverse()->TransformPoint(point), value, depth, name);
+      return true;
+    }
+
+    value = m_DefaultOutsideValue;
+    return false;
+  }
+
   auto it = m_ChildrenList.begin();
 
   PointType pnt;
@@ -350,6 +399,88 @@ SpatialObject<TDimension>::ValueAtChildrenInObjectSpace(const PointType &   poin
   return false;
 }
 
+template <unsigned int TDimension>
+void
+SpatialObject<TDimension>::UpdateChildrenHierarchy() const
+{
+  if (m_ChildrenHierarchyMTime == this->GetMyMTime())
+  {
+    return;
+  }
+
+  const std::lock_guard<std::mutex> lock(m_ChildrenHierarchyMutex);
+  const ModifiedTimeType            mtime = this->GetMyMTime();
+  if (m_ChildrenHierarchyMTime == mtime)
+  {
+    return;
+  }
+
+  m_ChildrenHierarchy.Clear();
+  m_ChildrenHierarchyObjects.clear();
+  m_ChildrenHierarchyObjects.reserve(m_ChildrenList.size());
+  for (const auto & child : m_ChildrenList)
+  {
+    PointType minimum;
+    PointType maximum;
+    child->ComputeFamilyBoundsInParentSpace(minimum, maximum);
+
+    // Pad the box to absorb the rounding of the transform to the child space
+    for (unsigned int i = 0; i < TDimension; ++i)
+    {
+      const double padding = 1e-10 * (std::abs(minimum[i]) + std::abs(maximum[i]));
+      minimum[i] -= padding;
+      maximum[i] += padding;
+    }
+    m_ChildrenHierarchy.AddBox(minimum, maximum);
+    m_ChildrenHierarchyObjects.push_back(child.GetPointer());
+  }
+  m_ChildrenHierarchy.Build();
+
+  m_ChildrenHierarchyMTime = mtime;
+}
+
+template <unsigned int TDimension>
+void
+SpatialObject<TDimension>::ComputeFamilyBoundsInParentSpace(PointType & minimum, PointType & maximum) const
+{
+  PointType familyMinimum = m_MyBoundingBoxInObjectSpace->GetMinimum();
+  PointType familyMaximum = m_MyBoundingBoxInObjectSpace->GetMaximum();
+  for (const auto & child : m_ChildrenList)
+  {
+    PointType childMinimum;
+    PointType childMaximum;
+    child->ComputeFamilyBoundsInParentSpace(childMinimum, childMaximum);
+    for (unsigned int i = 0; i < TDimension; ++i)
+    {
+      familyMinimum[i] = std::min(familyMinimum[i], childMinimum[i]);
+      familyMaximum[i] = std::max(familyMaximum[i], childMaximum[i]);
+    }
+  }
+
+  // Bound the transformed corners of the box
+  const TransformType * transform = this->GetObjectToParentTransform();
+  for (unsigned int corner = 0; corner < (1u << TDimension); ++corner)
+  {
+    PointType cornerPoint;
+    for (unsigned int i = 0; i < TDimension; ++i)
+    {
+      cornerPoint[i] = (corner & (1u << i)) ? familyMaximum[i] : familyMinimum[i];
+    }
+    cornerPoint = transform->TransformPoint(cornerPoint);
+    for (unsigned int i = 0; i < TDimension; ++i)
+    {
+      if (corner == 0 || cornerPoint[i] < minimum[i])
+      {
+        minimum[i] = cornerPoint[i];
+      }
+      if (corner == 0 || cornerPoint[i] > maximum[i])
+      {
+        maximum[i] = cornerPoint[i];
+      }
+    }
+  }
+}
+
 
 /** InternalClone */
 template <unsigned int TDimension>
@@ -404,6 +535,7 @@ SpatialObject<TDimension>::PrintSelf(std::ostream & os, Indent indent) const
   os << indent << "Object properties: " << std::endl;
   m_Property.Print(std::cout);
   os << indent << "ChildrenList:" << m_ChildrenList.size() << std::endl;
+  os << indent << "UseChildrenBoundingVolumeHierarchy:" << m_UseChildrenBoundingVolumeHierarchy << std::endl;
   os << indent << "DefaultInsideValue:" << m_DefaultInsideValue << std::endl;
   os << indent << "DefaultOutsideValue:" << m_DefaultOutsideValue << std::endl;
 }
@@ -0,0 +1,122 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkSpatialObjectBoundingVolumeHierarchy_h
+#define itkSpatialObjectBoundingVolumeHierarchy_h
+
+#include <vector>
+
+#include "itkPoint.h"
+#include "itkIntTypes.h"
+
+namespace itk
+{
+/**
+ * \class SpatialObjectBoundingVolumeHierarchy
+ * \brief Axis-aligned bounding box hierarchy used to accelerate point queries.
+ *
+ * Boxes are added with AddBox() and identified by their order of insertion.
+ * Once Build() has been called, VisitBoxesContaining() calls a visitor for
+ * every box that contains a point, which replaces a linear scan over all the
+ * boxes by a logarithmic descent of the hierarchy.
+ *
+ * Boxes are closed (a point on a face is inside), and a box with a NaN bound
+ * is treated as unbounded so that it is always visited.  The hierarchy is
+ * therefore only ever conservative: the caller still performs its exact test
+ * on the visited boxes.
+ *
+ * This is an internal helper of the spatial objects, it is not thread-safe
+ * while being built but can be queried concurrently once built.
+ *
+ * \ingroup ITKSpatialObjects
+ */
+template <unsigned int VDimension>
+class ITK_TEMPLATE_EXPORT SpatialObjectBoundingVolumeHierarchy
+{
+public:
+  using Self = SpatialObjectBoundingVolumeHierarchy;
+
+  using ScalarType = double;
+  using PointType = Point<ScalarType, VDimension>;
+  using BoxIdentifierType = SizeValueType;
+
+  /** Maximum number of boxes stored in a leaf of the hierarchy. */
+  static constexpr SizeValueType MaximumLeafSize = 4;
+
+  /** Remove all the boxes and the hierarchy. */
+  void
+  Clear();
+
+  /** Add a box. Its identifier is the number of boxes added before it. */
+  void
+  AddBox(const PointType & minimum, const PointType & maximum);
+
+  /** Build the hierarchy over the boxes added so far. */
+  void
+  Build();
+
+  SizeValueType
+  GetNumberOfBoxes() const
+  {
+    return static_cast<SizeValueType>(m_Minimums.size());
+  }
+
+  /** Call visitor(boxIdentifier) for each box containing the point, in no
+   * particular order. The search stops as soon as the visitor returns true,
+   * in which case true is returned. */
+  template <typename TVisitor>
+  bool
+  VisitBoxesContaining(const PointType & point, TVisitor && visitor) const;
+
+private:
+  struct Node
+  {
+    PointType     m_Minimum;
+    PointType     m_Maximum;
+    SizeValueType m_First;
+    SizeValueType m_Count;
+    SizeValueType m_SecondChild;
+  };
+
+  static bool
+  Contains(const PointType & minimum, const PointType & maximum, const PointType & point)
+  {
+    for (unsigned int i = 0; i < VDimension; ++i)
+    {
+      if (point[i] < minimum[i] || point[i] > maximum[i])
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  void
+  BuildNode(SizeValueType first, SizeValueType last, const std::vector<PointType> & centers);
+
+  std::vector<PointType>         m_Minimums;
+  std::vector<PointType>         m_Maximums;
+  std::vector<BoxIdentifierType> m_Order;
+  std::vector<Node>              m_Nodes;
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkSpatialObjectBoundingVolumeHierarchy.hxx"
+#endif
+
+#endif // itkSpatialObjectBoundingVolumeHierarchy_h
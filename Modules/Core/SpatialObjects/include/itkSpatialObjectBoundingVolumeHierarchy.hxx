@@ -0,0 +1,191 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkSpatialObjectBoundingVolumeHierarchy_hxx
+#define itkSpatialObjectBoundingVolumeHierarchy_hxx
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace itk
+{
+template <unsigned int VDimension>
+void
+SpatialObjectBoundingVolumeHierarchy<VDimension>::Clear()
+{
+  m_Minimums.clear();
+  m_Maximums.clear();
+  m_Order.clear();
+  m_Nodes.clear();
+}
+
+template <unsigned int VDimension>
+void
+SpatialObjectBoundingVolumeHierarchy<VDimension>::AddBox(const PointType & minimum, const PointType & maximum)
+{
+  for (unsigned int i = 0; i < VDimension; ++i)
+  {
+    if (std::isnan(minimum[i]) || std::isnan(maximum[i]))
+    {
+      // The box cannot be used for pruning, make sure it is always visited
+      PointType unboundedMinimum;
+      PointType unboundedMaximum;
+      unboundedMinimum.Fill(-std::numeric_limits<ScalarType>::infinity());
+      unboundedMaximum.Fill(std::numeric_limits<ScalarType>::infinity());
+      m_Minimums.push_back(unboundedMinimum);
+      m_Maximums.push_back(unboundedMaximum);
+      return;
+    }
+  }
+  m_Minimums.push_back(minimum);
+  m_Maximums.push_back(maximum);
+}
+
+template <unsigned int VDimension>
+void
+SpatialObjectBoundingVolumeHierarchy<VDimension>::Build()
+{
+  const SizeValueType numberOfBoxes = this->GetNumberOfBoxes();
+
+  m_Nodes.clear();
+  m_Order.resize(numberOfBoxes);
+  if (numberOfBoxes == 0)
+  {
+    return;
+  }
+
+  // Centers of unbounded boxes are meaningless, they are only used to
+  // partition the boxes, so replace them by the origin.
+  std::vector<PointType> centers(numberOfBoxes);
+  for (SizeValueType id = 0; id < numberOfBoxes; ++id)
+  {
+    m_Order[id] = id;
+    for (unsigned int i = 0; i < VDimension; ++i)
+    {
+      const ScalarType center = 0.5 * (m_Minimums[id][i] + m_Maximums[id][i]);
+      centers[id][i] = std::isfinite(center) ? center : 0.0;
+    }
+  }
+
+  m_Nodes.reserve(2 * (numberOfBoxes / MaximumLeafSize) + 1);
+  this->BuildNode(0, numberOfBoxes, centers);
+}
+
+template <unsigned int VDimension>
+void
+SpatialObjectBoundingVolumeHierarchy<VDimension>::BuildNode(SizeValueType                  first,
+                                                            SizeValueType                  last,
+                                                            const std::vector<PointType> & centers)
+{
+  const SizeValueType nodeId = m_Nodes.size();
+  m_Nodes.emplace_back();
+
+  Node node;
+  node.m_Minimum = m_Minimums[m_Order[first]];
+  node.m_Maximum = m_Maximums[m_Order[first]];
+  PointType centerMinimum = centers[m_Order[first]];
+  PointType centerMaximum = centerMinimum;
+  for (SizeValueType k = first + 1; k < last; ++k)
+  {
+    const BoxIdentifierType id = m_Order[k];
+    for (unsigned int i = 0; i < VDimension; ++i)
+    {
+      node.m_Minimum[i] = std::min(node.m_Minimum[i], m_Minimums[id][i]);
+      node.m_Maximum[i] = std::max(node.m_Maximum[i], m_Maximums[id][i]);
+      centerMinimum[i] = std::min(centerMinimum[i], centers[id][i]);
+      centerMaximum[i] = std::max(centerMaximum[i], centers[id][i]);
+    }
+  }
+  node.m_First = first;
+  node.m_Count = last - first;
+  node.m_SecondChild = 0;
+
+  if (node.m_Count > MaximumLeafSize)
+  {
+    // Split at the median of the centers along their widest extent
+    unsigned int axis = 0;
+    for (unsigned int i = 1; i < VDimension; ++i)
+    {
+      if (centerMaximum[i] - centerMinimum[i] > centerMaximum[axis] - centerMinimum[axis])
+      {
+        axis = i;
+      }
+    }
+    const SizeValueType middle = first + (last - first) / 2;
+    std::nth_element(m_Order.begin() + first,
+                     m_Order.begin() + middle,
+                     m_Order.begin() + last,
+                     [&centers, axis](BoxIdentifierType a, BoxIdentifierType b) {
+                       return centers[a][axis] < centers[b][axis];
+                     });
+
+    node.m_Count = 0;
+    this->BuildNode(first, middle, centers);
+    node.m_SecondChild = m_Nodes.size();
+    this->BuildNode(middle, last, centers);
+  }
+
+  m_Nodes[nodeId] = node;
+}
+
+template <unsigned int VDimension>
+template <typename TVisitor>
+bool
+SpatialObjectBoundingVolumeHierarchy<VDimension>::VisitBoxesContaining(const PointType & point,
+                                                                       TVisitor &&       visitor) const
+{
+  if (m_Nodes.empty())
+  {
+    return false;
+  }
+
+  // The tree is balanced, so its depth is bounded by the number of bits of
+  // the number of boxes.
+  SizeValueType stack[8 * sizeof(SizeValueType)];
+  unsigned int  stackSize = 0;
+  SizeValueType nodeId = 0;
+  while (true)
+  {
+    const Node & node = m_Nodes[nodeId];
+    if (Contains(node.m_Minimum, node.m_Maximum, point))
+    {
+      if (node.m_Count == 0)
+      {
+        stack[stackSize++] = node.m_SecondChild;
+        nodeId = nodeId + 1;
+        continue;
+      }
+      for (SizeValueType k = node.m_First; k < node.m_First + node.m_Count; ++k)
+      {
+        const BoxIdentifierType id = m_Order[k];
+        if (Contains(m_Minimums[id], m_Maximums[id], point) && visitor(id))
+        {
+          return true;
+        }
+      }
+    }
+    if (stackSize == 0)
+    {
+      return false;
+    }
+    nodeId = stack[--stackSize];
+  }
+}
+} // end namespace itk
+
+#endif // itkSpatialObjectBoundingVolumeHierarchy_hxx
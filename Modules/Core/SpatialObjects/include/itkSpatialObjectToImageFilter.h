@@ -31,6 +31,8 @@ namespace itk
  *  the maximum size of the object's bounding box is used.
  *  The spacing of the image is given by the spacing of the input
  *  Spatial object.
+ *  The image is generated in parallel, so the input spatial object and its
+ *  children are queried concurrently from several threads.
  * \ingroup ITKSpatialObjects
  *
  * \sphinx
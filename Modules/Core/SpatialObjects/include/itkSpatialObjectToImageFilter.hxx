@@ -19,9 +19,10 @@
 #define itkSpatialObjectToImageFilter_hxx
 
 #include "itkImageRegionIteratorWithIndex.h"
-#include "itkProgressReporter.h"
 #include "itkMath.h"
 
+#include <memory>
+
 namespace itk
 {
 /** Constructor */
@@ -321,53 +322,70 @@ SpatialObjectToImageFilter<TInputSpatialObject, TOutputImage>::GenerateData()
   OutputImage->SetDirection(m_Direction);
   OutputImage->Allocate(); // allocate the image
 
-  using myIteratorType = itk::ImageRegionIteratorWithIndex<OutputImageType>;
-
-  myIteratorType it(OutputImage, region);
+  // The inverse transforms are computed lazily, make sure they are up to
+  // date before the objects are queried concurrently.
+  InputObject->GetObjectToWorldTransformInverse();
+  const std::unique_ptr<typename InputSpatialObjectType::ChildrenConstListType> children(
+    InputObject->GetConstChildren(m_ChildrenDepth));
+  for (const auto & child : *children)
+  {
+    child->GetObjectToParentTransformInverse();
+    child->GetObjectToWorldTransformInverse();
+  }
 
-  itk::Point<double, ObjectDimension>      objectPoint;
-  itk::Point<double, OutputImageDimension> imagePoint;
+  const bool useInsideAndOutsideValues =
+    Math::NotExactlyEquals(m_InsideValue, NumericTraits<ValueType>::ZeroValue()) ||
+    Math::NotExactlyEquals(m_OutsideValue, NumericTraits<ValueType>::ZeroValue());
 
-  ProgressReporter progress(this, 0, OutputImage->GetRequestedRegion().GetNumberOfPixels());
+  this->GetMultiThreader()->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+  this->GetMultiThreader()->template ParallelizeImageRegion<OutputImageDimension>(
+    region,
+    [this, InputObject, &OutputImage, useInsideAndOutsideValues](const OutputImageRegionType & regionForThread) {
+      using myIteratorType = itk::ImageRegionIteratorWithIndex<OutputImageType>;
 
-  while (!it.IsAtEnd())
-  {
-    // ValueAtInWorldSpace requires the point to be in physical coordinate i.e
-    OutputImage->TransformIndexToPhysicalPoint(it.GetIndex(), imagePoint);
-    for (i = 0; i < ObjectDimension; ++i)
-    {
-      objectPoint[i] = imagePoint[i];
-    }
+      myIteratorType it(OutputImage, regionForThread);
 
-    double val = 0;
+      itk::Point<double, ObjectDimension>      objectPoint;
+      itk::Point<double, OutputImageDimension> imagePoint;
 
-    bool evaluable = InputObject->ValueAtInWorldSpace(objectPoint, val, m_ChildrenDepth);
-    if (Math::NotExactlyEquals(m_InsideValue, NumericTraits<ValueType>::ZeroValue()) ||
-        Math::NotExactlyEquals(m_OutsideValue, NumericTraits<ValueType>::ZeroValue()))
-    {
-      if (evaluable)
+      while (!it.IsAtEnd())
       {
-        if (m_UseObjectValue)
+        // ValueAtInWorldSpace requires the point to be in physical coordinate i.e
+        OutputImage->TransformIndexToPhysicalPoint(it.GetIndex(), imagePoint);
+        for (unsigned int i = 0; i < ObjectDimension; ++i)
         {
-          it.Set(static_cast<ValueType>(val));
+          objectPoint[i] = imagePoint[i];
+        }
+
+        double val = 0;
+
+        bool evaluable = InputObject->ValueAtInWorldSpace(objectPoint, val, m_ChildrenDepth);
+        if (useInsideAndOutsideValues)
+        {
+          if (evaluable)
+          {
+            if (m_UseObjectValue)
+            {
+              it.Set(static_cast<ValueType>(val));
+            }
+            else
+            {
+              it.Set(m_InsideValue);
+            }
+          }
+          else
+          {
+            it.Set(m_OutsideValue);
+          }
         }
         else
         {
-          it.Set(m_InsideValue);
+          it.Set(static_cast<ValueType>(val));
         }
+        ++it;
       }
-      else
-      {
-        it.Set(m_OutsideValue);
-      }
-    }
-    else
-    {
-      it.Set(static_cast<ValueType>(val));
-    }
-    ++it;
-    progress.CompletedPixel();
-  }
+    },
+    this);
 
   itkDebugMacro(<< "SpatialObjectToImageFilter::Update() finished");
 } // end update function
@@ -18,10 +18,13 @@
 #ifndef itkTubeSpatialObject_h
 #define itkTubeSpatialObject_h
 
+#include <atomic>
 #include <list>
+#include <mutex>
 
 #include "itkPointBasedSpatialObject.h"
 #include "itkTubeSpatialObjectPoint.h"
+#include "itkSpatialObjectBoundingVolumeHierarchy.h"
 
 namespace itk
 {
@@ -110,7 +113,11 @@ public:
 
   itkBooleanMacro(Root);
 
-  /** Returns true if the point is inside the tube, false otherwise. */
+  /** Returns true if the point is inside the tube, false otherwise.
+   *  Only the segments whose bounding box contains the point are tested,
+   *  using a hierarchy of the segment boxes that is built on the first call
+   *  after the tube is modified or updated. Points edited in place must be
+   *  followed by a call to Modified() or Update(). */
   bool
   IsInsideInObjectSpace(const PointType & point) const override;
 
@@ -136,9 +143,25 @@ protected:
   InternalClone() const override;
 
 private:
+  using SegmentHierarchyType = SpatialObjectBoundingVolumeHierarchy<TDimension>;
+
+  /** Returns true if the point is inside the part of the tube swept by the
+   *  segment joining the points segment and segment + 1. */
+  bool
+  IsInsideSegmentInObjectSpace(const PointType & point, SizeValueType segment) const;
+
+  /** Build the hierarchy of the segment bounding boxes if the tube was
+   *  modified since it was last built. */
+  void
+  UpdateSegmentHierarchy() const;
+
   int  m_ParentPoint;
   bool m_EndRounded;
   bool m_Root;
+
+  mutable SegmentHierarchyType          m_SegmentHierarchy;
+  mutable std::atomic<ModifiedTimeType> m_SegmentHierarchyMTime{ 0 };
+  mutable std::mutex                    m_SegmentHierarchyMutex;
 };
 
 } // end namespace itk
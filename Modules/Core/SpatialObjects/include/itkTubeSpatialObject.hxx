@@ -21,6 +21,8 @@
 
 #include "itkMath.h"
 
+#include <algorithm>
+
 namespace itk
 {
 /** Constructor */
@@ -49,6 +51,8 @@ TubeSpatialObject<TDimension, TTubePointType>::Clear()
   m_ParentPoint = -1;
   m_EndRounded = true; // default end-type is flat
 
+  m_SegmentHierarchyMTime = 0;
+
   this->Modified();
 }
 
@@ -127,6 +131,8 @@ TubeSpatialObject<TDimension, TTubePointType>::ComputeMyBoundingBox()
 {
   itkDebugMacro("Computing tube bounding box");
 
+  m_SegmentHierarchyMTime = 0;
+
   auto it = this->m_Points.begin();
   auto end = this->m_Points.end();
 
@@ -188,113 +194,184 @@ TubeSpatialObject<TDimension, TTubePointType>::IsInsideInObjectSpace(const Point
 {
   if (this->GetMyBoundingBoxInObjectSpace()->IsInside(point))
   {
-    double tempDist;
-    auto   it = this->m_Points.begin();
-    auto   first = it;
-    auto   it2 = it;
-    it2++;
-    auto end = this->m_Points.end();
-    auto last = end;
-    last--;
+    const auto numberOfPoints = static_cast<SizeValueType>(this->m_Points.size());
+    if (numberOfPoints < 2)
+    {
+      return false;
+    }
 
-    PointType firstP = first->GetPositionInObjectSpace();
-    double    firstR = first->GetRadiusInObjectSpace();
-    PointType lastP = last->GetPositionInObjectSpace();
-    double    lastR = last->GetRadiusInObjectSpace();
+    this->UpdateSegmentHierarchy();
 
-    bool withinEndCap = false;
-    while (it2 != end)
+    if (m_SegmentHierarchy.GetNumberOfBoxes() == numberOfPoints - 1)
     {
-      // Check if the point is on the normal plane
-      PointType a = (*it).GetPositionInObjectSpace();
-      PointType b = (*it2).GetPositionInObjectSpace();
+      return m_SegmentHierarchy.VisitBoxesContaining(
+        point, [this, &point](SizeValueType segment) { return this->IsInsideSegmentInObjectSpace(point, segment); });
+    }
 
-      if (!m_EndRounded)
+    // Points were added or removed without calling Update()
+    for (SizeValueType segment = 0; segment < numberOfPoints - 1; ++segment)
+    {
+      if (this->IsInsideSegmentInObjectSpace(point, segment))
       {
-        withinEndCap = false;
-        double firstDist = a.EuclideanDistanceTo(firstP);
-        double lastDist = a.EuclideanDistanceTo(lastP);
-        if (firstDist <= firstR || lastDist <= firstR)
-        {
-          withinEndCap = true;
-        }
-        else
-        {
-          firstDist = b.EuclideanDistanceTo(firstP);
-          lastDist = b.EuclideanDistanceTo(lastP);
-          if (firstDist <= lastR || lastDist <= lastR)
-          {
-            withinEndCap = true;
-          }
-        }
+        return true;
       }
+    }
+  }
+  return false;
+}
+
+template <unsigned int TDimension, typename TTubePointType>
+bool
+TubeSpatialObject<TDimension, TTubePointType>::IsInsideSegmentInObjectSpace(const PointType & point,
+                                                                           SizeValueType     segment) const
+{
+  const TubePointType & first = this->m_Points.front();
+  const TubePointType & last = this->m_Points.back();
+  const TubePointType & pointA = this->m_Points[segment];
+  const TubePointType & pointB = this->m_Points[segment + 1];
 
-      double A = 0;
-      double B = 0;
+  // Check if the point is on the normal plane
+  PointType a = pointA.GetPositionInObjectSpace();
+  PointType b = pointB.GetPositionInObjectSpace();
 
-      for (unsigned int i = 0; i < TDimension; ++i)
+  bool withinEndCap = false;
+  if (!m_EndRounded)
+  {
+    PointType firstP = first.GetPositionInObjectSpace();
+    double    firstR = first.GetRadiusInObjectSpace();
+    PointType lastP = last.GetPositionInObjectSpace();
+    double    lastR = last.GetRadiusInObjectSpace();
+
+    double firstDist = a.EuclideanDistanceTo(firstP);
+    double lastDist = a.EuclideanDistanceTo(lastP);
+    if (firstDist <= firstR || lastDist <= firstR)
+    {
+      withinEndCap = true;
+    }
+    else
+    {
+      firstDist = b.EuclideanDistanceTo(firstP);
+      lastDist = b.EuclideanDistanceTo(lastP);
+      if (firstDist <= lastR || lastDist <= lastR)
       {
-        A += (b[i] - a[i]) * (point[i] - a[i]);
-        B += (b[i] - a[i]) * (b[i] - a[i]);
+        withinEndCap = true;
       }
+    }
+  }
+
+  double A = 0;
+  double B = 0;
+
+  for (unsigned int i = 0; i < TDimension; ++i)
+  {
+    A += (b[i] - a[i]) * (point[i] - a[i]);
+    B += (b[i] - a[i]) * (b[i] - a[i]);
+  }
 
-      if (B != 0)
+  if (B != 0)
+  {
+    double lambda = A / B;
+    B = std::sqrt(B);
+
+    double lambdaMin = 0;
+    double lambdaMax = 1;
+    double lambdaMinR = pointA.GetRadiusInObjectSpace();
+    double lambdaMaxR = pointB.GetRadiusInObjectSpace();
+    if (m_EndRounded || !withinEndCap)
+    {
+      lambdaMin = -(lambdaMinR / B);
+      lambdaMax = 1 + (lambdaMaxR / B);
+      if (lambdaMax < (lambdaMinR / B))
       {
-        double lambda = A / B;
-        B = std::sqrt(B);
-
-        double lambdaMin = 0;
-        double lambdaMax = 1;
-        double lambdaMinR = (*it).GetRadiusInObjectSpace();
-        double lambdaMaxR = (*it2).GetRadiusInObjectSpace();
-        if (m_EndRounded || !withinEndCap)
-        {
-          lambdaMin = -(lambdaMinR / B);
-          lambdaMax = 1 + (lambdaMaxR / B);
-          if (lambdaMax < (lambdaMinR / B))
-          {
-            lambdaMax = (lambdaMinR / B);
-          }
-          if (lambdaMin > (1 - (lambdaMaxR / B)))
-          {
-            lambdaMin = 1 - (lambdaMaxR / B);
-          }
-        }
+        lambdaMax = (lambdaMinR / B);
+      }
+      if (lambdaMin > (1 - (lambdaMaxR / B)))
+      {
+        lambdaMin = 1 - (lambdaMaxR / B);
+      }
+    }
 
-        if (lambda >= lambdaMin && lambda <= lambdaMax)
-        {
-          if (lambda < 0)
-          {
-            lambda = 0;
-          }
-          else if (lambda > 1)
-          {
-            lambda = 1;
-          }
+    if (lambda >= lambdaMin && lambda <= lambdaMax)
+    {
+      if (lambda < 0)
+      {
+        lambda = 0;
+      }
+      else if (lambda > 1)
+      {
+        lambda = 1;
+      }
 
-          double lambdaR = lambdaMinR + lambda * (lambdaMaxR - lambdaMinR);
+      double lambdaR = lambdaMinR + lambda * (lambdaMaxR - lambdaMinR);
 
-          PointType p;
-          for (unsigned int i = 0; i < TDimension; ++i)
-          {
-            p[i] = a[i] + lambda * (b[i] - a[i]);
-          }
+      PointType p;
+      for (unsigned int i = 0; i < TDimension; ++i)
+      {
+        p[i] = a[i] + lambda * (b[i] - a[i]);
+      }
 
-          tempDist = point.EuclideanDistanceTo(p);
+      double tempDist = point.EuclideanDistanceTo(p);
 
-          if (tempDist <= lambdaR)
-          {
-            return true;
-          }
-        }
+      if (tempDist <= lambdaR)
+      {
+        return true;
       }
-      it++;
-      it2++;
     }
   }
   return false;
 }
 
+/** The closest point of a segment to a point inside the tube lies on the
+ *  segment, and it is at most the largest radius of the segment ends away,
+ *  so the segment can be bounded by its ends padded by that radius. */
+template <unsigned int TDimension, typename TTubePointType>
+void
+TubeSpatialObject<TDimension, TTubePointType>::UpdateSegmentHierarchy() const
+{
+  if (m_SegmentHierarchyMTime == this->GetMyMTime())
+  {
+    return;
+  }
+
+  const std::lock_guard<std::mutex> lock(m_SegmentHierarchyMutex);
+  const ModifiedTimeType            mtime = this->GetMyMTime();
+  if (m_SegmentHierarchyMTime == mtime)
+  {
+    return;
+  }
+
+  m_SegmentHierarchy.Clear();
+  auto it = this->m_Points.begin();
+  auto end = this->m_Points.end();
+  if (it != end)
+  {
+    auto it2 = it;
+    ++it2;
+    while (it2 != end)
+    {
+      const PointType a = it->GetPositionInObjectSpace();
+      const PointType b = it2->GetPositionInObjectSpace();
+      const double    radius = std::max(it->GetRadiusInObjectSpace(), it2->GetRadiusInObjectSpace());
+
+      // Pad the box to absorb the rounding of the distance computation
+      PointType minimum;
+      PointType maximum;
+      for (unsigned int i = 0; i < TDimension; ++i)
+      {
+        const double padding = radius + 1e-10 * (std::abs(radius) + std::abs(a[i]) + std::abs(b[i]));
+        minimum[i] = std::min(a[i], b[i]) - padding;
+        maximum[i] = std::max(a[i], b[i]) + padding;
+      }
+      m_SegmentHierarchy.AddBox(minimum, maximum);
+      ++it;
+      ++it2;
+    }
+  }
+  m_SegmentHierarchy.Build();
+
+  m_SegmentHierarchyMTime = mtime;
+}
+
 /** Remove duplicate points */
 template <unsigned int TDimension, typename TTubePointType>
 unsigned int
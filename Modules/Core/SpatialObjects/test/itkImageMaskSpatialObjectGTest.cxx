@@ -323,3 +323,70 @@ TEST(ImageMaskSpatialObject, CornerPointIsNotInsideMaskOfZeroValues)
   const double cornerPoint[] = { 1.5, 1.5 };
   ASSERT_FALSE(imageMaskSpatialObject->IsInsideInObjectSpace(cornerPoint));
 }
+
+
+// Tests that ComputeRunsInIndexSpace yields exactly the pixels of a region for
+// which IsInsideInIndexSpace is true, in buffer order, also when the region is
+// only partially inside the image.
+TEST(ImageMaskSpatialObject, RunsInIndexSpaceMatchIsInsideInIndexSpace)
+{
+  using ImageType = itk::Image<unsigned char, 3>;
+  using IndexType = ImageType::IndexType;
+  using SizeType = ImageType::SizeType;
+  using RegionType = ImageType::RegionType;
+
+  const auto image = ImageType::New();
+  image->SetRegions(RegionType(IndexType{ { -2, 3, 1 } }, SizeType{ { 11, 7, 5 } }));
+  image->Allocate(true);
+
+  for (const auto & index : itk::ImageRegionIndexRange<3>(image->GetBufferedRegion()))
+  {
+    if ((index[0] * 7 + index[1] * 3 + index[2]) % 5 < 2 || index[0] > 6)
+    {
+      image->SetPixel(index, 1);
+    }
+  }
+
+  const auto spatialObject = itk::ImageMaskSpatialObject<3>::New();
+  spatialObject->SetImage(image);
+  spatialObject->Update();
+
+  const RegionType regions[] = { image->GetBufferedRegion(),
+                                 RegionType(IndexType{ { 0, 4, 2 } }, SizeType{ { 5, 2, 3 } }),
+                                 RegionType(IndexType{ { -6, 0, -1 } }, SizeType{ { 20, 6, 3 } }),
+                                 RegionType(IndexType{ { 20, 4, 2 } }, SizeType{ { 2, 2, 2 } }) };
+
+  for (const auto & region : regions)
+  {
+    std::vector<IndexType> expectedIndices;
+    for (const auto & index : itk::ImageRegionIndexRange<3>(region))
+    {
+      if (spatialObject->IsInsideInIndexSpace(index))
+      {
+        expectedIndices.push_back(index);
+      }
+    }
+
+    itk::ImageMaskSpatialObject<3>::RunListType runs;
+    spatialObject->ComputeRunsInIndexSpace(region, runs);
+
+    std::vector<IndexType> actualIndices;
+    for (const auto & run : runs)
+    {
+      EXPECT_GT(run.m_Length, 0u);
+      IndexType index = run.m_Index;
+      for (itk::SizeValueType i = 0; i < run.m_Length; ++i, ++index[0])
+      {
+        actualIndices.push_back(index);
+      }
+    }
+    EXPECT_EQ(actualIndices, expectedIndices);
+  }
+
+  // The runs follow modifications of the mask image.
+  image->FillBuffer(0);
+  image->Modified();
+  itk::ImageMaskSpatialObject<3>::RunListType runs;
+  spatialObject->ComputeRunsInIndexSpace(image->GetBufferedRegion(), runs);
+  EXPECT_TRUE(runs.empty());
+}
@@ -17,7 +17,10 @@
  *=========================================================================*/
 
 #include "itkEllipseSpatialObject.h"
+#include "itkGroupSpatialObject.h"
+#include "itkTubeSpatialObject.h"
 #include "itkSpatialObjectToImageFilter.h"
+#include "itkImageRegionConstIterator.h"
 #include "itkCommand.h"
 #include "itkTestingMacros.h"
 
@@ -195,6 +198,89 @@ itkSpatialObjectToImageFilterTest(int, char *[])
     }
   }
 
+  // Test a group of tubes, which is generated in parallel and queried
+  // through the hierarchy of the children bounding boxes
+  using GroupType = itk::GroupSpatialObject<2>;
+  using TubeType = itk::TubeSpatialObject<2>;
+
+  auto group = GroupType::New();
+  for (unsigned int t = 0; t < 20; ++t)
+  {
+    auto                        tube = TubeType::New();
+    TubeType::TubePointListType points;
+    for (unsigned int k = 0; k < 30; ++k)
+    {
+      TubeType::PointType position;
+      position[0] = 10 + 1.2 * k;
+      position[1] = 12 + 2.5 * t + 1.5 * std::sin(0.4 * k + t);
+
+      TubeType::TubePointType point;
+      point.SetPositionInObjectSpace(position);
+      point.SetRadiusInObjectSpace(0.6 + 0.4 * std::cos(0.3 * k + t));
+      points.push_back(point);
+    }
+    tube->SetPoints(points);
+    tube->SetEndRounded(t % 2 == 0);
+    if (t % 3 == 0)
+    {
+      TubeType::TransformType::OffsetType tubeOffset;
+      tubeOffset[0] = 0.37;
+      tubeOffset[1] = -0.21;
+      tube->GetModifiableObjectToParentTransform()->SetOffset(tubeOffset);
+    }
+    tube->Update();
+    group->AddChild(tube);
+  }
+  group->Update();
+
+  using GroupToImageFilterType = itk::SpatialObjectToImageFilter<GroupType, ImageType>;
+  auto serialFilter = GroupToImageFilterType::New();
+  serialFilter->SetInput(group);
+  serialFilter->SetInsideValue(insideValue);
+  serialFilter->SetOutsideValue(outsideValue);
+  size.Fill(80);
+  serialFilter->SetSize(size);
+  serialFilter->SetNumberOfWorkUnits(1);
+  ITK_TRY_EXPECT_NO_EXCEPTION(serialFilter->Update());
+
+  bool useChildrenBoundingVolumeHierarchy = true;
+  ITK_TEST_SET_GET_BOOLEAN(group, UseChildrenBoundingVolumeHierarchy, useChildrenBoundingVolumeHierarchy);
+
+  auto groupFilter = GroupToImageFilterType::New();
+  groupFilter->SetInput(group);
+  groupFilter->SetInsideValue(insideValue);
+  groupFilter->SetOutsideValue(outsideValue);
+  groupFilter->SetSize(size);
+  groupFilter->SetNumberOfWorkUnits(4);
+  ITK_TRY_EXPECT_NO_EXCEPTION(groupFilter->Update());
+
+  std::cout << "Testing group of tubes: ";
+
+  unsigned int numberOfInsidePixels = 0;
+  using ConstIteratorType = itk::ImageRegionConstIterator<ImageType>;
+  ConstIteratorType serialIt(serialFilter->GetOutput(), serialFilter->GetOutput()->GetBufferedRegion());
+  ConstIteratorType groupIt(groupFilter->GetOutput(), groupFilter->GetOutput()->GetBufferedRegion());
+  for (; !serialIt.IsAtEnd(); ++serialIt, ++groupIt)
+  {
+    if (serialIt.Get() != groupIt.Get())
+    {
+      std::cout << "[FAILURE]" << std::endl;
+      std::cerr << "Pixel " << groupIt.GetIndex() << " differs from the one generated with one work unit" << std::endl;
+      return EXIT_FAILURE;
+    }
+    if (serialIt.Get() == insideValue)
+    {
+      ++numberOfInsidePixels;
+    }
+  }
+  if (numberOfInsidePixels == 0)
+  {
+    std::cout << "[FAILURE]" << std::endl;
+    std::cerr << "No pixel is inside the tubes" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "[PASSED]" << std::endl;
 
   std::cout << "Test finished" << std::endl;
   return EXIT_SUCCESS;
@@ -24,8 +24,11 @@
 #include "itkTestingMacros.h"
 #include "itkTubeSpatialObject.h"
 #include "itkGroupSpatialObject.h"
+#include "itkMersenneTwisterRandomVariateGenerator.h"
 #include "itkTestingMacros.h"
 
+#include <algorithm>
+
 
 int
 itkTubeSpatialObjectTest(int, char *[])
@@ -492,6 +495,100 @@ itkTubeSpatialObjectTest(int, char *[])
   std::cout << "[PASSED]" << std::endl;
 
 
+  // Compare IsInside() with a brute-force test of each segment, as a tube of
+  // two points, on a random tube. The hierarchy of the segment boxes must
+  // follow the points set with SetPoints() or edited in place.
+  std::cout << "Testing IsInside() against each segment: ";
+  {
+    auto randomGenerator = itk::Statistics::MersenneTwisterRandomVariateGenerator::New();
+    randomGenerator->Initialize(1234);
+
+    TubePointListType randomPoints;
+    Point             position;
+    position.Fill(0.0);
+    for (unsigned int i = 0; i < 200; ++i)
+    {
+      for (unsigned int j = 0; j < 3; ++j)
+      {
+        position[j] += randomGenerator->GetUniformVariate(-1.0, 2.0);
+      }
+      TubePointType point;
+      point.SetPositionInObjectSpace(position);
+      point.SetRadiusInObjectSpace(randomGenerator->GetUniformVariate(0.5, 2.0));
+      randomPoints.push_back(point);
+    }
+
+    auto randomTube = TubeType::New();
+    randomTube->SetPoints(randomPoints);
+    randomTube->Update();
+
+    const auto countMismatches = [&randomGenerator](const TubeType * tube, const TubePointListType & points) {
+      std::vector<TubePointer> segments;
+      for (size_t i = 0; i + 1 < points.size(); ++i)
+      {
+        TubePointListType segmentPoints;
+        segmentPoints.push_back(points[i]);
+        segmentPoints.push_back(points[i + 1]);
+        auto segment = TubeType::New();
+        segment->SetPoints(segmentPoints);
+        segment->Update();
+        segments.push_back(segment);
+      }
+
+      const auto * box = tube->GetMyBoundingBoxInObjectSpace();
+      unsigned int mismatches = 0;
+      for (unsigned int i = 0; i < 5000; ++i)
+      {
+        Point query;
+        for (unsigned int j = 0; j < 3; ++j)
+        {
+          query[j] = randomGenerator->GetUniformVariate(box->GetMinimum()[j] - 1.0, box->GetMaximum()[j] + 1.0);
+        }
+        bool inside = false;
+        for (const auto & segment : segments)
+        {
+          inside = inside || segment->IsInsideInObjectSpace(query);
+        }
+        if (inside != tube->IsInsideInObjectSpace(query))
+        {
+          ++mismatches;
+        }
+      }
+      return mismatches;
+    };
+
+    ITK_TEST_EXPECT_EQUAL(countMismatches(randomTube, randomPoints), 0);
+
+    // Shrink the tube within its bounding box, without calling Update()
+    for (auto & point : randomPoints)
+    {
+      Point shrunk = point.GetPositionInObjectSpace();
+      for (unsigned int j = 0; j < 3; ++j)
+      {
+        shrunk[j] *= 0.5;
+      }
+      point.SetPositionInObjectSpace(shrunk);
+    }
+    randomTube->SetPoints(randomPoints);
+    ITK_TEST_EXPECT_EQUAL(countMismatches(randomTube, randomPoints), 0);
+
+    // Reverse the points in place, followed by a call to Modified()
+    TubePointListType & tubePoints = randomTube->GetPoints();
+    std::reverse(tubePoints.begin(), tubePoints.end());
+    std::reverse(randomPoints.begin(), randomPoints.end());
+    for (auto & point : tubePoints)
+    {
+      point.SetRadiusInObjectSpace(0.5 * point.GetRadiusInObjectSpace());
+    }
+    for (auto & point : randomPoints)
+    {
+      point.SetRadiusInObjectSpace(0.5 * point.GetRadiusInObjectSpace());
+    }
+    randomTube->Modified();
+    ITK_TEST_EXPECT_EQUAL(countMismatches(randomTube, randomPoints), 0);
+  }
+  std::cout << "[PASSED]" << std::endl;
+
   // For coverage only
   std::cout << "Testing PointBasedSO: ";
   using PointBasedType = itk::PointBasedSpatialObject<3>;
@@ -146,6 +146,12 @@ public:
   OutputPointType
   TransformPoint(const InputPointType & point) const override;
 
+  /** Transform a block of points from azimuth-elevation to cartesian. */
+  void
+  TransformPoints(const InputPointType * inputPoints,
+                  OutputPointType *      outputPoints,
+                  SizeValueType          numberOfPoints) const override;
+
   /** Back transform from cartesian to azimuth-elevation.  */
   inline InputPointType
   BackTransform(const OutputPointType & point) const
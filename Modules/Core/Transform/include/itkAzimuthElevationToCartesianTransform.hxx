@@ -84,6 +84,21 @@ AzimuthElevationToCartesianTransform<TParametersValueType, VDimension>::Transfor
   return result;
 }
 
+template <typename TParametersValueType, unsigned int VDimension>
+void
+AzimuthElevationToCartesianTransform<TParametersValueType, VDimension>::TransformPoints(
+  const InputPointType * inputPoints,
+  OutputPointType *      outputPoints,
+  SizeValueType          numberOfPoints) const
+{
+  // The transform is not affine, so do not use the block transform of the
+  // superclass
+  for (SizeValueType i = 0; i < numberOfPoints; ++i)
+  {
+    outputPoints[i] = this->TransformPoint(inputPoints[i]);
+  }
+}
+
 /** Transform a point, from azimuth-elevation to cartesian */
 template <typename TParametersValueType, unsigned int VDimension>
 typename AzimuthElevationToCartesianTransform<TParametersValueType, VDimension>::OutputPointType
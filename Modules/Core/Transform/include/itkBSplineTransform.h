@@ -20,6 +20,8 @@
 
 #include "itkBSplineBaseTransform.h"
 
+#include <vector>
+
 namespace itk
 {
 /** \class BSplineTransform
@@ -238,10 +240,74 @@ public:
                  ParameterIndexArrayType & indices,
                  bool &                    inside) const override;
 
+  /** Transform a block of points, sharing the weights and indices storage. */
+  void
+  TransformPoints(const InputPointType * inputPoints,
+                  OutputPointType *      outputPoints,
+                  SizeValueType          numberOfPoints) const override;
+
   /** Compute the Jacobian in one position. */
   void
   ComputeJacobianWithRespectToParameters(const InputPointType &, JacobianType &) const override;
 
+  /** \brief Per axis B-spline weights of the points of a regular grid.
+   *
+   * The B-spline weights are separable: when the axes of a sampling grid,
+   * e.g. the virtual domain of a registration metric, are aligned with those
+   * of the control point grid, the weights at a grid point are products of
+   * per axis weights which only depend on one of its indices. These per axis
+   * weights are computed once by ComputeGridWeights(), after which
+   * TransformPointAtGridIndex() and
+   * ComputeJacobianWithRespectToParametersAtGridIndex() evaluate the
+   * transform at the grid points without evaluating the B-spline kernel.
+   *
+   * The tables only depend on the fixed parameters of the transform, so they
+   * remain valid when its parameters are updated. The grid index passed to
+   * the methods using them must lie in the region given to
+   * ComputeGridWeights(), otherwise an exception is thrown.
+   *
+   * These methods must be called explicitly: the image to image metrics map
+   * their virtual points through TransformPoints() and
+   * ComputeJacobianWithRespectToParameters(), and do not use the tables. */
+  struct GridWeightsType
+  {
+    using AxisWeightsType = FixedArray<double, VSplineOrder + 1>;
+
+    IndexType                    m_StartIndex;
+    std::vector<IndexValueType>  m_SupportIndex[VDimension];
+    std::vector<AxisWeightsType> m_Weights[VDimension];
+    std::vector<bool>            m_Inside[VDimension];
+  };
+
+  /** Compute the per axis weights of the points of the region of a grid.
+   * Returns false, leaving gridWeights unchanged, when the grid axes are not
+   * aligned with those of the control point grid. */
+  bool
+  ComputeGridWeights(const ImageBase<VDimension> * grid,
+                     const RegionType &            region,
+                     GridWeightsType &             gridWeights) const;
+
+  /** Same as TransformPoint(point, outputPoint, weights, indices, inside),
+   * for the point of a grid at the given index, using the weights computed
+   * by ComputeGridWeights() for this grid. The result only differs from that
+   * of TransformPoint by the rounding of the continuous index of the point. */
+  void
+  TransformPointAtGridIndex(const GridWeightsType &   gridWeights,
+                            const IndexType &         gridIndex,
+                            const InputPointType &    point,
+                            OutputPointType &         outputPoint,
+                            WeightsType &             weights,
+                            ParameterIndexArrayType & indices,
+                            bool &                    inside) const;
+
+  /** Same as ComputeJacobianWithRespectToParameters, for the point of a grid
+   * at the given index, using the weights computed by ComputeGridWeights()
+   * for this grid. */
+  void
+  ComputeJacobianWithRespectToParametersAtGridIndex(const GridWeightsType & gridWeights,
+                                                    const IndexType &       gridIndex,
+                                                    JacobianType &          jacobian) const;
+
   /** Return the number of parameters that completely define the Transfom. */
   NumberOfParametersType
   GetNumberOfParameters() const override;
@@ -315,6 +381,36 @@ private:
   bool
   InsideValidRegion(ContinuousIndexType &) const override;
 
+  /** Check if a continuous index value is inside the valid region along an
+   * axis, nudging it inside when it is on the upper bound. */
+  bool
+  InsideValidInterval(unsigned int axis, ScalarType & indexValue) const;
+
+  /** Get the weights and support region at a grid index from the per axis
+   * weights. Returns false if the point is outside the valid region. Throws
+   * an exception if the grid index is outside the region of the tables. */
+  bool
+  ComputeWeightsAtGridIndex(const GridWeightsType & gridWeights,
+                            const IndexType &       gridIndex,
+                            WeightsType &           weights,
+                            IndexType &             supportIndex) const;
+
+  /** Add the displacement given by weights over the support region to a
+   * point, and return the parameter indices of the support region. */
+  void
+  TransformPointUsingWeights(const InputPointType &    point,
+                             const WeightsType &       weights,
+                             const IndexType &         supportIndex,
+                             OutputPointType &         outputPoint,
+                             ParameterIndexArrayType & indices) const;
+
+  /** Set the Jacobian of the weights over the support region. The Jacobian
+   * must already be sized and filled with zeros. */
+  void
+  ComputeJacobianUsingWeights(const WeightsType & weights,
+                              const IndexType &   supportIndex,
+                              JacobianType &      jacobian) const;
+
   void
   SetFixedParametersFromCoefficientImageInformation();
 
@@ -19,10 +19,12 @@
 #define itkBSplineTransform_hxx
 
 
+#include "itkBSplineKernelFunction.h"
 #include "itkContinuousIndex.h"
-#include "itkImageScanlineConstIterator.h"
 #include "itkImageRegionConstIteratorWithIndex.h"
 
+#include <cmath>
+
 namespace itk
 {
 
@@ -481,32 +483,35 @@ template <typename TParametersValueType, unsigned int VDimension, unsigned int V
 bool
 BSplineTransform<TParametersValueType, VDimension, VSplineOrder>::InsideValidRegion(ContinuousIndexType & index) const
 {
-  const SizeType gridSize = this->m_CoefficientImages[0]->GetLargestPossibleRegion().GetSize();
-
-  const ScalarType minLimit = 0.5 * static_cast<ScalarType>(SplineOrder - 1);
-
-  // Needed so that index can be changed
-  bool inside = true;
   for (unsigned int j = 0; j < SpaceDimension; ++j)
   {
-    const ScalarType maxLimit =
-      static_cast<ScalarType>(gridSize[j]) - 0.5 * static_cast<ScalarType>(SplineOrder - 1) - 1.0;
-    if (Math::FloatAlmostEqual(index[j], maxLimit, 4))
-    {
-      index[j] = Math::FloatAddULP(maxLimit, -6);
-    }
-    else if (index[j] >= maxLimit)
-    {
-      inside = false;
-      break;
-    }
-    else if (index[j] < minLimit)
+    if (!this->InsideValidInterval(j, index[j]))
     {
-      inside = false;
-      break;
+      return false;
     }
   }
-  return inside;
+  return true;
+}
+
+template <typename TParametersValueType, unsigned int VDimension, unsigned int VSplineOrder>
+bool
+BSplineTransform<TParametersValueType, VDimension, VSplineOrder>::InsideValidInterval(unsigned int axis,
+                                                                                      ScalarType & indexValue) const
+{
+  const SizeValueType gridSize = this->m_CoefficientImages[0]->GetLargestPossibleRegion().GetSize(axis);
+
+  const ScalarType minLimit = 0.5 * static_cast<ScalarType>(SplineOrder - 1);
+  const ScalarType maxLimit =
+    static_cast<ScalarType>(gridSize) - 0.5 * static_cast<ScalarType>(SplineOrder - 1) - 1.0;
+  if (Math::FloatAlmostEqual(indexValue, maxLimit, 4))
+  {
+    indexValue = Math::FloatAddULP(maxLimit, -6);
+  }
+  else if (indexValue >= maxLimit || indexValue < minLimit)
+  {
+    return false;
+  }
+  return true;
 }
 
 template <typename TParametersValueType, unsigned int VDimension, unsigned int VSplineOrder>
@@ -538,62 +543,83 @@ BSplineTransform<TParametersValueType, VDimension, VSplineOrder>::TransformPoint
     // Compute interpolation weights
     this->m_WeightsFunction->Evaluate(index, weights, supportIndex);
 
-    // For each dimension, correlate coefficient with weights
-    SizeType supportSize;
-    supportSize.Fill(SplineOrder + 1);
-    const RegionType supportRegion(supportIndex, supportSize);
-
-    outputPoint.Fill(NumericTraits<ScalarType>::ZeroValue());
-
-    using IteratorType = ImageScanlineConstIterator<ImageType>;
-    IteratorType                coeffIterator[SpaceDimension];
-    unsigned long               counter = 0;
-    const ParametersValueType * basePointer = this->m_CoefficientImages[0]->GetBufferPointer();
+    this->TransformPointUsingWeights(point, weights, supportIndex, outputPoint, indices);
+  }
+  else
+  {
+    itkWarningMacro("B-spline coefficients have not been set");
     for (unsigned int j = 0; j < SpaceDimension; ++j)
     {
-      coeffIterator[j] = IteratorType(this->m_CoefficientImages[j], supportRegion);
+      outputPoint[j] = point[j];
     }
+  }
+}
 
-    while (!coeffIterator[0].IsAtEnd())
+template <typename TParametersValueType, unsigned int VDimension, unsigned int VSplineOrder>
+void
+BSplineTransform<TParametersValueType, VDimension, VSplineOrder>::TransformPointUsingWeights(
+  const InputPointType &    point,
+  const WeightsType &       weights,
+  const IndexType &         supportIndex,
+  OutputPointType &         outputPoint,
+  ParameterIndexArrayType & indices) const
+{
+  // For each dimension, correlate coefficient with weights. The support
+  // region is walked directly in the buffers, in the order of a scanline
+  // iterator, all the coefficient images having the same buffered region.
+  outputPoint.Fill(NumericTraits<ScalarType>::ZeroValue());
+
+  const ParametersValueType * coefficients[SpaceDimension];
+  for (unsigned int j = 0; j < SpaceDimension; ++j)
+  {
+    coefficients[j] = this->m_CoefficientImages[j]->GetBufferPointer();
+  }
+  const OffsetValueType * offsetTable = this->m_CoefficientImages[0]->GetOffsetTable();
+
+  OffsetValueType offset = this->m_CoefficientImages[0]->ComputeOffset(supportIndex);
+  unsigned int    position[SpaceDimension] = {};
+  for (unsigned long counter = 0; counter < Self::NumberOfWeights; ++counter)
+  {
+    // Multiply weigth with coefficient
+    for (unsigned int j = 0; j < SpaceDimension; ++j)
     {
-      while (!coeffIterator[0].IsAtEndOfLine())
-      {
-        // Multiply weigth with coefficient
-        for (unsigned int j = 0; j < SpaceDimension; ++j)
-        {
-          outputPoint[j] += static_cast<ScalarType>(weights[counter] * coeffIterator[j].Get());
-        }
-
-        // Populate the indices array
-        indices[counter] = &(coeffIterator[0].Value()) - basePointer;
-
-        // Go to next coefficient in the support region
-        ++counter;
-        for (unsigned int j = 0; j < SpaceDimension; ++j)
-        {
-          ++(coeffIterator[j]);
-        }
-      } // end scanline
-
-      for (unsigned int j = 0; j < SpaceDimension; ++j)
-      {
-        coeffIterator[j].NextLine();
-      }
+      outputPoint[j] += static_cast<ScalarType>(weights[counter] * coefficients[j][offset]);
     }
 
-    // Return results
-    for (unsigned int j = 0; j < SpaceDimension; ++j)
+    // Populate the indices array
+    indices[counter] = offset;
+
+    // Go to next coefficient in the support region
+    ++offset;
+    for (unsigned int d = 0; d + 1 < SpaceDimension && ++position[d] > SplineOrder; ++d)
     {
-      outputPoint[j] += point[j];
+      position[d] = 0;
+      offset += offsetTable[d + 1] - (SplineOrder + 1) * offsetTable[d];
     }
   }
-  else
+
+  // Return results
+  for (unsigned int j = 0; j < SpaceDimension; ++j)
   {
-    itkWarningMacro("B-spline coefficients have not been set");
-    for (unsigned int j = 0; j < SpaceDimension; ++j)
-    {
-      outputPoint[j] = point[j];
-    }
+    outputPoint[j] += point[j];
+  }
+}
+
+template <typename TParametersValueType, unsigned int VDimension, unsigned int VSplineOrder>
+void
+BSplineTransform<TParametersValueType, VDimension, VSplineOrder>::TransformPoints(const InputPointType * inputPoints,
+                                                                                  OutputPointType *      outputPoints,
+                                                                                  SizeValueType numberOfPoints) const
+{
+  WeightsType             weights;
+  ParameterIndexArrayType indices;
+  OutputPointType         outputPoint;
+  bool                    inside;
+
+  for (SizeValueType i = 0; i < numberOfPoints; ++i)
+  {
+    this->BSplineTransform::TransformPoint(inputPoints[i], outputPoint, weights, indices, inside);
+    outputPoints[i] = outputPoint;
   }
 }
 
@@ -606,8 +632,6 @@ BSplineTransform<TParametersValueType, VDimension, VSplineOrder>::ComputeJacobia
   // Zero all components of jacobian
   jacobian.SetSize(SpaceDimension, this->GetNumberOfParameters());
   jacobian.Fill(0.0);
-  SizeType supportSize;
-  supportSize.Fill(SplineOrder + 1);
 
   ContinuousIndexType index =
     this->m_CoefficientImages[0]
@@ -627,6 +651,18 @@ BSplineTransform<TParametersValueType, VDimension, VSplineOrder>::ComputeJacobia
   IndexType supportIndex;
   this->m_WeightsFunction->Evaluate(index, weights, supportIndex);
 
+  this->ComputeJacobianUsingWeights(weights, supportIndex, jacobian);
+}
+
+template <typename TParametersValueType, unsigned int VDimension, unsigned int VSplineOrder>
+void
+BSplineTransform<TParametersValueType, VDimension, VSplineOrder>::ComputeJacobianUsingWeights(
+  const WeightsType & weights,
+  const IndexType &   supportIndex,
+  JacobianType &      jacobian) const
+{
+  SizeType supportSize;
+  supportSize.Fill(SplineOrder + 1);
   const RegionType supportRegion(supportIndex, supportSize);
 
   IndexType startIndex = this->m_CoefficientImages[0]->GetLargestPossibleRegion().GetIndex();
@@ -661,6 +697,179 @@ BSplineTransform<TParametersValueType, VDimension, VSplineOrder>::ComputeJacobia
   }
 }
 
+template <typename TParametersValueType, unsigned int VDimension, unsigned int VSplineOrder>
+bool
+BSplineTransform<TParametersValueType, VDimension, VSplineOrder>::ComputeGridWeights(
+  const ImageBase<VDimension> * grid,
+  const RegionType &            region,
+  GridWeightsType &             gridWeights) const
+{
+  // The grid is aligned with the control point grid when the continuous
+  // index along each axis of the latter only depends on the grid index
+  // along the same axis, up to a negligible fraction of a control point
+  // over the region.
+  const ImageType * coefficientImage = this->m_CoefficientImages[0];
+  const auto        indexOfGridPoint = [grid, coefficientImage](const IndexType & gridIndex) {
+    return coefficientImage->template TransformPhysicalPointToContinuousIndex<double>(
+      grid->template TransformIndexToPhysicalPoint<double>(gridIndex));
+  };
+  const ContinuousIndex<double, VDimension> startIndex = indexOfGridPoint(region.GetIndex());
+  double                                    misalignment[VDimension] = {};
+  for (unsigned int j = 0; j < SpaceDimension; ++j)
+  {
+    IndexType nextIndex = region.GetIndex();
+    ++nextIndex[j];
+    const ContinuousIndex<double, VDimension> next = indexOfGridPoint(nextIndex);
+    for (unsigned int i = 0; i < SpaceDimension; ++i)
+    {
+      if (i != j)
+      {
+        misalignment[i] += std::abs(next[i] - startIndex[i]) * static_cast<double>(region.GetSize(j));
+      }
+    }
+  }
+  for (unsigned int i = 0; i < SpaceDimension; ++i)
+  {
+    if (misalignment[i] > 1e-6)
+    {
+      return false;
+    }
+  }
+
+  gridWeights.m_StartIndex = region.GetIndex();
+  for (unsigned int i = 0; i < SpaceDimension; ++i)
+  {
+    const SizeValueType size = region.GetSize(i);
+    gridWeights.m_SupportIndex[i].resize(size);
+    gridWeights.m_Weights[i].resize(size);
+    gridWeights.m_Inside[i].resize(size);
+
+    IndexType gridIndex = region.GetIndex();
+    for (SizeValueType n = 0; n < size; ++n, ++gridIndex[i])
+    {
+      InputPointType point;
+      point.CastFrom(grid->template TransformIndexToPhysicalPoint<double>(gridIndex));
+      ScalarType indexValue = this->m_CoefficientImages[0]
+                                ->template TransformPhysicalPointToContinuousIndex<ScalarType>(point)[i];
+
+      // Same computations as the weights function, along one axis
+      gridWeights.m_Inside[i][n] = this->InsideValidInterval(i, indexValue);
+      const IndexValueType supportIndex = Math::Floor<IndexValueType>(indexValue + 0.5 - SplineOrder / 2.0);
+      gridWeights.m_SupportIndex[i][n] = supportIndex;
+
+      double x = indexValue - static_cast<double>(supportIndex);
+      for (unsigned int k = 0; k <= SplineOrder; ++k)
+      {
+        gridWeights.m_Weights[i][n][k] = BSplineKernelFunction<SplineOrder>::FastEvaluate(x);
+        x -= 1.0;
+      }
+    }
+  }
+  return true;
+}
+
+template <typename TParametersValueType, unsigned int VDimension, unsigned int VSplineOrder>
+bool
+BSplineTransform<TParametersValueType, VDimension, VSplineOrder>::ComputeWeightsAtGridIndex(
+  const GridWeightsType & gridWeights,
+  const IndexType &       gridIndex,
+  WeightsType &           weights,
+  IndexType &             supportIndex) const
+{
+  // Offsets of the grid index in the tables. Negative offsets wrap around to
+  // large values, and fail the check as well.
+  SizeValueType offsetInTables[SpaceDimension];
+  for (unsigned int j = 0; j < SpaceDimension; ++j)
+  {
+    offsetInTables[j] = static_cast<SizeValueType>(gridIndex[j] - gridWeights.m_StartIndex[j]);
+    if (offsetInTables[j] >= gridWeights.m_Inside[j].size())
+    {
+      itkExceptionMacro("Grid index " << gridIndex << " is outside the region of the grid weights, which starts at "
+                                      << gridWeights.m_StartIndex << ".");
+    }
+  }
+
+  const typename GridWeightsType::AxisWeightsType * axisWeights[SpaceDimension];
+  for (unsigned int j = 0; j < SpaceDimension; ++j)
+  {
+    const SizeValueType n = offsetInTables[j];
+    if (!gridWeights.m_Inside[j][n])
+    {
+      return false;
+    }
+    supportIndex[j] = gridWeights.m_SupportIndex[j][n];
+    axisWeights[j] = &gridWeights.m_Weights[j][n];
+  }
+
+  // Products of the per axis weights, the first axis varying fastest
+  unsigned int offset[SpaceDimension] = {};
+  for (unsigned int k = 0; k < WeightsType::Length; ++k)
+  {
+    weights[k] = 1.0;
+    for (unsigned int j = 0; j < SpaceDimension; ++j)
+    {
+      weights[k] *= (*axisWeights[j])[offset[j]];
+    }
+    for (unsigned int j = 0; j < SpaceDimension && ++offset[j] > SplineOrder; ++j)
+    {
+      offset[j] = 0;
+    }
+  }
+  return true;
+}
+
+template <typename TParametersValueType, unsigned int VDimension, unsigned int VSplineOrder>
+void
+BSplineTransform<TParametersValueType, VDimension, VSplineOrder>::TransformPointAtGridIndex(
+  const GridWeightsType &   gridWeights,
+  const IndexType &         gridIndex,
+  const InputPointType &    point,
+  OutputPointType &         outputPoint,
+  WeightsType &             weights,
+  ParameterIndexArrayType & indices,
+  bool &                    inside) const
+{
+  inside = true;
+
+  if (!this->m_CoefficientImages[0]->GetBufferPointer())
+  {
+    itkWarningMacro("B-spline coefficients have not been set");
+    outputPoint = point;
+    return;
+  }
+
+  IndexType supportIndex;
+  inside = this->ComputeWeightsAtGridIndex(gridWeights, gridIndex, weights, supportIndex);
+  if (!inside)
+  {
+    outputPoint = point;
+    return;
+  }
+
+  this->TransformPointUsingWeights(point, weights, supportIndex, outputPoint, indices);
+}
+
+template <typename TParametersValueType, unsigned int VDimension, unsigned int VSplineOrder>
+void
+BSplineTransform<TParametersValueType, VDimension, VSplineOrder>::ComputeJacobianWithRespectToParametersAtGridIndex(
+  const GridWeightsType & gridWeights,
+  const IndexType &       gridIndex,
+  JacobianType &          jacobian) const
+{
+  // Zero all components of jacobian
+  jacobian.SetSize(SpaceDimension, this->GetNumberOfParameters());
+  jacobian.Fill(0.0);
+
+  WeightsType weights;
+  IndexType   supportIndex;
+  if (!this->ComputeWeightsAtGridIndex(gridWeights, gridIndex, weights, supportIndex))
+  {
+    return;
+  }
+
+  this->ComputeJacobianUsingWeights(weights, supportIndex, jacobian);
+}
+
 template <typename TParametersValueType, unsigned int VDimension, unsigned int VSplineOrder>
 void
 BSplineTransform<TParametersValueType, VDimension, VSplineOrder>::PrintSelf(std::ostream & os, Indent indent) const
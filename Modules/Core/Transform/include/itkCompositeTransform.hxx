@@ -18,6 +18,7 @@
 #ifndef itkCompositeTransform_hxx
 #define itkCompositeTransform_hxx
 
+#include <algorithm>
 
 namespace itk
 {
@@ -81,6 +82,25 @@ CompositeTransform<TParametersValueType, VDimension>::TransformPoint(const Input
 }
 
 
+template <typename TParametersValueType, unsigned int VDimension>
+void
+CompositeTransform<TParametersValueType, VDimension>::TransformPoints(const InputPointType * inputPoints,
+                                                                      OutputPointType *      outputPoints,
+                                                                      SizeValueType          numberOfPoints) const
+{
+  if (outputPoints != inputPoints)
+  {
+    std::copy(inputPoints, inputPoints + numberOfPoints, outputPoints);
+  }
+
+  /* Apply in reverse queue order, in place.  */
+  for (auto it = this->m_TransformQueue.rbegin(); it != this->m_TransformQueue.rend(); ++it)
+  {
+    (*it)->TransformPoints(outputPoints, outputPoints, numberOfPoints);
+  }
+}
+
+
 template <typename TParametersValueType, unsigned int VDimension>
 auto
 CompositeTransform<TParametersValueType, VDimension>::TransformVector(const InputVectorType & inputVector) const
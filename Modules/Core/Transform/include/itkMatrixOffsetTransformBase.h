@@ -394,6 +394,13 @@ public:
   OutputPointType
   TransformPoint(const InputPointType & point) const override;
 
+  /** Transform a block of points by applying the matrix and the offset.
+   * The subclasses which override TransformPoint override this method too. */
+  void
+  TransformPoints(const InputPointType * inputPoints,
+                  OutputPointType *      outputPoints,
+                  SizeValueType          numberOfPoints) const override;
+
   using Superclass::TransformVector;
 
   OutputVectorType
@@ -137,6 +137,20 @@ MatrixOffsetTransformBase<TParametersValueType, VInputDimension, VOutputDimensio
 }
 
 
+template <typename TParametersValueType, unsigned int VInputDimension, unsigned int VOutputDimension>
+void
+MatrixOffsetTransformBase<TParametersValueType, VInputDimension, VOutputDimension>::TransformPoints(
+  const InputPointType * inputPoints,
+  OutputPointType *      outputPoints,
+  SizeValueType          numberOfPoints) const
+{
+  for (SizeValueType i = 0; i < numberOfPoints; ++i)
+  {
+    outputPoints[i] = m_Matrix * inputPoints[i] + m_Offset;
+  }
+}
+
+
 template <typename TParametersValueType, unsigned int VInputDimension, unsigned int VOutputDimension>
 typename MatrixOffsetTransformBase<TParametersValueType, VInputDimension, VOutputDimension>::OutputVectorType
 MatrixOffsetTransformBase<TParametersValueType, VInputDimension, VOutputDimension>::TransformVector(
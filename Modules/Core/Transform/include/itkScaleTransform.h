@@ -155,6 +155,11 @@ public:
   OutputPointType
   TransformPoint(const InputPointType & point) const override;
 
+  void
+  TransformPoints(const InputPointType * inputPoints,
+                  OutputPointType *      outputPoints,
+                  SizeValueType          numberOfPoints) const override;
+
   using Superclass::TransformVector;
   OutputVectorType
   TransformVector(const InputVectorType & vect) const override;
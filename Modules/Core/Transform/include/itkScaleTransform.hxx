@@ -117,6 +117,25 @@ ScaleTransform<TParametersValueType, VDimension>::TransformPoint(const InputPoin
 }
 
 
+template <typename TParametersValueType, unsigned int VDimension>
+void
+ScaleTransform<TParametersValueType, VDimension>::TransformPoints(const InputPointType * inputPoints,
+                                                                  OutputPointType *      outputPoints,
+                                                                  SizeValueType          numberOfPoints) const
+{
+  const InputPointType & center = this->GetCenter();
+
+  for (SizeValueType k = 0; k < numberOfPoints; ++k)
+  {
+    const InputPointType point = inputPoints[k];
+    for (unsigned int i = 0; i < SpaceDimension; ++i)
+    {
+      outputPoints[k][i] = (point[i] - center[i]) * m_Scale[i] + center[i];
+    }
+  }
+}
+
+
 template <typename TParametersValueType, unsigned int VDimension>
 auto
 ScaleTransform<TParametersValueType, VDimension>::TransformVector(const InputVectorType & vect) const
@@ -71,6 +71,13 @@ namespace itk
  *                                                             const InputPointType & x,
  *                                                             JacobianPositionType &jacobian ) const;<br>
  *
+ * Subclasses may also override TransformPoints to map blocks of points
+ * faster than one point at a time. Such overrides do not call the virtual
+ * TransformPoint, so a subclass which overrides TransformPoint must also
+ * override TransformPoints, unless none of its superclasses overrides it.
+ * This applies to the subclasses of MatrixOffsetTransformBase,
+ * BSplineTransform, DisplacementFieldTransform and CompositeTransform.
+ *
  * Since TranformVector and TransformCovariantVector have multiple
  * overloaded methods from the base class, subclasses must specify:<br>
  *  using Superclass::TransformVector;<br>
@@ -180,6 +187,17 @@ public:
   virtual OutputPointType
   TransformPoint(const InputPointType &) const = 0;
 
+  /** Method to transform a block of points, which is equivalent to calling
+   * TransformPoint on each of them but only costs one virtual call, and lets
+   * transforms hoist their per point overhead out of the loop. When the input
+   * and output spaces have the same dimension, outputPoints may be
+   * inputPoints to transform the points in place.
+   * \warning This method must be thread-safe. */
+  virtual void
+  TransformPoints(const InputPointType * inputPoints,
+                  OutputPointType *      outputPoints,
+                  SizeValueType          numberOfPoints) const;
+
   /**  Method to transform a vector. */
   virtual OutputVectorType
   TransformVector(const InputVectorType &) const
@@ -121,6 +121,19 @@ Transform<TParametersValueType, VInputDimension, VOutputDimension>::UpdateTransf
 }
 
 
+template <typename TParametersValueType, unsigned int VInputDimension, unsigned int VOutputDimension>
+void
+Transform<TParametersValueType, VInputDimension, VOutputDimension>::TransformPoints(
+  const InputPointType * inputPoints,
+  OutputPointType *      outputPoints,
+  SizeValueType          numberOfPoints) const
+{
+  for (SizeValueType i = 0; i < numberOfPoints; ++i)
+  {
+    outputPoints[i] = this->TransformPoint(inputPoints[i]);
+  }
+}
+
 template <typename TParametersValueType, unsigned int VInputDimension, unsigned int VOutputDimension>
 typename Transform<TParametersValueType, VInputDimension, VOutputDimension>::OutputVectorType
 Transform<TParametersValueType, VInputDimension, VOutputDimension>::TransformVector(const InputVectorType & vector,
@@ -21,6 +21,7 @@
 #include "itkBSplineTransform.h"
 
 #include "itkImageRegionConstIterator.h"
+#include "itkIndexRange.h"
 
 namespace
 {
@@ -205,3 +206,105 @@ TEST(ITKBSplineTransform, NumberOfWeights)
   testNumberOfWeights(*itk::BSplineTransform<float, 2>::New());
   testNumberOfWeights(*itk::BSplineTransform<float, 2, 2>::New());
 }
+
+
+TEST(ITKBSplineTransform, GridWeights)
+{
+  using BSplineType = itk::BSplineTransform<double, 3, 3>;
+  auto bspline = BSplineType::New();
+
+  BSplineType::OriginType origin;
+  origin.Fill(-2.0);
+  BSplineType::PhysicalDimensionsType dimensions;
+  dimensions.Fill(10.0);
+  BSplineType::MeshSizeType meshSize;
+  meshSize.Fill(4);
+  bspline->SetTransformDomainOrigin(origin);
+  bspline->SetTransformDomainPhysicalDimensions(dimensions);
+  bspline->SetTransformDomainMeshSize(meshSize);
+
+  BSplineType::ParametersType parameters(bspline->GetNumberOfParameters());
+  for (unsigned int i = 0; i < parameters.size(); ++i)
+  {
+    parameters[i] = 0.1 * std::sin(1.7 * i);
+  }
+  bspline->SetParameters(parameters);
+
+  // A grid that extends beyond the transform domain, so that some of its
+  // points are outside the valid region
+  using GridType = itk::Image<float, 3>;
+  auto                 grid = GridType::New();
+  GridType::RegionType region;
+  region.SetIndex(itk::MakeIndex(3, -2, 0));
+  region.SetSize(itk::MakeSize(9, 7, 8));
+  grid->SetRegions(region);
+  grid->SetOrigin(itk::MakePoint(-1.3, 0.2, 0.1));
+  grid->SetSpacing(itk::MakeVector(1.1, 1.3, 1.7));
+
+  BSplineType::GridWeightsType gridWeights;
+  ASSERT_TRUE(bspline->ComputeGridWeights(grid, region, gridWeights));
+
+  BSplineType::WeightsType             weights;
+  BSplineType::WeightsType             gridPointWeights;
+  BSplineType::ParameterIndexArrayType indices;
+  BSplineType::ParameterIndexArrayType gridPointIndices;
+  BSplineType::JacobianType            jacobian;
+  BSplineType::JacobianType            gridPointJacobian;
+  unsigned int                         numberOfInsidePoints = 0;
+  for (const auto & index : itk::ImageRegionIndexRange<3>(region))
+  {
+    const BSplineType::InputPointType point = grid->TransformIndexToPhysicalPoint<double>(index);
+    BSplineType::OutputPointType      outputPoint;
+    BSplineType::OutputPointType      gridOutputPoint;
+    bool                              inside;
+    bool                              gridPointInside;
+    bspline->TransformPoint(point, outputPoint, weights, indices, inside);
+    bspline->TransformPointAtGridIndex(
+      gridWeights, index, point, gridOutputPoint, gridPointWeights, gridPointIndices, gridPointInside);
+
+    ASSERT_EQ(inside, gridPointInside) << index;
+    for (unsigned int d = 0; d < 3; ++d)
+    {
+      EXPECT_NEAR(outputPoint[d], gridOutputPoint[d], 1e-12) << index;
+    }
+    if (inside)
+    {
+      ++numberOfInsidePoints;
+      EXPECT_EQ(indices, gridPointIndices) << index;
+      for (unsigned int k = 0; k < BSplineType::NumberOfWeights; ++k)
+      {
+        EXPECT_NEAR(weights[k], gridPointWeights[k], 1e-12) << index;
+      }
+    }
+
+    bspline->ComputeJacobianWithRespectToParameters(point, jacobian);
+    bspline->ComputeJacobianWithRespectToParametersAtGridIndex(gridWeights, index, gridPointJacobian);
+    EXPECT_LT((jacobian - gridPointJacobian).absolute_value_max(), 1e-12) << index;
+  }
+  EXPECT_GT(numberOfInsidePoints, 0u);
+  EXPECT_LT(numberOfInsidePoints, region.GetNumberOfPixels());
+
+  // Indices outside the region of the weights, below or above it, are rejected
+  for (const auto & index : { itk::MakeIndex(2, 0, 0), itk::MakeIndex(3, -2, 8), itk::MakeIndex(12, 4, 7) })
+  {
+    const BSplineType::InputPointType point = grid->TransformIndexToPhysicalPoint<double>(index);
+    BSplineType::OutputPointType      gridOutputPoint;
+    bool                              gridPointInside;
+    EXPECT_THROW(bspline->TransformPointAtGridIndex(
+                   gridWeights, index, point, gridOutputPoint, gridPointWeights, gridPointIndices, gridPointInside),
+                 itk::ExceptionObject)
+      << index;
+    EXPECT_THROW(bspline->ComputeJacobianWithRespectToParametersAtGridIndex(gridWeights, index, gridPointJacobian),
+                 itk::ExceptionObject)
+      << index;
+  }
+
+  // A grid that is rotated with respect to the transform domain has no per axis weights
+  GridType::DirectionType direction;
+  direction.SetIdentity();
+  direction[0][0] = direction[1][1] = std::cos(0.1);
+  direction[0][1] = -std::sin(0.1);
+  direction[1][0] = std::sin(0.1);
+  grid->SetDirection(direction);
+  EXPECT_FALSE(bspline->ComputeGridWeights(grid, region, gridWeights));
+}
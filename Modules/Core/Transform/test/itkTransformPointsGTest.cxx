@@ -0,0 +1,220 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkAffineTransform.h"
+#include "itkAzimuthElevationToCartesianTransform.h"
+#include "itkBSplineTransform.h"
+#include "itkCompositeTransform.h"
+#include "itkEuler3DTransform.h"
+#include "itkMatrixOffsetTransformBase.h"
+#include "itkScaleTransform.h"
+#include "itkTranslationTransform.h"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace
+{
+constexpr unsigned int Dimension = 3;
+
+using TransformType = itk::Transform<double, Dimension, Dimension>;
+using PointType = TransformType::InputPointType;
+
+std::vector<PointType>
+MakePoints()
+{
+  std::vector<PointType> points;
+  for (unsigned int i = 0; i < 37; ++i)
+  {
+    PointType point;
+    point[0] = 0.25 * i - 1.0;
+    point[1] = 2.0 - 0.125 * i;
+    point[2] = 0.5 + 0.0625 * i * i;
+    points.push_back(point);
+  }
+  return points;
+}
+
+// Checks that transforming a block of points, into another buffer or in
+// place, gives exactly the points transformed one at a time.
+void
+ExpectSameAsTransformPoint(const TransformType & transform)
+{
+  const std::vector<PointType> points = MakePoints();
+
+  std::vector<PointType> transformedPoints(points.size());
+  transform.TransformPoints(points.data(), transformedPoints.data(), points.size());
+
+  std::vector<PointType> inPlacePoints = points;
+  transform.TransformPoints(inPlacePoints.data(), inPlacePoints.data(), inPlacePoints.size());
+
+  for (size_t i = 0; i < points.size(); ++i)
+  {
+    const PointType expected = transform.TransformPoint(points[i]);
+    EXPECT_EQ(transformedPoints[i], expected) << transform.GetNameOfClass() << " point " << i;
+    EXPECT_EQ(inPlacePoints[i], expected) << transform.GetNameOfClass() << " in place point " << i;
+  }
+}
+
+itk::AffineTransform<double, Dimension>::Pointer
+MakeAffineTransform()
+{
+  using AffineType = itk::AffineTransform<double, Dimension>;
+  auto                       affine = AffineType::New();
+  AffineType::ParametersType parameters(affine->GetNumberOfParameters());
+  for (unsigned int i = 0; i < parameters.size(); ++i)
+  {
+    parameters[i] = 0.1 * i + ((i % 4 == 0) ? 1.0 : 0.0);
+  }
+  affine->SetParameters(parameters);
+  return affine;
+}
+
+itk::BSplineTransform<double, Dimension, 3>::Pointer
+MakeBSplineTransform()
+{
+  using BSplineType = itk::BSplineTransform<double, Dimension, 3>;
+  auto bspline = BSplineType::New();
+
+  BSplineType::PhysicalDimensionsType dimensions;
+  dimensions.Fill(4.0);
+  BSplineType::OriginType origin;
+  origin.Fill(-1.0);
+  BSplineType::MeshSizeType meshSize;
+  meshSize.Fill(3);
+  bspline->SetTransformDomainOrigin(origin);
+  bspline->SetTransformDomainPhysicalDimensions(dimensions);
+  bspline->SetTransformDomainMeshSize(meshSize);
+
+  BSplineType::ParametersType parameters(bspline->GetNumberOfParameters());
+  for (unsigned int i = 0; i < parameters.size(); ++i)
+  {
+    parameters[i] = 0.01 * static_cast<double>(i % 17) - 0.05;
+  }
+  bspline->SetParametersByValue(parameters);
+  return bspline;
+}
+
+// Transform which shifts the points mapped by its superclass along the first
+// axis. As it overrides TransformPoint, it also overrides TransformPoints.
+template <typename TSuperclass>
+class ShiftedTransform : public TSuperclass
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(ShiftedTransform);
+
+  using Self = ShiftedTransform;
+  using Superclass = TSuperclass;
+  using Pointer = itk::SmartPointer<Self>;
+  using ConstPointer = itk::SmartPointer<const Self>;
+
+  itkNewMacro(Self);
+  itkTypeMacro(ShiftedTransform, TSuperclass);
+
+  using typename Superclass::InputPointType;
+  using typename Superclass::OutputPointType;
+
+  using Superclass::TransformPoint;
+  OutputPointType
+  TransformPoint(const InputPointType & point) const override
+  {
+    OutputPointType result = Superclass::TransformPoint(point);
+    result[0] += 10.0;
+    return result;
+  }
+
+  void
+  TransformPoints(const InputPointType * inputPoints,
+                  OutputPointType *      outputPoints,
+                  itk::SizeValueType     numberOfPoints) const override
+  {
+    Superclass::TransformPoints(inputPoints, outputPoints, numberOfPoints);
+    for (itk::SizeValueType i = 0; i < numberOfPoints; ++i)
+    {
+      outputPoints[i][0] += 10.0;
+    }
+  }
+
+protected:
+  ShiftedTransform() = default;
+  ~ShiftedTransform() override = default;
+};
+} // namespace
+
+
+TEST(TransformPoints, EqualsTransformPoint)
+{
+  auto translation = itk::TranslationTransform<double, Dimension>::New();
+  translation->Translate(itk::MakeVector(1.0, -2.0, 0.5));
+  ExpectSameAsTransformPoint(*translation);
+
+  ExpectSameAsTransformPoint(*MakeAffineTransform());
+
+  auto matrixOffset = itk::MatrixOffsetTransformBase<double, Dimension, Dimension>::New();
+  matrixOffset->SetParameters(MakeAffineTransform()->GetParameters());
+  ExpectSameAsTransformPoint(*matrixOffset);
+
+  auto euler = itk::Euler3DTransform<double>::New();
+  euler->SetRotation(0.1, -0.2, 0.3);
+  euler->SetTranslation(itk::MakeVector(1.0, 2.0, -3.0));
+  ExpectSameAsTransformPoint(*euler);
+
+  auto scale = itk::ScaleTransform<double, Dimension>::New();
+  scale->SetScale(itk::MakeVector(2.0, 0.5, -1.5));
+  scale->SetCenter(itk::MakePoint(0.5, 1.0, -0.25));
+  ExpectSameAsTransformPoint(*scale);
+
+  auto azimuthElevation = itk::AzimuthElevationToCartesianTransform<double, Dimension>::New();
+  azimuthElevation->SetAzimuthElevationToCartesianParameters(1.0, 2.0, 32, 32);
+  ExpectSameAsTransformPoint(*azimuthElevation);
+
+  ExpectSameAsTransformPoint(*MakeBSplineTransform());
+
+  auto composite = itk::CompositeTransform<double, Dimension>::New();
+  composite->AddTransform(MakeAffineTransform());
+  composite->AddTransform(scale);
+  composite->AddTransform(MakeBSplineTransform());
+  ExpectSameAsTransformPoint(*composite);
+}
+
+
+TEST(TransformPoints, EqualsOverriddenTransformPoint)
+{
+  auto affine = ShiftedTransform<itk::AffineTransform<double, Dimension>>::New();
+  affine->SetParameters(MakeAffineTransform()->GetParameters());
+  ExpectSameAsTransformPoint(*affine);
+
+  auto matrixOffset = ShiftedTransform<itk::MatrixOffsetTransformBase<double, Dimension, Dimension>>::New();
+  matrixOffset->SetParameters(MakeAffineTransform()->GetParameters());
+  ExpectSameAsTransformPoint(*matrixOffset);
+
+  auto bspline = ShiftedTransform<itk::BSplineTransform<double, Dimension, 3>>::New();
+  bspline->SetFixedParameters(MakeBSplineTransform()->GetFixedParameters());
+  bspline->SetParametersByValue(MakeBSplineTransform()->GetParameters());
+  ExpectSameAsTransformPoint(*bspline);
+
+  auto composite = ShiftedTransform<itk::CompositeTransform<double, Dimension>>::New();
+  composite->AddTransform(affine);
+  composite->AddTransform(bspline);
+  ExpectSameAsTransformPoint(*composite);
+
+  const PointType point = MakePoints()[3];
+  PointType       transformedPoint;
+  affine->TransformPoints(&point, &transformedPoint, 1);
+  EXPECT_EQ(transformedPoint[0], MakeAffineTransform()->TransformPoint(point)[0] + 10.0);
+}
@@ -114,6 +114,10 @@ public:
   using BaseSamplerType = itk::Statistics::RegionConstrainedSubsampler<PatchSampleType, InputImageRegionType>;
   using BaseSamplerPointer = typename BaseSamplerType::Pointer;
   using InstanceIdentifier = typename BaseSamplerType::InstanceIdentifier;
+  using PatchSampleListPointer = typename ListAdaptorType::Pointer;
+
+  /** Type definition for the buffer offsets of the patch neighbors. */
+  using PatchBufferOffsetsType = std::vector<OffsetValueType>;
 
   /**
    * Type definitions for Riemannian LogMap Eigensystem.
@@ -127,15 +131,30 @@ public:
 
   struct ThreadDataStruct
   {
-    ShortArrayType        validDerivatives;
-    RealArrayType         entropyFirstDerivative;
-    RealArrayType         entropySecondDerivative;
-    ShortArrayType        validNorms;
-    RealArrayType         minNorm;
-    RealArrayType         maxNorm;
-    BaseSamplerPointer    sampler;
-    EigenValuesCacheType  eigenValsCache;
-    EigenVectorsCacheType eigenVecsCache;
+    ShortArrayType         validDerivatives;
+    RealArrayType          entropyFirstDerivative;
+    RealArrayType          entropySecondDerivative;
+    ShortArrayType         validNorms;
+    RealArrayType          minNorm;
+    RealArrayType          maxNorm;
+    BaseSamplerPointer     sampler;
+    PatchSampleListPointer searchList;
+    EigenValuesCacheType   eigenValsCache;
+    EigenVectorsCacheType  eigenVecsCache;
+
+    /** Scratch storage of ComputeGradientJointEntropy, allocated at the first
+     * pixel of the work unit and reused by the following ones. */
+    typename BaseSamplerType::SubsamplePointer              selectedPatches;
+    std::vector<PixelType>                                  currentPatchPixels;
+    std::vector<bool>                                       currentPatchInBounds;
+    std::vector<RealArrayType>                              patchWeightArrays;
+    std::vector<typename InputImageType::InternalPixelType> currentPatchValues;
+    std::vector<RealValueType>                              squaredPatchWeights;
+    std::vector<RealValueType>                              weightedSquares;
+    RealArrayType                                           squaredNorm;
+    RealArrayType                                           centerPatchSquaredNorm;
+    RealArrayType                                           tmpNorm1;
+    RealArrayType                                           tmpNorm2;
   };
 
   /** Set/Get flag indicating whether smooth-disc patch weights should be used.
@@ -428,6 +447,11 @@ protected:
                               BaseSamplerPointer &                sampler,
                               ThreadDataStruct &                  threadData);
 
+  /** Compute the patch buffer offsets used by the contiguous patch-distance
+   * kernel.  Called once per iteration. */
+  virtual void
+  InitializePatchBufferOffsets();
+
   void
   ApplyUpdate() override;
 
@@ -512,6 +536,32 @@ private:
                                                     RealType &                                symMatrixLogMap,
                                                     RealArrayType &                           geodesicDist);
 
+  /** Contiguous patch-distance kernel.  Computes the weighted squared distance
+   * between the in-bounds current patch, cached in currentPatch, and the patch
+   * centered at selectedCenter in the output buffer.  The element-wise products
+   * are written to a flat scratch array that the compiler can vectorize; they are
+   * then accumulated in the same order as the generic path so that results do
+   * not depend on which path is taken. */
+  template <typename TPixel>
+  typename DisableIfMultiComponent<TPixel, RealValueType>::type
+  ComputeContiguousPatchSquaredDistance(const TPixel *                     selectedCenter,
+                                        const std::vector<TPixel> &        currentPatch,
+                                        const std::vector<RealValueType> & squaredWeights,
+                                        std::vector<RealValueType> &       scratch,
+                                        RealValueType &                    centerDifference) const;
+
+  template <typename TPixel>
+  typename EnableIfMultiComponent<TPixel, RealValueType>::type
+  ComputeContiguousPatchSquaredDistance(const TPixel *,
+                                        const std::vector<TPixel> &,
+                                        const std::vector<RealValueType> &,
+                                        std::vector<RealValueType> &,
+                                        RealValueType &) const
+  {
+    // Multi-component pixels always take the generic path.
+    return RealValueType{};
+  }
+
   template <typename TensorValueT>
   void
   Compute3x3EigenAnalysis(const DiffusionTensor3D<TensorValueT> & spdMatrix,
@@ -566,6 +616,9 @@ private:
 
   BaseSamplerPointer                m_Sampler;
   typename ListAdaptorType::Pointer m_SearchSpaceList;
+
+  PatchBufferOffsetsType m_PatchBufferOffsets;
+  bool                   m_UseContiguousPatchDistance{ false };
 };
 } // end namespace itk
 
@@ -279,7 +279,9 @@ PatchBasedDenoisingImageFilter<TInputImage, TOutputImage>::Initialize()
 
   this->EmptyCaches();
 
-  // initialize thread data struct
+  // initialize thread data struct; samplers are cloned lazily by the first
+  // iteration and reused by the following ones
+  m_ThreadData.clear();
   const unsigned int numWorkUnits = this->GetNumberOfWorkUnits();
   for (unsigned int thread = 0; thread < numWorkUnits; ++thread)
   {
@@ -300,6 +302,7 @@ PatchBasedDenoisingImageFilter<TInputImage, TOutputImage>::Initialize()
       newStruct.maxNorm[ic] = 0;
     }
     newStruct.sampler = nullptr;
+    newStruct.searchList = nullptr;
 
     m_ThreadData.push_back(newStruct);
   }
@@ -1337,14 +1340,54 @@ PatchBasedDenoisingImageFilter<TInputImage, TOutputImage>::InitializeIteration()
       m_ThreadData[thread].maxNorm[ic] = 0;
     }
 
-    // Provide a sampler to the thread
-    m_ThreadData[thread].sampler = dynamic_cast<BaseSamplerType *>(m_Sampler->Clone().GetPointer());
-    auto searchList = ListAdaptorType::New();
-    searchList->SetImage(this->m_OutputImage);
-    searchList->SetRadius(radius);
-    m_ThreadData[thread].sampler->SetSeed(thread);
-    m_ThreadData[thread].sampler->SetSample(searchList);
-    m_ThreadData[thread].sampler->SetSampleRegion(searchList->GetRegion());
+    // Provide a sampler to the thread.  The sampler is cloned only once per
+    // update; later iterations reset its seed and sample so that the same
+    // patches are drawn as with a freshly cloned sampler.
+    ThreadDataStruct & threadData = m_ThreadData[thread];
+    if (threadData.sampler.IsNull())
+    {
+      threadData.sampler = dynamic_cast<BaseSamplerType *>(m_Sampler->Clone().GetPointer());
+      threadData.searchList = ListAdaptorType::New();
+    }
+    threadData.searchList->SetImage(this->m_OutputImage);
+    threadData.searchList->SetRadius(radius);
+    threadData.sampler->SetSeed(thread);
+    threadData.sampler->SetSample(threadData.searchList);
+    threadData.sampler->SetSampleRegion(threadData.searchList->GetRegion());
+  }
+
+  this->InitializePatchBufferOffsets();
+}
+
+template <typename TInputImage, typename TOutputImage>
+void
+PatchBasedDenoisingImageFilter<TInputImage, TOutputImage>::InitializePatchBufferOffsets()
+{
+  // The contiguous kernel reads the output buffer directly, so it is only
+  // used for single-component pixels that are stored as themselves.
+  m_UseContiguousPatchDistance =
+    std::is_same<PixelType, typename OutputImageType::InternalPixelType>::value && m_NumPixelComponents == 1 &&
+    this->GetComponentSpace() == Superclass::ComponentSpaceEnum::EUCLIDEAN;
+
+  const PatchRadiusType   radius = this->GetPatchRadiusInVoxels();
+  const unsigned int      lengthPatch = this->GetPatchLengthInVoxels();
+  const OffsetValueType * offsetTable = this->m_OutputImage->GetOffsetTable();
+
+  // Patch neighbors are enumerated in neighborhood order, i.e. with the first
+  // dimension varying fastest.
+  m_PatchBufferOffsets.resize(lengthPatch);
+  for (unsigned int jj = 0; jj < lengthPatch; ++jj)
+  {
+    OffsetValueType bufferOffset = 0;
+    SizeValueType   remainder = jj;
+    for (unsigned int dim = 0; dim < ImageDimension; ++dim)
+    {
+      const SizeValueType diameter = 2 * radius[dim] + 1;
+      bufferOffset += (static_cast<OffsetValueType>(remainder % diameter) - static_cast<OffsetValueType>(radius[dim])) *
+                      offsetTable[dim];
+      remainder /= diameter;
+    }
+    m_PatchBufferOffsets[jj] = bufferOffset;
   }
 }
 
@@ -2150,7 +2193,31 @@ PatchBasedDenoisingImageFilter<TInputImage, TOutputImage>::ComputeGradientJointE
   region.SetIndex(rIndex);
   region.SetSize(rSize);
 
-  typename BaseSamplerType::SubsamplePointer selectedPatches = BaseSamplerType::SubsampleType::New();
+  // The scratch storage of the work unit is allocated at its first pixel.
+  if (threadData.currentPatchPixels.size() != lengthPatch)
+  {
+    const PatchWeightsType patchWeights = this->GetPatchWeights();
+    threadData.selectedPatches = BaseSamplerType::SubsampleType::New();
+    threadData.currentPatchPixels.resize(lengthPatch);
+    threadData.currentPatchInBounds.resize(lengthPatch);
+    threadData.patchWeightArrays.resize(lengthPatch);
+    threadData.currentPatchValues.resize(lengthPatch);
+    threadData.squaredPatchWeights.resize(lengthPatch);
+    threadData.weightedSquares.resize(lengthPatch);
+    for (unsigned int jj = 0; jj < lengthPatch; ++jj)
+    {
+      threadData.patchWeightArrays[jj].SetSize(m_NumIndependentComponents);
+      threadData.patchWeightArrays[jj].Fill(patchWeights[jj]);
+      const RealValueType weight = patchWeights[jj];
+      threadData.squaredPatchWeights[jj] = weight * weight;
+    }
+    threadData.squaredNorm.SetSize(m_NumIndependentComponents);
+    threadData.centerPatchSquaredNorm.SetSize(m_NumIndependentComponents);
+    threadData.tmpNorm1.SetSize(m_NumIndependentComponents);
+    threadData.tmpNorm2.SetSize(m_NumIndependentComponents);
+  }
+
+  typename BaseSamplerType::SubsamplePointer & selectedPatches = threadData.selectedPatches;
 
   sampler->SetRegionConstraint(region);
   sampler->CanSelectQueryOn();
@@ -2158,11 +2225,10 @@ PatchBasedDenoisingImageFilter<TInputImage, TOutputImage>::ComputeGradientJointE
 
   const unsigned int numPatches = selectedPatches->GetTotalFrequency();
 
-  RealType                             centerPatchDifference = m_ZeroPixel;
-  VariableLengthVector<PixelType>      currentPatchVec(lengthPatch);
-  VariableLengthVector<unsigned short> isInBoundsVec(lengthPatch);
-  VariableLengthVector<RealArrayType>  patchWeightVec(lengthPatch);
-  const PatchWeightsType               patchWeights = this->GetPatchWeights();
+  RealType                           centerPatchDifference = m_ZeroPixel;
+  std::vector<PixelType> &           currentPatchVec = threadData.currentPatchPixels;
+  std::vector<bool> &                isInBoundsVec = threadData.currentPatchInBounds;
+  const std::vector<RealArrayType> & patchWeightVec = threadData.patchWeightArrays;
 
   // Store the current patch prior to iterating over the selected patches
   // to avoid repeatedly calling GetPixel for this patch.
@@ -2179,15 +2245,20 @@ PatchBasedDenoisingImageFilter<TInputImage, TOutputImage>::ComputeGradientJointE
   {
     bool isInBounds;
     currentPatchVec[jj] = currentPatch.GetPixel(jj, isInBounds);
-    patchWeightVec[jj].SetSize(m_NumIndependentComponents);
-    patchWeightVec[jj].Fill(patchWeights[jj]);
-    if (isInBounds)
-    {
-      isInBoundsVec[jj] = true;
-    }
-    else
+    isInBoundsVec[jj] = isInBounds;
+  }
+
+  // When the current patch is entirely in bounds and the pixels are scalar,
+  // gather its values into a flat array for the contiguous patch-distance
+  // kernel.
+  using InternalPixelType = typename InputImageType::InternalPixelType;
+  const bool useContiguousKernel = m_UseContiguousPatchDistance && currentPatch.InBounds();
+  if (useContiguousKernel)
+  {
+    const InternalPixelType * currentCenter = currentPatch.GetCenterPointer();
+    for (unsigned int jj = 0; jj < lengthPatch; ++jj)
     {
-      isInBoundsVec[jj] = false;
+      threadData.currentPatchValues[jj] = currentCenter[m_PatchBufferOffsets[jj]];
     }
   }
 
@@ -2204,10 +2275,10 @@ PatchBasedDenoisingImageFilter<TInputImage, TOutputImage>::ComputeGradientJointE
 
   RealType gradientJointEntropy = m_ZeroPixel;
 
-  RealArrayType squaredNorm(m_NumIndependentComponents);
-  RealArrayType centerPatchSquaredNorm(m_NumIndependentComponents);
-  RealArrayType tmpNorm1(m_NumIndependentComponents);
-  RealArrayType tmpNorm2(m_NumIndependentComponents);
+  RealArrayType & squaredNorm = threadData.squaredNorm;
+  RealArrayType & centerPatchSquaredNorm = threadData.centerPatchSquaredNorm;
+  RealArrayType & tmpNorm1 = threadData.tmpNorm1;
+  RealArrayType & tmpNorm2 = threadData.tmpNorm2;
 
   bool useCachedComputations = false;
 
@@ -2223,7 +2294,20 @@ PatchBasedDenoisingImageFilter<TInputImage, TOutputImage>::ComputeGradientJointE
 
     squaredNorm.Fill(0.0);
     // Compute difference between selectedPatches[ii] and currentPatch
-    if (currentPatch.InBounds())
+    if (useContiguousKernel)
+    {
+      // The selected patch is at least as in bounds as the current patch, so
+      // its neighbors can be read straight from the buffer.
+      selectedPatch.NeedToUseBoundaryConditionOff();
+      RealValueType centerDifference;
+      squaredNorm[0] = this->ComputeContiguousPatchSquaredDistance(selectedPatch.GetCenterPointer(),
+                                                                   threadData.currentPatchValues,
+                                                                   threadData.squaredPatchWeights,
+                                                                   threadData.weightedSquares,
+                                                                   centerDifference);
+      this->SetComponent(centerPatchDifference, 0, centerDifference);
+    }
+    else if (currentPatch.InBounds())
     {
       // since we make sure that the search query can only take place in a
       // certain image region.
@@ -2369,6 +2453,44 @@ PatchBasedDenoisingImageFilter<TInputImage, TOutputImage>::ComputeGradientJointE
   return gradientJointEntropy;
 }
 
+template <typename TInputImage, typename TOutputImage>
+template <typename TPixel>
+auto
+PatchBasedDenoisingImageFilter<TInputImage, TOutputImage>::ComputeContiguousPatchSquaredDistance(
+  const TPixel *                     selectedCenter,
+  const std::vector<TPixel> &        currentPatch,
+  const std::vector<RealValueType> & squaredWeights,
+  std::vector<RealValueType> &       scratch,
+  RealValueType &                    centerDifference) const
+  -> typename DisableIfMultiComponent<TPixel, RealValueType>::type
+{
+  const auto              lengthPatch = static_cast<unsigned int>(currentPatch.size());
+  const unsigned int      center = (lengthPatch - 1) / 2;
+  const OffsetValueType * offsets = m_PatchBufferOffsets.data();
+  const TPixel *          current = currentPatch.data();
+  const RealValueType *   weights = squaredWeights.data();
+  RealValueType *         weightedSquares = scratch.data();
+
+  // Element-wise pass without dependencies between iterations.
+  for (unsigned int jj = 0; jj < lengthPatch; ++jj)
+  {
+    const RealValueType diff = selectedCenter[offsets[jj]] - current[jj];
+    weightedSquares[jj] = weights[jj] * diff * diff;
+  }
+
+  // Accumulate symmetric pairs and then the center, as the generic path does.
+  RealValueType squaredNorm = 0.0;
+  for (unsigned int jj = 0, kk = center + 1; jj < center; ++jj, ++kk)
+  {
+    squaredNorm += weightedSquares[jj];
+    squaredNorm += weightedSquares[kk];
+  }
+  squaredNorm += weightedSquares[center];
+
+  centerDifference = selectedCenter[offsets[center]] - current[center];
+  return squaredNorm;
+}
+
 template <typename TInputImage, typename TOutputImage>
 void
 PatchBasedDenoisingImageFilter<TInputImage, TOutputImage>::PostProcessOutput()
@@ -0,0 +1,147 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkCompositeTransformFlattener_h
+#define itkCompositeTransformFlattener_h
+
+#include "itkCompositeTransform.h"
+#include "itkDisplacementFieldTransform.h"
+
+namespace itk
+{
+/** \class CompositeTransformFlattener
+ * \brief Flatten a composite transform into a single displacement field transform.
+ *
+ * A CompositeTransform made of several displacement field or B-spline
+ * transforms evaluates each of them, and interpolates each field, at every
+ * call of TransformPoint(). This class samples the composite transform, or
+ * a range of its queue, on the grid of a reference image and stores the
+ * result in a single DisplacementFieldTransform, so that transforming a
+ * point costs one field lookup instead of one per sub-transform.
+ *
+ * The transforms of the queue with indices in
+ * [ FirstTransformIndex, FirstTransformIndex + NumberOfTransformsToFlatten )
+ * are flattened, in the same order as the composite transform applies them.
+ * A NumberOfTransformsToFlatten of zero, the default, means all the
+ * transforms from FirstTransformIndex to the end of the queue.
+ *
+ * The field is computed in parallel by Update(), which only recomputes it
+ * when the settings, the reference image, the composite transform or one of
+ * the flattened sub-transforms were modified since the last computation. The
+ * modification times of nested composite transforms and of the fields of
+ * displacement field transforms are taken into account. The output transform
+ * object is kept across updates, only its displacement field is replaced.
+ *
+ * The flattened transform is an approximation of the composite transform:
+ * it is exact on the grid points, and interpolated between them.
+ *
+ * \ingroup ITKDisplacementField
+ */
+template <typename TParametersValueType, unsigned int VDimension>
+class ITK_TEMPLATE_EXPORT CompositeTransformFlattener : public Object
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(CompositeTransformFlattener);
+
+  /** Standard class type aliases. */
+  using Self = CompositeTransformFlattener;
+  using Superclass = Object;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(CompositeTransformFlattener, Object);
+
+  static constexpr unsigned int Dimension = VDimension;
+
+  using CompositeTransformType = CompositeTransform<TParametersValueType, VDimension>;
+  using TransformType = typename CompositeTransformType::TransformType;
+  using DisplacementFieldTransformType = DisplacementFieldTransform<TParametersValueType, VDimension>;
+  using DisplacementFieldType = typename DisplacementFieldTransformType::DisplacementFieldType;
+
+  /** Typedef the reference image ImageBase. */
+  using ReferenceImageBaseType = ImageBase<VDimension>;
+
+  /** Set/Get the composite transform to flatten. */
+  itkSetConstObjectMacro(CompositeTransform, CompositeTransformType);
+  itkGetConstObjectMacro(CompositeTransform, CompositeTransformType);
+
+  /** Set/Get the image whose grid the composite transform is sampled on. */
+  itkSetConstObjectMacro(ReferenceImage, ReferenceImageBaseType);
+  itkGetConstObjectMacro(ReferenceImage, ReferenceImageBaseType);
+
+  /** Set/Get the index in the queue of the first transform to flatten. */
+  itkSetMacro(FirstTransformIndex, SizeValueType);
+  itkGetConstMacro(FirstTransformIndex, SizeValueType);
+
+  /** Set/Get the number of transforms to flatten, zero meaning up to the end
+   * of the queue. */
+  itkSetMacro(NumberOfTransformsToFlatten, SizeValueType);
+  itkGetConstMacro(NumberOfTransformsToFlatten, SizeValueType);
+
+  /** Set/Get the number of work units used to compute the field. */
+  itkSetClampMacro(NumberOfWorkUnits, ThreadIdType, 1, ITK_MAX_THREADS);
+  itkGetConstMacro(NumberOfWorkUnits, ThreadIdType);
+
+  /** Compute the flattened displacement field if it is out of date. */
+  void
+  Update();
+
+  /** Get the flattened transform. Its displacement field is only available
+   * after Update() has been called. */
+  itkGetModifiableObjectMacro(Output, DisplacementFieldTransformType);
+
+  /** Get the most recent modification time of the flattened sub-transforms. */
+  ModifiedTimeType
+  GetTransformsMTime() const;
+
+protected:
+  CompositeTransformFlattener();
+  ~CompositeTransformFlattener() override = default;
+
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+  /** Modification time of a transform, including the ones of the
+   * sub-transforms of a composite transform and of the field of a
+   * displacement field transform. */
+  static ModifiedTimeType
+  GetTransformMTime(const TransformType * transform);
+
+private:
+  typename CompositeTransformType::ConstPointer m_CompositeTransform;
+  typename ReferenceImageBaseType::ConstPointer m_ReferenceImage;
+
+  SizeValueType m_FirstTransformIndex{ 0 };
+  SizeValueType m_NumberOfTransformsToFlatten{ 0 };
+  ThreadIdType  m_NumberOfWorkUnits;
+
+  typename DisplacementFieldTransformType::Pointer m_Output;
+
+  /** Time of the last computation of the field. */
+  TimeStamp m_FlattenTime;
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkCompositeTransformFlattener.hxx"
+#endif
+
+#endif
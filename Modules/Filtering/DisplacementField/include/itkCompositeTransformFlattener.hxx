@@ -0,0 +1,168 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkCompositeTransformFlattener_hxx
+#define itkCompositeTransformFlattener_hxx
+
+#include "itkMultiThreaderBase.h"
+#include "itkTransformToDisplacementFieldFilter.h"
+
+#include <algorithm>
+
+namespace itk
+{
+
+template <typename TParametersValueType, unsigned int VDimension>
+CompositeTransformFlattener<TParametersValueType, VDimension>::CompositeTransformFlattener()
+  : m_NumberOfWorkUnits(MultiThreaderBase::GetGlobalDefaultNumberOfThreads())
+  , m_Output(DisplacementFieldTransformType::New())
+{}
+
+template <typename TParametersValueType, unsigned int VDimension>
+ModifiedTimeType
+CompositeTransformFlattener<TParametersValueType, VDimension>::GetTransformMTime(const TransformType * transform)
+{
+  ModifiedTimeType mtime = transform->GetMTime();
+
+  using MultiTransformType = MultiTransform<TParametersValueType, VDimension, VDimension>;
+  const auto * multiTransform = dynamic_cast<const MultiTransformType *>(transform);
+  if (multiTransform != nullptr)
+  {
+    for (SizeValueType n = 0; n < multiTransform->GetNumberOfTransforms(); ++n)
+    {
+      mtime = std::max(mtime, GetTransformMTime(multiTransform->GetNthTransformConstPointer(n)));
+    }
+  }
+
+  // The field of a displacement field transform may be modified in place
+  const auto * displacementFieldTransform = dynamic_cast<const DisplacementFieldTransformType *>(transform);
+  if (displacementFieldTransform != nullptr && displacementFieldTransform->GetDisplacementField() != nullptr)
+  {
+    mtime = std::max(mtime, displacementFieldTransform->GetDisplacementField()->GetMTime());
+  }
+
+  return mtime;
+}
+
+template <typename TParametersValueType, unsigned int VDimension>
+ModifiedTimeType
+CompositeTransformFlattener<TParametersValueType, VDimension>::GetTransformsMTime() const
+{
+  ModifiedTimeType mtime = 0;
+  if (this->m_CompositeTransform.IsNull())
+  {
+    return mtime;
+  }
+
+  const SizeValueType numberOfTransforms = this->m_CompositeTransform->GetNumberOfTransforms();
+  const SizeValueType lastTransformIndex =
+    (this->m_NumberOfTransformsToFlatten == 0)
+      ? numberOfTransforms
+      : std::min(numberOfTransforms, this->m_FirstTransformIndex + this->m_NumberOfTransformsToFlatten);
+
+  for (SizeValueType n = this->m_FirstTransformIndex; n < lastTransformIndex; ++n)
+  {
+    mtime = std::max(mtime, GetTransformMTime(this->m_CompositeTransform->GetNthTransformConstPointer(n)));
+  }
+  return mtime;
+}
+
+template <typename TParametersValueType, unsigned int VDimension>
+void
+CompositeTransformFlattener<TParametersValueType, VDimension>::Update()
+{
+  if (this->m_CompositeTransform.IsNull())
+  {
+    itkExceptionMacro(<< "The composite transform is not set.");
+  }
+  if (this->m_ReferenceImage.IsNull())
+  {
+    itkExceptionMacro(<< "The reference image is not set.");
+  }
+
+  const SizeValueType numberOfTransforms = this->m_CompositeTransform->GetNumberOfTransforms();
+  const SizeValueType firstTransformIndex = this->m_FirstTransformIndex;
+  const SizeValueType lastTransformIndex = (this->m_NumberOfTransformsToFlatten == 0)
+                                             ? numberOfTransforms
+                                             : firstTransformIndex + this->m_NumberOfTransformsToFlatten;
+  if (firstTransformIndex >= lastTransformIndex || lastTransformIndex > numberOfTransforms)
+  {
+    itkExceptionMacro(<< "The transforms [" << firstTransformIndex << ", " << lastTransformIndex
+                      << ") are not in the queue of " << numberOfTransforms << " transforms.");
+  }
+
+  const ModifiedTimeType mtime = std::max({ this->GetMTime(),
+                                            this->m_CompositeTransform->GetMTime(),
+                                            this->m_ReferenceImage->GetMTime(),
+                                            this->GetTransformsMTime() });
+  if (this->m_Output->GetDisplacementField() != nullptr && mtime < this->m_FlattenTime.GetMTime())
+  {
+    return;
+  }
+
+  // Avoid going through a composite transform when there is no need to
+  typename TransformType::ConstPointer transform;
+  if (lastTransformIndex - firstTransformIndex == 1)
+  {
+    transform = this->m_CompositeTransform->GetNthTransformConstPointer(firstTransformIndex);
+  }
+  else if (lastTransformIndex - firstTransformIndex == numberOfTransforms)
+  {
+    transform = this->m_CompositeTransform.GetPointer();
+  }
+  else
+  {
+    auto subComposite = CompositeTransformType::New();
+    for (SizeValueType n = firstTransformIndex; n < lastTransformIndex; ++n)
+    {
+      subComposite->AddTransform(this->m_CompositeTransform->GetNthTransformModifiablePointer(n));
+    }
+    transform = subComposite.GetPointer();
+  }
+
+  using FieldGeneratorType = TransformToDisplacementFieldFilter<DisplacementFieldType, TParametersValueType>;
+  auto fieldGenerator = FieldGeneratorType::New();
+  fieldGenerator->SetTransform(transform);
+  fieldGenerator->SetReferenceImage(this->m_ReferenceImage);
+  fieldGenerator->UseReferenceImageOn();
+  fieldGenerator->SetNumberOfWorkUnits(this->m_NumberOfWorkUnits);
+  fieldGenerator->Update();
+
+  typename DisplacementFieldType::Pointer field = fieldGenerator->GetOutput();
+  field->DisconnectPipeline();
+
+  this->m_Output->SetDisplacementField(field);
+  this->m_FlattenTime.Modified();
+}
+
+template <typename TParametersValueType, unsigned int VDimension>
+void
+CompositeTransformFlattener<TParametersValueType, VDimension>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  itkPrintSelfObjectMacro(CompositeTransform);
+  itkPrintSelfObjectMacro(ReferenceImage);
+  os << indent << "FirstTransformIndex: " << this->m_FirstTransformIndex << std::endl;
+  os << indent << "NumberOfTransformsToFlatten: " << this->m_NumberOfTransformsToFlatten << std::endl;
+  os << indent << "NumberOfWorkUnits: " << this->m_NumberOfWorkUnits << std::endl;
+  itkPrintSelfObjectMacro(Output);
+  os << indent << "FlattenTime: " << this->m_FlattenTime.GetMTime() << std::endl;
+}
+} // end namespace itk
+
+#endif
@@ -26,6 +26,7 @@
 #include "vnl/algo/vnl_matrix_inverse.h"
 #include "itkCastImageFilter.h"
 
+
 namespace itk
 {
 
@@ -100,6 +101,18 @@ DisplacementFieldTransform<TParametersValueType, VDimension>::TransformPoint(con
   return outputPoint;
 }
 
+template <typename TParametersValueType, unsigned int VDimension>
+void
+DisplacementFieldTransform<TParametersValueType, VDimension>::TransformPoints(const InputPointType * inputPoints,
+                                                                              OutputPointType *      outputPoints,
+                                                                              SizeValueType numberOfPoints) const
+{
+  for (SizeValueType i = 0; i < numberOfPoints; ++i)
+  {
+    outputPoints[i] = this->DisplacementFieldTransform::TransformPoint(inputPoints[i]);
+  }
+}
+
 template <typename TParametersValueType, unsigned int VDimension>
 bool
 DisplacementFieldTransform<TParametersValueType, VDimension>::GetInverse(Self * inverse) const
@@ -18,11 +18,14 @@
 #ifndef itkExponentialDisplacementFieldImageFilter_h
 #define itkExponentialDisplacementFieldImageFilter_h
 
-#include "itkDivideImageFilter.h"
-#include "itkCastImageFilter.h"
-#include "itkWarpVectorImageFilter.h"
-#include "itkVectorLinearInterpolateNearestNeighborExtrapolateImageFunction.h"
-#include "itkAddImageFilter.h"
+#include "itkImageToImageFilter.h"
+#if !defined(ITK_FUTURE_LEGACY_REMOVE)
+#  include "itkDivideImageFilter.h"
+#  include "itkCastImageFilter.h"
+#  include "itkWarpVectorImageFilter.h"
+#  include "itkVectorLinearInterpolateNearestNeighborExtrapolateImageFunction.h"
+#  include "itkAddImageFilter.h"
+#endif
 
 namespace itk
 {
@@ -48,6 +51,11 @@ namespace itk
  *    \f]
  *
  *
+ * Each squaring step composes the field with itself in a single pass, using
+ * linear interpolation with nearest neighbor extrapolation, and alternates
+ * between the output and one temporary buffer, so that no image is allocated
+ * nor pipeline executed per step.
+ *
  * This filter expects both the input and output images to be of pixel type
  * Vector.
  *
@@ -138,6 +146,10 @@ protected:
 
   using RegionType = typename InputImageType::RegionType;
 
+#if !defined(ITK_FUTURE_LEGACY_REMOVE)
+  /** Types of the mini-pipeline the filter used to run. The filter does
+   * not use them anymore.
+   * \deprecated Include and instantiate the filters directly instead. */
   using DivideByConstantType =
     DivideImageFilter<InputImageType, itk::Image<InputPixelRealValueType, ImageDimension>, OutputImageType>;
 
@@ -155,17 +167,17 @@ protected:
   using FieldInterpolatorPointer = typename FieldInterpolatorType::Pointer;
   using FieldInterpolatorOutputType = typename FieldInterpolatorType::OutputType;
   using AdderPointer = typename AdderType::Pointer;
+#endif
 
 private:
+  /** Write field + field o (Id + field) to composedField over the region. */
+  void
+  ComposeFieldWithItself(const OutputImageType * field, OutputImageType * composedField, const RegionType & region);
+
   bool         m_AutomaticNumberOfIterations;
   unsigned int m_MaximumNumberOfIterations;
 
   bool m_ComputeInverse;
-
-  DivideByConstantPointer m_Divider;
-  CasterPointer           m_Caster;
-  VectorWarperPointer     m_Warper;
-  AdderPointer            m_Adder;
 };
 } // end namespace itk
 
@@ -20,6 +20,8 @@
 
 #include "itkProgressReporter.h"
 #include "itkImageRegionConstIterator.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
+#include "itkImageRegionIterator.h"
 
 namespace itk
 {
@@ -32,15 +34,6 @@ ExponentialDisplacementFieldImageFilter<TInputImage, TOutputImage>::ExponentialD
   m_AutomaticNumberOfIterations = true;
   m_MaximumNumberOfIterations = 20;
   m_ComputeInverse = false;
-  m_Divider = DivideByConstantType::New();
-  m_Caster = CasterType::New();
-  m_Warper = VectorWarperType::New();
-
-  FieldInterpolatorPointer VectorInterpolator = FieldInterpolatorType::New();
-  m_Warper->SetInterpolator(VectorInterpolator);
-
-  m_Adder = AdderType::New();
-  m_Adder->InPlaceOn();
 }
 
 /**
@@ -127,89 +120,188 @@ ExponentialDisplacementFieldImageFilter<TInputImage, TOutputImage>::GenerateData
 
   ProgressReporter progress(this, 0, numiter + 1, numiter + 1);
 
-  if (numiter == 0)
+  this->AllocateOutputs();
+
+  OutputImageType * outputPtr = this->GetOutput();
+  const RegionType  region = outputPtr->GetRequestedRegion();
+
+  // The squaring steps alternate between the output and a temporary field,
+  // so start from the one that makes the last step write to the output
+  OutputImagePointer temporaryField;
+  OutputImageType *  field = outputPtr;
+  OutputImageType *  composedField = outputPtr;
+  if (numiter > 0)
   {
-    if (!this->m_ComputeInverse)
+    temporaryField = OutputImageType::New();
+    temporaryField->CopyInformation(outputPtr);
+    temporaryField->SetBufferedRegion(outputPtr->GetBufferedRegion());
+    temporaryField->Allocate();
+    if (numiter % 2 == 1)
     {
-      m_Caster->SetInput(inputPtr);
-      m_Caster->GraftOutput(this->GetOutput());
-      m_Caster->Update();
-      // Region passing stuff
-      this->GraftOutput(m_Caster->GetOutput());
+      field = temporaryField;
     }
     else
     {
-      // We only need the opposite. Here we use the
-      // divider for simplicity. If a filter appears in ITK
-      // to compute the opposite, we should use it.
-      m_Divider->SetInput(inputPtr);
-      m_Divider->SetInput2(static_cast<InputPixelRealValueType>(-1));
-      m_Divider->GraftOutput(this->GetOutput());
-      m_Divider->Update();
-      // Region passing stuff
-      this->GraftOutput(m_Divider->GetOutput());
+      composedField = temporaryField;
     }
-
-    this->GetOutput()->Modified();
-
-    progress.CompletedPixel();
-    return;
   }
 
-  // Get the first order approximation (division by 2^numiter)
-  m_Divider->SetInput(inputPtr);
-  m_Divider->GraftOutput(this->GetOutput());
-  if (!this->m_ComputeInverse)
+  // Get the first order approximation (division by 2^numiter). The scale is
+  // a power of two, so the multiplication is as exact as the division.
+  InputPixelRealValueType scale = 1.0 / static_cast<InputPixelRealValueType>(1 << numiter);
+  if (this->m_ComputeInverse)
   {
-    m_Divider->SetInput2(static_cast<InputPixelRealValueType>(1 << numiter));
-  }
-  else
-  {
-    m_Divider->SetInput2(-static_cast<InputPixelRealValueType>(1 << numiter));
+    scale = -scale;
   }
 
-  m_Divider->Update();
+  this->GetMultiThreader()->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+  this->GetMultiThreader()->template ParallelizeImageRegion<ImageDimension>(
+    region,
+    [inputPtr, field, scale](const RegionType & regionForThread) {
+      using OutputValueType = typename OutputPixelType::ValueType;
 
-  // Region passing stuff
-  this->GraftOutput(m_Divider->GetOutput());
-  this->GetOutput()->Modified();
+      ImageRegionConstIterator<InputImageType> inputIt(inputPtr, regionForThread);
+      ImageRegionIterator<OutputImageType>     fieldIt(field, regionForThread);
+      for (; !inputIt.IsAtEnd(); ++inputIt, ++fieldIt)
+      {
+        const InputPixelType & velocity = inputIt.Get();
+        OutputPixelType        displacement;
+        for (unsigned int k = 0; k < PixelDimension; ++k)
+        {
+          displacement[k] = static_cast<OutputValueType>(velocity[k] * scale);
+        }
+        fieldIt.Set(displacement);
+      }
+    },
+    nullptr);
 
   progress.CompletedPixel();
 
   // Do the iterative composition of the vector field
-  m_Warper->SetOutputOrigin(inputPtr->GetOrigin());
-  m_Warper->SetOutputSpacing(inputPtr->GetSpacing());
-  m_Warper->SetOutputDirection(inputPtr->GetDirection());
-
   for (unsigned int i = 0; i < numiter; ++i)
   {
-    m_Warper->SetInput(this->GetOutput());
-    m_Warper->SetDisplacementField(this->GetOutput());
-
-    m_Warper->GetOutput()->SetRequestedRegion(this->GetOutput()->GetRequestedRegion());
-
-    m_Warper->Update();
+    this->ComposeFieldWithItself(field, composedField, region);
+    std::swap(field, composedField);
 
-    OutputImagePointer warpedIm = m_Warper->GetOutput();
-    warpedIm->DisconnectPipeline();
-
-    // Remember we chose to use an inplace adder
-    m_Adder->SetInput1(this->GetOutput());
-
-    m_Adder->SetInput2(warpedIm);
-    m_Adder->GetOutput()->SetRequestedRegion(this->GetOutput()->GetRequestedRegion());
-
-    m_Adder->Update();
+    progress.CompletedPixel();
+  }
+}
 
-    // Region passing stuff
-    this->GraftOutput(m_Adder->GetOutput());
+template <typename TInputImage, typename TOutputImage>
+void
+ExponentialDisplacementFieldImageFilter<TInputImage, TOutputImage>::ComposeFieldWithItself(
+  const OutputImageType * field,
+  OutputImageType *       composedField,
+  const RegionType &      region)
+{
+  using OutputValueType = typename OutputPixelType::ValueType;
+  using RealType = typename NumericTraits<OutputValueType>::RealType;
+  using IndexType = typename OutputImageType::IndexType;
+  using PointType = Point<double, ImageDimension>;
+  using ContinuousIndexType = ContinuousIndex<double, ImageDimension>;
+
+  constexpr unsigned int numberOfNeighbors = 1 << ImageDimension;
+
+  // The field is linearly interpolated inside its buffered region and
+  // extrapolated to the nearest neighbor outside of it
+  const RegionType        bufferedRegion = field->GetBufferedRegion();
+  const OffsetValueType * offsetTable = field->GetOffsetTable();
+  const OutputPixelType * buffer = field->GetBufferPointer();
+  IndexType               startIndex;
+  IndexType               endIndex;
+  for (unsigned int d = 0; d < ImageDimension; ++d)
+  {
+    startIndex[d] = bufferedRegion.GetIndex()[d];
+    endIndex[d] = startIndex[d] + static_cast<IndexValueType>(bufferedRegion.GetSize()[d]) - 1;
+  }
 
-    // Make a call to modified. This seems only necessary for
-    // a non-inplace adder but it doesn't hurt anyhow.
-    this->GetOutput()->Modified();
+  this->GetMultiThreader()->template ParallelizeImageRegion<ImageDimension>(
+    region,
+    [&](const RegionType & regionForThread) {
+      ImageRegionConstIteratorWithIndex<OutputImageType> fieldIt(field, regionForThread);
+      ImageRegionIterator<OutputImageType>               composedIt(composedField, regionForThread);
 
-    progress.CompletedPixel();
-  }
+      PointType point;
+      for (; !fieldIt.IsAtEnd(); ++fieldIt, ++composedIt)
+      {
+        const OutputPixelType & displacement = fieldIt.Get();
+        field->TransformIndexToPhysicalPoint(fieldIt.GetIndex(), point);
+        for (unsigned int d = 0; d < ImageDimension; ++d)
+        {
+          point[d] += displacement[d];
+        }
+        const ContinuousIndexType cindex = field->template TransformPhysicalPointToContinuousIndex<double>(point);
+
+        OffsetValueType baseOffset = 0;
+        double          distance[ImageDimension];
+        for (unsigned int d = 0; d < ImageDimension; ++d)
+        {
+          IndexValueType baseIndex = Math::Floor<IndexValueType>(cindex[d]);
+          if (baseIndex < startIndex[d])
+          {
+            baseIndex = startIndex[d];
+            distance[d] = 0.0;
+          }
+          else if (baseIndex >= endIndex[d])
+          {
+            baseIndex = endIndex[d];
+            distance[d] = 0.0;
+          }
+          else
+          {
+            distance[d] = cindex[d] - static_cast<double>(baseIndex);
+          }
+          baseOffset += (baseIndex - startIndex[d]) * offsetTable[d];
+        }
+
+        // Neighbors with no overlap are skipped, which avoids reading past
+        // the buffer at its upper boundaries
+        RealType interpolated[PixelDimension] = {};
+        RealType totalOverlap = 0.0;
+        for (unsigned int counter = 0; counter < numberOfNeighbors; ++counter)
+        {
+          double          overlap = 1.0;
+          OffsetValueType offset = baseOffset;
+          unsigned int    upper = counter;
+          for (unsigned int d = 0; d < ImageDimension; ++d)
+          {
+            if (upper & 1)
+            {
+              offset += offsetTable[d];
+              overlap *= distance[d];
+            }
+            else
+            {
+              overlap *= 1.0 - distance[d];
+            }
+            upper >>= 1;
+          }
+
+          if (overlap)
+          {
+            const OutputPixelType & neighbor = buffer[offset];
+            for (unsigned int k = 0; k < PixelDimension; ++k)
+            {
+              interpolated[k] += overlap * static_cast<RealType>(neighbor[k]);
+            }
+            totalOverlap += overlap;
+          }
+
+          if (totalOverlap == 1.0)
+          {
+            break;
+          }
+        }
+
+        OutputPixelType composedDisplacement;
+        for (unsigned int k = 0; k < PixelDimension; ++k)
+        {
+          composedDisplacement[k] = displacement[k] + static_cast<OutputValueType>(interpolated[k]);
+        }
+        composedIt.Set(composedDisplacement);
+      }
+    },
+    nullptr);
 }
 } // end namespace itk
 
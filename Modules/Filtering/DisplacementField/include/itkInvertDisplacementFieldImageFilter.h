@@ -31,6 +31,15 @@ namespace itk
  *
  * \brief Iteratively estimate the inverse field of a displacement field.
  *
+ * The inverse is refined by a fixed-point iteration which starts from the
+ * initial estimate when one is given, e.g. the inverse of the previous
+ * iteration of a registration, and from a zero field otherwise.  In the
+ * latter case, setting the number of levels to more than one first estimates
+ * the inverse on coarser grids, each with half the number of voxels of the
+ * next one along every dimension, and uses the upsampled coarse inverse as
+ * the initial estimate of the finer level.  Since the coarse iterations are
+ * cheap, fewer full resolution iterations are needed to reach the tolerances.
+ *
  * \author Nick Tustison
  * \author Brian Avants
  *
@@ -136,6 +145,11 @@ public:
   /* Get the mean norm */
   itkGetConstMacro(MeanErrorNorm, RealType);
 
+  /* Set/Get the number of resolution levels used when no initial estimate is
+   * given. The default of 1 only iterates at full resolution. */
+  itkSetClampMacro(NumberOfLevels, unsigned int, 1, NumericTraits<unsigned int>::max());
+  itkGetConstMacro(NumberOfLevels, unsigned int);
+
   /* Should we force the boundary to have zero displacement? */
   itkSetMacro(EnforceBoundaryCondition, bool);
   itkGetMacro(EnforceBoundaryCondition, bool);
@@ -161,10 +175,16 @@ protected:
   DynamicThreadedGenerateData(const RegionType &) override;
 
 private:
+  /** Estimate the inverse on a grid twice as coarse and upsample it into the
+   * output. Returns false when the field is too small to be coarsened. */
+  bool
+  EstimateInverseAtCoarserLevel(InverseDisplacementFieldType * inverseField);
+
   /** The interpolator. */
   typename InterpolatorType::Pointer m_Interpolator;
 
   unsigned int m_MaximumNumberOfIterations{ 20 };
+  unsigned int m_NumberOfLevels{ 1 };
 
   RealType m_MaxErrorToleranceThreshold;
   RealType m_MeanErrorToleranceThreshold;
@@ -19,9 +19,10 @@
 #define itkInvertDisplacementFieldImageFilter_hxx
 
 
-#include "itkComposeDisplacementFieldsImageFilter.h"
+#include "itkImageAlgorithm.h"
 #include "itkImageDuplicator.h"
 #include "itkImageRegionIterator.h"
+#include "itkImageRegionIteratorWithIndex.h"
 #include <mutex>
 #include "itkProgressTransformer.h"
 
@@ -74,22 +75,33 @@ InvertDisplacementFieldImageFilter<TInputImage, TOutputImage>::GenerateData()
 
   typename DisplacementFieldType::ConstPointer displacementField = this->GetInput();
 
-  typename InverseDisplacementFieldType::Pointer inverseDisplacementField;
+  this->m_Interpolator->SetInputImage(displacementField);
 
-  if (this->GetInverseFieldInitialEstimate())
+  typename InverseDisplacementFieldType::Pointer inverseDisplacementField = this->GetOutput();
+
+  const InverseDisplacementFieldType * inverseFieldInitialEstimate = this->GetInverseFieldInitialEstimate();
+  if (inverseFieldInitialEstimate)
   {
-    using DuplicatorType = ImageDuplicator<InverseDisplacementFieldType>;
-    auto duplicator = DuplicatorType::New();
-    duplicator->SetInputImage(this->GetInverseFieldInitialEstimate());
-    duplicator->Update();
+    const RegionType & outputRegion = inverseDisplacementField->GetBufferedRegion();
+    if (inverseFieldInitialEstimate->GetBufferedRegion() == outputRegion)
+    {
+      ImageAlgorithm::Copy(
+        inverseFieldInitialEstimate, inverseDisplacementField.GetPointer(), outputRegion, outputRegion);
+    }
+    else
+    {
+      using DuplicatorType = ImageDuplicator<InverseDisplacementFieldType>;
+      auto duplicator = DuplicatorType::New();
+      duplicator->SetInputImage(inverseFieldInitialEstimate);
+      duplicator->Update();
 
-    inverseDisplacementField = duplicator->GetOutput();
+      inverseDisplacementField = duplicator->GetOutput();
 
-    this->SetNthOutput(0, inverseDisplacementField);
+      this->SetNthOutput(0, inverseDisplacementField);
+    }
   }
-  else
+  else if (this->m_NumberOfLevels < 2 || !this->EstimateInverseAtCoarserLevel(inverseDisplacementField))
   {
-    inverseDisplacementField = this->GetOutput();
     inverseDisplacementField->FillBuffer(zeroVector);
   }
 
@@ -98,6 +110,13 @@ InvertDisplacementFieldImageFilter<TInputImage, TOutputImage>::GenerateData()
     this->m_DisplacementFieldSpacing[d] = displacementField->GetSpacing()[d];
   }
 
+  // Storage of the composition of the displacement field with the current
+  // inverse, reused across the iterations
+  this->m_ComposedField = DisplacementFieldType::New();
+  this->m_ComposedField->CopyInformation(inverseDisplacementField);
+  this->m_ComposedField->SetRegions(inverseDisplacementField->GetLargestPossibleRegion());
+  this->m_ComposedField->Allocate();
+
   this->m_ScaledNormImage->CopyInformation(displacementField);
   this->m_ScaledNormImage->SetRegions(displacementField->GetRequestedRegion());
   this->m_ScaledNormImage->Allocate(true); // initialize buffer to zero
@@ -115,16 +134,8 @@ InvertDisplacementFieldImageFilter<TInputImage, TOutputImage>::GenerateData()
     itkDebugMacro("Iteration " << iteration << ": mean error norm = " << this->m_MeanErrorNorm
                                << ", max error norm = " << this->m_MaxErrorNorm);
 
-    using ComposerType = ComposeDisplacementFieldsImageFilter<DisplacementFieldType>;
-    auto composer = ComposerType::New();
-    composer->SetDisplacementField(displacementField);
-    composer->SetWarpingField(inverseDisplacementField);
-
-    this->m_ComposedField = composer->GetOutput();
-    this->m_ComposedField->Update();
-    this->m_ComposedField->DisconnectPipeline();
-
-    // Multithread processing to multiply each element of the composed field by 1 / spacing
+    // Multithread processing to compose the displacement field with the inverse
+    // and multiply each element of the composed field by 1 / spacing
     this->m_MeanErrorNorm = NumericTraits<RealType>::ZeroValue();
     this->m_MaxErrorNorm = NumericTraits<RealType>::ZeroValue();
 
@@ -164,6 +175,91 @@ InvertDisplacementFieldImageFilter<TInputImage, TOutputImage>::GenerateData()
   this->UpdateProgress(1.0f);
 }
 
+template <typename TInputImage, typename TOutputImage>
+bool
+InvertDisplacementFieldImageFilter<TInputImage, TOutputImage>::EstimateInverseAtCoarserLevel(
+  InverseDisplacementFieldType * inverseField)
+{
+  const RegionType region = inverseField->GetLargestPossibleRegion();
+  const SizeType   size = region.GetSize();
+
+  // The coarse grid spans the same physical extent, so that the boundaries
+  // of both grids coincide
+  SizeType    coarseSize;
+  SpacingType coarseSpacing;
+  for (unsigned int d = 0; d < ImageDimension; ++d)
+  {
+    coarseSize[d] = (size[d] - 1) / 2 + 1;
+    if (coarseSize[d] < 4)
+    {
+      return false;
+    }
+    coarseSpacing[d] = inverseField->GetSpacing()[d] * static_cast<double>(size[d] - 1) /
+                       static_cast<double>(coarseSize[d] - 1);
+  }
+  PointType coarseOrigin;
+  inverseField->TransformIndexToPhysicalPoint(region.GetIndex(), coarseOrigin);
+
+  auto coarseField = DisplacementFieldType::New();
+  coarseField->SetOrigin(coarseOrigin);
+  coarseField->SetSpacing(coarseSpacing);
+  coarseField->SetDirection(inverseField->GetDirection());
+  coarseField->SetRegions(coarseSize);
+  coarseField->Allocate();
+
+  this->GetMultiThreader()->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+  this->GetMultiThreader()->template ParallelizeImageRegion<ImageDimension>(
+    coarseField->GetBufferedRegion(),
+    [this, &coarseField](const RegionType & regionForThread) {
+      ImageRegionIteratorWithIndex<DisplacementFieldType> It(coarseField, regionForThread);
+      PointType                                           point;
+      for (It.GoToBegin(); !It.IsAtEnd(); ++It)
+      {
+        coarseField->TransformIndexToPhysicalPoint(It.GetIndex(), point);
+        typename InterpolatorType::OutputType displacement{};
+        if (this->m_Interpolator->IsInsideBuffer(point))
+        {
+          displacement = this->m_Interpolator->Evaluate(point);
+        }
+        It.Set(displacement);
+      }
+    },
+    nullptr);
+
+  auto coarseInverter = Self::New();
+  coarseInverter->SetDisplacementField(coarseField);
+  coarseInverter->SetMaximumNumberOfIterations(this->m_MaximumNumberOfIterations);
+  coarseInverter->SetMeanErrorToleranceThreshold(this->m_MeanErrorToleranceThreshold);
+  coarseInverter->SetMaxErrorToleranceThreshold(this->m_MaxErrorToleranceThreshold);
+  coarseInverter->SetEnforceBoundaryCondition(this->m_EnforceBoundaryCondition);
+  coarseInverter->SetNumberOfLevels(this->m_NumberOfLevels - 1);
+  coarseInverter->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+  coarseInverter->Update();
+
+  auto coarseInterpolator = DefaultInterpolatorType::New();
+  coarseInterpolator->SetInputImage(coarseInverter->GetOutput());
+
+  this->GetMultiThreader()->template ParallelizeImageRegion<ImageDimension>(
+    region,
+    [inverseField, &coarseInterpolator](const RegionType & regionForThread) {
+      ImageRegionIteratorWithIndex<InverseDisplacementFieldType> It(inverseField, regionForThread);
+      PointType                                                  point;
+      for (It.GoToBegin(); !It.IsAtEnd(); ++It)
+      {
+        inverseField->TransformIndexToPhysicalPoint(It.GetIndex(), point);
+        typename DefaultInterpolatorType::OutputType inverseDisplacement{};
+        if (coarseInterpolator->IsInsideBuffer(point))
+        {
+          inverseDisplacement = coarseInterpolator->Evaluate(point);
+        }
+        It.Set(inverseDisplacement);
+      }
+    },
+    nullptr);
+
+  return true;
+}
+
 template <typename TInputImage, typename TOutputImage>
 void
 InvertDisplacementFieldImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(const RegionType & region)
@@ -214,10 +310,38 @@ InvertDisplacementFieldImageFilter<TInputImage, TOutputImage>::DynamicThreadedGe
     {
       inverseSpacing[d] = 1.0 / this->m_DisplacementFieldSpacing[d];
     }
-    for (ItE.GoToBegin(), ItS.GoToBegin(); !ItE.IsAtEnd(); ++ItE, ++ItS)
+
+    const InverseDisplacementFieldType *                            inverseField = this->GetOutput();
+    ImageRegionConstIteratorWithIndex<InverseDisplacementFieldType> ItI(inverseField, region);
+
+    PointType pointIn1;
+    PointType pointIn2;
+    PointType pointIn3;
+
+    for (ItI.GoToBegin(), ItE.GoToBegin(), ItS.GoToBegin(); !ItE.IsAtEnd(); ++ItI, ++ItE, ++ItS)
     {
-      const VectorType & displacement = ItE.Get();
-      RealType           scaledNorm = 0.0;
+      // Compose the displacement field with the current estimate of the inverse
+      inverseField->TransformIndexToPhysicalPoint(ItI.GetIndex(), pointIn1);
+
+      const VectorType & inverseDisplacement = ItI.Get();
+      for (unsigned int d = 0; d < ImageDimension; ++d)
+      {
+        pointIn2[d] = pointIn1[d] + inverseDisplacement[d];
+      }
+
+      typename InterpolatorType::OutputType warpedDisplacement{};
+      if (this->m_Interpolator->IsInsideBuffer(pointIn2))
+      {
+        warpedDisplacement = this->m_Interpolator->Evaluate(pointIn2);
+      }
+
+      for (unsigned int d = 0; d < ImageDimension; ++d)
+      {
+        pointIn3[d] = pointIn2[d] + warpedDisplacement[d];
+      }
+
+      const VectorType displacement = pointIn3 - pointIn1;
+      RealType         scaledNorm = 0.0;
       for (unsigned int d = 0; d < ImageDimension; ++d)
       {
         scaledNorm += itk::Math::sqr(displacement[d] * inverseSpacing[d]);
@@ -253,6 +377,7 @@ InvertDisplacementFieldImageFilter<TInputImage, TOutputImage>::PrintSelf(std::os
   itkPrintSelfObjectMacro(Interpolator);
 
   os << "Maximum number of iterations: " << this->m_MaximumNumberOfIterations << std::endl;
+  os << "Number of levels: " << this->m_NumberOfLevels << std::endl;
   os << "Max error tolerance threshold: " << this->m_MaxErrorToleranceThreshold << std::endl;
   os << "Mean error tolerance threshold: " << this->m_MeanErrorToleranceThreshold << std::endl;
 }
@@ -24,6 +24,8 @@
 #include "itkImageRegionIteratorWithIndex.h"
 #include "itkImageScanlineIterator.h"
 
+#include <vector>
+
 namespace itk
 {
 
@@ -181,9 +183,17 @@ TransformToDisplacementFieldFilter<TOutputImage, TParametersValueType>::Nonlinea
   using OutputIteratorType = ImageScanlineIterator<TOutputImage>;
   OutputIteratorType outIt(output, outputRegionForThread);
 
+  // The points of a scan line are transformed by a single call to the
+  // transform, in buffers local to this work unit.
+  using TransformInputPointType = typename TransformType::InputPointType;
+  using TransformOutputPointType = typename TransformType::OutputPointType;
+  const SizeValueType                   lineLength = outputRegionForThread.GetSize(0);
+  std::vector<PointType>                outputPoints(lineLength);
+  std::vector<TransformInputPointType>  transformInputPoints(lineLength);
+  std::vector<TransformOutputPointType> transformOutputPoints(lineLength);
+
   // Define a few variables that will be used to translate from an input pixel
   // to an output pixel
-  PointType outputPoint;       // Coordinates of output pixel
   PointType transformedPoint;  // Coordinates of transformed pixel
   PixelType displacementPixel; // the difference, cast to pixel type
 
@@ -194,15 +204,23 @@ TransformToDisplacementFieldFilter<TOutputImage, TParametersValueType>::Nonlinea
   outIt.GoToBegin();
   while (!outIt.IsAtEnd())
   {
-    while (!outIt.IsAtEndOfLine())
+    // Determine the coordinates of the output pixels of the scan line
+    IndexType index = outIt.GetIndex();
+    for (SizeValueType k = 0; k < lineLength; ++k)
     {
-      // Determine the index of the current output pixel
-      output->TransformIndexToPhysicalPoint(outIt.GetIndex(), outputPoint);
+      output->TransformIndexToPhysicalPoint(index, outputPoints[k]);
+      transformInputPoints[k].CastFrom(outputPoints[k]);
+      ++index[0];
+    }
+
+    // Compute corresponding input pixel positions
+    transform->TransformPoints(transformInputPoints.data(), transformOutputPoints.data(), lineLength);
 
-      // Compute corresponding input pixel position
-      transformedPoint = transform->TransformPoint(outputPoint);
+    for (SizeValueType k = 0; k < lineLength; ++k)
+    {
+      transformedPoint.CastFrom(transformOutputPoints[k]);
 
-      const typename PointType::VectorType displacementVector = transformedPoint - outputPoint;
+      const typename PointType::VectorType displacementVector = transformedPoint - outputPoints[k];
       // Cast PointType -> PixelType
       for (IndexValueType idx = 0; idx < ImageDimension; ++idx)
       {
@@ -0,0 +1,200 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkCompositeTransformFlattener.h"
+#include "itkAffineTransform.h"
+#include "itkTranslationTransform.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkTestingMacros.h"
+
+namespace
+{
+template <typename TTransform, typename TFlattenedTransform, typename TImage>
+bool
+TransformsMatchOnGrid(const TTransform * transform, const TFlattenedTransform * flattenedTransform, const TImage * image)
+{
+  constexpr double tolerance = 1e-9;
+
+  itk::ImageRegionConstIteratorWithIndex<TImage> it(image, image->GetLargestPossibleRegion());
+  for (it.GoToBegin(); !it.IsAtEnd(); ++it)
+  {
+    typename TImage::PointType point;
+    image->TransformIndexToPhysicalPoint(it.GetIndex(), point);
+
+    const auto expected = transform->TransformPoint(point);
+    const auto flattened = flattenedTransform->TransformPoint(point);
+    if (expected.EuclideanDistanceTo(flattened) > tolerance)
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "Error at " << point << ": expected " << expected << ", but got " << flattened << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+} // namespace
+
+int
+itkCompositeTransformFlattenerTest(int, char *[])
+{
+  constexpr unsigned int Dimension = 2;
+  using ParametersValueType = double;
+
+  using FlattenerType = itk::CompositeTransformFlattener<ParametersValueType, Dimension>;
+  using CompositeTransformType = FlattenerType::CompositeTransformType;
+  using DisplacementFieldTransformType = FlattenerType::DisplacementFieldTransformType;
+  using DisplacementFieldType = FlattenerType::DisplacementFieldType;
+  using AffineTransformType = itk::AffineTransform<ParametersValueType, Dimension>;
+  using TranslationTransformType = itk::TranslationTransform<ParametersValueType, Dimension>;
+
+  auto flattener = FlattenerType::New();
+
+  ITK_EXERCISE_BASIC_OBJECT_METHODS(flattener, CompositeTransformFlattener, Object);
+
+  // Updating without a composite transform or a reference image fails
+  ITK_TRY_EXPECT_EXCEPTION(flattener->Update());
+
+  // Displacement field defined on a coarser grid than the reference image
+  DisplacementFieldType::SizeType fieldSize;
+  fieldSize.Fill(12);
+  DisplacementFieldType::SpacingType fieldSpacing;
+  fieldSpacing.Fill(3.0);
+  auto field = DisplacementFieldType::New();
+  field->SetRegions(fieldSize);
+  field->SetSpacing(fieldSpacing);
+  field->Allocate();
+
+  itk::ImageRegionIteratorWithIndex<DisplacementFieldType> fieldIt(field, field->GetLargestPossibleRegion());
+  for (fieldIt.GoToBegin(); !fieldIt.IsAtEnd(); ++fieldIt)
+  {
+    DisplacementFieldType::PixelType displacement;
+    displacement[0] = 1.5 * std::sin(0.4 * fieldIt.GetIndex()[1]);
+    displacement[1] = -0.75 * std::cos(0.3 * fieldIt.GetIndex()[0]);
+    fieldIt.Set(displacement);
+  }
+
+  auto displacementFieldTransform = DisplacementFieldTransformType::New();
+  displacementFieldTransform->SetDisplacementField(field);
+
+  auto affineTransform = AffineTransformType::New();
+  AffineTransformType::MatrixType matrix;
+  matrix(0, 0) = 1.05;
+  matrix(0, 1) = 0.1;
+  matrix(1, 0) = -0.05;
+  matrix(1, 1) = 0.95;
+  affineTransform->SetMatrix(matrix);
+
+  auto translationTransform = TranslationTransformType::New();
+  TranslationTransformType::OutputVectorType translation;
+  translation[0] = 2.0;
+  translation[1] = -1.0;
+  translationTransform->Translate(translation);
+
+  auto compositeTransform = CompositeTransformType::New();
+  compositeTransform->AddTransform(affineTransform);
+  compositeTransform->AddTransform(displacementFieldTransform);
+  compositeTransform->AddTransform(translationTransform);
+
+  // Reference grid
+  using ReferenceImageType = itk::Image<float, Dimension>;
+  ReferenceImageType::SizeType referenceSize;
+  referenceSize.Fill(32);
+  ReferenceImageType::PointType referenceOrigin;
+  referenceOrigin.Fill(0.5);
+  auto referenceImage = ReferenceImageType::New();
+  referenceImage->SetRegions(referenceSize);
+  referenceImage->SetOrigin(referenceOrigin);
+  referenceImage->Allocate();
+
+  flattener->SetCompositeTransform(compositeTransform);
+  ITK_TEST_SET_GET_VALUE(compositeTransform.GetPointer(), flattener->GetCompositeTransform());
+  flattener->SetReferenceImage(referenceImage);
+  ITK_TEST_SET_GET_VALUE(referenceImage.GetPointer(), flattener->GetReferenceImage());
+  ITK_TEST_SET_GET_VALUE(0, flattener->GetFirstTransformIndex());
+  ITK_TEST_SET_GET_VALUE(0, flattener->GetNumberOfTransformsToFlatten());
+  flattener->SetNumberOfWorkUnits(3);
+  ITK_TEST_SET_GET_VALUE(3, flattener->GetNumberOfWorkUnits());
+
+  // The whole queue
+  ITK_TRY_EXPECT_NO_EXCEPTION(flattener->Update());
+
+  DisplacementFieldTransformType * flattenedTransform = flattener->GetOutput();
+  if (!TransformsMatchOnGrid(compositeTransform.GetPointer(), flattenedTransform, referenceImage.GetPointer()))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Nothing changed, the field is not recomputed
+  const DisplacementFieldType * flattenedField = flattenedTransform->GetDisplacementField();
+  ITK_TRY_EXPECT_NO_EXCEPTION(flattener->Update());
+  ITK_TEST_EXPECT_EQUAL(flattenedField, flattenedTransform->GetDisplacementField());
+  ITK_TEST_EXPECT_EQUAL(flattenedTransform, flattener->GetOutput());
+
+  // Modifying a sub-transform invalidates the field
+  translation[0] = -0.5;
+  translationTransform->Translate(translation);
+  ITK_TRY_EXPECT_NO_EXCEPTION(flattener->Update());
+  ITK_TEST_EXPECT_TRUE(flattenedField != flattenedTransform->GetDisplacementField());
+  if (!TransformsMatchOnGrid(compositeTransform.GetPointer(), flattenedTransform, referenceImage.GetPointer()))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // So does modifying the field of a displacement field transform in place
+  flattenedField = flattenedTransform->GetDisplacementField();
+  for (fieldIt.GoToBegin(); !fieldIt.IsAtEnd(); ++fieldIt)
+  {
+    fieldIt.Set(fieldIt.Get() * 0.5);
+  }
+  field->Modified();
+  ITK_TRY_EXPECT_NO_EXCEPTION(flattener->Update());
+  ITK_TEST_EXPECT_TRUE(flattenedField != flattenedTransform->GetDisplacementField());
+  if (!TransformsMatchOnGrid(compositeTransform.GetPointer(), flattenedTransform, referenceImage.GetPointer()))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // A sub-range of the queue
+  flattener->SetFirstTransformIndex(1);
+  ITK_TEST_SET_GET_VALUE(1, flattener->GetFirstTransformIndex());
+  ITK_TRY_EXPECT_NO_EXCEPTION(flattener->Update());
+
+  auto subCompositeTransform = CompositeTransformType::New();
+  subCompositeTransform->AddTransform(displacementFieldTransform);
+  subCompositeTransform->AddTransform(translationTransform);
+  if (!TransformsMatchOnGrid(subCompositeTransform.GetPointer(), flattenedTransform, referenceImage.GetPointer()))
+  {
+    return EXIT_FAILURE;
+  }
+
+  flattener->SetNumberOfTransformsToFlatten(1);
+  ITK_TEST_SET_GET_VALUE(1, flattener->GetNumberOfTransformsToFlatten());
+  ITK_TRY_EXPECT_NO_EXCEPTION(flattener->Update());
+  if (!TransformsMatchOnGrid(
+        displacementFieldTransform.GetPointer(), flattenedTransform, referenceImage.GetPointer()))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // The range must lie in the queue
+  flattener->SetNumberOfTransformsToFlatten(3);
+  ITK_TRY_EXPECT_EXCEPTION(flattener->Update());
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
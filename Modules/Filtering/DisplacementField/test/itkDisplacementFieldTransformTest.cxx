@@ -435,6 +435,23 @@ itkDisplacementFieldTransformTest(int argc, char * argv[])
     return EXIT_FAILURE;
   }
 
+  // Test transforming a block of points, one of them outside of the field
+  DisplacementTransformType::InputPointType blockPoints[2];
+  blockPoints[0] = testPoint;
+  blockPoints[1][0] = -100.0;
+  blockPoints[1][1] = 100.0;
+  DisplacementTransformType::OutputPointType blockOutput[2];
+  displacementTransform->TransformPoints(blockPoints, blockOutput, 2);
+  for (unsigned int i = 0; i < 2; ++i)
+  {
+    if (blockOutput[i] != displacementTransform->TransformPoint(blockPoints[i]))
+    {
+      std::cout << "Error transforming point " << i << ": TransformPoints(...)" << std::endl;
+      std::cout << "Test failed!" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
   DisplacementTransformType::InputVectorType  testVector;
   DisplacementTransformType::OutputVectorType deformVector, deformVectorTruth;
   testVector[0] = 0.5;
@@ -17,6 +17,7 @@
  *=========================================================================*/
 
 #include "itkExponentialDisplacementFieldImageFilter.h"
+#include "itkImageRegionIteratorWithIndex.h"
 #include "itkTestingMacros.h"
 #include "vnl/vnl_random.h"
 
@@ -23,11 +23,11 @@
 int
 itkInvertDisplacementFieldImageFilterTest(int argc, char * argv[])
 {
-  if (argc != 5)
+  if (argc != 6)
   {
     std::cerr << "Missing parameters." << std::endl;
     std::cerr << "Usage: " << itkNameOfTestExecutableMacro(argv)
-              << " numberOfIterations meanTolerance maxTolerance enforceBoundaryCondition" << std::endl;
+              << " numberOfIterations meanTolerance maxTolerance enforceBoundaryCondition numberOfLevels" << std::endl;
     return EXIT_FAILURE;
   }
 
@@ -109,6 +109,10 @@ itkInvertDisplacementFieldImageFilterTest(int argc, char * argv[])
   auto enforceBoundaryCondition = static_cast<bool>(std::stoi(argv[4]));
   ITK_TEST_SET_GET_BOOLEAN(inverter, EnforceBoundaryCondition, enforceBoundaryCondition);
 
+  auto numberOfLevels = static_cast<unsigned int>(std::stoi(argv[5]));
+  inverter->SetNumberOfLevels(numberOfLevels);
+  ITK_TEST_SET_GET_VALUE(numberOfLevels, inverter->GetNumberOfLevels());
+
   inverter->SetInput(field);
   ITK_TEST_SET_GET_VALUE(field, inverter->GetDisplacementField());
 
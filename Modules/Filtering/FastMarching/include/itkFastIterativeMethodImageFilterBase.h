@@ -0,0 +1,145 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#ifndef itkFastIterativeMethodImageFilterBase_h
+#define itkFastIterativeMethodImageFilterBase_h
+
+#include "itkFastMarchingImageFilterBase.h"
+
+#include <vector>
+
+namespace itk
+{
+/**
+ * \class FastIterativeMethodImageFilterBase
+ * \brief Solve an Eikonal equation on an image with the Fast Iterative Method.
+ *
+ * This filter computes the same upwind discretization of the Eikonal
+ * equation as FastMarchingImageFilterBase, but does not visit the nodes in
+ * increasing order of arrival time. Instead, it maintains a list of active
+ * nodes that are all updated concurrently from the current values of their
+ * neighbors (Jacobi iterations). A node leaves the list when its value no
+ * longer decreases, and its neighbors are added to the list if their value
+ * can be improved. The iterations stop when the list is empty.
+ *
+ * Because the active list is processed in parallel and no priority queue
+ * is needed, this filter scales to large domains on many cores. Updates are
+ * computed from a snapshot of the output, so results do not depend on the
+ * number of threads.
+ *
+ * The filter accepts the same inputs as FastMarchingImageFilterBase: speed
+ * image or speed constant, alive, trial and forbidden points. Alive and
+ * trial points keep the values they are given. Since nodes are not
+ * accepted in arrival order:
+ * \li the stopping criterion is optional. When it is a
+ * FastMarchingThresholdStoppingCriterion, nodes whose value reaches the
+ * threshold do not propagate the front further; other criteria are
+ * rejected.
+ * \li topology checks are not supported.
+ * \li processed points, if collected, are sorted by arrival time once the
+ * iterations are done.
+ *
+ * Reference:
+ * W.-K. Jeong and R. T. Whitaker. "A Fast Iterative Method for Eikonal
+ * Equations", SIAM Journal on Scientific Computing, 30(5):2512-2534, 2008.
+ *
+ * \sa FastMarchingImageFilterBase
+ * \sa FastMarchingThresholdStoppingCriterion
+ *
+ * \ingroup ITKFastMarching
+ */
+template <typename TInput, typename TOutput>
+class ITK_TEMPLATE_EXPORT FastIterativeMethodImageFilterBase : public FastMarchingImageFilterBase<TInput, TOutput>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(FastIterativeMethodImageFilterBase);
+
+  using Self = FastIterativeMethodImageFilterBase;
+  using Superclass = FastMarchingImageFilterBase<TInput, TOutput>;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+  using typename Superclass::Traits;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(FastIterativeMethodImageFilterBase, FastMarchingImageFilterBase);
+
+  using typename Superclass::OutputImageType;
+  using typename Superclass::OutputPixelType;
+  using typename Superclass::NodeType;
+  using typename Superclass::NodePairType;
+  using typename Superclass::NodePairContainerType;
+  using typename Superclass::InternalNodeStructure;
+  using typename Superclass::InternalNodeStructureArray;
+
+  static constexpr unsigned int ImageDimension = Superclass::ImageDimension;
+
+  using NodeListType = std::vector<NodeType>;
+
+  /** Set/Get the decrease of a node value below which the node is
+   * considered converged. */
+  itkSetMacro(ConvergenceTolerance, double);
+  itkGetConstMacro(ConvergenceTolerance, double);
+
+  /** Set/Get the maximum number of iterations over the active list. Zero,
+   * the default, iterates until the active list is empty. */
+  itkSetMacro(MaximumNumberOfIterations, SizeValueType);
+  itkGetConstMacro(MaximumNumberOfIterations, SizeValueType);
+
+  /** Get the number of iterations performed by the last update. */
+  itkGetConstMacro(NumberOfIterations, SizeValueType);
+
+protected:
+  FastIterativeMethodImageFilterBase() = default;
+  ~FastIterativeMethodImageFilterBase() override = default;
+
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+  void
+  GenerateData() override;
+
+  /** Compute the arrival time of a node from the current values of its
+   * neighbors. Only reads the output and label images, so it can be called
+   * concurrently for different nodes. */
+  double
+  ComputeArrivalTime(OutputImageType * oImage, const NodeType & iNode) const;
+
+  /** Append to ioCandidates the neighbors of iNode whose value can change,
+   * i.e. that are neither alive, initial trial nor forbidden nodes. */
+  void
+  AppendCandidateNeighbors(const NodeType & iNode, NodeListType & ioCandidates) const;
+
+  /** Returns true if the value of the node is given by the user. */
+  bool
+  IsFixedNode(const NodeType & iNode) const;
+
+private:
+  double        m_ConvergenceTolerance{ 1e-6 };
+  SizeValueType m_MaximumNumberOfIterations{ 0 };
+  SizeValueType m_NumberOfIterations{ 0 };
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkFastIterativeMethodImageFilterBase.hxx"
+#endif
+
+#endif // itkFastIterativeMethodImageFilterBase_h
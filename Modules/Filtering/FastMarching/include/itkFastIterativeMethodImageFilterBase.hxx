@@ -0,0 +1,313 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#ifndef itkFastIterativeMethodImageFilterBase_hxx
+#define itkFastIterativeMethodImageFilterBase_hxx
+
+#include "itkFastMarchingThresholdStoppingCriterion.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
+#include "itkMultiThreaderBase.h"
+#include <algorithm>
+
+namespace itk
+{
+
+template <typename TInput, typename TOutput>
+bool
+FastIterativeMethodImageFilterBase<TInput, TOutput>::IsFixedNode(const NodeType & iNode) const
+{
+  const unsigned char label = this->m_LabelImage->GetPixel(iNode);
+  return (label == Traits::Alive) || (label == Traits::InitialTrial) || (label == Traits::Forbidden);
+}
+
+template <typename TInput, typename TOutput>
+void
+FastIterativeMethodImageFilterBase<TInput, TOutput>::AppendCandidateNeighbors(const NodeType & iNode,
+                                                                             NodeListType &   ioCandidates) const
+{
+  NodeType neighbor = iNode;
+
+  for (unsigned int j = 0; j < ImageDimension; ++j)
+  {
+    for (int s = -1; s < 2; s += 2)
+    {
+      const typename NodeType::IndexValueType temp = iNode[j] + s;
+
+      if ((temp <= this->m_LastIndex[j]) && (temp >= this->m_StartIndex[j]))
+      {
+        neighbor[j] = temp;
+        if (!this->IsFixedNode(neighbor))
+        {
+          ioCandidates.push_back(neighbor);
+        }
+      }
+    }
+    neighbor[j] = iNode[j];
+  }
+}
+
+template <typename TInput, typename TOutput>
+double
+FastIterativeMethodImageFilterBase<TInput, TOutput>::ComputeArrivalTime(OutputImageType * oImage,
+                                                                       const NodeType &  iNode) const
+{
+  InternalNodeStructureArray neighbors;
+  NodeType                   neighbor = iNode;
+  bool                       isReached = false;
+
+  for (unsigned int j = 0; j < ImageDimension; ++j)
+  {
+    InternalNodeStructure & upwind = neighbors[j];
+    upwind.m_Node = iNode;
+    upwind.m_Value = this->m_LargeValue;
+    upwind.m_Axis = j;
+
+    // Find smallest valued neighbor in this dimension, whatever its label,
+    // except for forbidden nodes whose value is meaningless
+    for (int s = -1; s < 2; s += 2)
+    {
+      const typename NodeType::IndexValueType temp = iNode[j] + s;
+
+      if ((temp <= this->m_LastIndex[j]) && (temp >= this->m_StartIndex[j]))
+      {
+        neighbor[j] = temp;
+        if (this->m_LabelImage->GetPixel(neighbor) != Traits::Forbidden)
+        {
+          const OutputPixelType value = oImage->GetPixel(neighbor);
+          if (value < upwind.m_Value)
+          {
+            upwind.m_Value = value;
+            upwind.m_Node = neighbor;
+          }
+        }
+      }
+    }
+    neighbor[j] = iNode[j];
+
+    isReached = isReached || (upwind.m_Value < this->m_LargeValue);
+  }
+
+  if (!isReached)
+  {
+    return static_cast<double>(this->m_LargeValue);
+  }
+  return this->Solve(oImage, iNode, neighbors);
+}
+
+template <typename TInput, typename TOutput>
+void
+FastIterativeMethodImageFilterBase<TInput, TOutput>::GenerateData()
+{
+  OutputImageType * output = this->GetOutput();
+
+  if (this->m_TrialPoints.IsNull())
+  {
+    itkExceptionMacro(<< "No Trial Nodes");
+  }
+  if (this->m_NormalizationFactor < itk::Math::eps)
+  {
+    itkExceptionMacro(<< "Normalization Factor is null or negative");
+  }
+  if (this->m_SpeedConstant < itk::Math::eps)
+  {
+    itkExceptionMacro(<< "SpeedConstant is null or negative");
+  }
+  if (this->m_TopologyCheck != Superclass::TopologyCheckEnum::Nothing)
+  {
+    itkExceptionMacro(<< "Topology checks require nodes to be accepted in increasing order of arrival time; "
+                      << "use FastMarchingImageFilterBase instead");
+  }
+
+  // Only a threshold criterion does not depend on the order in which nodes
+  // are accepted. It bounds the propagation of the front.
+  auto maximumValue = static_cast<double>(this->m_LargeValue);
+  if (this->m_StoppingCriterion.IsNotNull())
+  {
+    using ThresholdCriterionType = FastMarchingThresholdStoppingCriterion<TInput, TOutput>;
+    auto * thresholdCriterion = dynamic_cast<ThresholdCriterionType *>(this->m_StoppingCriterion.GetPointer());
+    if (thresholdCriterion == nullptr)
+    {
+      itkExceptionMacro(<< "Only FastMarchingThresholdStoppingCriterion can be used with the fast iterative method");
+    }
+    maximumValue = static_cast<double>(thresholdCriterion->GetThreshold());
+    thresholdCriterion->SetDomain(output);
+  }
+
+  if (this->m_CollectPoints && this->m_ProcessedPoints.IsNull())
+  {
+    this->m_ProcessedPoints = NodePairContainerType::New();
+  }
+
+  while (!this->m_Heap.empty())
+  {
+    this->m_Heap.pop();
+  }
+
+  this->InitializeOutput(output);
+
+  // The initial trial nodes have been pushed onto the heap; their ordering
+  // is irrelevant here, they only seed the active list.
+  NodeListType candidates;
+  while (!this->m_Heap.empty())
+  {
+    const NodePairType seed = this->m_Heap.top();
+    this->m_Heap.pop();
+    if (static_cast<double>(seed.GetValue()) < maximumValue)
+    {
+      this->AppendCandidateNeighbors(seed.GetNode(), candidates);
+    }
+  }
+
+  MultiThreaderBase * multiThreader = this->GetMultiThreader();
+  multiThreader->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+
+  NodeListType        activeList;
+  NodeListType        convergedNodes;
+  std::vector<double> values;
+
+  m_NumberOfIterations = 0;
+
+  for (;;)
+  {
+    // Evaluate the candidates, all from the same snapshot of the output, and
+    // activate those whose value decreases.
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+    values.resize(candidates.size());
+    multiThreader->ParallelizeArray(
+      0,
+      candidates.size(),
+      [this, output, &candidates, &values](SizeValueType i) {
+        values[i] = this->ComputeArrivalTime(output, candidates[i]);
+      },
+      nullptr);
+
+    for (SizeValueType i = 0; i < candidates.size(); ++i)
+    {
+      const auto value = static_cast<OutputPixelType>(values[i]);
+      if (value < output->GetPixel(candidates[i]))
+      {
+        output->SetPixel(candidates[i], value);
+        this->m_LabelImage->SetPixel(candidates[i], Traits::Trial);
+        activeList.push_back(candidates[i]);
+      }
+    }
+    candidates.clear();
+
+    std::sort(activeList.begin(), activeList.end());
+    activeList.erase(std::unique(activeList.begin(), activeList.end()), activeList.end());
+
+    if (activeList.empty() ||
+        (m_MaximumNumberOfIterations > 0 && m_NumberOfIterations >= m_MaximumNumberOfIterations))
+    {
+      break;
+    }
+
+    // Jacobi update of the active nodes
+    values.resize(activeList.size());
+    multiThreader->ParallelizeArray(
+      0,
+      activeList.size(),
+      [this, output, &activeList, &values](SizeValueType i) {
+        values[i] = this->ComputeArrivalTime(output, activeList[i]);
+      },
+      nullptr);
+
+    // Nodes whose value still decreases remain active; the neighbors of the
+    // converged ones become candidates for the next iteration. Values are
+    // compared once converted to the output pixel type, so that differences
+    // lost in the conversion do not keep nodes active.
+    convergedNodes.clear();
+    SizeValueType numberOfActiveNodes = 0;
+    for (SizeValueType i = 0; i < activeList.size(); ++i)
+    {
+      const NodeType &      node = activeList[i];
+      const OutputPixelType current = output->GetPixel(node);
+      const OutputPixelType updated = std::min(current, static_cast<OutputPixelType>(values[i]));
+
+      if (updated < current)
+      {
+        output->SetPixel(node, updated);
+      }
+
+      if (static_cast<double>(current) - static_cast<double>(updated) > m_ConvergenceTolerance)
+      {
+        activeList[numberOfActiveNodes++] = node;
+      }
+      else if (static_cast<double>(updated) < maximumValue)
+      {
+        convergedNodes.push_back(node);
+      }
+    }
+    activeList.resize(numberOfActiveNodes);
+
+    for (const NodeType & node : convergedNodes)
+    {
+      this->AppendCandidateNeighbors(node, candidates);
+    }
+
+    ++m_NumberOfIterations;
+  }
+
+  // Nodes reached before the threshold are now alive
+  OutputPixelType largestValue = NumericTraits<OutputPixelType>::ZeroValue();
+
+  ImageRegionConstIteratorWithIndex<OutputImageType> outIt(output, this->m_BufferedRegion);
+  for (outIt.GoToBegin(); !outIt.IsAtEnd(); ++outIt)
+  {
+    const NodeType      node = outIt.GetIndex();
+    const unsigned char label = this->m_LabelImage->GetPixel(node);
+    const auto          value = static_cast<double>(outIt.Get());
+
+    if ((label == Traits::Trial || label == Traits::InitialTrial) && value < maximumValue)
+    {
+      if (label == Traits::Trial)
+      {
+        this->m_LabelImage->SetPixel(node, Traits::Alive);
+      }
+      largestValue = std::max(largestValue, outIt.Get());
+      if (this->m_CollectPoints)
+      {
+        this->m_ProcessedPoints->push_back(NodePairType(node, outIt.Get()));
+      }
+    }
+  }
+
+  if (this->m_CollectPoints)
+  {
+    std::stable_sort(this->m_ProcessedPoints->begin(), this->m_ProcessedPoints->end());
+  }
+
+  this->m_TargetReachedValue = largestValue;
+}
+
+template <typename TInput, typename TOutput>
+void
+FastIterativeMethodImageFilterBase<TInput, TOutput>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "ConvergenceTolerance: " << m_ConvergenceTolerance << std::endl;
+  os << indent << "MaximumNumberOfIterations: " << m_MaximumNumberOfIterations << std::endl;
+  os << indent << "NumberOfIterations: " << m_NumberOfIterations << std::endl;
+}
+
+} // end namespace itk
+
+#endif // itkFastIterativeMethodImageFilterBase_hxx
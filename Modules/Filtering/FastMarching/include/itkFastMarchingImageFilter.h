@@ -21,6 +21,7 @@
 #include "itkImageToImageFilter.h"
 #include "itkImageRegionConstIteratorWithIndex.h"
 #include "itkLevelSet.h"
+#include "itkFastMarchingIndexedHeap.h"
 #include "itkMath.h"
 #include "ITKFastMarchingExport.h"
 
@@ -68,7 +69,7 @@ extern ITKFastMarching_EXPORT std::ostream &
  *
  * Updates are performed using an entropy satisfy scheme where only
  * "upwind" neighborhoods are used. This implementation of Fast Marching
- * uses a std::priority_queue to locate the next proper grid position to
+ * uses a FastMarchingIndexedHeap to locate the next proper grid position to
  * update.
  *
  * Fast Marching sweeps through N grid points in (N log N) steps to obtain
@@ -115,17 +116,10 @@ extern ITKFastMarching_EXPORT std::ostream &
  *
  * For an alternative implementation, see itk::FastMarchingImageFilter.
  *
- * Possible Improvements:
- * In the current implementation, std::priority_queue only allows
- * taking nodes out from the front and putting nodes in from the back.
- * To update a value already on the heap, a new node is added to the heap.
- * The defunct old node is left on the heap. When it is removed from the
- * top, it will be recognized as invalid and not used.
- * Future implementations can implement the heap in a different way
- * allowing the values to be updated. This will generally require
- * some sift-up and sift-down functions and
- * an image of back-pointers going from the image to heap in order
- * to locate the node which is to be updated.
+ * Trial points are keyed by their offset in the output buffer. When the
+ * value of a trial point already on the heap is updated, the existing node
+ * is moved up or down the heap instead of a new node being added, so each
+ * grid position has at most one node on the heap.
  *
  * \sa FastMarchingImageFilterBase
  * \sa LevelSetTypeDefault
@@ -455,9 +449,7 @@ private:
   /** Trial points are stored in a min-heap. This allow efficient access
    * to the trial point with minimum value which is the next grid point
    * the algorithm processes. */
-  using HeapContainer = std::vector<AxisNodeType>;
-  using NodeComparer = std::greater<AxisNodeType>;
-  using HeapType = std::priority_queue<AxisNodeType, HeapContainer, NodeComparer>;
+  using HeapType = FastMarchingIndexedHeap<AxisNodeType, OffsetValueType>;
 
   HeapType m_TrialHeap;
 
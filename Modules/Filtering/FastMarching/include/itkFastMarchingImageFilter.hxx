@@ -221,11 +221,8 @@ FastMarchingImageFilter<TLevelSet, TSpeedImage>::Initialize(LevelSetImageType *
     }
   }
 
-  // make sure the heap is empty
-  while (!m_TrialHeap.empty())
-  {
-    m_TrialHeap.pop();
-  }
+  // make sure the heap is empty, with a back-pointer per output pixel
+  m_TrialHeap.SetNumberOfKeys(m_BufferedRegion.GetNumberOfPixels());
 
   // process the input trial points
   if (m_TrialPoints)
@@ -248,7 +245,7 @@ FastMarchingImageFilter<TLevelSet, TSpeedImage>::Initialize(LevelSetImageType *
         outputPixel = node.GetValue();
         output->SetPixel(idx, outputPixel);
 
-        m_TrialHeap.push(node);
+        m_TrialHeap.Push(output->ComputeOffset(idx), node);
       }
       ++pointsIter;
     }
@@ -285,11 +282,11 @@ FastMarchingImageFilter<TLevelSet, TSpeedImage>::GenerateData()
   this->UpdateProgress(0.0); // Send first progress event
 
   // CACHE
-  while (!m_TrialHeap.empty())
+  while (!m_TrialHeap.Empty())
   {
     // get the node with the smallest value
-    node = m_TrialHeap.top();
-    m_TrialHeap.pop();
+    node = m_TrialHeap.Top();
+    m_TrialHeap.Pop();
 
     // does this node contain the current value ?
     currentValue = static_cast<double>(output->GetPixel(node.GetIndex()));
@@ -493,7 +490,7 @@ FastMarchingImageFilter<TLevelSet, TSpeedImage>::UpdateValue(const IndexType &
     m_LabelImage->SetPixel(index, LabelEnum::TrialPoint);
     node.SetValue(outputPixel);
     node.SetIndex(index);
-    m_TrialHeap.push(node);
+    m_TrialHeap.Push(output->ComputeOffset(index), node);
   }
 
   return solution;
@@ -0,0 +1,312 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#ifndef itkFastMarchingIndexedHeap_h
+#define itkFastMarchingIndexedHeap_h
+
+#include "itkIntTypes.h"
+#include "itkMacro.h"
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace itk
+{
+/**
+ * \class FastMarchingIndexedHeap
+ * \brief Binary min-heap of trial nodes supporting in-place updates.
+ *
+ * Each node is stored together with a key, typically the offset of the
+ * node in the output buffer. Pushing a node whose key is already in the
+ * heap updates its value and restores the heap property instead of
+ * inserting a duplicate, so the heap never holds more than one entry per
+ * node.
+ *
+ * Back-pointers from keys to heap positions are kept in a flat array of
+ * 32-bit positions indexed by key, so moving a node while restoring the heap
+ * property is a single store. The keys must lie in [0, NumberOfKeys), where
+ * NumberOfKeys is set once with SetNumberOfKeys(), typically to the number
+ * of pixels of the output buffer. The array costs 4 bytes per key whatever
+ * the number of nodes in the heap, that is as much memory as a float image
+ * of the same size.
+ *
+ * When NumberOfKeys exceeds MaximumNumberOfDenseKeys, positions would not
+ * fit in 32 bits and the array would be larger than the output image, so the
+ * back-pointers are kept in a hash table instead. Its size follows the
+ * number of nodes in the heap, at the cost of a hash lookup per move.
+ *
+ * TNode must be copyable and provide operator<. TKey must be an integral
+ * type.
+ *
+ * \ingroup ITKFastMarching
+ */
+template <typename TNode, typename TKey = OffsetValueType>
+class FastMarchingIndexedHeap
+{
+public:
+  using Self = FastMarchingIndexedHeap;
+  using NodeType = TNode;
+  using KeyType = TKey;
+  using SizeType = std::size_t;
+
+  /** Largest number of keys for which the back-pointers are kept in a flat
+   * array. Heap positions are below the number of keys, so they fit in the
+   * 32-bit entries of the array. */
+  static constexpr SizeType MaximumNumberOfDenseKeys = std::numeric_limits<std::uint32_t>::max();
+
+  /** Returns true if the heap holds no node. */
+  bool
+  Empty() const
+  {
+    return m_Heap.empty();
+  }
+
+  /** Number of nodes in the heap. */
+  SizeType
+  Size() const
+  {
+    return m_Heap.size();
+  }
+
+  /** Remove all nodes and set the range of the keys to [0, numberOfKeys). */
+  void
+  SetNumberOfKeys(SizeType numberOfKeys)
+  {
+    m_Heap.clear();
+    m_NumberOfKeys = numberOfKeys;
+    m_UseDensePositions = numberOfKeys <= MaximumNumberOfDenseKeys;
+    if (m_UseDensePositions)
+    {
+      m_DensePosition.assign(numberOfKeys, InvalidDensePosition);
+      m_SparsePosition = SparsePositionType();
+    }
+    else
+    {
+      m_DensePosition = DensePositionContainerType();
+      m_SparsePosition.clear();
+    }
+  }
+
+  /** Number of keys the heap can hold. */
+  SizeType
+  GetNumberOfKeys() const
+  {
+    return m_NumberOfKeys;
+  }
+
+  /** Returns true if the back-pointers are kept in a flat array, false if
+   * they are kept in a hash table. */
+  bool
+  GetUseDensePositions() const
+  {
+    return m_UseDensePositions;
+  }
+
+  /** Remove all nodes. The range of the keys is kept. */
+  void
+  Clear()
+  {
+    if (m_UseDensePositions)
+    {
+      for (const EntryType & entry : m_Heap)
+      {
+        m_DensePosition[static_cast<SizeType>(entry.first)] = InvalidDensePosition;
+      }
+    }
+    else
+    {
+      m_SparsePosition.clear();
+    }
+    m_Heap.clear();
+  }
+
+  /** Returns true if a node with the given key is in the heap. */
+  bool
+  Contains(const KeyType & key) const
+  {
+    return this->GetPosition(key) != InvalidPosition;
+  }
+
+  /** Node with the smallest value. The heap must not be empty. */
+  const NodeType &
+  Top() const
+  {
+    return m_Heap.front().second;
+  }
+
+  /** Remove the node with the smallest value. The heap must not be empty. */
+  void
+  Pop()
+  {
+    this->ErasePosition(m_Heap.front().first);
+    if (m_Heap.size() > 1)
+    {
+      m_Heap.front() = std::move(m_Heap.back());
+      m_Heap.pop_back();
+      this->SetPosition(m_Heap.front().first, 0);
+      this->SiftDown(0);
+    }
+    else
+    {
+      m_Heap.pop_back();
+    }
+  }
+
+  /** Insert a node, or replace the node already stored under the same key. */
+  void
+  Push(const KeyType & key, const NodeType & node)
+  {
+    const SizeType keyPosition = this->GetPosition(key);
+    if (keyPosition == InvalidPosition)
+    {
+      const SizeType position = m_Heap.size();
+      m_Heap.emplace_back(key, node);
+      this->SetPosition(key, position);
+      this->SiftUp(position);
+    }
+    else
+    {
+      const SizeType position = keyPosition;
+      const bool     decreased = node < m_Heap[position].second;
+      m_Heap[position].second = node;
+      if (decreased)
+      {
+        this->SiftUp(position);
+      }
+      else
+      {
+        this->SiftDown(position);
+      }
+    }
+  }
+
+private:
+  using EntryType = std::pair<KeyType, NodeType>;
+  using DensePositionType = std::uint32_t;
+  using DensePositionContainerType = std::vector<DensePositionType>;
+  using SparsePositionType = std::unordered_map<KeyType, SizeType>;
+
+  static constexpr SizeType          InvalidPosition = std::numeric_limits<SizeType>::max();
+  static constexpr DensePositionType InvalidDensePosition = std::numeric_limits<DensePositionType>::max();
+
+  SizeType
+  CheckedKey(const KeyType & key) const
+  {
+    itkAssertInDebugAndIgnoreInReleaseMacro(static_cast<SizeType>(key) < m_NumberOfKeys);
+    return static_cast<SizeType>(key);
+  }
+
+  SizeType
+  GetPosition(const KeyType & key) const
+  {
+    if (m_UseDensePositions)
+    {
+      const DensePositionType position = m_DensePosition[this->CheckedKey(key)];
+      return position == InvalidDensePosition ? InvalidPosition : SizeType{ position };
+    }
+    const auto it = m_SparsePosition.find(static_cast<KeyType>(this->CheckedKey(key)));
+    return it == m_SparsePosition.end() ? InvalidPosition : it->second;
+  }
+
+  void
+  SetPosition(const KeyType & key, SizeType position)
+  {
+    if (m_UseDensePositions)
+    {
+      m_DensePosition[static_cast<SizeType>(key)] = static_cast<DensePositionType>(position);
+    }
+    else
+    {
+      m_SparsePosition[key] = position;
+    }
+  }
+
+  void
+  ErasePosition(const KeyType & key)
+  {
+    if (m_UseDensePositions)
+    {
+      m_DensePosition[static_cast<SizeType>(key)] = InvalidDensePosition;
+    }
+    else
+    {
+      m_SparsePosition.erase(key);
+    }
+  }
+
+  void
+  SiftUp(SizeType position)
+  {
+    EntryType entry = std::move(m_Heap[position]);
+    while (position > 0)
+    {
+      const SizeType parent = (position - 1) / 2;
+      if (!(entry.second < m_Heap[parent].second))
+      {
+        break;
+      }
+      this->MoveTo(position, std::move(m_Heap[parent]));
+      position = parent;
+    }
+    this->MoveTo(position, std::move(entry));
+  }
+
+  void
+  SiftDown(SizeType position)
+  {
+    const SizeType size = m_Heap.size();
+    EntryType      entry = std::move(m_Heap[position]);
+    for (;;)
+    {
+      SizeType child = 2 * position + 1;
+      if (child >= size)
+      {
+        break;
+      }
+      if (child + 1 < size && m_Heap[child + 1].second < m_Heap[child].second)
+      {
+        ++child;
+      }
+      if (!(m_Heap[child].second < entry.second))
+      {
+        break;
+      }
+      this->MoveTo(position, std::move(m_Heap[child]));
+      position = child;
+    }
+    this->MoveTo(position, std::move(entry));
+  }
+
+  void
+  MoveTo(SizeType position, EntryType && entry)
+  {
+    this->SetPosition(entry.first, position);
+    m_Heap[position] = std::move(entry);
+  }
+
+  std::vector<EntryType>     m_Heap;
+  DensePositionContainerType m_DensePosition;
+  SparsePositionType         m_SparsePosition;
+  SizeType                   m_NumberOfKeys{ 0 };
+  bool                       m_UseDensePositions{ true };
+};
+} // end namespace itk
+
+#endif // itkFastMarchingIndexedHeap_h
@@ -0,0 +1,217 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkFastIterativeMethodImageFilterBase.h"
+#include "itkFastMarchingThresholdStoppingCriterion.h"
+#include "itkFastMarchingNumberOfElementsStoppingCriterion.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkTestingMacros.h"
+
+namespace
+{
+constexpr unsigned int Dimension = 2;
+using PixelType = float;
+using ImageType = itk::Image<PixelType, Dimension>;
+
+using FastIterativeType = itk::FastIterativeMethodImageFilterBase<ImageType, ImageType>;
+using FastMarchingType = itk::FastMarchingImageFilterBase<ImageType, ImageType>;
+using CriterionType = itk::FastMarchingThresholdStoppingCriterion<ImageType, ImageType>;
+using NodePairType = FastMarchingType::NodePairType;
+using NodePairContainerType = FastMarchingType::NodePairContainerType;
+
+ImageType::Pointer
+CreateSpeedImage(bool varying)
+{
+  ImageType::SizeType   size = { { 48, 40 } };
+  ImageType::RegionType region;
+  region.SetSize(size);
+
+  auto speed = ImageType::New();
+  speed->SetRegions(region);
+  speed->Allocate();
+
+  itk::ImageRegionIteratorWithIndex<ImageType> it(speed, region);
+  for (it.GoToBegin(); !it.IsAtEnd(); ++it)
+  {
+    const ImageType::IndexType idx = it.GetIndex();
+    PixelType                  value = 1.0;
+    if (varying)
+    {
+      // Slow band with a gap, plus a smooth variation
+      value = 0.5f + 0.02f * static_cast<PixelType>(idx[0] % 10);
+      if (idx[0] == 24 && idx[1] > 8)
+      {
+        value = 0.05f;
+      }
+    }
+    it.Set(value);
+  }
+  return speed;
+}
+
+NodePairContainerType::Pointer
+CreateTrialPoints()
+{
+  auto trial = NodePairContainerType::New();
+
+  ImageType::IndexType index = { { 5, 7 } };
+  trial->push_back(NodePairType(index, 0.0));
+
+  index[0] = 40;
+  index[1] = 30;
+  trial->push_back(NodePairType(index, 2.0));
+
+  return trial;
+}
+
+template <typename TFilter>
+void
+SetupFilter(TFilter * filter, ImageType * speed, PixelType threshold)
+{
+  auto criterion = CriterionType::New();
+  criterion->SetThreshold(threshold);
+
+  filter->SetInput(speed);
+  filter->SetTrialPoints(CreateTrialPoints());
+  filter->SetStoppingCriterion(criterion);
+  filter->SetCollectPoints(true);
+}
+
+bool
+CompareOutputs(ImageType * fim, ImageType * fmm, PixelType threshold, double tolerance)
+{
+  bool passed = true;
+
+  itk::ImageRegionIteratorWithIndex<ImageType> it(fmm, fmm->GetBufferedRegion());
+  for (it.GoToBegin(); !it.IsAtEnd(); ++it)
+  {
+    const PixelType expected = it.Get();
+    const PixelType value = fim->GetPixel(it.GetIndex());
+
+    // Beyond the threshold, both filters leave partially computed values
+    if (expected >= threshold && value >= threshold)
+    {
+      continue;
+    }
+    if (itk::Math::abs(expected - value) > tolerance * std::max(1.0f, expected))
+    {
+      std::cerr << "Mismatch at " << it.GetIndex() << ": expected " << expected << ", got " << value << std::endl;
+      passed = false;
+    }
+  }
+  return passed;
+}
+
+bool
+RunComparison(bool varying, PixelType threshold)
+{
+  ImageType::Pointer speed = CreateSpeedImage(varying);
+
+  auto fmm = FastMarchingType::New();
+  SetupFilter(fmm.GetPointer(), speed, threshold);
+  fmm->Update();
+
+  auto fim = FastIterativeType::New();
+  SetupFilter(fim.GetPointer(), speed, threshold);
+  fim->SetConvergenceTolerance(1e-7);
+  fim->Update();
+
+  std::cout << "Speed " << (varying ? "varying" : "constant") << ", threshold " << threshold << ": "
+            << fim->GetNumberOfIterations() << " iterations, " << fim->GetProcessedPoints()->size()
+            << " processed points" << std::endl;
+
+  bool passed = CompareOutputs(fim->GetOutput(), fmm->GetOutput(), threshold, 1e-4);
+
+  // Processed points must be sorted by arrival time
+  const NodePairContainerType * processed = fim->GetProcessedPoints();
+  for (size_t i = 1; i < processed->size(); ++i)
+  {
+    if (processed->ElementAt(i).GetValue() < processed->ElementAt(i - 1).GetValue())
+    {
+      std::cerr << "Processed points are not sorted" << std::endl;
+      passed = false;
+      break;
+    }
+  }
+
+  // Results do not depend on the number of work units
+  auto fimSingle = FastIterativeType::New();
+  SetupFilter(fimSingle.GetPointer(), speed, threshold);
+  fimSingle->SetConvergenceTolerance(1e-7);
+  fimSingle->SetNumberOfWorkUnits(1);
+  fimSingle->Update();
+
+  if (!CompareOutputs(fimSingle->GetOutput(), fim->GetOutput(), threshold, 0.0))
+  {
+    std::cerr << "Results differ with a single work unit" << std::endl;
+    passed = false;
+  }
+
+  return passed;
+}
+} // namespace
+
+int
+itkFastIterativeMethodImageFilterBaseTest(int, char *[])
+{
+  auto filter = FastIterativeType::New();
+
+  ITK_EXERCISE_BASIC_OBJECT_METHODS(filter, FastIterativeMethodImageFilterBase, FastMarchingImageFilterBase);
+
+  double tolerance = 1e-5;
+  filter->SetConvergenceTolerance(tolerance);
+  ITK_TEST_SET_GET_VALUE(tolerance, filter->GetConvergenceTolerance());
+
+  itk::SizeValueType maximumNumberOfIterations = 10;
+  filter->SetMaximumNumberOfIterations(maximumNumberOfIterations);
+  ITK_TEST_SET_GET_VALUE(maximumNumberOfIterations, filter->GetMaximumNumberOfIterations());
+  filter->SetMaximumNumberOfIterations(0);
+
+  bool passed = true;
+
+  passed &= RunComparison(false, 1e6);
+  passed &= RunComparison(true, 1e6);
+  passed &= RunComparison(true, 20.0);
+
+  // Topology checks need nodes to be accepted in order
+  ImageType::Pointer speed = CreateSpeedImage(false);
+  SetupFilter(filter.GetPointer(), speed, 1e6);
+  filter->SetTopologyCheck(FastIterativeType::TopologyCheckEnum::Strict);
+  ITK_TRY_EXPECT_EXCEPTION(filter->Update());
+
+  // Only threshold stopping criteria are supported
+  filter->SetTopologyCheck(FastIterativeType::TopologyCheckEnum::Nothing);
+  using NumberOfElementsCriterionType = itk::FastMarchingNumberOfElementsStoppingCriterion<ImageType, ImageType>;
+  auto numberOfElementsCriterion = NumberOfElementsCriterionType::New();
+  numberOfElementsCriterion->SetTargetNumberOfElements(100);
+  filter->SetStoppingCriterion(numberOfElementsCriterion);
+  ITK_TRY_EXPECT_EXCEPTION(filter->Update());
+
+  // The stopping criterion is optional
+  filter->SetStoppingCriterion(nullptr);
+  ITK_TRY_EXPECT_NO_EXCEPTION(filter->Update());
+
+  if (!passed)
+  {
+    std::cerr << "Test failed!" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,172 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkFastMarchingIndexedHeap.h"
+#include "itkMersenneTwisterRandomVariateGenerator.h"
+#include "itkTestingMacros.h"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+struct HeapTestNode
+{
+  double               value;
+  itk::OffsetValueType key;
+
+  bool
+  operator<(const HeapTestNode & other) const
+  {
+    return value < other.value;
+  }
+};
+} // namespace
+
+int
+itkFastMarchingIndexedHeapTest(int, char *[])
+{
+  using HeapType = itk::FastMarchingIndexedHeap<HeapTestNode>;
+  using KeyType = HeapType::KeyType;
+
+  HeapType heap;
+  heap.SetNumberOfKeys(16);
+  ITK_TEST_EXPECT_EQUAL(heap.GetNumberOfKeys(), 16);
+  ITK_TEST_EXPECT_TRUE(heap.GetUseDensePositions());
+  ITK_TEST_EXPECT_TRUE(heap.Empty());
+
+  // Pop order follows the values, not the keys or the insertion order
+  heap.Push(5, { 3.0, 5 });
+  heap.Push(2, { 1.0, 2 });
+  heap.Push(9, { 2.0, 9 });
+  heap.Push(0, { 4.0, 0 });
+  ITK_TEST_EXPECT_EQUAL(heap.Size(), 4);
+  ITK_TEST_EXPECT_TRUE(heap.Contains(9));
+  ITK_TEST_EXPECT_TRUE(!heap.Contains(1));
+
+  // Decrease-key moves the node to the top
+  heap.Push(0, { 0.5, 0 });
+  ITK_TEST_EXPECT_EQUAL(heap.Size(), 4);
+  ITK_TEST_EXPECT_EQUAL(heap.Top().value, 0.5);
+  ITK_TEST_EXPECT_EQUAL(heap.Top().key, 0);
+
+  // Increasing the value of a node moves it down
+  heap.Push(2, { 3.5, 2 });
+
+  const double  expectedValues[] = { 0.5, 2.0, 3.0, 3.5 };
+  const KeyType expectedKeys[] = { 0, 9, 5, 2 };
+  for (unsigned int i = 0; i < 4; ++i)
+  {
+    ITK_TEST_EXPECT_EQUAL(heap.Top().value, expectedValues[i]);
+    ITK_TEST_EXPECT_EQUAL(heap.Top().key, expectedKeys[i]);
+    heap.Pop();
+  }
+  ITK_TEST_EXPECT_TRUE(heap.Empty());
+  for (KeyType key = 0; key < 16; ++key)
+  {
+    ITK_TEST_EXPECT_TRUE(!heap.Contains(key));
+  }
+
+  // Clear keeps the range of the keys and forgets the nodes
+  heap.Push(15, { 1.0, 15 });
+  heap.Push(3, { 2.0, 3 });
+  heap.Clear();
+  ITK_TEST_EXPECT_TRUE(heap.Empty());
+  ITK_TEST_EXPECT_TRUE(!heap.Contains(15));
+  ITK_TEST_EXPECT_TRUE(!heap.Contains(3));
+  heap.Push(15, { 1.0, 15 });
+  ITK_TEST_EXPECT_EQUAL(heap.Size(), 1);
+
+  // Random pushes with duplicate keys: each key is popped once, with the
+  // value of its last push, in non-decreasing order
+  constexpr KeyType numberOfKeys = 1000;
+  heap.SetNumberOfKeys(numberOfKeys);
+  ITK_TEST_EXPECT_TRUE(heap.Empty());
+
+  using GeneratorType = itk::Statistics::MersenneTwisterRandomVariateGenerator;
+  GeneratorType::Pointer generator = GeneratorType::New();
+  generator->Initialize(1234);
+
+  std::vector<double> lastValues(numberOfKeys, -1.0);
+  for (KeyType i = 0; i < 10 * numberOfKeys; ++i)
+  {
+    const auto   key = static_cast<KeyType>(generator->GetIntegerVariate(numberOfKeys - 1));
+    const double value = generator->GetUniformVariate(0.0, 100.0);
+    heap.Push(key, { value, key });
+    lastValues[key] = value;
+  }
+
+  const auto numberOfPushedKeys =
+    static_cast<HeapType::SizeType>(std::count_if(lastValues.begin(), lastValues.end(), [](double value) {
+      return value >= 0.0;
+    }));
+  ITK_TEST_EXPECT_EQUAL(heap.Size(), numberOfPushedKeys);
+
+  std::vector<bool> popped(numberOfKeys, false);
+  double            previousValue = 0.0;
+  while (!heap.Empty())
+  {
+    const HeapTestNode node = heap.Top();
+    heap.Pop();
+    ITK_TEST_EXPECT_TRUE(node.value >= previousValue);
+    previousValue = node.value;
+
+    ITK_TEST_EXPECT_EQUAL(node.value, lastValues[node.key]);
+    ITK_TEST_EXPECT_TRUE(!popped[node.key]);
+    popped[node.key] = true;
+  }
+  ITK_TEST_EXPECT_EQUAL(static_cast<HeapType::SizeType>(std::count(popped.begin(), popped.end(), true)),
+                        numberOfPushedKeys);
+
+  // Beyond MaximumNumberOfDenseKeys the back-pointers are hashed, so large
+  // key ranges do not allocate an array of positions
+  constexpr auto largeNumberOfKeys = HeapType::MaximumNumberOfDenseKeys + 1;
+  heap.SetNumberOfKeys(largeNumberOfKeys);
+  ITK_TEST_EXPECT_EQUAL(heap.GetNumberOfKeys(), largeNumberOfKeys);
+  ITK_TEST_EXPECT_TRUE(!heap.GetUseDensePositions());
+  ITK_TEST_EXPECT_TRUE(heap.Empty());
+
+  const auto lastKey = static_cast<KeyType>(largeNumberOfKeys - 1);
+  heap.Push(lastKey, { 2.0, lastKey });
+  heap.Push(7, { 3.0, 7 });
+  heap.Push(lastKey - 1, { 1.0, lastKey - 1 });
+  heap.Push(7, { 0.5, 7 });
+  heap.Push(lastKey, { 4.0, lastKey });
+  ITK_TEST_EXPECT_EQUAL(heap.Size(), 3);
+  ITK_TEST_EXPECT_TRUE(heap.Contains(lastKey));
+  ITK_TEST_EXPECT_TRUE(!heap.Contains(8));
+
+  const double  expectedLargeValues[] = { 0.5, 1.0, 4.0 };
+  const KeyType expectedLargeKeys[] = { 7, lastKey - 1, lastKey };
+  for (unsigned int i = 0; i < 3; ++i)
+  {
+    ITK_TEST_EXPECT_EQUAL(heap.Top().value, expectedLargeValues[i]);
+    ITK_TEST_EXPECT_EQUAL(heap.Top().key, expectedLargeKeys[i]);
+    heap.Pop();
+  }
+  ITK_TEST_EXPECT_TRUE(heap.Empty());
+  ITK_TEST_EXPECT_TRUE(!heap.Contains(7));
+
+  heap.Push(lastKey, { 1.0, lastKey });
+  heap.Clear();
+  ITK_TEST_EXPECT_TRUE(!heap.Contains(lastKey));
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -28,6 +28,7 @@
 #include "itkImageAlgorithm.h"
 
 #include <type_traits> // For is_same.
+#include <vector>
 
 namespace itk
 {
@@ -382,9 +383,17 @@ ResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTran
 
 
   // Create an iterator that will walk the output region for this thread.
-  using OutputIterator = ImageRegionIteratorWithIndex<TOutputImage>;
+  using OutputIterator = ImageScanlineIterator<TOutputImage>;
   OutputIterator outIt(outputPtr, outputRegionForThread);
 
+  // The points of a scan line are transformed by a single call to the
+  // transform, in buffers local to this work unit.
+  using TransformInputPointType = typename TransformType::InputPointType;
+  using TransformOutputPointType = typename TransformType::OutputPointType;
+  const SizeValueType                   lineLength = outputRegionForThread.GetSize(0);
+  std::vector<TransformInputPointType>  transformInputPoints(lineLength);
+  std::vector<TransformOutputPointType> transformOutputPoints(lineLength);
+
   // Define a few indices that will be used to translate from an input pixel
   // to an output pixel
   OutputPointType outputPoint; // Coordinates of current output pixel
@@ -399,34 +408,46 @@ ResampleImageFilter<TInputImage, TOutputImage, TInterpolatorPrecisionType, TTran
 
   while (!outIt.IsAtEnd())
   {
-    // Determine the index of the current output pixel
-    outputPtr->TransformIndexToPhysicalPoint(outIt.GetIndex(), outputPoint);
-
-    // Compute corresponding input pixel position
-    inputPoint = transformPtr->TransformPoint(outputPoint);
-    const bool isInsideInput = inputPtr->TransformPhysicalPointToContinuousIndex(inputPoint, inputIndex);
-
-    OutputType value;
-    // Evaluate input at right position and copy to the output
-    if (m_Interpolator->IsInsideBuffer(inputIndex) && (!isSpecialCoordinatesImage || isInsideInput))
+    // Determine the coordinates of the output pixels of the scan line
+    IndexType index = outIt.GetIndex();
+    for (SizeValueType k = 0; k < lineLength; ++k)
     {
-      value = m_Interpolator->EvaluateAtContinuousIndex(inputIndex);
-      outIt.Set(Self::CastPixelWithBoundsChecking(value));
+      outputPtr->TransformIndexToPhysicalPoint(index, outputPoint);
+      transformInputPoints[k].CastFrom(outputPoint);
+      ++index[0];
     }
-    else
+
+    // Compute corresponding input pixel positions
+    transformPtr->TransformPoints(transformInputPoints.data(), transformOutputPoints.data(), lineLength);
+
+    for (SizeValueType k = 0; k < lineLength; ++k)
     {
-      if (m_Extrapolator.IsNull())
+      inputPoint.CastFrom(transformOutputPoints[k]);
+      const bool isInsideInput = inputPtr->TransformPhysicalPointToContinuousIndex(inputPoint, inputIndex);
+
+      OutputType value;
+      // Evaluate input at right position and copy to the output
+      if (m_Interpolator->IsInsideBuffer(inputIndex) && (!isSpecialCoordinatesImage || isInsideInput))
       {
-        outIt.Set(m_DefaultPixelValue); // default background value
+        value = m_Interpolator->EvaluateAtContinuousIndex(inputIndex);
+        outIt.Set(Self::CastPixelWithBoundsChecking(value));
       }
       else
       {
-        value = m_Extrapolator->EvaluateAtContinuousIndex(inputIndex);
-        outIt.Set(Self::CastPixelWithBoundsChecking(value));
+        if (m_Extrapolator.IsNull())
+        {
+          outIt.Set(m_DefaultPixelValue); // default background value
+        }
+        else
+        {
+          value = m_Extrapolator->EvaluateAtContinuousIndex(inputIndex);
+          outIt.Set(Self::CastPixelWithBoundsChecking(value));
+        }
       }
+      ++outIt;
     }
-    progress.CompletedPixel();
-    ++outIt;
+    progress.Completed(lineLength);
+    outIt.NextLine();
   }
 }
 
@@ -21,6 +21,7 @@
 #include "ITKIOMeshBYUExport.h"
 
 #include "itkMeshIOBase.h"
+#include "itkMeshIOTokenizer.h"
 #include "itkNumberToString.h"
 
 #include <fstream>
@@ -160,6 +161,7 @@ protected:
   PrintSelf(std::ostream & os, Indent indent) const override;
 
 private:
+  MeshIOTokenizer  m_Tokenizer; // content of the file, from ReadMeshInformation() to ReadCells()
   StreamOffsetType m_FilePosition{ 0 };
   SizeValueType    m_PartId;
   SizeValueType    m_FirstCellId;
@@ -62,14 +62,8 @@ BYUMeshIO ::CanWriteFile(const char * fileName)
 void
 BYUMeshIO ::ReadMeshInformation()
 {
-  // Define input file stream and attach it to input file
-  std::ifstream inputFile;
-
-  // Due to the windows couldn't work well for tellg() and seekg() for ASCII mode, hence we
-  // open the file with std::ios::binary
-  inputFile.open(this->m_FileName.c_str(), std::ios::in | std::ios::binary);
-
-  if (!inputFile.is_open())
+  // The file is parsed from memory, until the cells are read
+  if (!m_Tokenizer.ReadFile(this->m_FileName))
   {
     itkExceptionMacro(<< "Unable to open input file " << this->m_FileName);
   }
@@ -79,17 +73,18 @@ BYUMeshIO ::ReadMeshInformation()
   unsigned int numberOfConnectivityEntries = 0;
 
   // Read the number of points and number of cells
-  inputFile >> numberOfParts;
-  inputFile >> this->m_NumberOfPoints;
-  inputFile >> this->m_NumberOfCells;
-  inputFile >> numberOfConnectivityEntries;
+  m_Tokenizer.ReadValue(numberOfParts);
+  m_Tokenizer.ReadValue(this->m_NumberOfPoints);
+  m_Tokenizer.ReadValue(this->m_NumberOfCells);
+  m_Tokenizer.ReadValue(numberOfConnectivityEntries);
 
   // Determine which part to read, default is to readl all parts
   if (m_PartId > numberOfParts)
   {
     for (unsigned int ii = 0; ii < numberOfParts; ++ii)
     {
-      inputFile >> m_FirstCellId >> m_LastCellId;
+      m_Tokenizer.ReadValue(m_FirstCellId);
+      m_Tokenizer.ReadValue(m_LastCellId);
     }
 
     m_FirstCellId = 1;
@@ -101,20 +96,22 @@ BYUMeshIO ::ReadMeshInformation()
     unsigned int lastId;
     for (unsigned int ii = 0; ii < m_PartId; ++ii)
     {
-      inputFile >> firstId >> lastId;
+      m_Tokenizer.ReadValue(firstId);
+      m_Tokenizer.ReadValue(lastId);
     }
 
-    inputFile >> m_FirstCellId;
-    inputFile >> m_LastCellId;
+    m_Tokenizer.ReadValue(m_FirstCellId);
+    m_Tokenizer.ReadValue(m_LastCellId);
 
     for (unsigned int ii = m_PartId + 1; ii < numberOfParts; ++ii)
     {
-      inputFile >> firstId >> lastId;
+      m_Tokenizer.ReadValue(firstId);
+      m_Tokenizer.ReadValue(lastId);
     }
   }
 
   // Determine the start position of points
-  m_FilePosition = inputFile.tellg();
+  m_FilePosition = static_cast<StreamOffsetType>(m_Tokenizer.GetPosition());
 
   /** 6. Set default parameters */
   this->m_PointDimension = 3;
@@ -135,15 +132,8 @@ BYUMeshIO ::ReadMeshInformation()
   // Set default point component type
   this->m_PointComponentType = IOComponentEnum::DOUBLE;
 
-  // Read and omit points
-  double x;
-  for (SizeValueType ii = 0; ii < this->m_NumberOfPoints; ++ii)
-  {
-    for (unsigned int jj = 0; jj < this->m_PointDimension; ++jj)
-    {
-      inputFile >> x;
-    }
-  }
+  // Omit points
+  m_Tokenizer.SkipTokens(this->m_NumberOfPoints * this->m_PointDimension);
 
   // Determine cellbuffersize
   int ptId;
@@ -151,7 +141,10 @@ BYUMeshIO ::ReadMeshInformation()
   SizeValueType numLines = 0;
   while (numLines < this->m_NumberOfCells)
   {
-    inputFile >> ptId;
+    if (!m_Tokenizer.ReadValue(ptId))
+    {
+      itkExceptionMacro(<< "Unexpected end of file while reading cells");
+    }
 
     this->m_CellBufferSize++;
     if (ptId < 0)
@@ -173,76 +166,52 @@ BYUMeshIO ::ReadMeshInformation()
   this->m_CellPixelComponentType = IOComponentEnum::FLOAT;
   this->m_CellPixelType = IOPixelEnum::SCALAR;
   this->m_NumberOfCellPixelComponents = itk::NumericTraits<unsigned int>::OneValue();
-
-  inputFile.close();
 }
 
 void
 BYUMeshIO ::ReadPoints(void * buffer)
 {
-  // Define input file stream and attach it to input file
-  std::ifstream inputFile;
-
-  /** Due to the windows couldn't work well for tellg() and seekg() for ASCII mode, hence we
-  open the file with std::ios::binary */
-  inputFile.open(this->m_FileName.c_str(), std::ios::in | std::ios::binary);
-
-  if (!inputFile.is_open())
-  {
-    itkExceptionMacro(<< "Unable to open input file " << this->m_FileName);
-  }
-
   // Set the position to points start
-  inputFile.seekg(m_FilePosition, std::ios::beg);
-
-  // Number of data array
-  auto * data = static_cast<double *>(buffer);
-
-  // Read points
-  inputFile.precision(12);
+  m_Tokenizer.SetPosition(static_cast<SizeValueType>(m_FilePosition));
 
-  SizeValueType index = 0;
-  for (SizeValueType id = 0; id < this->m_NumberOfPoints; ++id)
+  // Read points, in parallel
+  const SizeValueType numberOfComponents = this->m_NumberOfPoints * this->m_PointDimension;
+  if (m_Tokenizer.ReadValues(static_cast<double *>(buffer), numberOfComponents) != numberOfComponents)
   {
-    for (unsigned int ii = 0; ii < this->m_PointDimension; ++ii)
-    {
-      inputFile >> data[index++];
-    }
+    itkExceptionMacro(<< "Unexpected end of file while reading points");
   }
 
   // Determine cells start position
-  m_FilePosition = inputFile.tellg();
-  inputFile.close();
+  m_FilePosition = static_cast<StreamOffsetType>(m_Tokenizer.GetPosition());
 }
 
 void
 BYUMeshIO ::ReadCells(void * buffer)
 {
-  // Define input file stream and attach it to input file
-  std::ifstream inputFile;
-
-  inputFile.open(this->m_FileName.c_str(), std::ios::in | std::ios::binary);
-
-  if (!inputFile.is_open())
+  // Set the position to current position
+  m_Tokenizer.SetPosition(static_cast<SizeValueType>(m_FilePosition));
+
+  // The point ids are read in parallel at the end of the cell buffer, after
+  // the space for the cell types and numbers of points, and then moved to
+  // their cells
+  auto *              data = static_cast<unsigned int *>(buffer);
+  const SizeValueType numberOfEntries = this->m_CellBufferSize - 2 * this->m_NumberOfCells;
+  unsigned int *      entries = data + 2 * this->m_NumberOfCells;
+  if (m_Tokenizer.ReadValues(entries, numberOfEntries) != numberOfEntries)
   {
-    itkExceptionMacro(<< "Unable to open input file " << this->m_FileName);
+    itkExceptionMacro(<< "Unexpected end of file while reading cells");
   }
+  m_Tokenizer = MeshIOTokenizer();
 
-  // Set the position to current position
-  inputFile.seekg(m_FilePosition, std::ios::beg);
-
-  // Get cell buffer
-  inputFile.precision(12);
-  auto *        data = static_cast<unsigned int *>(buffer);
   SizeValueType numPoints = 0;
   SizeValueType id = itk::NumericTraits<SizeValueType>::ZeroValue();
   SizeValueType index = 2;
   int           ptId;
   m_FirstCellId -= 1;
   m_LastCellId -= 1;
-  while (id < this->m_NumberOfCells)
+  for (SizeValueType ii = 0; ii < numberOfEntries && id < this->m_NumberOfCells; ++ii)
   {
-    inputFile >> ptId;
+    ptId = static_cast<int>(entries[ii]);
     if (ptId >= 0)
     {
       if (id >= m_FirstCellId && id <= m_LastCellId)
@@ -265,8 +234,6 @@ BYUMeshIO ::ReadCells(void * buffer)
       id++;
     }
   }
-
-  inputFile.close();
 }
 
 void
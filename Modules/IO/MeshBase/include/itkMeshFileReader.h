@@ -63,6 +63,10 @@ namespace itk
  * no accepted suffix, so you will have to
  * manually create the MeshIO instance of the write type.
  *
+ * The cells are allocated according to the CellsAllocationMethod of the
+ * output mesh. Setting it to CellsAllocatedInAnArena before the update
+ * avoids allocating the cells one by one when reading large meshes.
+ *
  * \sa MeshIOBase
  *
  * \ingroup IOFilters
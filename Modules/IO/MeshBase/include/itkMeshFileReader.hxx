@@ -137,13 +137,12 @@ MeshFileReader<TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits>::Re
           itkExceptionMacro(<< "Invalid Vertex Cell with number of points = " << numberOfPoints);
         }
         OutputCellAutoPointer cell;
-        auto *                vertexCell = new OutputVertexCellType;
+        auto *                vertexCell = output->template AllocateCell<OutputVertexCellType>(cell);
         for (unsigned int jj = 0; jj < OutputVertexCellType::NumberOfPoints; ++jj)
         {
           vertexCell->SetPointId(jj, static_cast<OutputPointIdentifier>(buffer[index++]));
         }
 
-        cell.TakeOwnership(vertexCell);
         output->SetCell(id++, cell);
         break;
       }
@@ -159,11 +158,10 @@ MeshFileReader<TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits>::Re
         for (unsigned int jj = 1; jj < numberOfPoints; ++jj)
         {
           OutputCellAutoPointer cell;
-          auto *                lineCell = new OutputLineCellType;
+          auto *                lineCell = output->template AllocateCell<OutputLineCellType>(cell);
           lineCell->SetPointId(0, pointIDBuffer);
           pointIDBuffer = static_cast<OutputPointIdentifier>(buffer[index++]);
           lineCell->SetPointId(1, pointIDBuffer);
-          cell.TakeOwnership(lineCell);
           output->SetCell(id++, cell);
         }
         break;
@@ -175,8 +173,8 @@ MeshFileReader<TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits>::Re
         {
           itkExceptionMacro(<< "Invalid Line Cell with number of points = " << numberOfPoints);
         }
-        auto *                polyLineCell = new OutputPolyLineCellType;
         OutputCellAutoPointer cell;
+        auto *                polyLineCell = output->template AllocateCell<OutputPolyLineCellType>(cell);
 
         for (unsigned int jj = 0; jj < numberOfPoints; ++jj)
         {
@@ -184,7 +182,6 @@ MeshFileReader<TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits>::Re
           polyLineCell->SetPointId(jj, pointIDBuffer);
         }
 
-        cell.TakeOwnership(polyLineCell);
         output->SetCell(id++, cell);
         break;
       }
@@ -197,13 +194,12 @@ MeshFileReader<TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits>::Re
         }
 
         OutputCellAutoPointer cell;
-        auto *                triangleCell = new OutputTriangleCellType;
+        auto *                triangleCell = output->template AllocateCell<OutputTriangleCellType>(cell);
         for (unsigned int jj = 0; jj < OutputTriangleCellType::NumberOfPoints; ++jj)
         {
           triangleCell->SetPointId(jj, static_cast<OutputPointIdentifier>(buffer[index++]));
         }
 
-        cell.TakeOwnership(triangleCell);
         output->SetCell(id++, cell);
         break;
       }
@@ -216,13 +212,12 @@ MeshFileReader<TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits>::Re
         }
 
         OutputCellAutoPointer cell;
-        auto *                quadrilateralCell = new OutputQuadrilateralCellType;
+        auto *                quadrilateralCell = output->template AllocateCell<OutputQuadrilateralCellType>(cell);
         for (unsigned int jj = 0; jj < OutputQuadrilateralCellType::NumberOfPoints; ++jj)
         {
           quadrilateralCell->SetPointId(jj, static_cast<OutputPointIdentifier>(buffer[index++]));
         }
 
-        cell.TakeOwnership(quadrilateralCell);
         output->SetCell(id++, cell);
         break;
       }
@@ -234,21 +229,19 @@ MeshFileReader<TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits>::Re
         auto                  numberOfPoints = static_cast<unsigned int>(buffer[index++]);
         if (numberOfPoints == OutputTriangleCellType::NumberOfPoints)
         {
-          auto * triangleCell = new OutputTriangleCellType;
+          auto * triangleCell = output->template AllocateCell<OutputTriangleCellType>(cell);
           for (unsigned int jj = 0; jj < OutputTriangleCellType::NumberOfPoints; ++jj)
           {
             triangleCell->SetPointId(jj, static_cast<OutputPointIdentifier>(buffer[index++]));
           }
-          cell.TakeOwnership(triangleCell);
         }
         else
         {
-          auto * polygonCell = new OutputPolygonCellType;
+          auto * polygonCell = output->template AllocateCell<OutputPolygonCellType>(cell);
           for (unsigned int jj = 0; jj < numberOfPoints; ++jj)
           {
             polygonCell->SetPointId(jj, static_cast<OutputPointIdentifier>(buffer[index++]));
           }
-          cell.TakeOwnership(polygonCell);
         }
 
         output->SetCell(id++, cell);
@@ -263,13 +256,12 @@ MeshFileReader<TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits>::Re
         }
 
         OutputCellAutoPointer cell;
-        auto *                tetrahedronCell = new OutputTetrahedronCellType;
+        auto *                tetrahedronCell = output->template AllocateCell<OutputTetrahedronCellType>(cell);
         for (unsigned int jj = 0; jj < OutputTetrahedronCellType::NumberOfPoints; ++jj)
         {
           tetrahedronCell->SetPointId(jj, static_cast<OutputPointIdentifier>(buffer[index++]));
         }
 
-        cell.TakeOwnership(tetrahedronCell);
         output->SetCell(id++, cell);
         break;
       }
@@ -282,13 +274,12 @@ MeshFileReader<TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits>::Re
         }
 
         OutputCellAutoPointer cell;
-        auto *                hexahedronCell = new OutputHexahedronCellType;
+        auto *                hexahedronCell = output->template AllocateCell<OutputHexahedronCellType>(cell);
         for (unsigned int jj = 0; jj < OutputHexahedronCellType::NumberOfPoints; ++jj)
         {
           hexahedronCell->SetPointId(jj, static_cast<OutputPointIdentifier>(buffer[index++]));
         }
 
-        cell.TakeOwnership(hexahedronCell);
         output->SetCell(id++, cell);
         break;
       }
@@ -301,13 +292,12 @@ MeshFileReader<TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits>::Re
         }
 
         OutputCellAutoPointer cell;
-        auto *                quadraticEdgeCell = new OutputQuadraticEdgeCellType;
+        auto *                quadraticEdgeCell = output->template AllocateCell<OutputQuadraticEdgeCellType>(cell);
         for (unsigned int jj = 0; jj < OutputQuadraticEdgeCellType::NumberOfPoints; ++jj)
         {
           quadraticEdgeCell->SetPointId(jj, static_cast<OutputPointIdentifier>(buffer[index++]));
         }
 
-        cell.TakeOwnership(quadraticEdgeCell);
         output->SetCell(id++, cell);
         break;
       }
@@ -320,13 +310,12 @@ MeshFileReader<TOutputMesh, ConvertPointPixelTraits, ConvertCellPixelTraits>::Re
         }
 
         OutputCellAutoPointer cell;
-        auto *                quadraticTriangleCell = new OutputQuadraticTriangleCellType;
+        auto *                quadraticTriangleCell = output->template AllocateCell<OutputQuadraticTriangleCellType>(cell);
         for (unsigned int jj = 0; jj < OutputQuadraticTriangleCellType::NumberOfPoints; ++jj)
         {
           quadraticTriangleCell->SetPointId(jj, static_cast<OutputPointIdentifier>(buffer[index++]));
         }
 
-        cell.TakeOwnership(quadraticTriangleCell);
         output->SetCell(id++, cell);
         break;
       }
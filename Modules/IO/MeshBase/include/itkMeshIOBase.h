@@ -784,7 +784,9 @@ protected:
   }
 
   /** Write cells to a data buffer, used when reading mesh, used for cellType
-    with non-constant number of points */
+    with non-constant number of points. The input may be stored in the output
+    buffer after the space needed for the cell types, since every input value
+    is read before it is overwritten. */
   template <typename TInput, typename TOutput>
   void
   WriteCellsBuffer(TInput * input, TOutput * output, CellGeometryEnum cellType, SizeValueType numberOfCells)
@@ -795,12 +797,13 @@ protected:
       SizeValueType outputIndex = NumericTraits<SizeValueType>::ZeroValue();
       for (SizeValueType ii = 0; ii < numberOfCells; ++ii)
       {
-        auto numberOfPoints = static_cast<unsigned int>(input[inputIndex++]);
+        auto             numberOfPoints = static_cast<unsigned int>(input[inputIndex++]);
+        CellGeometryEnum type = cellType;
         if (numberOfPoints > 2 && cellType == CellGeometryEnum::LINE_CELL)
         {
-          cellType = CellGeometryEnum::POLYLINE_CELL;
+          type = CellGeometryEnum::POLYLINE_CELL;
         }
-        output[outputIndex++] = static_cast<TOutput>(cellType);
+        output[outputIndex++] = static_cast<TOutput>(type);
         output[outputIndex++] = static_cast<TOutput>(numberOfPoints);
 
         for (unsigned int jj = 0; jj < numberOfPoints; ++jj)
@@ -0,0 +1,260 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkMeshIOTokenizer_h
+#define itkMeshIOTokenizer_h
+#include "ITKIOMeshBaseExport.h"
+
+#include "itkIntTypes.h"
+#include "itkMultiThreaderBase.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace itk
+{
+/**
+ *\class MeshIOTokenizer
+ * \brief Parses the content of a text mesh file held in memory.
+ *
+ * The file is read at once with ReadFile(), and a cursor moves through its
+ * content as lines, tokens and numbers are read. Numbers are parsed
+ * directly from the memory of the file, without going through a stream,
+ * and do not depend on the locale.
+ *
+ * ReadValues() reads large arrays of numbers in parallel: the text is split
+ * in chunks at white space, the number of values in each chunk is counted,
+ * and the chunks are then parsed in parallel into their part of the output
+ * buffer.
+ *
+ * Copies of a tokenizer share the content of the file, and have their own
+ * cursor. SplitLines() returns tokenizers restricted to consecutive parts of
+ * the remaining lines, so that line based formats can be parsed in
+ * parallel.
+ *
+ * \ingroup IOFilters
+ * \ingroup ITKIOMeshBase
+ */
+class ITKIOMeshBase_EXPORT MeshIOTokenizer
+{
+public:
+  using Self = MeshIOTokenizer;
+
+  MeshIOTokenizer() = default;
+
+  /** Read the whole file in memory, and set the cursor at its beginning.
+   * Returns false if the file cannot be read. */
+  bool
+  ReadFile(const std::string & fileName);
+
+  /** Offset of the cursor from the beginning of the file. */
+  SizeValueType
+  GetPosition() const
+  {
+    return static_cast<SizeValueType>(m_Current - m_Data->data());
+  }
+
+  void
+  SetPosition(SizeValueType position)
+  {
+    m_Current = m_Data->data() + position;
+  }
+
+  /** Returns true when the cursor is at the end of the file, or of the
+   * lines the tokenizer is restricted to. */
+  bool
+  IsAtEnd() const
+  {
+    return m_Current >= m_End;
+  }
+
+  /** Get the characters up to the end of the current line, and move the
+   * cursor to the beginning of the next line. The end of line character is
+   * not included in line. Returns false at the end of the file. */
+  bool
+  GetLine(std::string & line);
+
+  /** Move the cursor to the beginning of the next line. */
+  void
+  SkipLine();
+
+  /** Move the cursor to the beginning of the line after the first line that
+   * contains keyword, starting at the cursor. Returns false, and moves the
+   * cursor to the end, if there is no such line. */
+  bool
+  FindLineContaining(const char * keyword);
+
+  /** Skip white space, including ends of lines. */
+  void
+  SkipWhiteSpace();
+
+  /** Skip white space in the current line, and return true if the cursor is
+   * then at the end of the line. */
+  bool
+  IsAtEndOfLine();
+
+  /** Get the next token delimited by white space. */
+  bool
+  GetToken(std::string & token);
+
+  /** Skip the rest of the current token. */
+  void
+  SkipToken();
+
+  /** Skip the given number of tokens, and return the number of tokens that
+   * were skipped. */
+  SizeValueType
+  SkipTokens(SizeValueType numberOfTokens);
+
+  /** Move the cursor forward by the given number of bytes, for instance
+   * over binary data, without going past the end. */
+  void
+  SkipBytes(SizeValueType numberOfBytes)
+  {
+    m_Current += std::min(numberOfBytes, static_cast<SizeValueType>(m_End - m_Current));
+  }
+
+  /** Parse the next number, after white space. The cursor is left just after
+   * the number, which may be followed by other characters, as in "1/2/3".
+   * Returns false, without moving the cursor past the token, if no number is
+   * found. */
+  template <typename T>
+  bool
+  ReadValue(T & value)
+  {
+    this->SkipWhiteSpace();
+    return this->ParseValue(value);
+  }
+
+  /** Read numbers separated by white space into buffer, in parallel for
+   * large arrays. Returns the number of values read, which is smaller than
+   * numberOfValues if the end of the file or something that is not a number
+   * is found first. */
+  template <typename T>
+  SizeValueType
+  ReadValues(T * buffer, SizeValueType numberOfValues)
+  {
+    if (numberOfValues < MinimumNumberOfValuesToSplit)
+    {
+      return this->ReadValuesInChunk(buffer, numberOfValues);
+    }
+
+    std::vector<Self> chunks;
+    this->SplitTokens(numberOfValues, chunks);
+
+    std::vector<SizeValueType> numberOfValuesRead(chunks.size(), 0);
+    this->GetMultiThreader()->ParallelizeArray(
+      0,
+      chunks.size(),
+      [&chunks, &numberOfValuesRead, buffer](SizeValueType ii) {
+        numberOfValuesRead[ii] = chunks[ii].ReadValuesInChunk(buffer + chunks[ii].m_FirstToken,
+                                                              chunks[ii].m_NumberOfTokens);
+      },
+      nullptr);
+
+    return this->MergeChunks(chunks, numberOfValuesRead);
+  }
+
+  /** Split the lines from the cursor to the end in at most numberOfChunks
+   * tokenizers, each of them restricted to whole lines. */
+  std::vector<Self>
+  SplitLines(unsigned int numberOfChunks) const;
+
+  /** Multithreader used by ReadValues(). A default one is created when none
+   * is set. */
+  void
+  SetMultiThreader(MultiThreaderBase * threader)
+  {
+    m_MultiThreader = threader;
+  }
+
+  MultiThreaderBase *
+  GetMultiThreader();
+
+  /** Arrays with fewer values than this are read by a single thread. */
+  static constexpr SizeValueType MinimumNumberOfValuesToSplit = 65536;
+
+private:
+  bool
+  ParseNumber(double & value);
+
+  bool
+  ParseNumber(float & value);
+
+  bool
+  ParseNumber(long long & value);
+
+  /** Floating point types are parsed as double or float, and integer types
+   * as long long, without range check, like a C cast. */
+  template <typename T>
+  bool
+  ParseValue(T & value)
+  {
+    using ParsedType = typename std::conditional<
+      std::is_integral<T>::value,
+      long long,
+      typename std::conditional<std::is_same<T, float>::value, float, double>::type>::type;
+    ParsedType parsed;
+    if (this->ParseNumber(parsed))
+    {
+      value = static_cast<T>(parsed);
+      return true;
+    }
+    return false;
+  }
+
+  template <typename T>
+  SizeValueType
+  ReadValuesInChunk(T * buffer, SizeValueType numberOfValues)
+  {
+    for (SizeValueType ii = 0; ii < numberOfValues; ++ii)
+    {
+      if (!this->ReadValue(buffer[ii]))
+      {
+        return ii;
+      }
+    }
+    return numberOfValues;
+  }
+
+  /** Split the text from the cursor in chunks holding numberOfTokens tokens
+   * in total, and set the first token and the number of tokens of each
+   * chunk. */
+  void
+  SplitTokens(SizeValueType numberOfTokens, std::vector<Self> & chunks);
+
+  /** Move the cursor after the values read by the chunks, and return the
+   * number of values read. */
+  SizeValueType
+  MergeChunks(const std::vector<Self> & chunks, const std::vector<SizeValueType> & numberOfValuesRead);
+
+  std::shared_ptr<std::vector<char>> m_Data{ std::make_shared<std::vector<char>>(1, '\0') };
+  const char *                       m_Current{ m_Data->data() };
+  const char *                       m_End{ m_Data->data() };
+
+  /** Used by the chunks created by SplitTokens(). */
+  SizeValueType m_FirstToken{ 0 };
+  SizeValueType m_NumberOfTokens{ 0 };
+
+  MultiThreaderBase::Pointer m_MultiThreader;
+};
+} // end namespace itk
+
+#endif
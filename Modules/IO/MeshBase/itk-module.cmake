@@ -13,6 +13,8 @@ itk_module(ITKIOMeshBase
     ITKQuadEdgeMesh
     ITKMesh
     ITKVoronoi
+  PRIVATE_DEPENDS
+    ITKDoubleConversion
   TEST_DEPENDS
     ITKTestKernel
   DESCRIPTION
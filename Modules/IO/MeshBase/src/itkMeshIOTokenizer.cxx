@@ -0,0 +1,359 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkMeshIOTokenizer.h"
+#include "double-conversion/string-to-double.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+namespace
+{
+inline bool
+IsWhiteSpace(char c)
+{
+  return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+inline bool
+IsDigit(char c)
+{
+  return c >= '0' && c <= '9';
+}
+
+const char *
+FindWhiteSpace(const char * p, const char * end)
+{
+  while (p < end && !IsWhiteSpace(*p))
+  {
+    ++p;
+  }
+  return p;
+}
+
+itk::SizeValueType
+CountTokens(const char * p, const char * end)
+{
+  itk::SizeValueType count = 0;
+  bool               previousIsWhiteSpace = true;
+  for (; p < end; ++p)
+  {
+    const bool isWhiteSpace = IsWhiteSpace(*p);
+    count += (previousIsWhiteSpace && !isWhiteSpace);
+    previousIsWhiteSpace = isWhiteSpace;
+  }
+  return count;
+}
+
+const double_conversion::StringToDoubleConverter &
+GetStringToDoubleConverter()
+{
+  static const double_conversion::StringToDoubleConverter converter(
+    double_conversion::StringToDoubleConverter::ALLOW_TRAILING_JUNK |
+      double_conversion::StringToDoubleConverter::ALLOW_CASE_INSENSITIVITY,
+    0.0,
+    std::numeric_limits<double>::quiet_NaN(),
+    "inf",
+    "nan");
+  return converter;
+}
+} // namespace
+
+namespace itk
+{
+constexpr SizeValueType MeshIOTokenizer::MinimumNumberOfValuesToSplit;
+
+bool
+MeshIOTokenizer::ReadFile(const std::string & fileName)
+{
+  std::ifstream inputFile(fileName.c_str(), std::ios::in | std::ios::binary);
+  if (!inputFile.is_open())
+  {
+    return false;
+  }
+
+  inputFile.seekg(0, std::ios::end);
+  const std::streamoff size = inputFile.tellg();
+  if (size < 0)
+  {
+    return false;
+  }
+  inputFile.seekg(0, std::ios::beg);
+
+  // The content is followed by a null character, so that it is always safe
+  // to look at the character at the end
+  auto data = std::make_shared<std::vector<char>>(static_cast<std::size_t>(size) + 1, '\0');
+  if (!inputFile.read(data->data(), size))
+  {
+    return false;
+  }
+
+  m_Data = data;
+  m_Current = m_Data->data();
+  m_End = m_Data->data() + size;
+  return true;
+}
+
+bool
+MeshIOTokenizer::GetLine(std::string & line)
+{
+  if (this->IsAtEnd())
+  {
+    line.clear();
+    return false;
+  }
+
+  const auto * endOfLine =
+    static_cast<const char *>(std::memchr(m_Current, '\n', static_cast<std::size_t>(m_End - m_Current)));
+  if (endOfLine == nullptr)
+  {
+    endOfLine = m_End;
+  }
+  line.assign(m_Current, endOfLine);
+  m_Current = std::min(endOfLine + 1, m_End);
+  return true;
+}
+
+void
+MeshIOTokenizer::SkipLine()
+{
+  const auto * endOfLine =
+    static_cast<const char *>(std::memchr(m_Current, '\n', static_cast<std::size_t>(m_End - m_Current)));
+  m_Current = (endOfLine == nullptr) ? m_End : endOfLine + 1;
+}
+
+bool
+MeshIOTokenizer::FindLineContaining(const char * keyword)
+{
+  const char * found = std::search(m_Current, m_End, keyword, keyword + std::strlen(keyword));
+  if (found == m_End)
+  {
+    m_Current = m_End;
+    return false;
+  }
+  m_Current = found;
+  this->SkipLine();
+  return true;
+}
+
+void
+MeshIOTokenizer::SkipWhiteSpace()
+{
+  while (m_Current < m_End && IsWhiteSpace(*m_Current))
+  {
+    ++m_Current;
+  }
+}
+
+bool
+MeshIOTokenizer::IsAtEndOfLine()
+{
+  while (m_Current < m_End && *m_Current != '\n' && IsWhiteSpace(*m_Current))
+  {
+    ++m_Current;
+  }
+  return m_Current >= m_End || *m_Current == '\n';
+}
+
+bool
+MeshIOTokenizer::GetToken(std::string & token)
+{
+  this->SkipWhiteSpace();
+  const char * begin = m_Current;
+  this->SkipToken();
+  token.assign(begin, m_Current);
+  return !token.empty();
+}
+
+void
+MeshIOTokenizer::SkipToken()
+{
+  m_Current = FindWhiteSpace(m_Current, m_End);
+}
+
+SizeValueType
+MeshIOTokenizer::SkipTokens(SizeValueType numberOfTokens)
+{
+  SizeValueType count = 0;
+  for (; count < numberOfTokens; ++count)
+  {
+    this->SkipWhiteSpace();
+    if (this->IsAtEnd())
+    {
+      break;
+    }
+    this->SkipToken();
+  }
+  return count;
+}
+
+bool
+MeshIOTokenizer::ParseNumber(double & value)
+{
+  const char * endOfToken = FindWhiteSpace(m_Current, m_End);
+  int          processed = 0;
+  value = GetStringToDoubleConverter().StringToDouble(m_Current, static_cast<int>(endOfToken - m_Current), &processed);
+  m_Current += processed;
+  return processed > 0;
+}
+
+bool
+MeshIOTokenizer::ParseNumber(float & value)
+{
+  const char * endOfToken = FindWhiteSpace(m_Current, m_End);
+  int          processed = 0;
+  value = GetStringToDoubleConverter().StringToFloat(m_Current, static_cast<int>(endOfToken - m_Current), &processed);
+  m_Current += processed;
+  return processed > 0;
+}
+
+bool
+MeshIOTokenizer::ParseNumber(long long & value)
+{
+  const char * p = m_Current;
+  bool         negative = false;
+  if (p < m_End && (*p == '-' || *p == '+'))
+  {
+    negative = (*p == '-');
+    ++p;
+  }
+  if (p >= m_End || !IsDigit(*p))
+  {
+    return false;
+  }
+
+  unsigned long long magnitude = 0;
+  for (; p < m_End && IsDigit(*p); ++p)
+  {
+    magnitude = magnitude * 10 + static_cast<unsigned long long>(*p - '0');
+  }
+  value = negative ? -static_cast<long long>(magnitude) : static_cast<long long>(magnitude);
+  m_Current = p;
+  return true;
+}
+
+std::vector<MeshIOTokenizer>
+MeshIOTokenizer::SplitLines(unsigned int numberOfChunks) const
+{
+  std::vector<Self> chunks;
+  const auto        size = static_cast<SizeValueType>(m_End - m_Current);
+  const char *      begin = m_Current;
+  for (unsigned int ii = 1; ii <= numberOfChunks && begin < m_End; ++ii)
+  {
+    Self chunk(*this);
+    chunk.m_Current = begin;
+    chunk.m_End = m_End;
+    if (ii < numberOfChunks)
+    {
+      // End the chunk after the line that contains its nominal end
+      const char * end = std::max(begin, m_Current + size * ii / numberOfChunks);
+      const auto * endOfLine = static_cast<const char *>(std::memchr(end, '\n', static_cast<std::size_t>(m_End - end)));
+      if (endOfLine != nullptr)
+      {
+        chunk.m_End = endOfLine + 1;
+      }
+    }
+    begin = chunk.m_End;
+    chunks.push_back(chunk);
+  }
+  return chunks;
+}
+
+MultiThreaderBase *
+MeshIOTokenizer::GetMultiThreader()
+{
+  if (m_MultiThreader.IsNull())
+  {
+    m_MultiThreader = MultiThreaderBase::New();
+  }
+  return m_MultiThreader;
+}
+
+void
+MeshIOTokenizer::SplitTokens(SizeValueType numberOfTokens, std::vector<Self> & chunks)
+{
+  MultiThreaderBase * threader = this->GetMultiThreader();
+
+  const SizeValueType numberOfChunks = 4 * SizeValueType{ threader->GetNumberOfWorkUnits() };
+  const auto          remaining = static_cast<SizeValueType>(m_End - m_Current);
+
+  // Guess the length of the text holding the tokens, and double it until it
+  // holds enough of them
+  SizeValueType              windowSize = std::min(remaining, numberOfTokens * 16);
+  std::vector<const char *>  bounds(numberOfChunks + 1);
+  std::vector<SizeValueType> counts(numberOfChunks);
+  while (true)
+  {
+    bounds[0] = m_Current;
+    for (SizeValueType ii = 1; ii <= numberOfChunks; ++ii)
+    {
+      bounds[ii] = FindWhiteSpace(std::max(bounds[ii - 1], m_Current + windowSize * ii / numberOfChunks), m_End);
+    }
+
+    threader->ParallelizeArray(
+      0,
+      numberOfChunks,
+      [&bounds, &counts](SizeValueType ii) { counts[ii] = CountTokens(bounds[ii], bounds[ii + 1]); },
+      nullptr);
+
+    SizeValueType total = 0;
+    for (const SizeValueType count : counts)
+    {
+      total += count;
+    }
+    if (total >= numberOfTokens || bounds[numberOfChunks] == m_End)
+    {
+      break;
+    }
+    windowSize = std::min(remaining, 2 * windowSize);
+  }
+
+  chunks.clear();
+  SizeValueType firstToken = 0;
+  for (SizeValueType ii = 0; ii < numberOfChunks && firstToken < numberOfTokens; ++ii)
+  {
+    if (counts[ii] == 0)
+    {
+      continue;
+    }
+    Self chunk(*this);
+    chunk.m_Current = bounds[ii];
+    chunk.m_End = bounds[ii + 1];
+    chunk.m_FirstToken = firstToken;
+    chunk.m_NumberOfTokens = std::min(counts[ii], numberOfTokens - firstToken);
+    firstToken += counts[ii];
+    chunks.push_back(chunk);
+  }
+}
+
+SizeValueType
+MeshIOTokenizer::MergeChunks(const std::vector<Self> & chunks, const std::vector<SizeValueType> & numberOfValuesRead)
+{
+  for (std::size_t ii = 0; ii < chunks.size(); ++ii)
+  {
+    m_Current = chunks[ii].m_Current;
+    if (numberOfValuesRead[ii] < chunks[ii].m_NumberOfTokens)
+    {
+      return chunks[ii].m_FirstToken + numberOfValuesRead[ii];
+    }
+  }
+  return chunks.empty() ? 0 : chunks.back().m_FirstToken + chunks.back().m_NumberOfTokens;
+}
+
+} // end namespace itk
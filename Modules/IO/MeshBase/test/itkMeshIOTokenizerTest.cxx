@@ -0,0 +1,148 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkMeshIOTokenizer.h"
+#include "itkTestingMacros.h"
+
+#include <fstream>
+
+int
+itkMeshIOTokenizerTest(int argc, char * argv[])
+{
+  if (argc < 2)
+  {
+    std::cerr << "Missing Parameters " << std::endl;
+    std::cerr << "Usage: " << itkNameOfTestExecutableMacro(argv) << " outputFileName" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // More values than MinimumNumberOfValuesToSplit, so that they are read in
+  // parallel, with irregular white space
+  const unsigned int numberOfValues = 3 * itk::MeshIOTokenizer::MinimumNumberOfValuesToSplit + 17;
+  {
+    std::ofstream outputFile(argv[1]);
+    outputFile << "# header line\n";
+    outputFile << "POINTS 3 float\n";
+    outputFile << "  1.5 -2e-3\t 4\n";
+    outputFile << "f 1/2/3 4//5 -6\n";
+    for (unsigned int ii = 0; ii < numberOfValues; ++ii)
+    {
+      outputFile << ii << ((ii % 7 == 0) ? "\n" : ((ii % 5 == 0) ? " \t " : " "));
+    }
+    outputFile << "\nEND 1.25 oops\n";
+  }
+
+  itk::MeshIOTokenizer tokenizer;
+  ITK_TEST_EXPECT_TRUE(!tokenizer.ReadFile(std::string(argv[1]) + ".missing"));
+  ITK_TEST_EXPECT_TRUE(tokenizer.ReadFile(argv[1]));
+
+  std::string line;
+  ITK_TEST_EXPECT_TRUE(tokenizer.GetLine(line));
+  ITK_TEST_EXPECT_EQUAL(line, "# header line");
+
+  std::string token;
+  ITK_TEST_EXPECT_TRUE(tokenizer.GetToken(token));
+  ITK_TEST_EXPECT_EQUAL(token, "POINTS");
+  unsigned int numberOfPoints = 0;
+  ITK_TEST_EXPECT_TRUE(tokenizer.ReadValue(numberOfPoints));
+  ITK_TEST_EXPECT_EQUAL(numberOfPoints, 3);
+  tokenizer.SkipLine();
+
+  float points[3];
+  ITK_TEST_EXPECT_EQUAL(tokenizer.ReadValues(points, 3), 3);
+  ITK_TEST_EXPECT_EQUAL(points[0], 1.5f);
+  ITK_TEST_EXPECT_EQUAL(points[1], -2e-3f);
+  ITK_TEST_EXPECT_EQUAL(points[2], 4.0f);
+  ITK_TEST_EXPECT_TRUE(tokenizer.IsAtEndOfLine());
+
+  // Face indices are followed by other characters
+  const itk::SizeValueType position = tokenizer.GetPosition();
+  tokenizer.SkipWhiteSpace();
+  tokenizer.SkipToken();
+  long ids[3];
+  for (long & id : ids)
+  {
+    ITK_TEST_EXPECT_TRUE(tokenizer.ReadValue(id));
+    tokenizer.SkipToken();
+  }
+  ITK_TEST_EXPECT_EQUAL(ids[0], 1);
+  ITK_TEST_EXPECT_EQUAL(ids[1], 4);
+  ITK_TEST_EXPECT_EQUAL(ids[2], -6);
+  tokenizer.SetPosition(position);
+  ITK_TEST_EXPECT_TRUE(!tokenizer.ReadValue(ids[0]));
+  tokenizer.SkipLine();
+
+  std::vector<unsigned int> values(numberOfValues);
+  ITK_TEST_EXPECT_EQUAL(tokenizer.ReadValues(values.data(), numberOfValues), numberOfValues);
+  for (unsigned int ii = 0; ii < numberOfValues; ++ii)
+  {
+    if (values[ii] != ii)
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "Error in ReadValues() at index [" << ii << "]" << std::endl;
+      std::cerr << "Expected value " << ii << std::endl;
+      std::cerr << " differs from " << values[ii] << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // The cursor is just after the values
+  ITK_TEST_EXPECT_TRUE(tokenizer.GetToken(token));
+  ITK_TEST_EXPECT_EQUAL(token, "END");
+
+  // Reading stops at something that is not a number
+  double end[3];
+  ITK_TEST_EXPECT_EQUAL(tokenizer.ReadValues(end, 3), 1);
+  ITK_TEST_EXPECT_EQUAL(end[0], 1.25);
+  ITK_TEST_EXPECT_TRUE(tokenizer.GetToken(token));
+  ITK_TEST_EXPECT_EQUAL(token, "oops");
+  ITK_TEST_EXPECT_TRUE(!tokenizer.GetToken(token));
+  ITK_TEST_EXPECT_TRUE(tokenizer.IsAtEnd());
+
+  // Parallel reading stops at the first missing value. Values after it may
+  // be written to the buffer.
+  values.resize(numberOfValues + 2);
+  tokenizer.SetPosition(position);
+  tokenizer.FindLineContaining("f 1/2/3");
+  ITK_TEST_EXPECT_EQUAL(tokenizer.ReadValues(values.data(), numberOfValues + 2), numberOfValues);
+  ITK_TEST_EXPECT_TRUE(tokenizer.GetToken(token));
+  ITK_TEST_EXPECT_EQUAL(token, "END");
+
+  // Lines are split in chunks that cover all of them
+  tokenizer.SetPosition(position);
+  unsigned int numberOfLines = 0;
+  for (itk::MeshIOTokenizer chunk : tokenizer.SplitLines(8))
+  {
+    while (chunk.GetLine(line))
+    {
+      ++numberOfLines;
+    }
+  }
+  unsigned int expectedNumberOfLines = 0;
+  while (tokenizer.GetLine(line))
+  {
+    ++expectedNumberOfLines;
+  }
+  ITK_TEST_EXPECT_EQUAL(numberOfLines, expectedNumberOfLines);
+
+  ITK_TEST_EXPECT_TRUE(!tokenizer.FindLineContaining("missing keyword"));
+  ITK_TEST_EXPECT_TRUE(tokenizer.IsAtEnd());
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -21,6 +21,7 @@
 #include "ITKIOMeshOBJExport.h"
 
 #include "itkMeshIOBase.h"
+#include "itkMeshIOTokenizer.h"
 #include "itkNumberToString.h"
 #include <fstream>
 
@@ -184,6 +185,11 @@ protected:
   void
   CloseFile();
 
+  /** Read the whole file in the tokenizer, and split its lines in chunks
+   * that are parsed in parallel. */
+  std::vector<MeshIOTokenizer>
+  ReadFileInChunks(MeshIOTokenizer & tokenizer);
+
 private:
   std::ifstream  m_InputFile;
   std::streampos m_PointsStartPosition; // file position for points rlative to
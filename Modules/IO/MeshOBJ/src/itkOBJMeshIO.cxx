@@ -125,46 +125,183 @@ OBJMeshIO ::SplitLine(const std::string & line, std::string & type, std::string
   return true;
 }
 
-void
-OBJMeshIO ::ReadMeshInformation()
+std::vector<MeshIOTokenizer>
+OBJMeshIO ::ReadFileInChunks(MeshIOTokenizer & tokenizer)
 {
-  // Define input file stream and attach it to input file
-  OpenFile();
+  if (this->m_FileName.empty())
+  {
+    itkExceptionMacro("No input FileName");
+  }
 
-  // Read and analyze the first line in the file
-  SizeValueType numberOfCellPoints = 0;
-  this->m_NumberOfPoints = 0;
-  this->m_NumberOfCells = 0;
-  this->m_NumberOfPointPixels = 0;
-  std::string line;
-  std::string inputLine;
-  std::string type;
-  std::locale loc;
-  while (std::getline(m_InputFile, line, '\n'))
+  if (!tokenizer.ReadFile(this->m_FileName))
   {
-    if (SplitLine(line, type, inputLine) && !inputLine.empty())
-    {
-      if (type == "v")
-      {
-        this->m_NumberOfPoints++;
-      }
-      else if (type == "f")
-      {
-        this->m_NumberOfCells++;
+    itkExceptionMacro("Unable to open file " << this->m_FileName);
+  }
+
+  return tokenizer.SplitLines(tokenizer.GetMultiThreader()->GetNumberOfWorkUnits());
+}
+
+namespace
+{
+enum class OBJLineType
+{
+  Vertex,
+  Face,
+  Normal,
+  Other
+};
+
+/** Read the type at the beginning of the line, like SplitLine() does. Lines
+ * without content are ignored. */
+OBJLineType
+ReadLineType(MeshIOTokenizer & chunk, std::string & type)
+{
+  if (chunk.IsAtEndOfLine())
+  {
+    return OBJLineType::Other;
+  }
+  chunk.GetToken(type);
+  if (chunk.IsAtEndOfLine())
+  {
+    return OBJLineType::Other;
+  }
 
-        std::stringstream ss(inputLine);
-        std::string       item;
-        while (ss >> item)
+  if (type == "v")
+  {
+    return OBJLineType::Vertex;
+  }
+  if (type == "f")
+  {
+    return OBJLineType::Face;
+  }
+  if (type == "vn")
+  {
+    return OBJLineType::Normal;
+  }
+  return OBJLineType::Other;
+}
+
+/** Read a value of the current line, or zero if there is none. */
+template <typename T>
+void
+ReadValueInLine(MeshIOTokenizer & chunk, T & value)
+{
+  if (chunk.IsAtEndOfLine() || !chunk.ReadValue(value))
+  {
+    value = T{};
+  }
+}
+
+struct OBJLineCounts
+{
+  SizeValueType m_NumberOfPoints{ 0 };
+  SizeValueType m_NumberOfCells{ 0 };
+  SizeValueType m_NumberOfCellPoints{ 0 };
+  SizeValueType m_NumberOfNormals{ 0 };
+};
+
+/** Count the lines of each type in each chunk, in parallel. */
+std::vector<OBJLineCounts>
+CountLines(const std::vector<MeshIOTokenizer> & chunks, MultiThreaderBase * threader)
+{
+  std::vector<OBJLineCounts> counts(chunks.size());
+  threader->ParallelizeArray(
+    0,
+    chunks.size(),
+    [&chunks, &counts](SizeValueType ii) {
+      MeshIOTokenizer chunk = chunks[ii];
+      OBJLineCounts & count = counts[ii];
+      std::string     type;
+      while (!chunk.IsAtEnd())
+      {
+        switch (ReadLineType(chunk, type))
         {
-          numberOfCellPoints++;
+          case OBJLineType::Vertex:
+            ++count.m_NumberOfPoints;
+            break;
+          case OBJLineType::Face:
+            ++count.m_NumberOfCells;
+            while (!chunk.IsAtEndOfLine())
+            {
+              chunk.SkipToken();
+              ++count.m_NumberOfCellPoints;
+            }
+            break;
+          case OBJLineType::Normal:
+            ++count.m_NumberOfNormals;
+            break;
+          default:
+            break;
         }
+        chunk.SkipLine();
       }
-      else if (type == "vn")
+    },
+    nullptr);
+  return counts;
+}
+
+/** Read the three values of the vertex or normal lines of each chunk in
+ * parallel. The values of each chunk are stored after those of the previous
+ * chunks. */
+void
+ReadPointLines(const std::vector<MeshIOTokenizer> & chunks,
+               MultiThreaderBase *                  threader,
+               OBJLineType                          lineType,
+               float *                              data)
+{
+  const std::vector<OBJLineCounts> counts = CountLines(chunks, threader);
+
+  std::vector<float *> chunkData(chunks.size());
+  for (std::size_t ii = 0; ii < chunks.size(); ++ii)
+  {
+    chunkData[ii] = data;
+    data += 3 * (lineType == OBJLineType::Vertex ? counts[ii].m_NumberOfPoints : counts[ii].m_NumberOfNormals);
+  }
+
+  threader->ParallelizeArray(
+    0,
+    chunks.size(),
+    [&chunks, &chunkData, lineType](SizeValueType ii) {
+      MeshIOTokenizer chunk = chunks[ii];
+      float *         output = chunkData[ii];
+      std::string     type;
+      while (!chunk.IsAtEnd())
       {
-        this->m_NumberOfPointPixels++;
-        this->m_UpdatePointData = true;
+        if (ReadLineType(chunk, type) == lineType)
+        {
+          for (unsigned int jj = 0; jj < 3; ++jj)
+          {
+            ReadValueInLine(chunk, *output++);
+          }
+        }
+        chunk.SkipLine();
       }
-    }
+    },
+    nullptr);
+}
+} // namespace
+
+void
+OBJMeshIO ::ReadMeshInformation()
+{
+  MeshIOTokenizer                    tokenizer;
+  const std::vector<MeshIOTokenizer> chunks = this->ReadFileInChunks(tokenizer);
+
+  // Count the lines of each type
+  SizeValueType numberOfCellPoints = 0;
+  this->m_NumberOfPoints = 0;
+  this->m_NumberOfCells = 0;
+  this->m_NumberOfPointPixels = 0;
+  for (const OBJLineCounts & count : CountLines(chunks, tokenizer.GetMultiThreader()))
+  {
+    this->m_NumberOfPoints += count.m_NumberOfPoints;
+    this->m_NumberOfCells += count.m_NumberOfCells;
+    numberOfCellPoints += count.m_NumberOfCellPoints;
+    this->m_NumberOfPointPixels += count.m_NumberOfNormals;
+  }
+  if (this->m_NumberOfPointPixels)
+  {
+    this->m_UpdatePointData = true;
   }
 
   this->m_PointDimension = 3;
@@ -207,130 +344,72 @@ OBJMeshIO ::ReadMeshInformation()
   this->m_CellPixelType = IOPixelEnum::VECTOR;
   this->m_NumberOfCellPixelComponents = 3;
   this->m_UpdateCellData = false;
-
-  CloseFile();
 }
 
 void
 OBJMeshIO ::ReadPoints(void * buffer)
 {
-  // Define input file stream and attach it to input file
-  OpenFile();
-
-  // Number of data array
-  auto *        data = static_cast<float *>(buffer);
-  SizeValueType index = 0;
-
-  // Read and analyze the first line in the file
-  std::string line;
-  std::string inputLine;
-  std::string type;
-  std::locale loc;
-  while (std::getline(m_InputFile, line, '\n'))
-  {
-    if (SplitLine(line, type, inputLine) && !inputLine.empty())
-    {
-      if (type == "v")
-      {
-        std::stringstream ss(inputLine);
-        for (unsigned int ii = 0; ii < this->m_PointDimension; ++ii)
-        {
-          ss >> data[index++];
-        }
-      }
-    }
-  }
+  MeshIOTokenizer                    tokenizer;
+  const std::vector<MeshIOTokenizer> chunks = this->ReadFileInChunks(tokenizer);
 
-  CloseFile();
+  ReadPointLines(chunks, tokenizer.GetMultiThreader(), OBJLineType::Vertex, static_cast<float *>(buffer));
 }
 
 void
 OBJMeshIO ::ReadCells(void * buffer)
 {
-  // Define input file stream and attach it to input file
-  OpenFile();
-
-  // Read and analyze the first line in the file
-  auto *        data = new long[this->m_CellBufferSize - this->m_NumberOfCells];
-  SizeValueType index = 0;
-
-  std::string line;
-  std::string inputLine;
-  std::string type;
-  std::locale loc;
-  while (std::getline(m_InputFile, line, '\n'))
+  MeshIOTokenizer                    tokenizer;
+  const std::vector<MeshIOTokenizer> chunks = this->ReadFileInChunks(tokenizer);
+  MultiThreaderBase *                threader = tokenizer.GetMultiThreader();
+
+  // The cells of each chunk are written directly in the buffer, after those
+  // of the previous chunks
+  const std::vector<OBJLineCounts> counts = CountLines(chunks, threader);
+  std::vector<long *>              chunkData(chunks.size());
+  auto *                           data = static_cast<long *>(buffer);
+  for (std::size_t ii = 0; ii < chunks.size(); ++ii)
   {
-    if (SplitLine(line, type, inputLine) && !inputLine.empty())
-    {
-      if (type == "f")
+    chunkData[ii] = data;
+    data += 2 * counts[ii].m_NumberOfCells + counts[ii].m_NumberOfCellPoints;
+  }
+
+  threader->ParallelizeArray(
+    0,
+    chunks.size(),
+    [&chunks, &chunkData](SizeValueType ii) {
+      MeshIOTokenizer chunk = chunks[ii];
+      long *          output = chunkData[ii];
+      std::string     type;
+      while (!chunk.IsAtEnd())
       {
-        std::stringstream ss(inputLine);
-        std::string       item;
-        std::vector<long> idList;
-        while (ss >> item)
+        if (ReadLineType(chunk, type) == OBJLineType::Face)
         {
-          long                   id;
-          std::string::size_type pos = item.find('/');
-          while (pos != std::string::npos)
+          // Only the vertex index of items such as "1/2/3" is used
+          *output++ = static_cast<long>(CellGeometryEnum::POLYGON_CELL);
+          long * numberOfPoints = output++;
+          *numberOfPoints = 0;
+          while (!chunk.IsAtEndOfLine())
           {
-            item.replace(pos, 1, " ");
-            pos = item.find('/', pos);
+            long id;
+            ReadValueInLine(chunk, id);
+            chunk.SkipToken();
+            *output++ = id - 1;
+            ++(*numberOfPoints);
           }
-
-          std::stringstream st(item);
-          st >> id;
-
-          idList.push_back(id);
-        }
-
-        data[index++] = static_cast<long>(idList.size());
-        for (long it : idList)
-        {
-          data[index++] = (it - 1);
         }
+        chunk.SkipLine();
       }
-    }
-  }
-
-  CloseFile();
-
-  this->WriteCellsBuffer(data, static_cast<long *>(buffer), CellGeometryEnum::POLYGON_CELL, this->m_NumberOfCells);
-  // this->WriteCellsBuffer(data, static_cast<unsigned int *>(buffer),
-  // CellGeometryEnum::TRIANGLE_CELL, 3, this->m_NumberOfCells);
-  delete[] data;
+    },
+    nullptr);
 }
 
 void
 OBJMeshIO ::ReadPointData(void * buffer)
 {
-  // Define input file stream and attach it to input file
-  OpenFile();
-
-  // Number of data array
-  auto *        data = static_cast<float *>(buffer);
-  SizeValueType index = 0;
-
-  // Read and analyze the first line in the file
-  std::string line;
-  std::string inputLine;
-  std::string type;
-  std::locale loc;
-  while (std::getline(m_InputFile, line, '\n'))
-  {
-    if (SplitLine(line, type, inputLine) && !inputLine.empty())
-    {
-      if (type == "vn")
-      {
-        std::stringstream ss(inputLine);
-        for (unsigned int ii = 0; ii < this->m_PointDimension; ++ii)
-        {
-          ss >> data[index++];
-        }
-      }
-    }
-  }
+  MeshIOTokenizer                    tokenizer;
+  const std::vector<MeshIOTokenizer> chunks = this->ReadFileInChunks(tokenizer);
 
-  CloseFile();
+  ReadPointLines(chunks, tokenizer.GetMultiThreader(), OBJLineType::Normal, static_cast<float *>(buffer));
 }
 
 void
@@ -21,6 +21,7 @@
 #include "ITKIOMeshOFFExport.h"
 
 #include "itkMeshIOBase.h"
+#include "itkMeshIOTokenizer.h"
 
 #include <fstream>
 
@@ -112,26 +113,11 @@ public:
   Write() override;
 
 protected:
-  /** Read buffer as ascii stream */
-  template <typename T>
+  /** Read the number of points and the point ids of each cell of an ASCII
+   * file into buffer, in parallel. Values after the point ids in each line,
+   * such as colors, are ignored. */
   void
-  ReadCellsBufferAsAscii(T * buffer, std::ifstream & inputFile)
-  {
-    SizeValueType index = 0;
-    unsigned int  numberOfPoints = 0;
-    std::string   line;
-
-    for (SizeValueType ii = 0; ii < this->m_NumberOfCells; ++ii)
-    {
-      inputFile >> numberOfPoints;
-      buffer[index++] = static_cast<T>(numberOfPoints);
-      for (unsigned int jj = 0; jj < numberOfPoints; ++jj)
-      {
-        inputFile >> buffer[index++];
-      }
-      std::getline(inputFile, line, '\n');
-    }
-  }
+  ReadCellsBufferAsAscii(unsigned int * buffer);
 
   /** Read cells from a data buffer, used when writting cells. This function
     write all kind of cells as it is stored in cells container. It is used when
@@ -205,7 +191,9 @@ protected:
 
 private:
   std::ifstream    m_InputFile;
+  MeshIOTokenizer  m_Tokenizer;           // content of an ASCII file
   StreamOffsetType m_PointsStartPosition; // file position for points rlative to std::ios::beg
+  SizeValueType    m_CellsStartPosition;  // position of the cells in an ASCII file
   bool             m_TriangleCellType;    // if all cells are trinalge it is true. otherwise, it is false.
 };
 } // end namespace itk
@@ -27,6 +27,7 @@ OFFMeshIO ::OFFMeshIO()
   this->AddSupportedWriteExtension(".off");
   this->SetByteOrderToBigEndian();
   m_PointsStartPosition = itk::NumericTraits<StreamOffsetType>::ZeroValue();
+  m_CellsStartPosition = 0;
   m_TriangleCellType = true;
 }
 
@@ -117,12 +118,27 @@ OFFMeshIO ::ReadMeshInformation()
   else
   {
     this->m_FileType = IOFileEnum::ASCII;
+
+    // ASCII files are parsed from memory, after the first line
+    CloseFile();
+    if (!m_Tokenizer.ReadFile(this->m_FileName))
+    {
+      itkExceptionMacro("Unable to open file " << this->m_FileName);
+    }
+    m_Tokenizer.SkipLine();
   }
 
   // Read and Set point dimension
   if (line.find("nOFF") != std::string::npos)
   {
-    m_InputFile >> this->m_PointDimension;
+    if (this->m_FileType == IOFileEnum::ASCII)
+    {
+      m_Tokenizer.ReadValue(this->m_PointDimension);
+    }
+    else
+    {
+      m_InputFile >> this->m_PointDimension;
+    }
     m_PointDimension++;
   }
   else if (line.find("4OFF") != std::string::npos)
@@ -135,10 +151,20 @@ OFFMeshIO ::ReadMeshInformation()
   }
 
   // Ignore comment lines
-  std::getline(m_InputFile, line, '\n');
+  const auto getLine = [this](std::string & nextLine) {
+    if (this->m_FileType == IOFileEnum::ASCII)
+    {
+      m_Tokenizer.GetLine(nextLine);
+    }
+    else
+    {
+      std::getline(m_InputFile, nextLine, '\n');
+    }
+  };
+  getLine(line);
   while (line.find("#") != std::string::npos)
   {
-    std::getline(m_InputFile, line, '\n');
+    getLine(line);
   }
 
   // Read points and cells information
@@ -159,12 +185,13 @@ OFFMeshIO ::ReadMeshInformation()
     ss >> numberOfEdges;
 
     // Read points start position in the file
-    m_PointsStartPosition = m_InputFile.tellg();
+    m_PointsStartPosition = static_cast<StreamOffsetType>(m_Tokenizer.GetPosition());
 
     for (SizeValueType id = 0; id < this->m_NumberOfPoints; ++id)
     {
-      std::getline(m_InputFile, line, '\n');
+      m_Tokenizer.SkipLine();
     }
+    m_CellsStartPosition = m_Tokenizer.GetPosition();
 
     // Set default cell component type
     this->m_CellBufferSize = this->m_NumberOfCells * 2;
@@ -173,9 +200,10 @@ OFFMeshIO ::ReadMeshInformation()
     unsigned int numberOfCellPoints = 0;
     for (SizeValueType id = 0; id < this->m_NumberOfCells; ++id)
     {
-      m_InputFile >> numberOfCellPoints;
+      numberOfCellPoints = 0;
+      m_Tokenizer.ReadValue(numberOfCellPoints);
       this->m_CellBufferSize += numberOfCellPoints;
-      std::getline(m_InputFile, line, '\n');
+      m_Tokenizer.SkipLine();
 
       if (numberOfCellPoints != 3)
       {
@@ -203,28 +231,24 @@ OFFMeshIO ::ReadMeshInformation()
     // Get points start position
     m_PointsStartPosition = m_InputFile.tellg();
 
-    // Read points
-    auto * pointsBuffer = new float[this->m_NumberOfPoints * this->m_PointDimension];
-    this->ReadBufferAsBinary(pointsBuffer, m_InputFile, this->m_NumberOfPoints * this->m_PointDimension);
-    delete[] pointsBuffer;
+    // Skip points
+    m_InputFile.ignore(this->m_NumberOfPoints * this->m_PointDimension * sizeof(float));
 
     // Set default cell component type
     this->m_CellBufferSize = this->m_NumberOfCells * 2;
 
-    // Read cells
+    // Read the number of points of the cells, and skip their point ids
     itk::uint32_t numberOfCellPoints = 0;
-    auto *        cellsBuffer = new itk::uint32_t[this->m_NumberOfCells];
     for (unsigned long id = 0; id < this->m_NumberOfCells; ++id)
     {
       this->ReadBufferAsBinary(&numberOfCellPoints, m_InputFile, 1);
       this->m_CellBufferSize += numberOfCellPoints;
-      this->ReadBufferAsBinary(cellsBuffer, m_InputFile, numberOfCellPoints);
+      m_InputFile.ignore(numberOfCellPoints * sizeof(itk::uint32_t));
       if (numberOfCellPoints != 3)
       {
         m_TriangleCellType = false;
       }
     }
-    delete[] cellsBuffer;
   }
 
   // Set default point component type
@@ -261,16 +285,21 @@ OFFMeshIO ::ReadMeshInformation()
 void
 OFFMeshIO ::ReadPoints(void * buffer)
 {
-  // Set file position to points start position
-  m_InputFile.seekg(m_PointsStartPosition, std::ios::beg);
-
   // Read file according to ASCII or BINARY
   if (this->m_FileType == IOFileEnum::ASCII)
   {
-    this->ReadBufferAsAscii(static_cast<float *>(buffer), m_InputFile, this->m_NumberOfPoints * this->m_PointDimension);
+    // Set the cursor to points start position, and read the points in parallel
+    const SizeValueType numberOfComponents = this->m_NumberOfPoints * this->m_PointDimension;
+    m_Tokenizer.SetPosition(static_cast<SizeValueType>(m_PointsStartPosition));
+    if (m_Tokenizer.ReadValues(static_cast<float *>(buffer), numberOfComponents) != numberOfComponents)
+    {
+      itkExceptionMacro(<< "Unexpected end of file while reading points");
+    }
   }
   else if (this->m_FileType == IOFileEnum::BINARY)
   {
+    // Set file position to points start position
+    m_InputFile.seekg(m_PointsStartPosition, std::ios::beg);
     this->ReadBufferAsBinary(
       static_cast<float *>(buffer), m_InputFile, this->m_NumberOfPoints * this->m_PointDimension);
   }
@@ -283,11 +312,15 @@ OFFMeshIO ::ReadPoints(void * buffer)
 void
 OFFMeshIO ::ReadCells(void * buffer)
 {
-  auto * data = new itk::uint32_t[this->m_CellBufferSize - this->m_NumberOfCells];
+  // The number of points and the point ids of the cells are read at the end
+  // of the buffer, and expanded in place to the cell types, the number of
+  // points and the point ids
+  auto * output = static_cast<unsigned int *>(buffer);
+  auto * data = output + this->m_NumberOfCells;
 
   if (this->m_FileType == IOFileEnum::ASCII)
   {
-    this->ReadCellsBufferAsAscii(data, m_InputFile);
+    this->ReadCellsBufferAsAscii(data);
   }
   else if (this->m_FileType == IOFileEnum::BINARY)
   {
@@ -299,19 +332,101 @@ OFFMeshIO ::ReadCells(void * buffer)
   }
 
   CloseFile();
+  m_Tokenizer = MeshIOTokenizer();
 
   if (m_TriangleCellType)
   {
-    this->WriteCellsBuffer(
-      data, static_cast<unsigned int *>(buffer), CellGeometryEnum::TRIANGLE_CELL, this->m_NumberOfCells);
+    this->WriteCellsBuffer(data, output, CellGeometryEnum::TRIANGLE_CELL, this->m_NumberOfCells);
   }
   else
   {
-    this->WriteCellsBuffer(
-      data, static_cast<unsigned int *>(buffer), CellGeometryEnum::POLYGON_CELL, this->m_NumberOfCells);
+    this->WriteCellsBuffer(data, output, CellGeometryEnum::POLYGON_CELL, this->m_NumberOfCells);
   }
+}
 
-  delete[] data;
+void
+OFFMeshIO ::ReadCellsBufferAsAscii(unsigned int * buffer)
+{
+  // Count the cells and their point ids in each chunk of lines
+  m_Tokenizer.SetPosition(m_CellsStartPosition);
+  std::vector<MeshIOTokenizer> chunks = m_Tokenizer.SplitLines(m_Tokenizer.GetMultiThreader()->GetNumberOfWorkUnits());
+  std::vector<SizeValueType>   numberOfCells(chunks.size(), 0);
+  std::vector<SizeValueType>   numberOfValues(chunks.size(), 0);
+  m_Tokenizer.GetMultiThreader()->ParallelizeArray(
+    0,
+    chunks.size(),
+    [&chunks, &numberOfCells, &numberOfValues](SizeValueType ii) {
+      MeshIOTokenizer chunk = chunks[ii];
+      unsigned int    numberOfPoints;
+      while (!chunk.IsAtEnd())
+      {
+        chunk.SkipWhiteSpace();
+        if (chunk.ReadValue(numberOfPoints))
+        {
+          ++numberOfCells[ii];
+          numberOfValues[ii] += SizeValueType{ numberOfPoints } + 1;
+        }
+        chunk.SkipLine();
+      }
+    },
+    nullptr);
+
+  // Only the first m_NumberOfCells cells are read, as the following lines are
+  // not part of the cells
+  std::vector<SizeValueType> firstCell(chunks.size(), 0);
+  std::vector<SizeValueType> firstValue(chunks.size(), 0);
+  SizeValueType              cellCount = 0;
+  SizeValueType              valueCount = 0;
+  for (std::size_t ii = 0; ii < chunks.size(); ++ii)
+  {
+    if (cellCount >= this->m_NumberOfCells)
+    {
+      chunks.resize(ii);
+      break;
+    }
+    firstCell[ii] = cellCount;
+    firstValue[ii] = valueCount;
+    cellCount += numberOfCells[ii];
+    valueCount += numberOfValues[ii];
+  }
+  if (cellCount < this->m_NumberOfCells)
+  {
+    itkExceptionMacro(<< "Unexpected end of file while reading cells");
+  }
+
+  const SizeValueType numberOfCellsToRead = this->m_NumberOfCells;
+  const SizeValueType bufferSize = this->m_CellBufferSize - this->m_NumberOfCells;
+  m_Tokenizer.GetMultiThreader()->ParallelizeArray(
+    0,
+    chunks.size(),
+    [&chunks, &firstCell, &firstValue, numberOfCellsToRead, bufferSize, buffer](SizeValueType ii) {
+      MeshIOTokenizer chunk = chunks[ii];
+      SizeValueType   cell = firstCell[ii];
+      SizeValueType   index = firstValue[ii];
+      unsigned int    numberOfPoints;
+      while (!chunk.IsAtEnd() && cell < numberOfCellsToRead)
+      {
+        chunk.SkipWhiteSpace();
+        if (chunk.ReadValue(numberOfPoints))
+        {
+          if (index + numberOfPoints + 1 > bufferSize)
+          {
+            // The file changed since ReadMeshInformation()
+            return;
+          }
+          buffer[index++] = numberOfPoints;
+          for (unsigned int jj = 0; jj < numberOfPoints; ++jj)
+          {
+            unsigned int id = 0;
+            chunk.ReadValue(id);
+            buffer[index++] = id;
+          }
+          ++cell;
+        }
+        chunk.SkipLine();
+      }
+    },
+    nullptr);
 }
 
 void
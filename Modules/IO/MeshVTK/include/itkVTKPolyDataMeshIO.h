@@ -22,6 +22,7 @@
 #include "itkByteSwapper.h"
 #include "itkMetaDataObject.h"
 #include "itkMeshIOBase.h"
+#include "itkMeshIOTokenizer.h"
 #include "itkVectorContainer.h"
 #include "itkNumberToString.h"
 
@@ -132,6 +133,19 @@ protected:
   int
   GetNextLine(std::ifstream & ifs, std::string & line, bool lowerCase = true, SizeValueType count = 0);
 
+  /** Skip the values of a section after its header line, as tokens for an
+   * ASCII file or as bytes for a binary file. */
+  void
+  SkipValues(MeshIOTokenizer & tokenizer, SizeValueType numberOfValues, IOComponentEnum componentType) const;
+
+  /** Read the whole file for ASCII reading, or open it for binary reading,
+   * and throw an exception if the file cannot be read. */
+  void
+  ReadFileInTokenizer(MeshIOTokenizer & tokenizer);
+
+  void
+  OpenBinaryFile(std::ifstream & inputFile);
+
   template <typename T>
   void
   UpdateCellInformation(T * buffer)
@@ -194,22 +208,15 @@ protected:
 
   template <typename T>
   void
-  ReadPointsBufferAsASCII(std::ifstream & inputFile, T * buffer)
+  ReadPointsBufferAsASCII(MeshIOTokenizer & tokenizer, T * buffer)
   {
-    std::string line;
-
-    while (!inputFile.eof())
+    if (tokenizer.FindLineContaining("POINTS"))
     {
-      std::getline(inputFile, line, '\n');
-
-      if (line.find("POINTS") != std::string::npos)
+      /**  Load the point coordinates into the itk::Mesh */
+      SizeValueType numberOfComponents = this->m_NumberOfPoints * this->m_PointDimension;
+      if (tokenizer.ReadValues(buffer, numberOfComponents) != numberOfComponents)
       {
-        /**  Load the point coordinates into the itk::Mesh */
-        SizeValueType numberOfComponents = this->m_NumberOfPoints * this->m_PointDimension;
-        for (SizeValueType ii = 0; ii < numberOfComponents; ++ii)
-        {
-          inputFile >> buffer[ii];
-        }
+        itkExceptionMacro("UnExpected end of file while trying to read POINTS");
       }
     }
   }
@@ -233,59 +240,53 @@ protected:
         {
           itk::ByteSwapper<T>::SwapRangeFromSystemToBigEndian(buffer, numberOfComponents);
         }
+        return;
       }
     }
   }
 
   void
-  ReadCellsBufferAsASCII(std::ifstream & inputFile, void * buffer);
+  ReadCellsBufferAsASCII(MeshIOTokenizer & tokenizer, void * buffer);
 
   void
   ReadCellsBufferAsBINARY(std::ifstream & inputFile, void * buffer);
 
+  /** Convert a section of cells, read as the number of points and the point
+   * ids of each cell at the end of its part of the buffer, to the cell type,
+   * the number of points and the point ids of each cell. */
+  void
+  ExpandCellsSection(unsigned int *   buffer,
+                     CellGeometryEnum cellType,
+                     unsigned int     numberOfCells,
+                     unsigned int     numberOfIndices);
+
   template <typename T>
   void
-  ReadPointDataBufferAsASCII(std::ifstream & inputFile, T * buffer)
+  ReadPointDataBufferAsASCII(MeshIOTokenizer & tokenizer, T * buffer)
   {
     StringType line;
 
-    while (!inputFile.eof())
+    if (tokenizer.FindLineContaining("POINT_DATA"))
     {
-      std::getline(inputFile, line, '\n');
-      if (line.find("POINT_DATA") != std::string::npos)
+      if (!tokenizer.GetLine(line))
       {
-        if (!inputFile.eof())
-        {
-          std::getline(inputFile, line, '\n');
-        }
-        else
-        {
-          itkExceptionMacro("UnExpected end of line while trying to read POINT_DATA");
-        }
+        itkExceptionMacro("UnExpected end of line while trying to read POINT_DATA");
+      }
 
-        /** For scalars we have to read the next line of LOOKUP_TABLE */
-        if (line.find("SCALARS") != std::string::npos && line.find("COLOR_SCALARS") == std::string::npos)
+      /** For scalars we have to read the next line of LOOKUP_TABLE */
+      if (line.find("SCALARS") != std::string::npos && line.find("COLOR_SCALARS") == std::string::npos)
+      {
+        if (!tokenizer.GetLine(line) || line.find("LOOKUP_TABLE") == std::string::npos)
         {
-          if (!inputFile.eof())
-          {
-            std::getline(inputFile, line, '\n');
-            if (line.find("LOOKUP_TABLE") == std::string::npos)
-            {
-              itkExceptionMacro("UnExpected end of line while trying to read LOOKUP_TABLE");
-            }
-          }
-          else
-          {
-            itkExceptionMacro("UnExpected end of line while trying to read LOOKUP_TABLE");
-          }
+          itkExceptionMacro("UnExpected end of line while trying to read LOOKUP_TABLE");
         }
+      }
 
-        /** for VECTORS or NORMALS or TENSORS, we could read them directly */
-        SizeValueType numberOfComponents = this->m_NumberOfPointPixels * this->m_NumberOfPointPixelComponents;
-        for (SizeValueType ii = 0; ii < numberOfComponents; ++ii)
-        {
-          inputFile >> buffer[ii];
-        }
+      /** for VECTORS or NORMALS or TENSORS, we could read them directly */
+      SizeValueType numberOfComponents = this->m_NumberOfPointPixels * this->m_NumberOfPointPixelComponents;
+      if (tokenizer.ReadValues(buffer, numberOfComponents) != numberOfComponents)
+      {
+        itkExceptionMacro("UnExpected end of file while trying to read POINT_DATA");
       }
     }
   }
@@ -334,53 +335,38 @@ protected:
         {
           itk::ByteSwapper<T>::SwapRangeFromSystemToBigEndian(buffer, numberOfComponents);
         }
+        return;
       }
     }
   }
 
   template <typename T>
   void
-  ReadCellDataBufferAsASCII(std::ifstream & inputFile, T * buffer)
+  ReadCellDataBufferAsASCII(MeshIOTokenizer & tokenizer, T * buffer)
   {
     StringType line;
 
-    while (!inputFile.eof())
+    if (tokenizer.FindLineContaining("CELL_DATA"))
     {
-      std::getline(inputFile, line, '\n');
-      if (line.find("CELL_DATA") != std::string::npos)
+      if (!tokenizer.GetLine(line))
       {
-        if (!inputFile.eof())
-        {
-          std::getline(inputFile, line, '\n');
-        }
-        else
-        {
-          itkExceptionMacro("UnExpected end of line while trying to read CELL_DATA");
-        }
+        itkExceptionMacro("UnExpected end of line while trying to read CELL_DATA");
+      }
 
-        /** For scalars we have to read the next line of LOOKUP_TABLE */
-        if (line.find("SCALARS") != std::string::npos && line.find("COLOR_SCALARS") == std::string::npos)
+      /** For scalars we have to read the next line of LOOKUP_TABLE */
+      if (line.find("SCALARS") != std::string::npos && line.find("COLOR_SCALARS") == std::string::npos)
+      {
+        if (!tokenizer.GetLine(line) || line.find("LOOKUP_TABLE") == std::string::npos)
         {
-          if (!inputFile.eof())
-          {
-            std::getline(inputFile, line, '\n');
-            if (line.find("LOOKUP_TABLE") == std::string::npos)
-            {
-              itkExceptionMacro("UnExpected end of line while trying to read LOOKUP_TABLE");
-            }
-          }
-          else
-          {
-            itkExceptionMacro("UnExpected end of line while trying to read LOOKUP_TABLE");
-          }
+          itkExceptionMacro("UnExpected end of line while trying to read LOOKUP_TABLE");
         }
+      }
 
-        /** for VECTORS or NORMALS or TENSORS, we could read them directly */
-        SizeValueType numberOfComponents = this->m_NumberOfCellPixels * this->m_NumberOfCellPixelComponents;
-        for (SizeValueType ii = 0; ii < numberOfComponents; ++ii)
-        {
-          inputFile >> buffer[ii];
-        }
+      /** for VECTORS or NORMALS or TENSORS, we could read them directly */
+      SizeValueType numberOfComponents = this->m_NumberOfCellPixels * this->m_NumberOfCellPixelComponents;
+      if (tokenizer.ReadValues(buffer, numberOfComponents) != numberOfComponents)
+      {
+        itkExceptionMacro("UnExpected end of file while trying to read CELL_DATA");
       }
     }
   }
@@ -394,7 +380,7 @@ protected:
     while (!inputFile.eof())
     {
       std::getline(inputFile, line, '\n');
-      if (line.find("POINT_DATA") != std::string::npos)
+      if (line.find("CELL_DATA") != std::string::npos)
       {
         if (!inputFile.eof())
         {
@@ -402,7 +388,7 @@ protected:
         }
         else
         {
-          itkExceptionMacro("UnExpected end of line while trying to read POINT_DATA");
+          itkExceptionMacro("UnExpected end of line while trying to read CELL_DATA");
         }
 
         /** For scalars we have to read the next line of LOOKUP_TABLE */
@@ -428,6 +414,7 @@ protected:
         {
           itk::ByteSwapper<T>::SwapRangeFromSystemToBigEndian(buffer, numberOfComponents);
         }
+        return;
       }
     }
   }
@@ -76,6 +76,44 @@ VTKPolyDataMeshIO ::GetNextLine(std::ifstream & ifs, std::string & line, bool lo
   return 1;
 }
 
+void
+VTKPolyDataMeshIO::SkipValues(MeshIOTokenizer & tokenizer,
+                              SizeValueType     numberOfValues,
+                              IOComponentEnum   componentType) const
+{
+  if (this->m_FileType == IOFileEnum::ASCII)
+  {
+    tokenizer.SkipTokens(numberOfValues);
+  }
+  else
+  {
+    tokenizer.SkipBytes(numberOfValues * this->GetComponentSize(componentType));
+  }
+}
+
+void
+VTKPolyDataMeshIO::ReadFileInTokenizer(MeshIOTokenizer & tokenizer)
+{
+  if (!tokenizer.ReadFile(this->m_FileName))
+  {
+    itkExceptionMacro(<< "Unable to open file\n"
+                         "inputFilename= "
+                      << this->m_FileName);
+  }
+}
+
+void
+VTKPolyDataMeshIO::OpenBinaryFile(std::ifstream & inputFile)
+{
+  inputFile.open(this->m_FileName.c_str(), std::ios::in | std::ios::binary);
+  if (!inputFile.is_open())
+  {
+    itkExceptionMacro(<< "Unable to open file\n"
+                         "inputFilename= "
+                      << this->m_FileName);
+  }
+}
+
 
 bool
 VTKPolyDataMeshIO ::CanReadFile(const char * fileName)
@@ -191,19 +229,8 @@ VTKPolyDataMeshIO::GetComponentTypeFromString(const std::string & pointType)
 void
 VTKPolyDataMeshIO ::ReadMeshInformation()
 {
-  std::ifstream inputFile;
-
-  // Use default filetype
-  if (this->m_FileType == IOFileEnum::ASCII)
-  {
-    inputFile.open(this->m_FileName.c_str(), std::ios::in);
-  }
-  else if (m_FileType == IOFileEnum::BINARY)
-  {
-    inputFile.open(this->m_FileName.c_str(), std::ios::in | std::ios::binary);
-  }
-
-  if (!inputFile.is_open())
+  MeshIOTokenizer tokenizer;
+  if (!tokenizer.ReadFile(this->m_FileName))
   {
     itkExceptionMacro("Unable to open file\n"
                       "inputFilename= "
@@ -214,45 +241,19 @@ VTKPolyDataMeshIO ::ReadMeshInformation()
   std::string  line;
 
   // Read vtk file header (the first 3 lines)
-  while (!inputFile.eof() && numLine < 3)
+  while (!tokenizer.IsAtEnd() && numLine < 3)
   {
-    std::getline(inputFile, line, '\n');
+    tokenizer.GetLine(line);
     ++numLine;
   }
 
   if (line.find("ASCII") != std::string::npos)
   {
-    if (this->m_FileType != IOFileEnum::ASCII)
-    {
-      this->m_FileType = IOFileEnum::ASCII;
-#ifdef _WIN32
-      inputFile.close();
-      inputFile.open(this->m_FileName.c_str(), std::ios::in);
-      if (!inputFile.is_open())
-      {
-        itkExceptionMacro("Unable to open file\n"
-                          "inputFilename= "
-                          << this->m_FileName);
-      }
-#endif
-    }
+    this->m_FileType = IOFileEnum::ASCII;
   }
   else if (line.find("BINARY") != std::string::npos)
   {
-    if (this->m_FileType != IOFileEnum::BINARY)
-    {
-      this->m_FileType = IOFileEnum::BINARY;
-#ifdef _WIN32
-      inputFile.close();
-      inputFile.open(this->m_FileName.c_str(), std::ios::in | std::ios::binary);
-      if (!inputFile.is_open())
-      {
-        itkExceptionMacro("Unable to open file\n"
-                          "inputFilename= "
-                          << this->m_FileName);
-      }
-#endif
-    }
+    this->m_FileType = IOFileEnum::BINARY;
   }
   else
   {
@@ -266,10 +267,8 @@ VTKPolyDataMeshIO ::ReadMeshInformation()
   MetaDataDictionary & metaDic = this->GetMetaDataDictionary();
 
   // Searching the vtk file
-  while (!inputFile.eof())
+  while (tokenizer.GetLine(line))
   {
-    //  Read lines from input file
-    std::getline(inputFile, line, '\n');
     StringType item;
 
     //  If there are points
@@ -296,6 +295,9 @@ VTKPolyDataMeshIO ::ReadMeshInformation()
       }
 
       this->m_UpdatePoints = true;
+
+      // Skip the coordinates, instead of searching keywords in them
+      this->SkipValues(tokenizer, this->m_NumberOfPoints * this->m_PointDimension, this->m_PointComponentType);
     }
     else if (line.find("VERTICES") != std::string::npos)
     {
@@ -333,6 +335,8 @@ VTKPolyDataMeshIO ::ReadMeshInformation()
       // Set cell component type
       this->m_CellComponentType = IOComponentEnum::UINT;
       this->m_UpdateCells = true;
+
+      this->SkipValues(tokenizer, numberOfVertexIndices, IOComponentEnum::UINT);
     }
     else if (line.find("LINES") != std::string::npos)
     {
@@ -370,6 +374,8 @@ VTKPolyDataMeshIO ::ReadMeshInformation()
       // Set cell component type
       this->m_CellComponentType = IOComponentEnum::UINT;
       this->m_UpdateCells = true;
+
+      this->SkipValues(tokenizer, numberOfLineIndices, IOComponentEnum::UINT);
     }
     else if (line.find("POLYGONS") != std::string::npos)
     {
@@ -407,6 +413,8 @@ VTKPolyDataMeshIO ::ReadMeshInformation()
       // Set cell component type
       this->m_CellComponentType = IOComponentEnum::UINT;
       this->m_UpdateCells = true;
+
+      this->SkipValues(tokenizer, numberOfPolygonIndices, IOComponentEnum::UINT);
     }
     else if (line.find("POINT_DATA") != std::string::npos)
     {
@@ -421,9 +429,9 @@ VTKPolyDataMeshIO ::ReadMeshInformation()
       pdss >> this->m_NumberOfPointPixels;
 
       // Continue to read line and get data type
-      if (!inputFile.eof())
+      if (!tokenizer.IsAtEnd())
       {
-        std::getline(inputFile, line, '\n');
+        tokenizer.GetLine(line);
       }
       else
       {
@@ -556,9 +564,9 @@ VTKPolyDataMeshIO ::ReadMeshInformation()
       cdss >> this->m_NumberOfCellPixels;
 
       // Continue to read line and get data type
-      if (!inputFile.eof())
+      if (!tokenizer.IsAtEnd())
       {
-        std::getline(inputFile, line, '\n');
+        tokenizer.GetLine(line);
       }
       else
       {
@@ -682,8 +690,6 @@ VTKPolyDataMeshIO ::ReadMeshInformation()
   {
     this->m_CellBufferSize += this->m_NumberOfCells;
   }
-
-  inputFile.close();
 }
 
 #define CASE_INVOKE_BY_TYPE(function, param)                    \
@@ -756,30 +762,14 @@ VTKPolyDataMeshIO ::ReadMeshInformation()
 void
 VTKPolyDataMeshIO ::ReadPoints(void * buffer)
 {
-  std::ifstream inputFile;
-
   if (this->m_FileType == IOFileEnum::ASCII)
   {
-    inputFile.open(this->m_FileName.c_str(), std::ios::in);
-  }
-  else if (m_FileType == IOFileEnum::BINARY)
-  {
-    inputFile.open(this->m_FileName.c_str(), std::ios::in | std::ios::binary);
-  }
-
-  if (!inputFile.is_open())
-  {
-    itkExceptionMacro("Unable to open file\n"
-                      "inputFilename= "
-                      << this->m_FileName);
-  }
-
+    MeshIOTokenizer tokenizer;
+    this->ReadFileInTokenizer(tokenizer);
 
-  if (this->m_FileType == IOFileEnum::ASCII)
-  {
     switch (this->m_PointComponentType)
     {
-      CASE_INVOKE_BY_TYPE(ReadPointsBufferAsASCII, inputFile)
+      CASE_INVOKE_BY_TYPE(ReadPointsBufferAsASCII, tokenizer)
 
       default:
       {
@@ -789,6 +779,9 @@ VTKPolyDataMeshIO ::ReadPoints(void * buffer)
   }
   else if (this->m_FileType == IOFileEnum::BINARY)
   {
+    std::ifstream inputFile;
+    this->OpenBinaryFile(inputFile);
+
     switch (this->m_PointComponentType)
     {
       CASE_INVOKE_BY_TYPE(ReadPointsBufferAsBINARY, inputFile)
@@ -803,231 +796,171 @@ VTKPolyDataMeshIO ::ReadPoints(void * buffer)
   {
     itkExceptionMacro(<< "Invalid output file type(not ASCII or BINARY)");
   }
-
-  inputFile.close();
 }
 
 void
 VTKPolyDataMeshIO ::ReadCells(void * buffer)
 {
-  std::ifstream inputFile;
-
-  if (this->m_FileType == IOFileEnum::ASCII)
-  {
-    inputFile.open(this->m_FileName.c_str(), std::ios::in);
-  }
-  else if (m_FileType == IOFileEnum::BINARY)
-  {
-    inputFile.open(this->m_FileName.c_str(), std::ios::in | std::ios::binary);
-  }
-
-  if (!inputFile.is_open())
-  {
-    itkExceptionMacro(<< "Unable to open file\n"
-                         "inputFilename= "
-                      << this->m_FileName);
-  }
-
-
   if (this->m_FileType == IOFileEnum::ASCII)
   {
-    ReadCellsBufferAsASCII(inputFile, buffer);
+    MeshIOTokenizer tokenizer;
+    this->ReadFileInTokenizer(tokenizer);
+    ReadCellsBufferAsASCII(tokenizer, buffer);
   }
   else if (this->m_FileType == IOFileEnum::BINARY)
   {
+    std::ifstream inputFile;
+    this->OpenBinaryFile(inputFile);
     ReadCellsBufferAsBINARY(inputFile, buffer);
   }
   else
   {
     itkExceptionMacro(<< "Unkonw file type");
   }
-
-  inputFile.close();
 }
 
 void
-VTKPolyDataMeshIO::ReadCellsBufferAsASCII(std::ifstream & inputFile, void * buffer)
+VTKPolyDataMeshIO::ReadCellsBufferAsASCII(MeshIOTokenizer & tokenizer, void * buffer)
 {
   std::string   line;
   SizeValueType index = 0;
-  unsigned int  numPoints; // number of point in each cell
 
   MetaDataDictionary & metaDic = this->GetMetaDataDictionary();
   using GeometryIntegerType = unsigned int;
   auto * data = static_cast<GeometryIntegerType *>(buffer);
 
-  while (!inputFile.eof())
+  while (index < this->m_CellBufferSize && tokenizer.GetLine(line))
   {
-    std::getline(inputFile, line, '\n');
+    CellGeometryEnum cellType;
+    unsigned int     numberOfCells = 0;
+    unsigned int     numberOfIndices = 0;
     if (line.find("VERTICES") != std::string::npos)
     {
-      unsigned int numberOfVertices = 0;
-      ExposeMetaData<unsigned int>(metaDic, "numberOfVertices", numberOfVertices);
-
-      for (unsigned int ii = 0; ii < numberOfVertices; ++ii)
-      {
-        inputFile >> numPoints;
-        data[index++] = static_cast<GeometryIntegerType>(CellGeometryEnum::VERTEX_CELL);
-        data[index++] = numPoints;
-        for (unsigned int jj = 0; jj < numPoints; ++jj)
-        {
-          inputFile >> data[index++];
-        }
-      }
+      cellType = CellGeometryEnum::VERTEX_CELL;
+      ExposeMetaData<unsigned int>(metaDic, "numberOfVertices", numberOfCells);
+      ExposeMetaData<unsigned int>(metaDic, "numberOfVertexIndices", numberOfIndices);
     }
     else if (line.find("LINES") != std::string::npos)
     {
-      unsigned int numberOfLines = 0;
-      ExposeMetaData<unsigned int>(metaDic, "numberOfLines", numberOfLines);
-
-      for (unsigned int ii = 0; ii < numberOfLines; ++ii)
-      {
-        inputFile >> numPoints;
-        if (numPoints == 2)
-        {
-          data[index++] = static_cast<GeometryIntegerType>(CellGeometryEnum::LINE_CELL);
-        }
-        else
-        {
-          // Use POLYLINE_CELL when more than 2 points are present
-          data[index++] = static_cast<GeometryIntegerType>(CellGeometryEnum::POLYLINE_CELL);
-        }
-        data[index++] = numPoints;
-        for (unsigned int jj = 0; jj < numPoints; ++jj)
-        {
-          inputFile >> data[index++];
-        }
-      }
+      cellType = CellGeometryEnum::LINE_CELL;
+      ExposeMetaData<unsigned int>(metaDic, "numberOfLines", numberOfCells);
+      ExposeMetaData<unsigned int>(metaDic, "numberOfLineIndices", numberOfIndices);
     }
     else if (line.find("POLYGONS") != std::string::npos)
     {
-      unsigned int numberOfPolygons = 0;
-      ExposeMetaData<unsigned int>(metaDic, "numberOfPolygons", numberOfPolygons);
-
-      for (unsigned int ii = 0; ii < numberOfPolygons; ++ii)
-      {
-        inputFile >> numPoints;
+      cellType = CellGeometryEnum::POLYGON_CELL;
+      ExposeMetaData<unsigned int>(metaDic, "numberOfPolygons", numberOfCells);
+      ExposeMetaData<unsigned int>(metaDic, "numberOfPolygonIndices", numberOfIndices);
+    }
+    else
+    {
+      continue;
+    }
 
-        data[index++] = static_cast<GeometryIntegerType>(CellGeometryEnum::POLYGON_CELL);
-        data[index++] = numPoints;
-        for (unsigned int jj = 0; jj < numPoints; ++jj)
-        {
-          inputFile >> data[index++];
-        }
-      }
+    // The whole section is read at once, in parallel for large sections
+    GeometryIntegerType * section = data + index;
+    if (tokenizer.ReadValues(section + numberOfCells, numberOfIndices) != numberOfIndices)
+    {
+      itkExceptionMacro(<< "UnExpected end of file while trying to read cells");
     }
+    this->ExpandCellsSection(section, cellType, numberOfCells, numberOfIndices);
+    index += numberOfCells + numberOfIndices;
   }
 }
 
 void
 VTKPolyDataMeshIO ::ReadCellsBufferAsBINARY(std::ifstream & inputFile, void * buffer)
 {
-  if (!this->m_CellBufferSize)
-  {
-    return;
-  }
-
-  auto * inputBuffer = new unsigned int[this->m_CellBufferSize - this->m_NumberOfCells];
-  void * pv = inputBuffer;
-  auto * startBuffer = static_cast<char *>(pv);
-  auto * outputBuffer = static_cast<unsigned int *>(buffer);
+  std::string   line;
+  SizeValueType index = 0;
 
-  std::string          line;
   MetaDataDictionary & metaDic = this->GetMetaDataDictionary();
+  auto *               data = static_cast<unsigned int *>(buffer);
 
-  while (!inputFile.eof())
+  while (index < this->m_CellBufferSize && !inputFile.eof())
   {
     std::getline(inputFile, line, '\n');
+
+    CellGeometryEnum cellType;
+    unsigned int     numberOfCells = 0;
+    unsigned int     numberOfIndices = 0;
     if (line.find("VERTICES") != std::string::npos)
     {
-      unsigned int numberOfVertices = 0;
-      unsigned int numberOfVertexIndices = 0;
-      ExposeMetaData<unsigned int>(metaDic, "numberOfVertices", numberOfVertices);
-      ExposeMetaData<unsigned int>(metaDic, "numberOfVertexIndices", numberOfVertexIndices);
-      inputFile.read(startBuffer, numberOfVertexIndices * sizeof(unsigned int));
-
-      pv = startBuffer;
-      auto * data = static_cast<unsigned int *>(pv);
-      if (itk::ByteSwapper<unsigned int>::SystemIsLittleEndian())
-      {
-        itk::ByteSwapper<unsigned int>::SwapRangeFromSystemToBigEndian(data, numberOfVertexIndices);
-      }
-      this->WriteCellsBuffer(data, outputBuffer, CellGeometryEnum::VERTEX_CELL, numberOfVertices);
-      startBuffer += numberOfVertexIndices * sizeof(unsigned int);
-      outputBuffer += (numberOfVertexIndices + numberOfVertices) * sizeof(unsigned int);
+      cellType = CellGeometryEnum::VERTEX_CELL;
+      ExposeMetaData<unsigned int>(metaDic, "numberOfVertices", numberOfCells);
+      ExposeMetaData<unsigned int>(metaDic, "numberOfVertexIndices", numberOfIndices);
     }
     else if (line.find("LINES") != std::string::npos)
     {
-      unsigned int numberOfLines = 0;
-      unsigned int numberOfLineIndices = 0;
-      ExposeMetaData<unsigned int>(metaDic, "numberOfLines", numberOfLines);
-      ExposeMetaData<unsigned int>(metaDic, "numberOfLineIndices", numberOfLineIndices);
-      inputFile.read(startBuffer, numberOfLineIndices * sizeof(unsigned int));
-
-      pv = startBuffer;
-      auto * data = static_cast<unsigned int *>(pv);
-      if (itk::ByteSwapper<unsigned int>::SystemIsLittleEndian())
-      {
-        itk::ByteSwapper<unsigned int>::SwapRangeFromSystemToBigEndian(data, numberOfLineIndices);
-      }
-      this->WriteCellsBuffer(data, outputBuffer, CellGeometryEnum::LINE_CELL, numberOfLines);
-      startBuffer += numberOfLineIndices * sizeof(unsigned int);
-      outputBuffer += (numberOfLineIndices + numberOfLines) * sizeof(unsigned int);
+      cellType = CellGeometryEnum::LINE_CELL;
+      ExposeMetaData<unsigned int>(metaDic, "numberOfLines", numberOfCells);
+      ExposeMetaData<unsigned int>(metaDic, "numberOfLineIndices", numberOfIndices);
     }
     else if (line.find("POLYGONS") != std::string::npos)
     {
-      unsigned int numberOfPolygons = 0;
-      unsigned int numberOfPolygonIndices = 0;
-      ExposeMetaData<unsigned int>(metaDic, "numberOfPolygons", numberOfPolygons);
-      ExposeMetaData<unsigned int>(metaDic, "numberOfPolygonIndices", numberOfPolygonIndices);
-      inputFile.read(startBuffer, numberOfPolygonIndices * sizeof(unsigned int));
-
-      pv = startBuffer;
-      auto * data = static_cast<unsigned int *>(pv);
-      if (itk::ByteSwapper<unsigned int>::SystemIsLittleEndian())
-      {
-        itk::ByteSwapper<unsigned int>::SwapRangeFromSystemToBigEndian(data, numberOfPolygonIndices);
-      }
-
-      this->WriteCellsBuffer(data, outputBuffer, CellGeometryEnum::POLYGON_CELL, numberOfPolygons);
-      startBuffer += numberOfPolygonIndices * sizeof(unsigned int);
-      outputBuffer += (numberOfPolygonIndices + numberOfPolygons) * sizeof(unsigned int);
+      cellType = CellGeometryEnum::POLYGON_CELL;
+      ExposeMetaData<unsigned int>(metaDic, "numberOfPolygons", numberOfCells);
+      ExposeMetaData<unsigned int>(metaDic, "numberOfPolygonIndices", numberOfIndices);
+    }
+    else
+    {
+      continue;
     }
-  }
 
-  if (this->m_CellBufferSize)
-  {
-    delete[] inputBuffer;
+    // The section is read directly in the output buffer, without a temporary
+    // copy
+    unsigned int * section = data + index;
+    if (!inputFile.read(reinterpret_cast<char *>(section + numberOfCells), numberOfIndices * sizeof(unsigned int)))
+    {
+      itkExceptionMacro(<< "UnExpected end of file while trying to read cells");
+    }
+    if (itk::ByteSwapper<unsigned int>::SystemIsLittleEndian())
+    {
+      itk::ByteSwapper<unsigned int>::SwapRangeFromSystemToBigEndian(section + numberOfCells, numberOfIndices);
+    }
+    this->ExpandCellsSection(section, cellType, numberOfCells, numberOfIndices);
+    index += numberOfCells + numberOfIndices;
   }
 }
 
+/**
+ * The cells are expanded from the front. The output position is behind the
+ * input position by the number of cells left, so that every input value is
+ * read before it is overwritten.
+ */
 void
-VTKPolyDataMeshIO ::ReadPointData(void * buffer)
+VTKPolyDataMeshIO::ExpandCellsSection(unsigned int *   buffer,
+                                      CellGeometryEnum cellType,
+                                      unsigned int     numberOfCells,
+                                      unsigned int     numberOfIndices)
 {
-  std::ifstream inputFile;
+  const unsigned int * input = buffer + numberOfCells;
 
-  if (this->m_FileType == IOFileEnum::ASCII)
+  // Check the number of points of the cells before writing them
+  SizeValueType position = 0;
+  for (unsigned int ii = 0; ii < numberOfCells && position < numberOfIndices; ++ii)
   {
-    inputFile.open(this->m_FileName.c_str(), std::ios::in);
+    position += SizeValueType{ input[position] } + 1;
   }
-  else if (m_FileType == IOFileEnum::BINARY)
+  if (position != numberOfIndices)
   {
-    inputFile.open(this->m_FileName.c_str(), std::ios::in | std::ios::binary);
-  }
-
-  if (!inputFile.is_open())
-  {
-    itkExceptionMacro(<< "Unable to open file\n"
-                         "inputFilename= "
-                      << this->m_FileName);
+    itkExceptionMacro(<< "The number of points of the cells does not match the number of indices " << numberOfIndices);
   }
 
+  this->WriteCellsBuffer(input, buffer, cellType, numberOfCells);
+}
 
+void
+VTKPolyDataMeshIO ::ReadPointData(void * buffer)
+{
   if (this->m_FileType == IOFileEnum::ASCII)
   {
+    MeshIOTokenizer tokenizer;
+    this->ReadFileInTokenizer(tokenizer);
+
     switch (this->m_PointPixelComponentType)
     {
-      CASE_INVOKE_BY_TYPE(ReadPointDataBufferAsASCII, inputFile)
+      CASE_INVOKE_BY_TYPE(ReadPointDataBufferAsASCII, tokenizer)
 
       default:
       {
@@ -1037,6 +970,9 @@ VTKPolyDataMeshIO ::ReadPointData(void * buffer)
   }
   else if (this->m_FileType == IOFileEnum::BINARY)
   {
+    std::ifstream inputFile;
+    this->OpenBinaryFile(inputFile);
+
     switch (this->m_PointPixelComponentType)
     {
       CASE_INVOKE_BY_TYPE(ReadPointDataBufferAsBINARY, inputFile)
@@ -1051,37 +987,19 @@ VTKPolyDataMeshIO ::ReadPointData(void * buffer)
   {
     itkExceptionMacro(<< "Unkonw file type");
   }
-
-  inputFile.close();
 }
 
 void
 VTKPolyDataMeshIO ::ReadCellData(void * buffer)
 {
-  std::ifstream inputFile;
-
   if (this->m_FileType == IOFileEnum::ASCII)
   {
-    inputFile.open(this->m_FileName.c_str(), std::ios::in);
-  }
-  else if (m_FileType == IOFileEnum::BINARY)
-  {
-    inputFile.open(this->m_FileName.c_str(), std::ios::in | std::ios::binary);
-  }
+    MeshIOTokenizer tokenizer;
+    this->ReadFileInTokenizer(tokenizer);
 
-  if (!inputFile.is_open())
-  {
-    itkExceptionMacro(<< "Unable to open file\n"
-                         "inputFilename= "
-                      << this->m_FileName);
-  }
-
-
-  if (this->m_FileType == IOFileEnum::ASCII)
-  {
     switch (this->m_CellPixelComponentType)
     {
-      CASE_INVOKE_BY_TYPE(ReadCellDataBufferAsASCII, inputFile)
+      CASE_INVOKE_BY_TYPE(ReadCellDataBufferAsASCII, tokenizer)
 
       default:
       {
@@ -1091,6 +1009,9 @@ VTKPolyDataMeshIO ::ReadCellData(void * buffer)
   }
   else if (this->m_FileType == IOFileEnum::BINARY)
   {
+    std::ifstream inputFile;
+    this->OpenBinaryFile(inputFile);
+
     switch (this->m_CellPixelComponentType)
     {
       CASE_INVOKE_BY_TYPE(ReadCellDataBufferAsBINARY, inputFile)
@@ -1105,8 +1026,6 @@ VTKPolyDataMeshIO ::ReadCellData(void * buffer)
   {
     itkExceptionMacro(<< "Unkonw file type");
   }
-
-  inputFile.close();
 }
 
 void
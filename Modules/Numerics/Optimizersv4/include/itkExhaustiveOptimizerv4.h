@@ -21,6 +21,9 @@
 #include "itkIntTypes.h"
 #include "itkObjectToObjectOptimizerBase.h"
 
+#include <exception>
+#include <vector>
+
 namespace itk
 {
 /**
@@ -73,6 +76,17 @@ namespace itk
  * the number of steps along each dimension, a side of the region is
  * stepLength*(2*numberOfSteps[d]+1)*scaling[d].
  *
+ * The grid positions are independent of each other, so they can be evaluated
+ * concurrently by setting a list of worker metrics with SetWorkerMetrics().
+ * Each worker metric must compute the same values as the metric of the
+ * optimizer while owning its own state, typically a metric configured like
+ * the optimizer's one with its own copy of the moving transform (see
+ * Transform::Clone()). The metric values are then computed in parallel, one
+ * worker per metric, while the search itself is replayed in grid order: the
+ * IterationEvents, the current index and the extrema found are those of the
+ * serial search. Each worker runs on a thread of its own rather than on the
+ * thread pool, so the worker metrics may themselves be multi-threaded.
+ *
  * \ingroup ITKOptimizersv4
  */
 template <typename TInternalComputationValueType>
@@ -106,6 +120,11 @@ public:
   /** Scales type */
   using typename Superclass::ScalesType;
 
+  /** Metric type */
+  using typename Superclass::MetricType;
+  using MetricTypePointer = typename MetricType::Pointer;
+  using MetricsListType = std::vector<MetricTypePointer>;
+
   void
   StartOptimization(bool doOnlyInitialization = false) override;
 
@@ -147,6 +166,18 @@ public:
     return m_InitialPosition;
   }
 
+  /** Set/Get the metrics evaluating the grid positions in parallel, one
+   * worker per metric. The metrics must not be shared with the optimizer or
+   * between workers. An empty list, the default, walks the grid serially
+   * with the metric of the optimizer. */
+  void
+  SetWorkerMetrics(const MetricsListType & metrics);
+  const MetricsListType &
+  GetWorkerMetrics() const
+  {
+    return m_WorkerMetrics;
+  }
+
 protected:
   ExhaustiveOptimizerv4();
   ~ExhaustiveOptimizerv4() override = default;
@@ -160,6 +191,13 @@ protected:
   void
   IncrementIndex(ParametersType & newPosition);
 
+  /** Compute with the worker metrics the values of the next grid positions,
+   * starting with the current one. When an evaluation fails, the values stop
+   * at the position the serial walk would have failed at, and the exception
+   * it would have thrown is returned. */
+  std::exception_ptr
+  EvaluateNextPositionsInParallel(std::vector<MeasureType> & values);
+
 protected:
   ParametersType m_InitialPosition;
   MeasureType    m_CurrentValue{ 0 };
@@ -174,6 +212,7 @@ protected:
 
 private:
   std::ostringstream m_StopConditionDescription{ "" };
+  MetricsListType    m_WorkerMetrics;
 };
 } // end namespace itk
 
@@ -18,6 +18,10 @@
 #ifndef itkExhaustiveOptimizerv4_hxx
 #define itkExhaustiveOptimizerv4_hxx
 
+#include "itkPlatformMultiThreader.h"
+
+#include <algorithm>
+#include <exception>
 
 namespace itk
 {
@@ -87,6 +91,19 @@ ExhaustiveOptimizerv4<TInternalComputationValueType>::StartWalking()
   }
   this->m_Metric->SetParameters(position);
 
+  for (const auto & workerMetric : m_WorkerMetrics)
+  {
+    if (workerMetric.IsNull() || workerMetric == this->m_Metric)
+    {
+      itkExceptionMacro(<< "The worker metrics must be set and distinct from the metric of the optimizer.");
+    }
+    if (workerMetric->GetNumberOfParameters() != spaceDimension)
+    {
+      itkExceptionMacro(<< "The number of parameters of a worker metric is " << workerMetric->GetNumberOfParameters()
+                        << ", but the NumberOfParameters is " << spaceDimension << ".");
+    }
+  }
+
   itkDebugMacro("Calling ResumeWalking");
 
   this->ResumeWalking();
@@ -99,6 +116,12 @@ ExhaustiveOptimizerv4<TInternalComputationValueType>::ResumeWalking()
   itkDebugMacro("ResumeWalk");
   m_Stop = false;
 
+  // Values of the next grid positions when they are computed in parallel,
+  // and the failure met after them
+  std::vector<MeasureType> values;
+  size_t                   nextValue = 0;
+  std::exception_ptr       failure;
+
   while (!m_Stop)
   {
     ParametersType currentPosition = this->GetCurrentPosition();
@@ -109,7 +132,24 @@ ExhaustiveOptimizerv4<TInternalComputationValueType>::ResumeWalking()
       break;
     }
 
-    m_CurrentValue = this->m_Metric->GetValue();
+    if (m_WorkerMetrics.empty())
+    {
+      m_CurrentValue = this->m_Metric->GetValue();
+    }
+    else
+    {
+      if (nextValue == values.size() && !failure)
+      {
+        failure = this->EvaluateNextPositionsInParallel(values);
+        nextValue = 0;
+      }
+      // The failure is thrown once the positions before it are walked
+      if (nextValue == values.size())
+      {
+        std::rethrow_exception(failure);
+      }
+      m_CurrentValue = values[nextValue++];
+    }
 
     if (m_CurrentValue > m_MaximumMetricValue)
     {
@@ -202,6 +242,98 @@ ExhaustiveOptimizerv4<TInternalComputationValueType>::IncrementIndex(ParametersT
   }
 }
 
+template <typename TInternalComputationValueType>
+std::exception_ptr
+ExhaustiveOptimizerv4<TInternalComputationValueType>::EvaluateNextPositionsInParallel(std::vector<MeasureType> & values)
+{
+  // Number of grid positions evaluated by each worker before the search is
+  // replayed, which bounds the evaluations wasted when the walk is stopped.
+  constexpr SizeValueType positionsPerWorker = 64;
+
+  using ParametersValueType = typename ParametersType::ValueType;
+
+  const unsigned int     spaceDimension = this->m_Metric->GetParameters().GetSize();
+  const auto             numberOfWorkers = static_cast<SizeValueType>(m_WorkerMetrics.size());
+  const ScalesType &     scales = this->GetScales();
+  const ParametersType & initialPosition = this->GetInitialPosition();
+  const ParametersType   currentPosition = this->GetCurrentPosition();
+
+  // Linear index of the current grid position, the first axis varying fastest
+  SizeValueType currentLinearIndex = 0;
+  SizeValueType numberOfPositions = 1;
+  for (unsigned int i = 0; i < spaceDimension; ++i)
+  {
+    currentLinearIndex += static_cast<SizeValueType>(m_CurrentIndex[i]) * numberOfPositions;
+    numberOfPositions *= 2 * m_NumberOfSteps[i] + 1;
+  }
+  const SizeValueType numberOfValues =
+    std::min(numberOfPositions - currentLinearIndex, numberOfWorkers * positionsPerWorker);
+  values.resize(numberOfValues);
+
+  std::vector<std::exception_ptr> exceptions(numberOfWorkers);
+  std::vector<SizeValueType>      failedValues(numberOfWorkers, numberOfValues);
+
+  // The workers run on threads of their own: on the thread pool, they would
+  // wait for the pool work of the metrics while occupying the pool threads
+  auto multiThreader = PlatformMultiThreader::New();
+  multiThreader->SetNumberOfWorkUnits(numberOfWorkers);
+  multiThreader->ParallelizeArray(
+    0,
+    numberOfWorkers,
+    [&](SizeValueType worker) {
+      MetricType *   metric = m_WorkerMetrics[worker];
+      ParametersType position(spaceDimension);
+      for (SizeValueType k = worker; k < numberOfValues; k += numberOfWorkers)
+      {
+        if (k == 0)
+        {
+          position = currentPosition;
+        }
+        else
+        {
+          // Same computation as IncrementIndex(), from the grid index of the position
+          SizeValueType linearIndex = currentLinearIndex + k;
+          for (unsigned int i = 0; i < spaceDimension; ++i)
+          {
+            const SizeValueType size = 2 * m_NumberOfSteps[i] + 1;
+            const auto          index = static_cast<ParametersValueType>(linearIndex % size);
+            linearIndex /= size;
+            position[i] = (index - m_NumberOfSteps[i]) * m_StepLength * scales[i] + initialPosition[i];
+          }
+        }
+        try
+        {
+          metric->SetParameters(position);
+          values[k] = metric->GetValue();
+        }
+        catch (...)
+        {
+          exceptions[worker] = std::current_exception();
+          failedValues[worker] = k;
+          return;
+        }
+      }
+    },
+    nullptr);
+
+  // Keep the failure the serial walk would have met first. All the positions
+  // before it have been evaluated.
+  const auto firstFailure = std::min_element(failedValues.begin(), failedValues.end()) - failedValues.begin();
+  values.resize(failedValues[firstFailure]);
+  return exceptions[firstFailure];
+}
+
+template <typename TInternalComputationValueType>
+void
+ExhaustiveOptimizerv4<TInternalComputationValueType>::SetWorkerMetrics(const MetricsListType & metrics)
+{
+  if (metrics != m_WorkerMetrics)
+  {
+    m_WorkerMetrics = metrics;
+    this->Modified();
+  }
+}
+
 template <typename TInternalComputationValueType>
 const std::string
 ExhaustiveOptimizerv4<TInternalComputationValueType>::GetStopConditionDescription() const
@@ -233,6 +365,7 @@ ExhaustiveOptimizerv4<TInternalComputationValueType>::PrintSelf(std::ostream & o
   os << indent << "MinimumMetricValue = " << m_MinimumMetricValue << std::endl;
   os << indent << "MinimumMetricValuePosition = " << m_MinimumMetricValuePosition << std::endl;
   os << indent << "MaximumMetricValuePosition = " << m_MaximumMetricValuePosition << std::endl;
+  os << indent << "NumberOfWorkerMetrics = " << m_WorkerMetrics.size() << std::endl;
 }
 } // end namespace itk
 
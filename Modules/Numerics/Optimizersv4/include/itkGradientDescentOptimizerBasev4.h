@@ -123,8 +123,8 @@ public:
 
   /** Modify the gradient in place, to advance the optimization.
    * This call performs a threaded modification for transforms with
-   * local support (assumed to be dense). Otherwise the modification
-   * is performed w/out threading.
+   * local support (assumed to be dense) or with many parameters.
+   * Otherwise the modification is performed w/out threading.
    * See EstimateLearningRate() to perform optionally learning rate
    * estimation.
    * At completion, m_Gradient can be used to update the transform
@@ -138,6 +138,15 @@ public:
   virtual void
   ModifyGradientByLearningRate();
 
+  /** Modify the gradient in place by the scales and then by the learning
+   * rate, with the same result as ModifyGradientByScales() followed by
+   * ModifyGradientByLearningRate(), but in a single pass over the gradient.
+   * It can be used when the learning rate does not depend on the scaled
+   * gradient, i.e. when it is not estimated at the current iteration, and
+   * when CanFuseGradientModification() returns true. */
+  virtual void
+  ModifyGradientByScalesAndLearningRate();
+
   using IndexRangeType = ThreadedIndexedContainerPartitioner::IndexRangeType;
 
   /** Derived classes define this worker method to modify the gradient by scales.
@@ -159,6 +168,17 @@ public:
   virtual void
   ModifyGradientByLearningRateOverSubRange(const IndexRangeType & subrange) = 0;
 
+  /** Modify the gradient by scales and then by learning rates over the index
+   * range defined in \c subrange.
+   * Called from ModifyGradientByScalesAndLearningRate(), either directly or
+   * via threaded operation. The default implementation calls
+   * ModifyGradientByScalesOverSubRange() and then
+   * ModifyGradientByLearningRateOverSubRange() on successive blocks of the
+   * subrange that are small enough to stay in cache, so that the gradient is
+   * only read from memory once. */
+  virtual void
+  ModifyGradientByScalesAndLearningRateOverSubRange(const IndexRangeType & subrange);
+
 protected:
   /** Default constructor */
   GradientDescentOptimizerBasev4Template();
@@ -199,6 +219,8 @@ protected:
 
   typename DomainThreader<ThreadedIndexedContainerPartitioner, Self>::Pointer m_ModifyGradientByScalesThreader;
   typename DomainThreader<ThreadedIndexedContainerPartitioner, Self>::Pointer m_ModifyGradientByLearningRateThreader;
+  typename DomainThreader<ThreadedIndexedContainerPartitioner, Self>::Pointer
+    m_ModifyGradientByScalesAndLearningRateThreader;
 
   /* Common variables for optimization control and reporting */
   bool                                     m_Stop{ false };
@@ -210,6 +232,21 @@ protected:
   void
   PrintSelf(std::ostream & os, Indent indent) const override;
 
+  /** Whether the gradient is modified by threaded operations. This is the
+   * case for transforms with local support and, when
+   * CanFuseGradientModification() returns true, for global transforms with
+   * enough parameters for threading to pay off, e.g. B-spline transforms. */
+  bool
+  GetModifyGradientIsThreaded() const;
+
+  /** Whether ModifyGradientByScalesAndLearningRate() may replace
+   * ModifyGradientByScales() followed by ModifyGradientByLearningRate().
+   * The single pass calls the sub-range methods on blocks of the gradient
+   * from its own threader, so it is only equivalent when none of these
+   * methods and threaders is customized. Returns false by default. */
+  virtual bool
+  CanFuseGradientModification() const;
+
 private:
 };
 
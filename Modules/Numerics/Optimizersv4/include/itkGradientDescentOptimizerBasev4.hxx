@@ -20,6 +20,9 @@
 
 #include "itkGradientDescentOptimizerBasev4ModifyGradientByScalesThreader.h"
 #include "itkGradientDescentOptimizerBasev4ModifyGradientByLearningRateThreader.h"
+#include "itkGradientDescentOptimizerBasev4ModifyGradientByScalesAndLearningRateThreader.h"
+
+#include <algorithm>
 
 namespace itk
 {
@@ -41,6 +44,11 @@ GradientDescentOptimizerBasev4Template<TInternalComputationValueType>::GradientD
     GradientDescentOptimizerBasev4ModifyGradientByLearningRateThreaderTemplate<TInternalComputationValueType>::New();
   this->m_ModifyGradientByLearningRateThreader = modifyGradientByLearningRateThreader;
 
+  /** Threader for apply the scales and the learning rate to gradient */
+  this->m_ModifyGradientByScalesAndLearningRateThreader =
+    GradientDescentOptimizerBasev4ModifyGradientByScalesAndLearningRateThreaderTemplate<
+      TInternalComputationValueType>::New();
+
   this->m_StopCondition = StopConditionObjectToObjectOptimizerEnum::MAXIMUM_NUMBER_OF_ITERATIONS;
   this->m_StopConditionDescription << this->GetNameOfClass() << ": ";
 
@@ -75,6 +83,7 @@ GradientDescentOptimizerBasev4Template<TInternalComputationValueType>::PrintSelf
   itkPrintSelfObjectMacro(ConvergenceMonitoring);
   itkPrintSelfObjectMacro(ModifyGradientByScalesThreader);
   itkPrintSelfObjectMacro(ModifyGradientByLearningRateThreader);
+  itkPrintSelfObjectMacro(ModifyGradientByScalesAndLearningRateThreader);
 
   os << indent << "Stop: " << (this->m_Stop ? "On" : "Off") << std::endl;
   os << indent << "StopCondition: "
@@ -120,7 +129,7 @@ GradientDescentOptimizerBasev4Template<TInternalComputationValueType>::ModifyGra
   fullrange[1] = this->m_Gradient.GetSize() - 1; // range is inclusive
   /* Perform the modification either with or without threading */
 
-  if (this->m_Metric->HasLocalSupport())
+  if (this->GetModifyGradientIsThreaded())
   {
     // Inheriting classes should instantiate and assign m_ModifyGradientByScalesThreader
     // in their constructor.
@@ -189,7 +198,7 @@ GradientDescentOptimizerBasev4Template<TInternalComputationValueType>::ModifyGra
   fullrange[1] = this->m_Gradient.GetSize() - 1; // range is inclusive
 
   /* Perform the modification either with or without threading */
-  if (this->m_Metric->HasLocalSupport())
+  if (this->GetModifyGradientIsThreaded())
   {
     // Inheriting classes should instantiate and assign m_ModifyGradientByLearningRateThreader
     // in their constructor.
@@ -207,6 +216,77 @@ GradientDescentOptimizerBasev4Template<TInternalComputationValueType>::ModifyGra
   }
 }
 
+//-------------------------------------------------------------------
+template <typename TInternalComputationValueType>
+void
+GradientDescentOptimizerBasev4Template<TInternalComputationValueType>::ModifyGradientByScalesAndLearningRate()
+{
+  if (this->GetScalesAreIdentity() && this->GetWeightsAreIdentity())
+  {
+    this->ModifyGradientByLearningRate();
+    return;
+  }
+  if (this->m_Gradient.GetSize() == 0)
+  {
+    return;
+  }
+
+  IndexRangeType fullrange;
+  fullrange[0] = 0;
+  fullrange[1] = this->m_Gradient.GetSize() - 1; // range is inclusive
+
+  /* Perform the modification either with or without threading */
+  if (this->GetModifyGradientIsThreaded())
+  {
+    this->m_ModifyGradientByScalesAndLearningRateThreader->Execute(this, fullrange);
+  }
+  else
+  {
+    this->ModifyGradientByScalesAndLearningRateOverSubRange(fullrange);
+  }
+}
+
+//-------------------------------------------------------------------
+template <typename TInternalComputationValueType>
+void
+GradientDescentOptimizerBasev4Template<TInternalComputationValueType>::
+  ModifyGradientByScalesAndLearningRateOverSubRange(const IndexRangeType & subrange)
+{
+  // 4096 values of the gradient fit in the L1 cache of current processors
+  constexpr IndexValueType blockSize = 4096;
+
+  IndexRangeType block;
+  for (block[0] = subrange[0]; block[0] <= subrange[1]; block[0] += blockSize)
+  {
+    block[1] = std::min(block[0] + blockSize - 1, subrange[1]); // range is inclusive
+    this->ModifyGradientByScalesOverSubRange(block);
+    this->ModifyGradientByLearningRateOverSubRange(block);
+  }
+}
+
+//-------------------------------------------------------------------
+template <typename TInternalComputationValueType>
+bool
+GradientDescentOptimizerBasev4Template<TInternalComputationValueType>::GetModifyGradientIsThreaded() const
+{
+  // Below this size, a pass over the gradient is faster than starting the threads
+  constexpr SizeValueType minimumSizeForThreading = 1 << 16;
+
+  // Only the gradient modification of the classes which can fuse it is known
+  // to be cheap and thread safe for global transforms, e.g. subclasses may
+  // allocate per call buffers of the size of the scales.
+  return this->m_Metric->HasLocalSupport() ||
+         (this->CanFuseGradientModification() && this->m_Gradient.GetSize() >= minimumSizeForThreading);
+}
+
+//-------------------------------------------------------------------
+template <typename TInternalComputationValueType>
+bool
+GradientDescentOptimizerBasev4Template<TInternalComputationValueType>::CanFuseGradientModification() const
+{
+  return false;
+}
+
 } // namespace itk
 
 #endif
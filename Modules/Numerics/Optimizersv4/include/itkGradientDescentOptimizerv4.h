@@ -215,6 +215,20 @@ protected:
   void
   ModifyGradientByLearningRateOverSubRange(const IndexRangeType & subrange) override;
 
+  /** Whether EstimateLearningRate() estimates the learning rate at the
+   * current iteration. */
+  bool
+  GetLearningRateIsEstimatedAtCurrentIteration() const;
+
+  /** Return true, since the single pass is equivalent to the gradient
+   * modification methods of this class. Subclasses which override
+   * ModifyGradientByScalesOverSubRange(),
+   * ModifyGradientByLearningRateOverSubRange() or the methods running their
+   * threaders must override this method to return false, so that these
+   * overrides keep being called. */
+  bool
+  CanFuseGradientModification() const override;
+
   /** Default constructor */
   GradientDescentOptimizerv4Template();
 
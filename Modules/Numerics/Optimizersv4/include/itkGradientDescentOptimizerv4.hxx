@@ -165,10 +165,20 @@ GradientDescentOptimizerv4Template<TInternalComputationValueType>::AdvanceOneSte
   // Scale by gradient scales, then estimate the learning
   // rate if options are set to (using the scaled gradient),
   // then modify by learning rate. The m_Gradient variable
-  // is modified in-place.
-  this->ModifyGradientByScales();
-  this->EstimateLearningRate();
-  this->ModifyGradientByLearningRate();
+  // is modified in-place. When the learning rate is not
+  // estimated, and the gradient modification is not customized
+  // by a subclass, the scales and the learning rate are applied
+  // in a single pass.
+  if (this->GetLearningRateIsEstimatedAtCurrentIteration() || !this->CanFuseGradientModification())
+  {
+    this->ModifyGradientByScales();
+    this->EstimateLearningRate();
+    this->ModifyGradientByLearningRate();
+  }
+  else
+  {
+    this->ModifyGradientByScalesAndLearningRate();
+  }
 
   try
   {
@@ -196,33 +206,48 @@ GradientDescentOptimizerv4Template<TInternalComputationValueType>::ModifyGradien
   const ScalesType & scales = this->GetScales();
   const ScalesType & weights = this->GetWeights();
 
-  ScalesType factor(scales.Size());
-
-  if (this->GetWeightsAreIdentity())
+  // scales is checked during StartOptmization for values <=
+  // machine epsilon.
+  // The gradient of transforms with local support stores the gradient of
+  // the local parameters at each local index with linear packing, so that
+  // the scale of the j-th value is that of index j modulo the number of
+  // scales. The factors are computed on the fly to avoid allocating an
+  // array of the size of the scales, which is that of the gradient for
+  // global transforms.
+  const SizeValueType numberOfScales = scales.Size();
+  const bool          weightsAreIdentity = this->GetWeightsAreIdentity();
+  const auto          one = NumericTraits<typename ScalesType::ValueType>::OneValue();
+
+  if (numberOfScales == this->m_Gradient.Size())
   {
-    for (SizeValueType i = 0; i < factor.Size(); ++i)
+    // Loop over the range. It is inclusive.
+    if (weightsAreIdentity)
     {
-      factor[i] = NumericTraits<typename ScalesType::ValueType>::OneValue() / scales[i];
+      for (IndexValueType j = subrange[0]; j <= subrange[1]; ++j)
+      {
+        this->m_Gradient[j] = this->m_Gradient[j] * (one / scales[j]);
+      }
     }
-  }
-  else
-  {
-    for (SizeValueType i = 0; i < factor.Size(); ++i)
+    else
     {
-      factor[i] = weights[i] / scales[i];
+      for (IndexValueType j = subrange[0]; j <= subrange[1]; ++j)
+      {
+        this->m_Gradient[j] = this->m_Gradient[j] * (weights[j] / scales[j]);
+      }
     }
+    return;
   }
 
-  // Loop over the range. It is inclusive.
+  SizeValueType index = subrange[0] % numberOfScales;
   for (IndexValueType j = subrange[0]; j <= subrange[1]; ++j)
   {
-    // scales is checked during StartOptmization for values <=
-    // machine epsilon.
-    // Take the modulo of the index to handle gradients from transforms
-    // with local support. The gradient array stores the gradient of local
-    // parameters at each local index with linear packing.
-    IndexValueType index = j % scales.Size();
-    this->m_Gradient[j] = this->m_Gradient[j] * factor[index];
+    const typename ScalesType::ValueType factor =
+      weightsAreIdentity ? one / scales[index] : weights[index] / scales[index];
+    this->m_Gradient[j] = this->m_Gradient[j] * factor;
+    if (++index == numberOfScales)
+    {
+      index = 0;
+    }
   }
 }
 
@@ -242,12 +267,7 @@ template <typename TInternalComputationValueType>
 void
 GradientDescentOptimizerv4Template<TInternalComputationValueType>::EstimateLearningRate()
 {
-  if (this->m_ScalesEstimator.IsNull())
-  {
-    return;
-  }
-  if (this->m_DoEstimateLearningRateAtEachIteration ||
-      (this->m_DoEstimateLearningRateOnce && this->m_CurrentIteration == 0))
+  if (this->GetLearningRateIsEstimatedAtCurrentIteration())
   {
     TInternalComputationValueType stepScale = this->m_ScalesEstimator->EstimateStepScale(this->m_Gradient);
 
@@ -262,6 +282,22 @@ GradientDescentOptimizerv4Template<TInternalComputationValueType>::EstimateLearn
   }
 }
 
+template <typename TInternalComputationValueType>
+bool
+GradientDescentOptimizerv4Template<TInternalComputationValueType>::GetLearningRateIsEstimatedAtCurrentIteration() const
+{
+  return this->m_ScalesEstimator.IsNotNull() &&
+         (this->m_DoEstimateLearningRateAtEachIteration ||
+          (this->m_DoEstimateLearningRateOnce && this->m_CurrentIteration == 0));
+}
+
+template <typename TInternalComputationValueType>
+bool
+GradientDescentOptimizerv4Template<TInternalComputationValueType>::CanFuseGradientModification() const
+{
+  return true;
+}
+
 template <typename TInternalComputationValueType>
 void
 GradientDescentOptimizerv4Template<TInternalComputationValueType>::PrintSelf(std::ostream & os, Indent indent) const
@@ -0,0 +1,209 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkLimitedMemoryBFGSOptimizerv4_h
+#define itkLimitedMemoryBFGSOptimizerv4_h
+
+#include "itkGradientDescentOptimizerv4.h"
+#include "itkMultiThreaderBase.h"
+
+#include <vector>
+
+namespace itk
+{
+/**
+ *\class LimitedMemoryBFGSOptimizerv4Template
+ * \brief Native limited memory BFGS optimizer for large parameter vectors.
+ *
+ * The search direction is computed with the two-loop recursion of L-BFGS
+ * from the last NumberOfCorrections position and derivative changes, and
+ * the step along it is chosen by a backtracking line search enforcing
+ * sufficient decrease of the metric (Armijo condition). Corrections with
+ * a non positive curvature are discarded.
+ *
+ * Unlike LBFGSOptimizerv4, LBFGSBOptimizerv4 and LBFGS2Optimizerv4, which
+ * wrap vnl, netlib and libLBFGS code, the optimizer works directly on the
+ * parameters of the metric and on the derivative it computes: no copy to
+ * and from vnl vectors is made at each evaluation, and the vector
+ * operations of the recursion run in parallel over blocks of the
+ * parameters. The reductions are always summed in block order, so the
+ * optimization does not depend on the number of work units. This makes
+ * quasi-Newton optimization practical for dense transforms.
+ *
+ * The parameter scales precondition the recursion: the initial inverse
+ * Hessian approximation is the diagonal of the inverse scales, scaled by
+ * the usual estimate of the curvature along the last correction. When
+ * there is no correction, at the first iteration or after a failed line
+ * search, the direction is the scaled derivative and the first trial step
+ * is the learning rate, estimated at the first iteration when a scales
+ * estimator is set. Otherwise the first trial step is one.
+ *
+ * The optimization stops when the magnitude of the derivative falls below
+ * GradientConvergenceTolerance * max(1, ||parameters||), when the line
+ * search fails along the scaled derivative, or on the stop conditions of
+ * GradientDescentOptimizerv4Template.
+ *
+ * \sa QuasiNewtonOptimizerv4Template, LBFGS2Optimizerv4Template
+ *
+ * \ingroup ITKOptimizersv4
+ */
+template <typename TInternalComputationValueType>
+class ITK_TEMPLATE_EXPORT LimitedMemoryBFGSOptimizerv4Template
+  : public GradientDescentOptimizerv4Template<TInternalComputationValueType>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(LimitedMemoryBFGSOptimizerv4Template);
+
+  /** Standard class type aliases. */
+  using Self = LimitedMemoryBFGSOptimizerv4Template;
+  using Superclass = GradientDescentOptimizerv4Template<TInternalComputationValueType>;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+  itkTypeMacro(LimitedMemoryBFGSOptimizerv4Template, Superclass);
+
+  /** It should be possible to derive the internal computation type from the class object. */
+  using InternalComputationValueType = TInternalComputationValueType;
+
+  using typename Superclass::ParametersType;
+  using typename Superclass::MeasureType;
+  using typename Superclass::DerivativeType;
+
+  /** Start and run the optimization */
+  void
+  StartOptimization(bool doOnlyInitialization = false) override;
+
+  /** Set/Get the number of corrections approximating the inverse Hessian. */
+  itkSetClampMacro(NumberOfCorrections, SizeValueType, 1, NumericTraits<SizeValueType>::max());
+  itkGetConstMacro(NumberOfCorrections, SizeValueType);
+
+  /** Set/Get the gradient convergence tolerance. The optimization stops
+   * when ||derivative|| < tolerance * max(1, ||parameters||). */
+  itkSetMacro(GradientConvergenceTolerance, TInternalComputationValueType);
+  itkGetConstMacro(GradientConvergenceTolerance, TInternalComputationValueType);
+
+  /** Set/Get the maximum number of metric evaluations of a line search. */
+  itkSetClampMacro(MaximumLineSearchIterations, unsigned int, 1, NumericTraits<unsigned int>::max());
+  itkGetConstMacro(MaximumLineSearchIterations, unsigned int);
+
+  /** Get the number of metric evaluations of the last line search. */
+  itkGetConstMacro(LineSearchIterations, unsigned int);
+
+  /** Get the step accepted by the last line search, relative to the search direction. */
+  itkGetConstMacro(CurrentStepLength, TInternalComputationValueType);
+
+  /** Get the magnitude of the derivative at the current iteration. */
+  itkGetConstMacro(CurrentGradientNorm, TInternalComputationValueType);
+
+  /** Get the number of corrections currently approximating the inverse Hessian. */
+  itkGetConstMacro(NumberOfStoredCorrections, SizeValueType);
+
+  /** Get the most recent search direction. */
+  itkGetConstReferenceMacro(SearchDirection, DerivativeType);
+
+protected:
+  /** Compute the search direction, search the step along it and update the
+   * corrections. */
+  void
+  AdvanceOneStep() override;
+
+  /** Compute the L-BFGS direction from the derivative and the corrections. */
+  virtual void
+  ComputeSearchDirection();
+
+  /** Search a step with sufficient decrease along the search direction,
+   * starting from the given step. The metric is left at the accepted
+   * position. Return false if the line search fails, the metric is then
+   * left at the current position. */
+  virtual bool
+  LineSearch(TInternalComputationValueType initialStepLength, TInternalComputationValueType directionalDerivative);
+
+  LimitedMemoryBFGSOptimizerv4Template();
+  ~LimitedMemoryBFGSOptimizerv4Template() override = default;
+
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+  SizeValueType                 m_NumberOfCorrections{ 5 };
+  TInternalComputationValueType m_GradientConvergenceTolerance;
+  unsigned int                  m_MaximumLineSearchIterations{ 20 };
+  unsigned int                  m_LineSearchIterations{ 0 };
+  TInternalComputationValueType m_CurrentStepLength;
+  TInternalComputationValueType m_CurrentGradientNorm;
+
+  /** The search direction and the position it starts from */
+  DerivativeType m_SearchDirection;
+  ParametersType m_PreviousPosition;
+
+private:
+  /** Number of parameters of the blocks the vector operations are split in. */
+  static constexpr SizeValueType ParameterBlockSize = 4096;
+
+  /** Call function(firstIndex, lastIndexPlus1) on the blocks of the
+   * parameters and return the sum of the values it returns, in block order.
+   * The blocks are processed in parallel for large parameter vectors. */
+  template <typename TBlockFunction>
+  TInternalComputationValueType
+  ReduceOverParameterBlocks(const TBlockFunction & function);
+
+  /** Dot product of two vectors of the size of the parameters. The scaled
+   * version divides each term by the scale of its parameter. */
+  TInternalComputationValueType
+  Dot(const TInternalComputationValueType * a, const TInternalComputationValueType * b);
+  TInternalComputationValueType
+  ScaledDot(const TInternalComputationValueType * a, const TInternalComputationValueType * b);
+
+  /** Discard all the corrections. */
+  void
+  ClearCorrections();
+
+  /** Complete the pending correction with the derivative change, and keep
+   * it if its curvature is positive. */
+  void
+  UpdateCorrections();
+
+  /** Corrections in a circular buffer: the position and derivative
+   * changes, and the inverse of their dot product. */
+  std::vector<DerivativeType>                m_PositionChanges;
+  std::vector<DerivativeType>                m_DerivativeChanges;
+  std::vector<TInternalComputationValueType> m_CorrectionRhos;
+  std::vector<TInternalComputationValueType> m_CorrectionAlphas;
+  SizeValueType                              m_NumberOfStoredCorrections{ 0 };
+  SizeValueType                              m_NextCorrection{ 0 };
+  bool                                       m_CorrectionIsPending{ false };
+
+  /** Scale of the initial inverse Hessian approximation */
+  TInternalComputationValueType m_InitialHessianScale;
+
+  std::vector<TInternalComputationValueType> m_BlockSums;
+  MultiThreaderBase::Pointer                 m_MultiThreader;
+};
+
+/** This helps to meet backward compatibility */
+using LimitedMemoryBFGSOptimizerv4 = LimitedMemoryBFGSOptimizerv4Template<double>;
+
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkLimitedMemoryBFGSOptimizerv4.hxx"
+#endif
+
+#endif
@@ -0,0 +1,493 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkLimitedMemoryBFGSOptimizerv4_hxx
+#define itkLimitedMemoryBFGSOptimizerv4_hxx
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace itk
+{
+
+template <typename TInternalComputationValueType>
+LimitedMemoryBFGSOptimizerv4Template<TInternalComputationValueType>::LimitedMemoryBFGSOptimizerv4Template()
+  : m_GradientConvergenceTolerance(static_cast<TInternalComputationValueType>(1e-5))
+  , m_CurrentStepLength(NumericTraits<TInternalComputationValueType>::ZeroValue())
+  , m_CurrentGradientNorm(NumericTraits<TInternalComputationValueType>::ZeroValue())
+  , m_InitialHessianScale(NumericTraits<TInternalComputationValueType>::OneValue())
+{
+  this->m_MultiThreader = MultiThreaderBase::New();
+}
+
+template <typename TInternalComputationValueType>
+void
+LimitedMemoryBFGSOptimizerv4Template<TInternalComputationValueType>::StartOptimization(bool doOnlyInitialization)
+{
+  itkDebugMacro("StartOptimization");
+
+  // Allocate the corrections once for the whole optimization. A missing
+  // metric is reported by the superclass.
+  if (this->m_Metric.IsNotNull())
+  {
+    const SizeValueType numberOfParameters = this->m_Metric->GetNumberOfParameters();
+
+    this->m_PositionChanges.resize(this->m_NumberOfCorrections);
+    this->m_DerivativeChanges.resize(this->m_NumberOfCorrections);
+    for (SizeValueType c = 0; c < this->m_NumberOfCorrections; ++c)
+    {
+      this->m_PositionChanges[c].SetSize(numberOfParameters);
+      this->m_DerivativeChanges[c].SetSize(numberOfParameters);
+    }
+    this->m_CorrectionRhos.assign(this->m_NumberOfCorrections,
+                                  NumericTraits<TInternalComputationValueType>::ZeroValue());
+    this->m_CorrectionAlphas.assign(this->m_NumberOfCorrections,
+                                    NumericTraits<TInternalComputationValueType>::ZeroValue());
+    this->m_SearchDirection.SetSize(numberOfParameters);
+  }
+  this->ClearCorrections();
+
+  // Must call the superclass version for basic validation, setup,
+  // and to start the optimization loop.
+  Superclass::StartOptimization(doOnlyInitialization);
+}
+
+template <typename TInternalComputationValueType>
+void
+LimitedMemoryBFGSOptimizerv4Template<TInternalComputationValueType>::AdvanceOneStep()
+{
+  itkDebugMacro("AdvanceOneStep");
+
+  // The derivative of the metric is the descent direction of its value:
+  // the gradient of the value is -m_Gradient.
+  if (this->m_CorrectionIsPending)
+  {
+    this->UpdateCorrections();
+  }
+
+  const TInternalComputationValueType * derivative = this->m_Gradient.data_block();
+  const TInternalComputationValueType * position = this->GetCurrentPosition().data_block();
+
+  this->m_CurrentGradientNorm = std::sqrt(this->Dot(derivative, derivative));
+  const TInternalComputationValueType positionNorm = std::sqrt(this->Dot(position, position));
+  if (this->m_CurrentGradientNorm <=
+      this->m_GradientConvergenceTolerance *
+        std::max(NumericTraits<TInternalComputationValueType>::OneValue(), positionNorm))
+  {
+    this->m_StopCondition = StopConditionObjectToObjectOptimizerEnum::GRADIENT_MAGNITUDE_TOLEARANCE;
+    this->m_StopConditionDescription << "Gradient magnitude tolerance met after " << this->m_CurrentIteration
+                                     << " iterations.";
+    this->StopOptimization();
+    return;
+  }
+
+  this->m_PreviousPosition = this->GetCurrentPosition();
+
+  // Search along the L-BFGS direction, then along the scaled derivative if
+  // the corrections do not lead to a decrease of the metric.
+  bool stepFound = false;
+  while (!stepFound)
+  {
+    this->ComputeSearchDirection();
+
+    TInternalComputationValueType initialStepLength = NumericTraits<TInternalComputationValueType>::OneValue();
+    if (this->m_NumberOfStoredCorrections == 0)
+    {
+      if (this->GetLearningRateIsEstimatedAtCurrentIteration())
+      {
+        // The learning rate is estimated from the scaled derivative
+        swap(this->m_Gradient, this->m_SearchDirection);
+        this->EstimateLearningRate();
+        swap(this->m_Gradient, this->m_SearchDirection);
+      }
+      initialStepLength = this->m_LearningRate;
+    }
+
+    const TInternalComputationValueType directionalDerivative =
+      this->Dot(this->m_Gradient.data_block(), this->m_SearchDirection.data_block());
+    stepFound = directionalDerivative > NumericTraits<TInternalComputationValueType>::ZeroValue() &&
+                this->LineSearch(initialStepLength, directionalDerivative);
+
+    if (!stepFound)
+    {
+      if (this->m_NumberOfStoredCorrections == 0)
+      {
+        break;
+      }
+      this->ClearCorrections();
+    }
+  }
+
+  if (!stepFound)
+  {
+    this->m_StopCondition = StopConditionObjectToObjectOptimizerEnum::STEP_TOO_SMALL;
+    this->m_StopConditionDescription << "Line search failed to decrease the metric at iteration "
+                                     << this->m_CurrentIteration << ".";
+    this->StopOptimization();
+    return;
+  }
+
+  // Position change of the new correction, its derivative change is known
+  // once the derivative is computed at the new position.
+  TInternalComputationValueType *       positionChange = this->m_PositionChanges[this->m_NextCorrection].data_block();
+  const TInternalComputationValueType * newPosition = this->GetCurrentPosition().data_block();
+  const TInternalComputationValueType * previousPosition = this->m_PreviousPosition.data_block();
+  this->ReduceOverParameterBlocks([=](SizeValueType first, SizeValueType last) {
+    for (SizeValueType i = first; i < last; ++i)
+    {
+      positionChange[i] = newPosition[i] - previousPosition[i];
+    }
+    return NumericTraits<TInternalComputationValueType>::ZeroValue();
+  });
+  this->m_CorrectionIsPending = true;
+
+  this->InvokeEvent(IterationEvent());
+}
+
+template <typename TInternalComputationValueType>
+void
+LimitedMemoryBFGSOptimizerv4Template<TInternalComputationValueType>::ComputeSearchDirection()
+{
+  using ValueType = TInternalComputationValueType;
+
+  const SizeValueType numberOfCorrections = this->m_PositionChanges.size();
+  const SizeValueType numberOfStoredCorrections = this->m_NumberOfStoredCorrections;
+
+  // Index of the k-th newest correction
+  const auto correction = [this, numberOfCorrections](SizeValueType k) {
+    return (this->m_NextCorrection + numberOfCorrections - 1 - k) % numberOfCorrections;
+  };
+
+  const ValueType * derivative = this->m_Gradient.data_block();
+  ValueType *       direction = this->m_SearchDirection.data_block();
+
+  // Each pass over the parameters updates the direction and computes the dot
+  // product of the next step of the recursion.
+  const ValueType * nextPositionChange =
+    numberOfStoredCorrections > 0 ? this->m_PositionChanges[correction(0)].data_block() : nullptr;
+  ValueType dotProduct = this->ReduceOverParameterBlocks([=](SizeValueType first, SizeValueType last) {
+    ValueType sum = NumericTraits<ValueType>::ZeroValue();
+    std::copy(derivative + first, derivative + last, direction + first);
+    if (nextPositionChange)
+    {
+      for (SizeValueType i = first; i < last; ++i)
+      {
+        sum += nextPositionChange[i] * direction[i];
+      }
+    }
+    return sum;
+  });
+
+  // First loop, from the newest correction to the oldest
+  for (SizeValueType k = 0; k < numberOfStoredCorrections; ++k)
+  {
+    const SizeValueType c = correction(k);
+    const ValueType     alpha = this->m_CorrectionRhos[c] * dotProduct;
+    this->m_CorrectionAlphas[c] = alpha;
+
+    const ValueType * derivativeChange = this->m_DerivativeChanges[c].data_block();
+    nextPositionChange =
+      k + 1 < numberOfStoredCorrections ? this->m_PositionChanges[correction(k + 1)].data_block() : nullptr;
+    dotProduct = this->ReduceOverParameterBlocks([=](SizeValueType first, SizeValueType last) {
+      ValueType sum = NumericTraits<ValueType>::ZeroValue();
+      for (SizeValueType i = first; i < last; ++i)
+      {
+        direction[i] -= alpha * derivativeChange[i];
+      }
+      if (nextPositionChange)
+      {
+        for (SizeValueType i = first; i < last; ++i)
+        {
+          sum += nextPositionChange[i] * direction[i];
+        }
+      }
+      return sum;
+    });
+  }
+
+  // Initial inverse Hessian approximation: the inverse scales, scaled by the
+  // curvature along the newest correction.
+  const ValueType   hessianScale = numberOfStoredCorrections > 0 ? this->m_InitialHessianScale : ValueType{ 1 };
+  const ValueType * nextDerivativeChange =
+    numberOfStoredCorrections > 0
+      ? this->m_DerivativeChanges[correction(numberOfStoredCorrections - 1)].data_block()
+      : nullptr;
+  const bool          scalesAreIdentity = this->GetScalesAreIdentity();
+  const ValueType *   scales = this->GetScales().data_block();
+  const SizeValueType numberOfScales = this->GetScales().Size();
+  dotProduct = this->ReduceOverParameterBlocks([=](SizeValueType first, SizeValueType last) {
+    ValueType sum = NumericTraits<ValueType>::ZeroValue();
+    if (scalesAreIdentity)
+    {
+      for (SizeValueType i = first; i < last; ++i)
+      {
+        direction[i] *= hessianScale;
+      }
+    }
+    else
+    {
+      SizeValueType s = first % numberOfScales;
+      for (SizeValueType i = first; i < last; ++i)
+      {
+        direction[i] *= hessianScale / scales[s];
+        if (++s == numberOfScales)
+        {
+          s = 0;
+        }
+      }
+    }
+    if (nextDerivativeChange)
+    {
+      for (SizeValueType i = first; i < last; ++i)
+      {
+        sum += nextDerivativeChange[i] * direction[i];
+      }
+    }
+    return sum;
+  });
+
+  // Second loop, from the oldest correction to the newest
+  for (SizeValueType k = numberOfStoredCorrections; k-- > 0;)
+  {
+    const SizeValueType c = correction(k);
+    const ValueType     factor = this->m_CorrectionAlphas[c] - this->m_CorrectionRhos[c] * dotProduct;
+
+    const ValueType * positionChange = this->m_PositionChanges[c].data_block();
+    nextDerivativeChange = k > 0 ? this->m_DerivativeChanges[correction(k - 1)].data_block() : nullptr;
+    dotProduct = this->ReduceOverParameterBlocks([=](SizeValueType first, SizeValueType last) {
+      ValueType sum = NumericTraits<ValueType>::ZeroValue();
+      for (SizeValueType i = first; i < last; ++i)
+      {
+        direction[i] += factor * positionChange[i];
+      }
+      if (nextDerivativeChange)
+      {
+        for (SizeValueType i = first; i < last; ++i)
+        {
+          sum += nextDerivativeChange[i] * direction[i];
+        }
+      }
+      return sum;
+    });
+  }
+}
+
+template <typename TInternalComputationValueType>
+bool
+LimitedMemoryBFGSOptimizerv4Template<TInternalComputationValueType>::LineSearch(
+  TInternalComputationValueType initialStepLength,
+  TInternalComputationValueType directionalDerivative)
+{
+  using ValueType = TInternalComputationValueType;
+
+  // Fraction of the decrease predicted by the directional derivative that a
+  // step must achieve.
+  const ValueType sufficientDecrease = static_cast<ValueType>(1e-4);
+
+  const MeasureType initialValue = this->m_CurrentMetricValue;
+  ValueType         stepLength = initialStepLength;
+  for (this->m_LineSearchIterations = 1;; ++this->m_LineSearchIterations)
+  {
+    try
+    {
+      this->m_Metric->UpdateTransformParameters(this->m_SearchDirection, stepLength);
+    }
+    catch (ExceptionObject & err)
+    {
+      this->m_StopCondition = StopConditionObjectToObjectOptimizerEnum::UPDATE_PARAMETERS_ERROR;
+      this->m_StopConditionDescription << "UpdateTransformParameters error";
+      this->StopOptimization();
+
+      // Pass exception to caller
+      throw err;
+    }
+
+    const MeasureType value = this->m_Metric->GetValue();
+    if (value <= initialValue - sufficientDecrease * stepLength * directionalDerivative)
+    {
+      this->m_CurrentStepLength = stepLength;
+      return true;
+    }
+
+    this->m_Metric->SetParameters(this->m_PreviousPosition);
+    if (this->m_LineSearchIterations >= this->m_MaximumLineSearchIterations)
+    {
+      return false;
+    }
+
+    // Minimum of the quadratic interpolating the metric along the direction,
+    // kept within [0.1, 0.5] of the rejected step. A NaN value halves it.
+    const ValueType curvature = value - initialValue + stepLength * directionalDerivative;
+    ValueType       nextStepLength = static_cast<ValueType>(0.5) * stepLength;
+    if (curvature > NumericTraits<ValueType>::ZeroValue())
+    {
+      nextStepLength = std::min(nextStepLength,
+                                std::max(static_cast<ValueType>(0.1) * stepLength,
+                                         directionalDerivative * stepLength * stepLength / (2 * curvature)));
+    }
+    stepLength = nextStepLength;
+  }
+}
+
+template <typename TInternalComputationValueType>
+void
+LimitedMemoryBFGSOptimizerv4Template<TInternalComputationValueType>::ClearCorrections()
+{
+  this->m_NumberOfStoredCorrections = 0;
+  this->m_NextCorrection = 0;
+  this->m_CorrectionIsPending = false;
+  this->m_InitialHessianScale = NumericTraits<TInternalComputationValueType>::OneValue();
+}
+
+template <typename TInternalComputationValueType>
+void
+LimitedMemoryBFGSOptimizerv4Template<TInternalComputationValueType>::UpdateCorrections()
+{
+  using ValueType = TInternalComputationValueType;
+
+  this->m_CorrectionIsPending = false;
+
+  // Change of the gradient of the metric value, the opposite of the change
+  // of its derivative.
+  const SizeValueType c = this->m_NextCorrection;
+  const ValueType *   positionChange = this->m_PositionChanges[c].data_block();
+  ValueType *         derivativeChange = this->m_DerivativeChanges[c].data_block();
+  const ValueType *   previousDerivative = this->m_PreviousGradient.data_block();
+  const ValueType *   derivative = this->m_Gradient.data_block();
+  const ValueType     curvature = this->ReduceOverParameterBlocks([=](SizeValueType first, SizeValueType last) {
+    ValueType sum = NumericTraits<ValueType>::ZeroValue();
+    for (SizeValueType i = first; i < last; ++i)
+    {
+      derivativeChange[i] = previousDerivative[i] - derivative[i];
+      sum += positionChange[i] * derivativeChange[i];
+    }
+    return sum;
+  });
+  const ValueType derivativeChangeNorm = this->ScaledDot(derivativeChange, derivativeChange);
+
+  // Keep the correction only if it preserves the positive definiteness of
+  // the inverse Hessian approximation.
+  if (curvature > NumericTraits<ValueType>::epsilon() * derivativeChangeNorm &&
+      derivativeChangeNorm > NumericTraits<ValueType>::ZeroValue())
+  {
+    this->m_CorrectionRhos[c] = NumericTraits<ValueType>::OneValue() / curvature;
+    this->m_InitialHessianScale = curvature / derivativeChangeNorm;
+    this->m_NextCorrection = (c + 1) % this->m_PositionChanges.size();
+    this->m_NumberOfStoredCorrections =
+      std::min(this->m_NumberOfStoredCorrections + 1, static_cast<SizeValueType>(this->m_PositionChanges.size()));
+  }
+}
+
+template <typename TInternalComputationValueType>
+template <typename TBlockFunction>
+TInternalComputationValueType
+LimitedMemoryBFGSOptimizerv4Template<TInternalComputationValueType>::ReduceOverParameterBlocks(
+  const TBlockFunction & function)
+{
+  const SizeValueType numberOfParameters = this->m_SearchDirection.Size();
+  const SizeValueType numberOfBlocks = (numberOfParameters + ParameterBlockSize - 1) / ParameterBlockSize;
+
+  this->m_BlockSums.resize(numberOfBlocks);
+  TInternalComputationValueType * blockSums = this->m_BlockSums.data();
+  const auto                      processBlock = [&function, blockSums, numberOfParameters](SizeValueType block) {
+    const SizeValueType first = block * ParameterBlockSize;
+    blockSums[block] = function(first, std::min(first + ParameterBlockSize, numberOfParameters));
+  };
+
+  // Small vectors are not worth the synchronization of the work units
+  const ThreadIdType numberOfWorkUnits = this->GetNumberOfWorkUnits();
+  if (numberOfWorkUnits > 1 && numberOfBlocks >= 16)
+  {
+    this->m_MultiThreader->SetNumberOfWorkUnits(
+      static_cast<ThreadIdType>(std::min<SizeValueType>(numberOfWorkUnits, numberOfBlocks)));
+    this->m_MultiThreader->ParallelizeArray(0, numberOfBlocks, processBlock, nullptr);
+  }
+  else
+  {
+    for (SizeValueType block = 0; block < numberOfBlocks; ++block)
+    {
+      processBlock(block);
+    }
+  }
+
+  // Summed in block order, whatever the number of work units
+  return std::accumulate(
+    this->m_BlockSums.begin(), this->m_BlockSums.end(), NumericTraits<TInternalComputationValueType>::ZeroValue());
+}
+
+template <typename TInternalComputationValueType>
+TInternalComputationValueType
+LimitedMemoryBFGSOptimizerv4Template<TInternalComputationValueType>::Dot(const TInternalComputationValueType * a,
+                                                                         const TInternalComputationValueType * b)
+{
+  return this->ReduceOverParameterBlocks([a, b](SizeValueType first, SizeValueType last) {
+    auto sum = NumericTraits<TInternalComputationValueType>::ZeroValue();
+    for (SizeValueType i = first; i < last; ++i)
+    {
+      sum += a[i] * b[i];
+    }
+    return sum;
+  });
+}
+
+template <typename TInternalComputationValueType>
+TInternalComputationValueType
+LimitedMemoryBFGSOptimizerv4Template<TInternalComputationValueType>::ScaledDot(
+  const TInternalComputationValueType * a,
+  const TInternalComputationValueType * b)
+{
+  if (this->GetScalesAreIdentity())
+  {
+    return this->Dot(a, b);
+  }
+
+  const TInternalComputationValueType * scales = this->GetScales().data_block();
+  const SizeValueType                   numberOfScales = this->GetScales().Size();
+  return this->ReduceOverParameterBlocks([a, b, scales, numberOfScales](SizeValueType first, SizeValueType last) {
+    auto          sum = NumericTraits<TInternalComputationValueType>::ZeroValue();
+    SizeValueType s = first % numberOfScales;
+    for (SizeValueType i = first; i < last; ++i)
+    {
+      sum += a[i] * b[i] / scales[s];
+      if (++s == numberOfScales)
+      {
+        s = 0;
+      }
+    }
+    return sum;
+  });
+}
+
+template <typename TInternalComputationValueType>
+void
+LimitedMemoryBFGSOptimizerv4Template<TInternalComputationValueType>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "NumberOfCorrections: " << this->m_NumberOfCorrections << std::endl;
+  os << indent << "GradientConvergenceTolerance: " << this->m_GradientConvergenceTolerance << std::endl;
+  os << indent << "MaximumLineSearchIterations: " << this->m_MaximumLineSearchIterations << std::endl;
+  os << indent << "LineSearchIterations: " << this->m_LineSearchIterations << std::endl;
+  os << indent << "CurrentStepLength: " << this->m_CurrentStepLength << std::endl;
+  os << indent << "CurrentGradientNorm: " << this->m_CurrentGradientNorm << std::endl;
+  os << indent << "NumberOfStoredCorrections: " << this->m_NumberOfStoredCorrections << std::endl;
+}
+
+} // end namespace itk
+
+#endif
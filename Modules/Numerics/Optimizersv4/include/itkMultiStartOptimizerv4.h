@@ -21,6 +21,9 @@
 #include "itkObjectToObjectOptimizerBase.h"
 #include "itkGradientDescentOptimizerv4.h"
 
+#include <exception>
+#include <vector>
+
 namespace itk
 {
 
@@ -36,6 +39,16 @@ namespace itk
  *   focus modifying the parameter sample space.  This is why we place the burden on the user to provide
  *   the parameter samples over which to optimize.
  *
+ *   The searches from the start points are independent, so they can run concurrently by setting a list
+ *   of worker metrics with SetWorkerMetrics() and, when a local optimizer is used, one local optimizer
+ *   per worker metric with SetWorkerLocalOptimizers().  Each worker metric must compute the same values
+ *   as the metric of the optimizer while owning its own state, typically a metric configured like the
+ *   optimizer's one with its own copy of the moving transform, and each worker local optimizer must be
+ *   configured like the local optimizer.  The results are then reduced in the order of the start points,
+ *   so the metric values, the best parameters and the IterationEvents are those of the serial search.
+ *   Each worker runs on a thread of its own rather than on the thread pool, so the worker metrics and
+ *   local optimizers may themselves be multi-threaded.
+ *
  * \ingroup ITKOptimizersv4
  */
 template <typename TInternalComputationValueType>
@@ -105,6 +118,10 @@ public:
   using typename Superclass::MeasureType;
   using MetricValuesListType = std::vector<MeasureType>;
 
+  /** Lists of the metrics and local optimizers of the parallel search */
+  using MetricsListType = std::vector<MetricTypePointer>;
+  using OptimizersListType = std::vector<OptimizerPointer>;
+
   /** Get stop condition enum */
   itkGetConstReferenceMacro(StopCondition, StopConditionObjectToObjectOptimizerEnum);
 
@@ -156,6 +173,28 @@ public:
     return this->m_BestParametersIndex;
   }
 
+  /** Set/Get the metrics searching from the start points in parallel, one
+   * worker per metric. The metrics must not be shared with the optimizer or
+   * between workers. An empty list, the default, searches serially with the
+   * metric of the optimizer. */
+  void
+  SetWorkerMetrics(const MetricsListType & metrics);
+  const MetricsListType &
+  GetWorkerMetrics() const
+  {
+    return this->m_WorkerMetrics;
+  }
+
+  /** Set/Get the local optimizers of the parallel search, one per worker
+   * metric. They are required when a local optimizer is set. */
+  void
+  SetWorkerLocalOptimizers(const OptimizersListType & optimizers);
+  const OptimizersListType &
+  GetWorkerLocalOptimizers() const
+  {
+    return this->m_WorkerLocalOptimizers;
+  }
+
 protected:
   /** Default constructor */
   MultiStartOptimizerv4Template();
@@ -174,6 +213,22 @@ protected:
   MeasureType                              m_MaximumMetricValue;
   ParameterListSizeType                    m_BestParametersIndex;
   OptimizerPointer                         m_LocalOptimizer;
+
+private:
+  /** Outcome of the search from a start point by a worker */
+  struct WorkerResultType
+  {
+    ParametersType     m_Parameters;
+    MeasureType        m_Value{};
+    std::exception_ptr m_Exception;
+  };
+
+  /** Search from the remaining start points with the worker metrics. */
+  void
+  SearchRemainingStartsInParallel(std::vector<WorkerResultType> & results);
+
+  MetricsListType    m_WorkerMetrics;
+  OptimizersListType m_WorkerLocalOptimizers;
 };
 
 /** This helps to meet backward compatibility */
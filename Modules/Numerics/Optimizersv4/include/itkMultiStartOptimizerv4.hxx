@@ -18,6 +18,10 @@
 #ifndef itkMultiStartOptimizerv4_hxx
 #define itkMultiStartOptimizerv4_hxx
 
+#include "itkPlatformMultiThreader.h"
+
+#include <algorithm>
+#include <atomic>
 
 namespace itk
 {
@@ -45,6 +49,8 @@ MultiStartOptimizerv4Template<TInternalComputationValueType>::PrintSelf(std::ost
   Superclass::PrintSelf(os, indent);
   os << indent << "Stop condition:" << this->m_StopCondition << std::endl;
   os << indent << "Stop condition description: " << this->m_StopConditionDescription.str() << std::endl;
+  os << indent << "Number of worker metrics: " << this->m_WorkerMetrics.size() << std::endl;
+  os << indent << "Number of worker local optimizers: " << this->m_WorkerLocalOptimizers.size() << std::endl;
 }
 
 //-------------------------------------------------------------------
@@ -86,6 +92,31 @@ MultiStartOptimizerv4Template<TInternalComputationValueType>::GetBestParameters(
 }
 
 
+/** Set the metrics of the parallel search */
+template <typename TInternalComputationValueType>
+void
+MultiStartOptimizerv4Template<TInternalComputationValueType>::SetWorkerMetrics(const MetricsListType & metrics)
+{
+  if (metrics != this->m_WorkerMetrics)
+  {
+    this->m_WorkerMetrics = metrics;
+    this->Modified();
+  }
+}
+
+/** Set the local optimizers of the parallel search */
+template <typename TInternalComputationValueType>
+void
+MultiStartOptimizerv4Template<TInternalComputationValueType>::SetWorkerLocalOptimizers(
+  const OptimizersListType & optimizers)
+{
+  if (optimizers != this->m_WorkerLocalOptimizers)
+  {
+    this->m_WorkerLocalOptimizers = optimizers;
+    this->Modified();
+  }
+}
+
 //-------------------------------------------------------------------
 template <typename TInternalComputationValueType>
 void
@@ -161,6 +192,14 @@ MultiStartOptimizerv4Template<TInternalComputationValueType>::ResumeOptimization
   this->m_StopConditionDescription << this->GetNameOfClass() << ": ";
   this->InvokeEvent(StartEvent());
 
+  /* The searches run in parallel up front, their results are then reduced in order */
+  std::vector<WorkerResultType> workerResults;
+  const SizeValueType           firstStart = this->m_CurrentIteration;
+  if (!this->m_WorkerMetrics.empty())
+  {
+    this->SearchRemainingStartsInParallel(workerResults);
+  }
+
   this->m_Stop = false;
   while (!this->m_Stop)
   {
@@ -168,13 +207,30 @@ MultiStartOptimizerv4Template<TInternalComputationValueType>::ResumeOptimization
     try
     {
       this->m_Metric->SetParameters(this->m_ParametersList[this->m_CurrentIteration]);
-      if (this->m_LocalOptimizer)
+      if (workerResults.empty())
+      {
+        if (this->m_LocalOptimizer)
+        {
+          this->m_LocalOptimizer->SetMetric(this->m_Metric);
+          this->m_LocalOptimizer->StartOptimization();
+          this->m_ParametersList[this->m_CurrentIteration] = this->m_Metric->GetParameters();
+        }
+        this->m_CurrentMetricValue = this->m_Metric->GetValue();
+      }
+      else
       {
-        this->m_LocalOptimizer->SetMetric(this->m_Metric);
-        this->m_LocalOptimizer->StartOptimization();
-        this->m_ParametersList[this->m_CurrentIteration] = this->m_Metric->GetParameters();
+        const WorkerResultType & result = workerResults[this->m_CurrentIteration - firstStart];
+        if (result.m_Exception)
+        {
+          std::rethrow_exception(result.m_Exception);
+        }
+        if (this->m_LocalOptimizer)
+        {
+          this->m_ParametersList[this->m_CurrentIteration] = result.m_Parameters;
+          this->m_Metric->SetParameters(this->m_ParametersList[this->m_CurrentIteration]);
+        }
+        this->m_CurrentMetricValue = result.m_Value;
       }
-      this->m_CurrentMetricValue = this->m_Metric->GetValue();
       this->m_MetricValuesList.push_back(this->m_CurrentMetricValue);
     }
     catch (ExceptionObject &)
@@ -215,6 +271,76 @@ MultiStartOptimizerv4Template<TInternalComputationValueType>::ResumeOptimization
   } // while (!m_Stop)
 }
 
+/**
+ * Search from the remaining start points in parallel.
+ */
+template <typename TInternalComputationValueType>
+void
+MultiStartOptimizerv4Template<TInternalComputationValueType>::SearchRemainingStartsInParallel(
+  std::vector<WorkerResultType> & results)
+{
+  const auto numberOfWorkers = static_cast<SizeValueType>(this->m_WorkerMetrics.size());
+  if (this->m_LocalOptimizer && this->m_WorkerLocalOptimizers.size() != numberOfWorkers)
+  {
+    itkExceptionMacro(<< "The number of worker local optimizers is " << this->m_WorkerLocalOptimizers.size()
+                      << ", but the number of worker metrics is " << numberOfWorkers << ".");
+  }
+  for (SizeValueType worker = 0; worker < numberOfWorkers; ++worker)
+  {
+    if (this->m_WorkerMetrics[worker].IsNull() || this->m_WorkerMetrics[worker] == this->m_Metric)
+    {
+      itkExceptionMacro(<< "The worker metrics must be set and distinct from the metric of the optimizer.");
+    }
+    if (this->m_LocalOptimizer && (this->m_WorkerLocalOptimizers[worker].IsNull() ||
+                                   this->m_WorkerLocalOptimizers[worker] == this->m_LocalOptimizer))
+    {
+      itkExceptionMacro(<< "The worker local optimizers must be set and distinct from the local optimizer.");
+    }
+  }
+
+  const SizeValueType firstStart = this->m_CurrentIteration;
+  const SizeValueType lastStart = this->m_NumberOfIterations;
+  results.assign(std::max(firstStart, lastStart) - firstStart, WorkerResultType());
+
+  /* The start points are handed out one at a time since the local
+   * optimizations can take very different numbers of iterations. */
+  std::atomic<SizeValueType> nextStart{ firstStart };
+
+  // The workers run on threads of their own: on the thread pool, they would
+  // wait for the pool work of the metrics and local optimizers while
+  // occupying the pool threads
+  auto multiThreader = PlatformMultiThreader::New();
+  multiThreader->SetNumberOfWorkUnits(numberOfWorkers);
+  multiThreader->ParallelizeArray(
+    0,
+    numberOfWorkers,
+    [&](SizeValueType worker) {
+      MetricType *    metric = this->m_WorkerMetrics[worker];
+      OptimizerType * optimizer = this->m_LocalOptimizer ? this->m_WorkerLocalOptimizers[worker].GetPointer() : nullptr;
+      for (SizeValueType start = nextStart++; start < lastStart; start = nextStart++)
+      {
+        WorkerResultType & result = results[start - firstStart];
+        try
+        {
+          ParametersType parameters = this->m_ParametersList[start];
+          metric->SetParameters(parameters);
+          if (optimizer)
+          {
+            optimizer->SetMetric(metric);
+            optimizer->StartOptimization();
+            result.m_Parameters = metric->GetParameters();
+          }
+          result.m_Value = metric->GetValue();
+        }
+        catch (...)
+        {
+          result.m_Exception = std::current_exception();
+        }
+      }
+    },
+    nullptr);
+}
+
 } // namespace itk
 
 #endif
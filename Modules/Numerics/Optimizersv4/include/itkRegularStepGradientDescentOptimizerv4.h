@@ -126,6 +126,14 @@ protected:
   void
   ModifyGradientByLearningRateOverSubRange(const IndexRangeType & subrange) override;
 
+  /** The gradient modification methods are overridden, so the scales and the
+   * learning rate are not applied in a single pass. */
+  bool
+  CanFuseGradientModification() const override
+  {
+    return false;
+  }
+
 
   /** Default constructor. */
   RegularStepGradientDescentOptimizerv4();
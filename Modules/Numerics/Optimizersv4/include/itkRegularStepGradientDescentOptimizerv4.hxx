@@ -187,34 +187,29 @@ RegularStepGradientDescentOptimizerv4<TInternalComputationValueType>::ModifyGrad
   const ScalesType & scales = this->GetScales();
   const ScalesType & weights = this->GetWeights();
 
-  ScalesType factor(scales.Size());
-
-  if (this->GetWeightsAreIdentity())
-  {
-    for (SizeValueType i = 0; i < factor.Size(); ++i)
-    {
-      factor[i] = NumericTraits<typename ScalesType::ValueType>::OneValue() / scales[i];
-    }
-  }
-  else
-  {
-    for (SizeValueType i = 0; i < factor.Size(); ++i)
-    {
-      factor[i] = weights[i] / scales[i];
-    }
-  }
+  // The factors are computed on the fly, as in the superclass, to avoid
+  // allocating an array of the size of the scales on each call.
+  const SizeValueType numberOfScales = scales.Size();
+  const bool          weightsAreIdentity = this->GetWeightsAreIdentity();
+  const auto          one = NumericTraits<typename ScalesType::ValueType>::OneValue();
 
   // Loop over the range. It is inclusive.
+  // Scale is checked during StartOptmization for values <=
+  // machine epsilon.
+  // Take the modulo of the index to handle gradients from transforms
+  // with local support. The gradient array stores the gradient of local
+  // parameters at each local index with linear packing.
+  SizeValueType index = subrange[0] % numberOfScales;
   for (IndexValueType j = subrange[0]; j <= subrange[1]; ++j)
   {
-    // Scale is checked during StartOptmization for values <=
-    // machine epsilon.
-    // Take the modulo of the index to handle gradients from transforms
-    // with local support. The gradient array stores the gradient of local
-    // parameters at each local index with linear packing.
-    IndexValueType index = j % scales.Size();
-    this->m_Gradient[j] = this->m_Gradient[j] * factor[index];
-    this->m_PreviousGradient[j] = this->m_PreviousGradient[j] * factor[index];
+    const typename ScalesType::ValueType factor =
+      weightsAreIdentity ? one / scales[index] : weights[index] / scales[index];
+    this->m_Gradient[j] = this->m_Gradient[j] * factor;
+    this->m_PreviousGradient[j] = this->m_PreviousGradient[j] * factor;
+    if (++index == numberOfScales)
+    {
+      index = 0;
+    }
   }
 }
 
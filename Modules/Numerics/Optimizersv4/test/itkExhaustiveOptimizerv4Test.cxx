@@ -69,6 +69,12 @@ public:
 
     std::cout << "GetValue ( " << x << " , " << y << ") = ";
 
+    if (m_FailingPosition.GetSize() == SpaceDimension && itk::Math::ExactlyEquals(x, m_FailingPosition[0]) &&
+        itk::Math::ExactlyEquals(y, m_FailingPosition[1]))
+    {
+      itkGenericExceptionMacro(<< "Failing position " << m_FailingPosition);
+    }
+
     MeasureType val = 0.5 * (3 * x * x + 4 * x * y + 6 * y * y) - 2 * x + 8 * y;
 
     std::cout << val << std::endl;
@@ -140,12 +146,20 @@ public:
     m_HasLocalSupport = hls;
   }
 
+  /** Make GetValue() throw an exception at the given position. */
+  void
+  SetFailingPosition(const ParametersType & position)
+  {
+    m_FailingPosition = position;
+  }
+
   void
   UpdateTransformParameters(const DerivativeType &, ParametersValueType) override
   {}
 
 private:
   ParametersType m_Parameters;
+  ParametersType m_FailingPosition;
   bool           m_HasLocalSupport;
 };
 
@@ -286,6 +300,56 @@ itkExhaustiveOptimizerv4Test(int, char *[])
   bool                       visitedIndicesPass = true;
   std::vector<unsigned long> visitedIndices = idxObserver->m_VisitedIndices;
 
+  // Walk the grid again with the positions evaluated in parallel, the walk
+  // must be the serial one.
+  const double                        serialMinimumMetricValue = itkOptimizer->GetMinimumMetricValue();
+  const double                        serialMaximumMetricValue = itkOptimizer->GetMaximumMetricValue();
+  const OptimizerType::ParametersType serialMaximumPosition = itkOptimizer->GetMaximumMetricValuePosition();
+
+  OptimizerType::MetricsListType workerMetrics;
+  for (unsigned int i = 0; i < 3; ++i)
+  {
+    workerMetrics.push_back(ExhaustiveOptv4Metric::New());
+  }
+  itkOptimizer->SetWorkerMetrics(workerMetrics);
+  ITK_TEST_EXPECT_EQUAL(workerMetrics.size(), itkOptimizer->GetWorkerMetrics().size());
+
+  idxObserver->m_VisitedIndices.clear();
+  metric->SetParameters(initialPosition);
+  ITK_TRY_EXPECT_NO_EXCEPTION(itkOptimizer->StartOptimization());
+
+  ITK_TEST_EXPECT_TRUE(visitedIndices == idxObserver->m_VisitedIndices);
+  ITK_TEST_EXPECT_EQUAL(serialMinimumMetricValue, itkOptimizer->GetMinimumMetricValue());
+  ITK_TEST_EXPECT_EQUAL(serialMaximumMetricValue, itkOptimizer->GetMaximumMetricValue());
+  ITK_TEST_EXPECT_EQUAL(finalPosition, itkOptimizer->GetMinimumMetricValuePosition());
+  ITK_TEST_EXPECT_EQUAL(serialMaximumPosition, itkOptimizer->GetMaximumMetricValuePosition());
+
+  // When the evaluation of a position fails, the exception is thrown after
+  // the IterationEvents of the positions walked before it, as in the serial
+  // walk. The failing position has the grid index (3, 7), the 151st one.
+  ParametersType failingPosition(spaceDimension);
+  failingPosition[0] = initialPosition[0] + (3 - 10) * stepLength;
+  failingPosition[1] = initialPosition[1] + (7 - 10) * stepLength;
+  metric->SetFailingPosition(failingPosition);
+  for (const auto & workerMetric : workerMetrics)
+  {
+    static_cast<ExhaustiveOptv4Metric *>(workerMetric.GetPointer())->SetFailingPosition(failingPosition);
+  }
+
+  itkOptimizer->SetWorkerMetrics(OptimizerType::MetricsListType());
+  idxObserver->m_VisitedIndices.clear();
+  metric->SetParameters(initialPosition);
+  ITK_TRY_EXPECT_EXCEPTION(itkOptimizer->StartOptimization());
+  const std::vector<unsigned long> serialFailureVisitedIndices = idxObserver->m_VisitedIndices;
+  ITK_TEST_EXPECT_EQUAL(serialFailureVisitedIndices.size(), 150);
+
+  itkOptimizer->SetWorkerMetrics(workerMetrics);
+  idxObserver->m_VisitedIndices.clear();
+  metric->SetParameters(initialPosition);
+  ITK_TRY_EXPECT_EXCEPTION(itkOptimizer->StartOptimization());
+  ITK_TEST_EXPECT_TRUE(serialFailureVisitedIndices == idxObserver->m_VisitedIndices);
+  ITK_TEST_EXPECT_EQUAL(failingPosition, metric->GetParameters());
+
   size_t requiredNumberOfSteps = (2 * steps[0] + 1) * (2 * steps[1] + 1);
   if (visitedIndices.size() != requiredNumberOfSteps)
   {
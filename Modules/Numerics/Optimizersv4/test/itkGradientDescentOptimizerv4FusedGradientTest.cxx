@@ -0,0 +1,284 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkGradientDescentOptimizerv4.h"
+#include "itkMath.h"
+#include "itkTestingMacros.h"
+
+#include <cmath>
+
+/* This test checks that applying the scales and the learning rate to the
+ * gradient in a single pass gives exactly the same updates as the two
+ * passes, for transforms with and without local support, with sizes below
+ * and above the threshold of the threaded gradient modification. It also
+ * checks that a subclass overriding the gradient modification methods, and
+ * thus CanFuseGradientModification(), gets the two passes. */
+
+namespace
+{
+/**
+ *  \class GradientDescentOptimizerv4FusedGradientTestMetric for test
+ *
+ *  Quadratic metric of a configurable number of parameters, with or
+ *  without local support.
+ */
+class GradientDescentOptimizerv4FusedGradientTestMetric : public itk::ObjectToObjectMetricBase
+{
+public:
+  using Self = GradientDescentOptimizerv4FusedGradientTestMetric;
+  using Superclass = itk::ObjectToObjectMetricBase;
+  using Pointer = itk::SmartPointer<Self>;
+  using ConstPointer = itk::SmartPointer<const Self>;
+  itkNewMacro(Self);
+  itkTypeMacro(GradientDescentOptimizerv4FusedGradientTestMetric, ObjectToObjectMetricBase);
+
+  using ParametersType = Superclass::ParametersType;
+  using ParametersValueType = Superclass::ParametersValueType;
+  using NumberOfParametersType = Superclass::NumberOfParametersType;
+  using DerivativeType = Superclass::DerivativeType;
+  using MeasureType = Superclass::MeasureType;
+
+  void
+  SetSize(NumberOfParametersType numberOfParameters, NumberOfParametersType numberOfLocalParameters, bool localSupport)
+  {
+    m_NumberOfLocalParameters = numberOfLocalParameters;
+    m_HasLocalSupport = localSupport;
+    m_Parameters.SetSize(numberOfParameters);
+    m_Parameters.Fill(0.0);
+  }
+
+  void
+  Initialize() override
+  {}
+
+  void
+  GetDerivative(DerivativeType & derivative) const override
+  {
+    MeasureType value;
+    GetValueAndDerivative(value, derivative);
+  }
+
+  void
+  GetValueAndDerivative(MeasureType & value, DerivativeType & derivative) const override
+  {
+    derivative.SetSize(this->GetNumberOfParameters());
+    value = 0.0;
+    for (NumberOfParametersType i = 0; i < this->GetNumberOfParameters(); ++i)
+    {
+      const double difference = std::sin(0.37 * i) - m_Parameters[i];
+      value += difference * difference;
+      derivative[i] = difference;
+    }
+  }
+
+  MeasureType
+  GetValue() const override
+  {
+    MeasureType    value;
+    DerivativeType derivative;
+    GetValueAndDerivative(value, derivative);
+    return value;
+  }
+
+  void
+  UpdateTransformParameters(const DerivativeType & update, ParametersValueType) override
+  {
+    m_Parameters += update;
+  }
+
+  unsigned int
+  GetNumberOfParameters() const override
+  {
+    return m_Parameters.Size();
+  }
+
+  bool
+  HasLocalSupport() const override
+  {
+    return m_HasLocalSupport;
+  }
+
+  unsigned int
+  GetNumberOfLocalParameters() const override
+  {
+    return m_NumberOfLocalParameters;
+  }
+
+  void
+  SetParameters(ParametersType & parameters) override
+  {
+    m_Parameters = parameters;
+  }
+
+  const ParametersType &
+  GetParameters() const override
+  {
+    return m_Parameters;
+  }
+
+private:
+  ParametersType         m_Parameters;
+  NumberOfParametersType m_NumberOfLocalParameters{ 0 };
+  bool                   m_HasLocalSupport{ false };
+};
+
+/* Optimizer which counts the calls to the single pass. */
+class GradientDescentOptimizerv4FusedGradientTestFusedOptimizer : public itk::GradientDescentOptimizerv4
+{
+public:
+  using Self = GradientDescentOptimizerv4FusedGradientTestFusedOptimizer;
+  using Superclass = itk::GradientDescentOptimizerv4;
+  using Pointer = itk::SmartPointer<Self>;
+  using ConstPointer = itk::SmartPointer<const Self>;
+  itkNewMacro(Self);
+  itkTypeMacro(GradientDescentOptimizerv4FusedGradientTestFusedOptimizer, GradientDescentOptimizerv4);
+
+  void
+  ModifyGradientByScalesAndLearningRate() override
+  {
+    ++m_NumberOfFusedCalls;
+    Superclass::ModifyGradientByScalesAndLearningRate();
+  }
+
+  unsigned int m_NumberOfFusedCalls{ 0 };
+};
+
+/* Optimizer which overrides ModifyGradientByScales, so it disables the
+ * single pass. */
+class GradientDescentOptimizerv4FusedGradientTestTwoPassOptimizer : public itk::GradientDescentOptimizerv4
+{
+public:
+  using Self = GradientDescentOptimizerv4FusedGradientTestTwoPassOptimizer;
+  using Superclass = itk::GradientDescentOptimizerv4;
+  using Pointer = itk::SmartPointer<Self>;
+  using ConstPointer = itk::SmartPointer<const Self>;
+  itkNewMacro(Self);
+  itkTypeMacro(GradientDescentOptimizerv4FusedGradientTestTwoPassOptimizer, GradientDescentOptimizerv4);
+
+  void
+  ModifyGradientByScales() override
+  {
+    ++m_NumberOfScalesCalls;
+    Superclass::ModifyGradientByScales();
+  }
+
+  unsigned int m_NumberOfScalesCalls{ 0 };
+
+protected:
+  bool
+  CanFuseGradientModification() const override
+  {
+    return false;
+  }
+};
+
+using MetricType = GradientDescentOptimizerv4FusedGradientTestMetric;
+
+MetricType::ParametersType
+Optimize(itk::GradientDescentOptimizerv4 *     optimizer,
+         MetricType::NumberOfParametersType numberOfParameters,
+         MetricType::NumberOfParametersType numberOfLocalParameters,
+         bool                               localSupport,
+         unsigned int                       numberOfIterations)
+{
+  auto metric = MetricType::New();
+  metric->SetSize(numberOfParameters, numberOfLocalParameters, localSupport);
+
+  itk::GradientDescentOptimizerv4::ScalesType scales(numberOfLocalParameters);
+  itk::GradientDescentOptimizerv4::ScalesType weights(numberOfLocalParameters);
+  for (MetricType::NumberOfParametersType i = 0; i < numberOfLocalParameters; ++i)
+  {
+    scales[i] = 1.0 + 0.25 * (i % 7);
+    weights[i] = 0.5 + 0.125 * (i % 5);
+  }
+
+  optimizer->SetMetric(metric);
+  optimizer->SetScales(scales);
+  optimizer->SetWeights(weights);
+  optimizer->SetLearningRate(0.3);
+  optimizer->SetNumberOfIterations(numberOfIterations);
+  optimizer->SetDoEstimateLearningRateOnce(false);
+  optimizer->SetDoEstimateLearningRateAtEachIteration(false);
+  optimizer->SetReturnBestParametersAndValue(false);
+  optimizer->SetMinimumConvergenceValue(-1.0);
+  optimizer->StartOptimization();
+
+  return metric->GetParameters();
+}
+} // namespace
+
+int
+itkGradientDescentOptimizerv4FusedGradientTest(int, char *[])
+{
+  constexpr unsigned int numberOfIterations = 4;
+
+  struct Case
+  {
+    MetricType::NumberOfParametersType numberOfParameters;
+    MetricType::NumberOfParametersType numberOfLocalParameters;
+    bool                               localSupport;
+  };
+  // The gradient modification is threaded for transforms with local support,
+  // and for global transforms of at least 1 << 16 parameters when the
+  // optimizer can fuse it, i.e. the single pass optimizers below
+  const Case cases[] = { { 3 * 1000, 3, true },
+                         { 3 * 30000, 3, true },
+                         { 1000, 1000, false },
+                         { (1 << 16) + 123, (1 << 16) + 123, false } };
+
+  bool testPassed = true;
+  for (const Case & c : cases)
+  {
+    std::cout << "Parameters: " << c.numberOfParameters << ", local parameters: " << c.numberOfLocalParameters
+              << ", local support: " << c.localSupport << std::endl;
+
+    auto fusedOptimizer = GradientDescentOptimizerv4FusedGradientTestFusedOptimizer::New();
+    const MetricType::ParametersType fusedParameters =
+      Optimize(fusedOptimizer, c.numberOfParameters, c.numberOfLocalParameters, c.localSupport, numberOfIterations);
+    ITK_TEST_EXPECT_EQUAL(fusedOptimizer->m_NumberOfFusedCalls, numberOfIterations);
+
+    auto twoPassOptimizer = GradientDescentOptimizerv4FusedGradientTestTwoPassOptimizer::New();
+    const MetricType::ParametersType twoPassParameters =
+      Optimize(twoPassOptimizer, c.numberOfParameters, c.numberOfLocalParameters, c.localSupport, numberOfIterations);
+    ITK_TEST_EXPECT_EQUAL(twoPassOptimizer->m_NumberOfScalesCalls, numberOfIterations);
+
+    auto optimizer = itk::GradientDescentOptimizerv4::New();
+    const MetricType::ParametersType parameters =
+      Optimize(optimizer, c.numberOfParameters, c.numberOfLocalParameters, c.localSupport, numberOfIterations);
+
+    for (MetricType::NumberOfParametersType i = 0; i < c.numberOfParameters; ++i)
+    {
+      if (itk::Math::NotExactlyEquals(fusedParameters[i], twoPassParameters[i]) ||
+          itk::Math::NotExactlyEquals(parameters[i], twoPassParameters[i]))
+      {
+        std::cerr << "Test failed!" << std::endl;
+        std::cerr << "Parameter " << i << " differs: single pass " << fusedParameters[i] << ", two passes "
+                  << twoPassParameters[i] << ", default " << parameters[i] << std::endl;
+        testPassed = false;
+        break;
+      }
+    }
+  }
+
+  if (!testPassed)
+  {
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
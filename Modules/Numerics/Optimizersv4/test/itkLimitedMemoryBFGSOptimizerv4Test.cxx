@@ -0,0 +1,391 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkLimitedMemoryBFGSOptimizerv4.h"
+#include "itkMath.h"
+#include "itkTestingMacros.h"
+#include <iostream>
+
+/**
+ * \class itkLimitedMemoryBFGSOptimizerv4TestMetric
+ *
+ *  The objective function is the quadratic form:
+ *
+ *  1/2 x^T A x - b^T x
+ *
+ *  The system in this example is:
+ *
+ *     | 3  2 ||x|   | 2|   |0|
+ *     | 2  6 ||y| + |-8| = |0|
+ *
+ *
+ *   the solution is the vector | 2 -2 |
+ *
+ */
+class itkLimitedMemoryBFGSOptimizerv4TestMetric : public itk::ObjectToObjectMetricBase
+{
+public:
+  using Self = itkLimitedMemoryBFGSOptimizerv4TestMetric;
+  using Superclass = itk::ObjectToObjectMetricBase;
+  using Pointer = itk::SmartPointer<Self>;
+  using ConstPointer = itk::SmartPointer<const Self>;
+  itkNewMacro(Self);
+
+  itkTypeMacro(itkLimitedMemoryBFGSOptimizerv4TestMetric, ObjectToObjectMetricBase);
+
+  enum
+  {
+    SpaceDimension = 2
+  };
+
+  using ParametersType = Superclass::ParametersType;
+  using DerivativeType = Superclass::DerivativeType;
+  using MeasureType = Superclass::MeasureType;
+
+  itkLimitedMemoryBFGSOptimizerv4TestMetric() { m_Parameters.SetSize(SpaceDimension); }
+
+  MeasureType
+  GetValue() const override
+  {
+    double x = this->m_Parameters[0];
+    double y = this->m_Parameters[1];
+
+    return 0.5 * (3 * x * x + 4 * x * y + 6 * y * y) - 2 * x + 8 * y;
+  }
+
+  void
+  GetDerivative(DerivativeType & derivative) const override
+  {
+    double x = this->m_Parameters[0];
+    double y = this->m_Parameters[1];
+
+    // The derivative of the v4 metrics is the descent direction
+    derivative.SetSize(SpaceDimension);
+    derivative[0] = -(3 * x + 2 * y - 2);
+    derivative[1] = -(2 * x + 6 * y + 8);
+  }
+
+  void
+  GetValueAndDerivative(MeasureType & value, DerivativeType & derivative) const override
+  {
+    value = GetValue();
+    GetDerivative(derivative);
+  }
+
+  void
+  Initialize() override
+  {}
+
+  Superclass::NumberOfParametersType
+  GetNumberOfLocalParameters() const override
+  {
+    return SpaceDimension;
+  }
+
+  Superclass::NumberOfParametersType
+  GetNumberOfParameters() const override
+  {
+    return SpaceDimension;
+  }
+
+  void
+  SetParameters(ParametersType & params) override
+  {
+    this->m_Parameters = params;
+  }
+
+  const ParametersType &
+  GetParameters() const override
+  {
+    return this->m_Parameters;
+  }
+
+  bool
+  HasLocalSupport() const override
+  {
+    return false;
+  }
+
+  void
+  UpdateTransformParameters(const DerivativeType & update, ParametersValueType factor) override
+  {
+    for (unsigned int i = 0; i < SpaceDimension; ++i)
+    {
+      this->m_Parameters[i] += factor * update[i];
+    }
+  }
+
+private:
+  ParametersType m_Parameters;
+};
+
+/**
+ * \class itkLimitedMemoryBFGSOptimizerv4TestLargeMetric
+ *
+ *  Ill-conditioned quadratic over a large number of parameters with local
+ *  support, sum of 1/2 a_i (x_i - c_i)^2 + 1/2 (x_i - x_{i+1})^2.
+ */
+class itkLimitedMemoryBFGSOptimizerv4TestLargeMetric : public itk::ObjectToObjectMetricBase
+{
+public:
+  using Self = itkLimitedMemoryBFGSOptimizerv4TestLargeMetric;
+  using Superclass = itk::ObjectToObjectMetricBase;
+  using Pointer = itk::SmartPointer<Self>;
+  using ConstPointer = itk::SmartPointer<const Self>;
+  itkNewMacro(Self);
+
+  itkTypeMacro(itkLimitedMemoryBFGSOptimizerv4TestLargeMetric, ObjectToObjectMetricBase);
+
+  using ParametersType = Superclass::ParametersType;
+  using DerivativeType = Superclass::DerivativeType;
+  using MeasureType = Superclass::MeasureType;
+
+  static constexpr unsigned int NumberOfLocalParameters = 2;
+  static constexpr unsigned int NumberOfParameters = 100000 * NumberOfLocalParameters;
+
+  itkLimitedMemoryBFGSOptimizerv4TestLargeMetric() { m_Parameters.SetSize(NumberOfParameters); }
+
+  static double
+  Curvature(unsigned int i)
+  {
+    return 1.0 + (i % 97);
+  }
+
+  static double
+  Center(unsigned int i)
+  {
+    return 0.01 * (i % 89) - 0.3;
+  }
+
+  MeasureType
+  GetValue() const override
+  {
+    double value = 0.0;
+    for (unsigned int i = 0; i < NumberOfParameters; ++i)
+    {
+      const double difference = m_Parameters[i] - Center(i);
+      value += 0.5 * Curvature(i) * difference * difference;
+      if (i + 1 < NumberOfParameters)
+      {
+        const double neighborDifference = m_Parameters[i] - m_Parameters[i + 1];
+        value += 0.5 * neighborDifference * neighborDifference;
+      }
+    }
+    return value;
+  }
+
+  void
+  GetDerivative(DerivativeType & derivative) const override
+  {
+    derivative.SetSize(NumberOfParameters);
+    for (unsigned int i = 0; i < NumberOfParameters; ++i)
+    {
+      double gradient = Curvature(i) * (m_Parameters[i] - Center(i));
+      if (i > 0)
+      {
+        gradient += m_Parameters[i] - m_Parameters[i - 1];
+      }
+      if (i + 1 < NumberOfParameters)
+      {
+        gradient += m_Parameters[i] - m_Parameters[i + 1];
+      }
+      derivative[i] = -gradient;
+    }
+  }
+
+  void
+  GetValueAndDerivative(MeasureType & value, DerivativeType & derivative) const override
+  {
+    value = GetValue();
+    GetDerivative(derivative);
+  }
+
+  void
+  Initialize() override
+  {}
+
+  Superclass::NumberOfParametersType
+  GetNumberOfLocalParameters() const override
+  {
+    return NumberOfLocalParameters;
+  }
+
+  Superclass::NumberOfParametersType
+  GetNumberOfParameters() const override
+  {
+    return NumberOfParameters;
+  }
+
+  void
+  SetParameters(ParametersType & params) override
+  {
+    this->m_Parameters = params;
+  }
+
+  const ParametersType &
+  GetParameters() const override
+  {
+    return this->m_Parameters;
+  }
+
+  bool
+  HasLocalSupport() const override
+  {
+    return true;
+  }
+
+  void
+  UpdateTransformParameters(const DerivativeType & update, ParametersValueType factor) override
+  {
+    for (unsigned int i = 0; i < NumberOfParameters; ++i)
+    {
+      this->m_Parameters[i] += factor * update[i];
+    }
+  }
+
+private:
+  ParametersType m_Parameters;
+};
+
+
+int
+itkLimitedMemoryBFGSOptimizerv4Test(int, char *[])
+{
+  std::cout << "LimitedMemoryBFGS Optimizerv4 Test \n \n";
+
+  using OptimizerType = itk::LimitedMemoryBFGSOptimizerv4;
+
+  // Declaration of an itkOptimizer
+  auto itkOptimizer = OptimizerType::New();
+
+  ITK_EXERCISE_BASIC_OBJECT_METHODS(
+    itkOptimizer, LimitedMemoryBFGSOptimizerv4Template, GradientDescentOptimizerv4Template);
+
+
+  // Set some optimizer parameters
+  itk::SizeValueType numberOfCorrections = 4;
+  itkOptimizer->SetNumberOfCorrections(numberOfCorrections);
+  ITK_TEST_SET_GET_VALUE(numberOfCorrections, itkOptimizer->GetNumberOfCorrections());
+
+  double gradientConvergenceTolerance = 1e-8;
+  itkOptimizer->SetGradientConvergenceTolerance(gradientConvergenceTolerance);
+  ITK_TEST_SET_GET_VALUE(gradientConvergenceTolerance, itkOptimizer->GetGradientConvergenceTolerance());
+
+  unsigned int maximumLineSearchIterations = 30;
+  itkOptimizer->SetMaximumLineSearchIterations(maximumLineSearchIterations);
+  ITK_TEST_SET_GET_VALUE(maximumLineSearchIterations, itkOptimizer->GetMaximumLineSearchIterations());
+
+  itkOptimizer->SetNumberOfIterations(100);
+
+  // Declaration of the metric
+  auto metric = itkLimitedMemoryBFGSOptimizerv4TestMetric::New();
+  itkOptimizer->SetMetric(metric);
+
+  OptimizerType::ParametersType initialValue(itkLimitedMemoryBFGSOptimizerv4TestMetric::SpaceDimension);
+
+  // We start far from | 2 -2 |
+  initialValue[0] = 100;
+  initialValue[1] = -100;
+  metric->SetParameters(initialValue);
+
+  // The first step along the derivative is cut by the line search
+  itkOptimizer->SetLearningRate(1.0);
+
+  ITK_TRY_EXPECT_NO_EXCEPTION(itkOptimizer->StartOptimization());
+
+  OptimizerType::ParametersType finalPosition = itkOptimizer->GetCurrentPosition();
+
+  std::cout << "Solution        = (" << finalPosition[0] << "," << finalPosition[1] << ")" << std::endl;
+  std::cout << "End condition   = " << itkOptimizer->GetStopConditionDescription() << std::endl;
+  std::cout << "NumberOfIterations  = " << itkOptimizer->GetCurrentIteration() << std::endl;
+  std::cout << "CurrentGradientNorm: " << itkOptimizer->GetCurrentGradientNorm() << std::endl;
+  std::cout << "CurrentStepLength: " << itkOptimizer->GetCurrentStepLength() << std::endl;
+  std::cout << "LineSearchIterations: " << itkOptimizer->GetLineSearchIterations() << std::endl;
+
+  ITK_TEST_EXPECT_EQUAL(itkOptimizer->GetStopCondition(),
+                        itk::StopConditionObjectToObjectOptimizerEnum::GRADIENT_MAGNITUDE_TOLEARANCE);
+
+  // A quadratic in two dimensions is minimized in a few quasi-Newton steps
+  ITK_TEST_EXPECT_TRUE(itkOptimizer->GetCurrentIteration() < 10);
+
+  double trueParameters[2] = { 2, -2 };
+  for (unsigned int j = 0; j < 2; ++j)
+  {
+    if (itk::Math::abs(finalPosition[j] - trueParameters[j]) > 1e-6)
+    {
+      std::cout << "Test failed." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  ITK_TEST_EXPECT_TRUE(itk::Math::abs(itkOptimizer->GetValue() + 10.0) < 1e-6);
+
+  //
+  // Test stopping when number of iterations reached
+  //
+  itkOptimizer->SetNumberOfIterations(1);
+  metric->SetParameters(initialValue);
+
+  ITK_TRY_EXPECT_NO_EXCEPTION(itkOptimizer->StartOptimization());
+
+  ITK_TEST_EXPECT_EQUAL(itkOptimizer->GetCurrentIteration(), 1);
+  ITK_TEST_EXPECT_EQUAL(itkOptimizer->GetStopCondition(),
+                        itk::StopConditionObjectToObjectOptimizerEnum::MAXIMUM_NUMBER_OF_ITERATIONS);
+
+  //
+  // Test a large parameter vector, whose vector operations are split
+  // between the work units. The optimization must not depend on their
+  // number.
+  //
+  using LargeMetricType = itkLimitedMemoryBFGSOptimizerv4TestLargeMetric;
+  OptimizerType::ParametersType largeFinalPositions[2];
+  const itk::ThreadIdType       numberOfWorkUnits[2] = { 1, 4 };
+  for (unsigned int run = 0; run < 2; ++run)
+  {
+    auto largeMetric = LargeMetricType::New();
+    OptimizerType::ParametersType largeInitialValue(LargeMetricType::NumberOfParameters);
+    largeInitialValue.Fill(0.0);
+    largeMetric->SetParameters(largeInitialValue);
+
+    auto largeOptimizer = OptimizerType::New();
+    largeOptimizer->SetMetric(largeMetric);
+    largeOptimizer->SetNumberOfWorkUnits(numberOfWorkUnits[run]);
+    largeOptimizer->SetNumberOfIterations(500);
+    largeOptimizer->SetGradientConvergenceTolerance(1e-6);
+    largeOptimizer->SetLearningRate(0.01);
+
+    // Per local parameter scales precondition the recursion
+    OptimizerType::ScalesType scales(LargeMetricType::NumberOfLocalParameters);
+    scales[0] = 1.0;
+    scales[1] = 2.0;
+    largeOptimizer->SetScales(scales);
+
+    ITK_TRY_EXPECT_NO_EXCEPTION(largeOptimizer->StartOptimization());
+
+    std::cout << "Work units: " << numberOfWorkUnits[run] << ", iterations: " << largeOptimizer->GetCurrentIteration()
+              << ", gradient norm: " << largeOptimizer->GetCurrentGradientNorm() << std::endl;
+    ITK_TEST_EXPECT_EQUAL(largeOptimizer->GetStopCondition(),
+                          itk::StopConditionObjectToObjectOptimizerEnum::GRADIENT_MAGNITUDE_TOLEARANCE);
+    ITK_TEST_EXPECT_EQUAL(largeOptimizer->GetNumberOfStoredCorrections(), largeOptimizer->GetNumberOfCorrections());
+
+    largeFinalPositions[run] = largeOptimizer->GetCurrentPosition();
+  }
+  ITK_TEST_EXPECT_TRUE(largeFinalPositions[0] == largeFinalPositions[1]);
+
+  std::cout << "Test passed." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -303,5 +303,62 @@ itkMultiStartOptimizerv4Test(int, char *[])
     return EXIT_FAILURE;
   }
   std::cout << "Test 3 passed." << std::endl;
+
+  /*
+   * Test 4
+   */
+  std::cout << "Test optimization 4: with local optimizers run in parallel" << std::endl;
+  parametersList.clear();
+  for (int i = -7; i < 9; i += 4)
+  {
+    for (int j = -5; j < 5; j += 4)
+    {
+      ParametersType testPosition(spaceDimension);
+      testPosition[0] = static_cast<double>(i);
+      testPosition[1] = static_cast<double>(j);
+      parametersList.push_back(testPosition);
+    }
+  }
+  metric->SetParameters(parametersList[0]);
+  itkOptimizer->SetParametersList(parametersList);
+  if (MultiStartOptimizerv4RunTest(itkOptimizer) == EXIT_FAILURE)
+  {
+    return EXIT_FAILURE;
+  }
+  const OptimizerType::MetricValuesListType serialMetricValues = itkOptimizer->GetMetricValuesList();
+  const OptimizerType::ParametersListType   serialParametersList = itkOptimizer->GetParametersList();
+  const auto                                serialBestParametersIndex = itkOptimizer->GetBestParametersIndex();
+
+  OptimizerType::MetricsListType    workerMetrics;
+  OptimizerType::OptimizersListType workerOptimizers;
+  for (unsigned int i = 0; i < 3; ++i)
+  {
+    workerMetrics.push_back(MultiStartOptimizerv4TestMetric::New());
+    OptimizerType::LocalOptimizerPointer workerOptimizer = OptimizerType::LocalOptimizerType::New();
+    workerOptimizer->SetLearningRate(1.e-1);
+    workerOptimizer->SetNumberOfIterations(25);
+    workerOptimizers.push_back(workerOptimizer.GetPointer());
+  }
+  itkOptimizer->SetWorkerMetrics(workerMetrics);
+  ITK_TEST_EXPECT_EQUAL(workerMetrics.size(), itkOptimizer->GetWorkerMetrics().size());
+
+  // A local optimizer is required per worker metric
+  ITK_TRY_EXPECT_EXCEPTION(itkOptimizer->StartOptimization());
+
+  itkOptimizer->SetWorkerLocalOptimizers(workerOptimizers);
+  ITK_TEST_EXPECT_EQUAL(workerOptimizers.size(), itkOptimizer->GetWorkerLocalOptimizers().size());
+  metric->SetParameters(parametersList[0]);
+  itkOptimizer->SetParametersList(parametersList);
+  if (MultiStartOptimizerv4RunTest(itkOptimizer) == EXIT_FAILURE)
+  {
+    return EXIT_FAILURE;
+  }
+
+  // The parallel search reduces to the results of the serial one
+  ITK_TEST_EXPECT_TRUE(serialMetricValues == itkOptimizer->GetMetricValuesList());
+  ITK_TEST_EXPECT_TRUE(serialParametersList == itkOptimizer->GetParametersList());
+  ITK_TEST_EXPECT_EQUAL(serialBestParametersIndex, itkOptimizer->GetBestParametersIndex());
+  ITK_TEST_EXPECT_EQUAL(serialParametersList[serialBestParametersIndex], itkOptimizer->GetMetric()->GetParameters());
+  std::cout << "Test 4 passed." << std::endl;
   return EXIT_SUCCESS;
 }
@@ -0,0 +1,187 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkExhaustiveOptimizerv4.h"
+#include "itkMultiStartOptimizerv4.h"
+#include "itkMeanSquaresImageToImageMetricv4.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkThreadPool.h"
+#include "itkTranslationTransform.h"
+#include "itkTestingMacros.h"
+
+#include <cmath>
+
+/* This test runs the parallel searches of ExhaustiveOptimizerv4 and
+ * MultiStartOptimizerv4 with multi-threaded image metrics, with more worker
+ * metrics than threads in the thread pool. The workers must not wait for the
+ * pool work of their metrics while occupying the pool threads. The results
+ * must be those of the serial searches. */
+
+namespace
+{
+constexpr unsigned int Dimension = 2;
+
+using ImageType = itk::Image<double, Dimension>;
+using TransformType = itk::TranslationTransform<double, Dimension>;
+using MetricType = itk::MeanSquaresImageToImageMetricv4<ImageType, ImageType>;
+
+ImageType::Pointer
+MakeBlobImage(double centerX, double centerY)
+{
+  auto                  image = ImageType::New();
+  ImageType::RegionType region;
+  region.SetSize({ { 24, 24 } });
+  image->SetRegions(region);
+  image->Allocate();
+
+  itk::ImageRegionIteratorWithIndex<ImageType> it(image, region);
+  for (; !it.IsAtEnd(); ++it)
+  {
+    const double dx = it.GetIndex()[0] - centerX;
+    const double dy = it.GetIndex()[1] - centerY;
+    it.Set(100.0 * std::exp(-(dx * dx + dy * dy) / 18.0));
+  }
+  return image;
+}
+
+MetricType::Pointer
+MakeMetric(const ImageType * fixedImage, const ImageType * movingImage)
+{
+  auto transform = TransformType::New();
+  transform->SetIdentity();
+
+  auto metric = MetricType::New();
+  metric->SetFixedImage(fixedImage);
+  metric->SetMovingImage(movingImage);
+  metric->SetMovingTransform(transform);
+  metric->Initialize();
+  return metric;
+}
+} // namespace
+
+int
+itkParallelSearchOptimizersv4ImageMetricTest(int, char *[])
+{
+  // The metrics split their work in several work units run by the thread pool
+  itk::MultiThreaderBase::SetGlobalDefaultThreader(itk::MultiThreaderBase::ThreaderEnum::Pool);
+  itk::MultiThreaderBase::SetGlobalDefaultNumberOfThreads(2);
+
+  const ImageType::Pointer fixedImage = MakeBlobImage(11.0, 12.0);
+  const ImageType::Pointer movingImage = MakeBlobImage(13.0, 11.0);
+
+  auto metric = MakeMetric(fixedImage, movingImage);
+
+  // More workers than threads in the pool
+  const itk::ThreadIdType numberOfWorkers = itk::ThreadPool::GetInstance()->GetMaximumNumberOfThreads() + 2;
+  std::cout << "Number of workers: " << numberOfWorkers << std::endl;
+
+  MetricType::ParametersType initialPosition(Dimension);
+  initialPosition.Fill(0.0);
+
+  //
+  // ExhaustiveOptimizerv4
+  //
+  using ExhaustiveOptimizerType = itk::ExhaustiveOptimizerv4<double>;
+  auto exhaustiveOptimizer = ExhaustiveOptimizerType::New();
+  exhaustiveOptimizer->SetMetric(metric);
+  exhaustiveOptimizer->SetStepLength(0.5);
+  ExhaustiveOptimizerType::StepsType steps(Dimension);
+  steps.Fill(8);
+  exhaustiveOptimizer->SetNumberOfSteps(steps);
+  ExhaustiveOptimizerType::ScalesType scales(Dimension);
+  scales.Fill(1.0);
+  exhaustiveOptimizer->SetScales(scales);
+
+  metric->SetParameters(initialPosition);
+  ITK_TRY_EXPECT_NO_EXCEPTION(exhaustiveOptimizer->StartOptimization());
+  const double                                  serialMinimumValue = exhaustiveOptimizer->GetMinimumMetricValue();
+  const ExhaustiveOptimizerType::ParametersType serialMinimumPosition =
+    exhaustiveOptimizer->GetMinimumMetricValuePosition();
+  std::cout << "Serial exhaustive minimum " << serialMinimumValue << " at " << serialMinimumPosition << std::endl;
+
+  ExhaustiveOptimizerType::MetricsListType exhaustiveWorkerMetrics;
+  for (itk::ThreadIdType i = 0; i < numberOfWorkers; ++i)
+  {
+    exhaustiveWorkerMetrics.push_back(MakeMetric(fixedImage, movingImage).GetPointer());
+  }
+  exhaustiveOptimizer->SetWorkerMetrics(exhaustiveWorkerMetrics);
+
+  metric->SetParameters(initialPosition);
+  ITK_TRY_EXPECT_NO_EXCEPTION(exhaustiveOptimizer->StartOptimization());
+  std::cout << "Parallel exhaustive minimum " << exhaustiveOptimizer->GetMinimumMetricValue() << " at "
+            << exhaustiveOptimizer->GetMinimumMetricValuePosition() << std::endl;
+
+  ITK_TEST_EXPECT_EQUAL(serialMinimumValue, exhaustiveOptimizer->GetMinimumMetricValue());
+  ITK_TEST_EXPECT_EQUAL(serialMinimumPosition, exhaustiveOptimizer->GetMinimumMetricValuePosition());
+  ITK_TEST_EXPECT_EQUAL(serialMinimumPosition[0], 2.0);
+  ITK_TEST_EXPECT_EQUAL(serialMinimumPosition[1], -1.0);
+
+  //
+  // MultiStartOptimizerv4 with local gradient descent optimizers
+  //
+  using MultiStartOptimizerType = itk::MultiStartOptimizerv4;
+  auto multiStartOptimizer = MultiStartOptimizerType::New();
+  multiStartOptimizer->SetMetric(metric);
+
+  MultiStartOptimizerType::ParametersListType parametersList;
+  for (int i = -3; i <= 3; i += 2)
+  {
+    for (int j = -3; j <= 3; j += 2)
+    {
+      MultiStartOptimizerType::ParametersType startPosition(Dimension);
+      startPosition[0] = i;
+      startPosition[1] = j;
+      parametersList.push_back(startPosition);
+    }
+  }
+
+  const auto makeLocalOptimizer = []() {
+    auto localOptimizer = MultiStartOptimizerType::LocalOptimizerType::New();
+    localOptimizer->SetLearningRate(0.01);
+    localOptimizer->SetNumberOfIterations(5);
+    return localOptimizer;
+  };
+  multiStartOptimizer->SetLocalOptimizer(makeLocalOptimizer());
+
+  metric->SetParameters(parametersList[0]);
+  multiStartOptimizer->SetParametersList(parametersList);
+  ITK_TRY_EXPECT_NO_EXCEPTION(multiStartOptimizer->StartOptimization());
+  const MultiStartOptimizerType::MetricValuesListType serialMetricValues = multiStartOptimizer->GetMetricValuesList();
+  const MultiStartOptimizerType::ParametersListType   serialParametersList = multiStartOptimizer->GetParametersList();
+  const auto serialBestParametersIndex = multiStartOptimizer->GetBestParametersIndex();
+
+  MultiStartOptimizerType::MetricsListType    multiStartWorkerMetrics;
+  MultiStartOptimizerType::OptimizersListType workerLocalOptimizers;
+  for (itk::ThreadIdType i = 0; i < numberOfWorkers; ++i)
+  {
+    multiStartWorkerMetrics.push_back(MakeMetric(fixedImage, movingImage).GetPointer());
+    workerLocalOptimizers.push_back(makeLocalOptimizer().GetPointer());
+  }
+  multiStartOptimizer->SetWorkerMetrics(multiStartWorkerMetrics);
+  multiStartOptimizer->SetWorkerLocalOptimizers(workerLocalOptimizers);
+
+  metric->SetParameters(parametersList[0]);
+  multiStartOptimizer->SetParametersList(parametersList);
+  ITK_TRY_EXPECT_NO_EXCEPTION(multiStartOptimizer->StartOptimization());
+
+  ITK_TEST_EXPECT_TRUE(serialMetricValues == multiStartOptimizer->GetMetricValuesList());
+  ITK_TEST_EXPECT_TRUE(serialParametersList == multiStartOptimizer->GetParametersList());
+  ITK_TEST_EXPECT_EQUAL(serialBestParametersIndex, multiStartOptimizer->GetBestParametersIndex());
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
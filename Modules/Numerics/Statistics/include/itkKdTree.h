@@ -25,6 +25,7 @@
 #include "itkSize.h"
 #include "itkObject.h"
 #include "itkArray.h"
+#include "itkMultiThreaderBase.h"
 
 #include "itkSubsample.h"
 
@@ -194,6 +195,20 @@ struct ITK_TEMPLATE_EXPORT KdTreeNonterminalNode : public KdTreeNode<TSample>
     return m_Right;
   }
 
+  /** Sets the left child of this node */
+  void
+  SetLeft(Superclass * left)
+  {
+    m_Left = left;
+  }
+
+  /** Sets the right child of this node */
+  void
+  SetRight(Superclass * right)
+  {
+    m_Right = right;
+  }
+
   /**
    * Returs the number of measurement vectors under this node including
    * its children
@@ -324,6 +339,20 @@ struct ITK_TEMPLATE_EXPORT KdTreeWeightedCentroidNonterminalNode : public KdTree
     return m_Right;
   }
 
+  /** Set the left tree pointer. */
+  void
+  SetLeft(Superclass * left)
+  {
+    m_Left = left;
+  }
+
+  /** Set the right tree pointer. */
+  void
+  SetRight(Superclass * right)
+  {
+    m_Right = right;
+  }
+
   /** Return the size of the node. */
   unsigned int
   Size() const override
@@ -516,6 +545,20 @@ private:
  * 'MeasurementVectorSize'  has been removed to allow the length of a measurement
  * vector to be specified at run time. Please use the function
  * GetMeasurementVectorSize() instead.
+ *
+ * Several query points can be searched at once with the Search methods
+ * taking a vector of query points. The queries are distributed over the
+ * threads of the multi-threader returned by GetMultiThreader(). The input
+ * sample must then support concurrent calls to GetMeasurementVector(),
+ * which is the case of ListSample but not of the image adaptors that cache
+ * the last measurement vector; set the number of work units of the
+ * multi-threader to one to search such samples.
+ *
+ * When the root is set, the nodes are also copied into a flat array in
+ * depth-first order, with the instance identifiers of the terminal nodes
+ * stored contiguously, and the searches traverse this array rather than
+ * the linked nodes. The linked nodes returned by GetRoot() must therefore
+ * not be modified after SetRoot() has been called.
 
  * \sa KdTreeNode, KdTreeNonterminalNode,
  * KdTreeWeightedCentroidNonterminalNode, KdTreeTerminalNode,
@@ -567,6 +610,12 @@ public:
 
   using InstanceIdentifierVectorType = std::vector<InstanceIdentifier>;
 
+  /** Types used by the batched searches: the query points, and for each of
+   * them the neighbors found and their distances. */
+  using MeasurementVectorListType = std::vector<MeasurementVectorType>;
+  using InstanceIdentifierVectorListType = std::vector<InstanceIdentifierVectorType>;
+  using DistanceVectorListType = std::vector<std::vector<double>>;
+
   /**
    *\class NearestNeighbors
    * \brief data structure for storing k-nearest neighbor search result
@@ -700,6 +749,7 @@ public:
       this->DeleteNode(this->m_Root);
     }
     this->m_Root = root;
+    this->FlattenTree();
   }
 
   /** Returns the pointer to the root node. */
@@ -746,6 +796,36 @@ public:
   void
   Search(const MeasurementVectorType &, double, InstanceIdentifierVectorType &) const;
 
+  /** Searches the k-nearest neighbors of each query point. The
+   * neighbors of the i-th query point are stored in the i-th element of
+   * the result. */
+  void
+  Search(const MeasurementVectorListType &, unsigned int, InstanceIdentifierVectorListType &) const;
+
+  /** Searches the k-nearest neighbors of each query point, and returns
+   * their distances as well. */
+  void
+  Search(const MeasurementVectorListType &,
+         unsigned int,
+         InstanceIdentifierVectorListType &,
+         DistanceVectorListType &) const;
+
+  /** Searches the neighbors fallen into a hypersphere around each query
+   * point. */
+  void
+  Search(const MeasurementVectorListType &, double, InstanceIdentifierVectorListType &) const;
+
+  /** Get the multi-threader used by the batched searches. */
+  itkGetModifiableObjectMacro(MultiThreader, MultiThreaderBase);
+
+  /** Set/Get an upper bound on the distance that the measurement vectors of
+   * the sample have moved since the tree was generated. The pruning of the
+   * searches is relaxed by this distance, so that their results stay exact
+   * while the sample moves slightly, without regenerating the tree. The
+   * default is 0, for a sample that does not change. */
+  itkSetMacro(MaximumSampleDisplacement, double);
+  itkGetConstMacro(MaximumSampleDisplacement, double);
+
   /** Returns true if the intermediate k-nearest neighbors exist within
    * the the bounding box defined by the lowerBound and the
    * upperBound. Otherwise returns false. Returns false if the ball
@@ -788,6 +868,20 @@ protected:
   /** Constructor */
   KdTree();
 
+  /** Sets the bounds of a search to the whole measurement space. */
+  void
+  InitializeSearchBounds(MeasurementVectorType & lowerBound, MeasurementVectorType & upperBound) const;
+
+  /** Distance between the query point and a measurement vector of the
+   * sample. */
+  double
+  EvaluateDistance(const MeasurementVectorType & query, const MeasurementVectorType & measurement) const
+  {
+    // The metric is created by this class, so the call does not need to be
+    // dispatched dynamically.
+    return this->m_DistanceMetric->DistanceMetricType::Evaluate(query, measurement);
+  }
+
   /** Destructor: deletes the root node and the empty terminal node. */
   ~KdTree() override;
 
@@ -812,6 +906,44 @@ protected:
              InstanceIdentifierVectorType &) const;
 
 private:
+  /** A node of the flat copy of the tree. A nonterminal node is followed
+   * by its left child and stores the index of its right child; a terminal
+   * node has no right child. */
+  struct FlatNode
+  {
+    MeasurementType m_PartitionValue;
+    unsigned int    m_PartitionDimension;
+    bool            m_IsEmpty;
+    SizeValueType   m_Right;
+    SizeValueType   m_BeginInstance;
+    SizeValueType   m_EndInstance;
+  };
+
+  /** Copies the linked nodes into the flat array. The array is left empty
+   * if a nonterminal node misses a child. */
+  void
+  FlattenTree();
+
+  bool
+  FlattenNode(const KdTreeNodeType * node);
+
+  /** search loop over the flat array */
+  int
+  FlatNearestNeighborSearchLoop(SizeValueType,
+                                const MeasurementVectorType &,
+                                MeasurementVectorType &,
+                                MeasurementVectorType &,
+                                NearestNeighbors &) const;
+
+  /** search loop over the flat array */
+  int
+  FlatSearchLoop(SizeValueType,
+                 const MeasurementVectorType &,
+                 double,
+                 MeasurementVectorType &,
+                 MeasurementVectorType &,
+                 InstanceIdentifierVectorType &) const;
+
   /** Pointer to the input sample */
   const TSample * m_Sample;
 
@@ -824,11 +956,21 @@ private:
   /** Pointer to the empty terminal node */
   KdTreeNodeType * m_EmptyTerminalNode;
 
+  /** Flat copy of the tree, and the instance identifiers of its nodes */
+  std::vector<FlatNode>           m_FlatNodes;
+  std::vector<InstanceIdentifier> m_FlatInstanceIdentifiers;
+
   /** Distance metric smart pointer */
   typename DistanceMetricType::Pointer m_DistanceMetric;
 
+  /** Multi-threader used by the batched searches */
+  MultiThreaderBase::Pointer m_MultiThreader;
+
   /** Measurement vector size */
   MeasurementVectorSizeType m_MeasurementVectorSize;
+
+  /** Distance by which the sample may have moved since the tree was generated */
+  double m_MaximumSampleDisplacement;
 }; // end of class
 } // end of namespace Statistics
 } // end of namespace itk
@@ -78,10 +78,12 @@ KdTree<TSample>::KdTree()
   this->m_EmptyTerminalNode = new KdTreeTerminalNode<TSample>();
 
   this->m_DistanceMetric = DistanceMetricType::New();
+  this->m_MultiThreader = MultiThreaderBase::New();
   this->m_Sample = nullptr;
   this->m_Root = nullptr;
   this->m_BucketSize = 16;
   this->m_MeasurementVectorSize = 0;
+  this->m_MaximumSampleDisplacement = 0.0;
 }
 
 template <typename TSample>
@@ -120,6 +122,8 @@ KdTree<TSample>::PrintSelf(std::ostream & os, Indent indent) const
     os << "not set." << std::endl;
   }
   os << indent << "MeasurementVectorSize: " << this->m_MeasurementVectorSize << std::endl;
+  os << indent << "MaximumSampleDisplacement: " << this->m_MaximumSampleDisplacement << std::endl;
+  itkPrintSelfObjectMacro(MultiThreader);
 }
 
 template <typename TSample>
@@ -152,6 +156,67 @@ KdTree<TSample>::DeleteNode(KdTreeNodeType * node)
   delete node;
 }
 
+template <typename TSample>
+void
+KdTree<TSample>::FlattenTree()
+{
+  this->m_FlatNodes.clear();
+  this->m_FlatInstanceIdentifiers.clear();
+  if (this->m_Root == nullptr)
+  {
+    return;
+  }
+
+  if (!this->FlattenNode(this->m_Root))
+  {
+    this->m_FlatNodes.clear();
+    this->m_FlatInstanceIdentifiers.clear();
+  }
+  this->m_FlatNodes.shrink_to_fit();
+  this->m_FlatInstanceIdentifiers.shrink_to_fit();
+}
+
+template <typename TSample>
+bool
+KdTree<TSample>::FlattenNode(const KdTreeNodeType * node)
+{
+  const SizeValueType index = this->m_FlatNodes.size();
+  FlatNode            flatNode{};
+  flatNode.m_BeginInstance = this->m_FlatInstanceIdentifiers.size();
+
+  if (node->IsTerminal())
+  {
+    flatNode.m_IsEmpty = (node == this->m_EmptyTerminalNode);
+    if (!flatNode.m_IsEmpty)
+    {
+      for (unsigned int i = 0; i < node->Size(); ++i)
+      {
+        this->m_FlatInstanceIdentifiers.push_back(node->GetInstanceIdentifier(i));
+      }
+    }
+    flatNode.m_EndInstance = this->m_FlatInstanceIdentifiers.size();
+    this->m_FlatNodes.push_back(flatNode);
+    return true;
+  }
+
+  if (node->Left() == nullptr || node->Right() == nullptr)
+  {
+    return false;
+  }
+
+  node->GetParameters(flatNode.m_PartitionDimension, flatNode.m_PartitionValue);
+  this->m_FlatInstanceIdentifiers.push_back(node->GetInstanceIdentifier(0));
+  flatNode.m_EndInstance = this->m_FlatInstanceIdentifiers.size();
+  this->m_FlatNodes.push_back(flatNode);
+
+  if (!this->FlattenNode(node->Left()))
+  {
+    return false;
+  }
+  this->m_FlatNodes[index].m_Right = this->m_FlatNodes.size();
+  return this->FlattenNode(node->Right());
+}
+
 template <typename TSample>
 void
 KdTree<TSample>::SetSample(const TSample * sample)
@@ -204,8 +269,26 @@ KdTree<TSample>::Search(const MeasurementVectorType &  query,
   nearestNeighbors.resize(numberOfNeighborsRequested);
 
   MeasurementVectorType lowerBound;
-  NumericTraits<MeasurementVectorType>::SetLength(lowerBound, this->m_MeasurementVectorSize);
   MeasurementVectorType upperBound;
+  this->InitializeSearchBounds(lowerBound, upperBound);
+
+  if (!this->m_FlatNodes.empty())
+  {
+    this->FlatNearestNeighborSearchLoop(0, query, lowerBound, upperBound, nearestNeighbors);
+  }
+  else
+  {
+    this->NearestNeighborSearchLoop(this->m_Root, query, lowerBound, upperBound, nearestNeighbors);
+  }
+
+  result = nearestNeighbors.GetNeighbors();
+}
+
+template <typename TSample>
+void
+KdTree<TSample>::InitializeSearchBounds(MeasurementVectorType & lowerBound, MeasurementVectorType & upperBound) const
+{
+  NumericTraits<MeasurementVectorType>::SetLength(lowerBound, this->m_MeasurementVectorSize);
   NumericTraits<MeasurementVectorType>::SetLength(upperBound, this->m_MeasurementVectorSize);
 
   for (unsigned int d = 0; d < this->m_MeasurementVectorSize; ++d)
@@ -215,9 +298,116 @@ KdTree<TSample>::Search(const MeasurementVectorType &  query,
     upperBound[d] =
       static_cast<MeasurementType>(std::sqrt(static_cast<double>(NumericTraits<MeasurementType>::max()) / 2.0));
   }
-  this->NearestNeighborSearchLoop(this->m_Root, query, lowerBound, upperBound, nearestNeighbors);
+}
 
-  result = nearestNeighbors.GetNeighbors();
+template <typename TSample>
+void
+KdTree<TSample>::Search(const MeasurementVectorListType &  queries,
+                        unsigned int                       numberOfNeighborsRequested,
+                        InstanceIdentifierVectorListType & results) const
+{
+  DistanceVectorListType not_used_distances;
+  this->Search(queries, numberOfNeighborsRequested, results, not_used_distances);
+}
+
+template <typename TSample>
+void
+KdTree<TSample>::Search(const MeasurementVectorListType &  queries,
+                        unsigned int                       numberOfNeighborsRequested,
+                        InstanceIdentifierVectorListType & results,
+                        DistanceVectorListType &           distances) const
+{
+  if (numberOfNeighborsRequested > this->Size())
+  {
+    itkExceptionMacro("The numberOfNeighborsRequested for the nearest "
+                      << "neighbor search should be less than or equal to the number of "
+                      << "the measurement vectors.");
+  }
+
+  const SizeValueType numberOfQueries = queries.size();
+  results.resize(numberOfQueries);
+  distances.resize(numberOfQueries);
+  if (numberOfQueries == 0)
+  {
+    return;
+  }
+
+  // The queries are processed in chunks, so that the search bounds are
+  // allocated once per chunk rather than once per query.
+  const SizeValueType numberOfChunks =
+    std::min(numberOfQueries, static_cast<SizeValueType>(4 * this->m_MultiThreader->GetNumberOfWorkUnits()));
+
+  this->m_MultiThreader->ParallelizeArray(
+    0,
+    numberOfChunks,
+    [this, &queries, &results, &distances, numberOfQueries, numberOfChunks, numberOfNeighborsRequested](
+      SizeValueType chunk) {
+      MeasurementVectorType lowerBound;
+      MeasurementVectorType upperBound;
+
+      const SizeValueType first = chunk * numberOfQueries / numberOfChunks;
+      const SizeValueType last = (chunk + 1) * numberOfQueries / numberOfChunks;
+      for (SizeValueType q = first; q < last; ++q)
+      {
+        NearestNeighbors nearestNeighbors(distances[q]);
+        nearestNeighbors.resize(numberOfNeighborsRequested);
+
+        this->InitializeSearchBounds(lowerBound, upperBound);
+        if (!this->m_FlatNodes.empty())
+        {
+          this->FlatNearestNeighborSearchLoop(0, queries[q], lowerBound, upperBound, nearestNeighbors);
+        }
+        else
+        {
+          this->NearestNeighborSearchLoop(this->m_Root, queries[q], lowerBound, upperBound, nearestNeighbors);
+        }
+
+        results[q] = nearestNeighbors.GetNeighbors();
+      }
+    },
+    nullptr);
+}
+
+template <typename TSample>
+void
+KdTree<TSample>::Search(const MeasurementVectorListType &  queries,
+                        double                             radius,
+                        InstanceIdentifierVectorListType & results) const
+{
+  const SizeValueType numberOfQueries = queries.size();
+  results.resize(numberOfQueries);
+  if (numberOfQueries == 0)
+  {
+    return;
+  }
+
+  const SizeValueType numberOfChunks =
+    std::min(numberOfQueries, static_cast<SizeValueType>(4 * this->m_MultiThreader->GetNumberOfWorkUnits()));
+
+  this->m_MultiThreader->ParallelizeArray(
+    0,
+    numberOfChunks,
+    [this, &queries, &results, numberOfQueries, numberOfChunks, radius](SizeValueType chunk) {
+      MeasurementVectorType lowerBound;
+      MeasurementVectorType upperBound;
+
+      const SizeValueType first = chunk * numberOfQueries / numberOfChunks;
+      const SizeValueType last = (chunk + 1) * numberOfQueries / numberOfChunks;
+      for (SizeValueType q = first; q < last; ++q)
+      {
+        results[q].clear();
+        this->InitializeSearchBounds(lowerBound, upperBound);
+        if (!this->m_FlatNodes.empty())
+        {
+          this->FlatSearchLoop(0, queries[q], radius, lowerBound, upperBound, results[q]);
+        }
+        else
+        {
+          this->SearchLoop(this->m_Root, queries[q], radius, lowerBound, upperBound, results[q]);
+        }
+      }
+    },
+    nullptr);
 }
 
 template <typename TSample>
@@ -244,14 +434,15 @@ KdTree<TSample>::NearestNeighborSearchLoop(const KdTreeNodeType *        node,
     for (i = 0; i < node->Size(); ++i)
     {
       tempId = node->GetInstanceIdentifier(i);
-      tempDistance = this->m_DistanceMetric->Evaluate(query, this->m_Sample->GetMeasurementVector(tempId));
+      tempDistance = this->EvaluateDistance(query, this->m_Sample->GetMeasurementVector(tempId));
       if (tempDistance < nearestNeighbors.GetLargestDistance())
       {
         nearestNeighbors.ReplaceFarthestNeighbor(tempId, tempDistance);
       }
     }
 
-    if (this->BallWithinBounds(query, lowerBound, upperBound, nearestNeighbors.GetLargestDistance()))
+    if (this->BallWithinBounds(
+          query, lowerBound, upperBound, nearestNeighbors.GetLargestDistance() + this->m_MaximumSampleDisplacement))
     {
       return 1;
     }
@@ -269,7 +460,7 @@ KdTree<TSample>::NearestNeighborSearchLoop(const KdTreeNodeType *        node,
   // and potentially add it to the list of nearest neighbors
   //
   tempId = node->GetInstanceIdentifier(0);
-  tempDistance = this->m_DistanceMetric->Evaluate(query, this->m_Sample->GetMeasurementVector(tempId));
+  tempDistance = this->EvaluateDistance(query, this->m_Sample->GetMeasurementVector(tempId));
   if (tempDistance < nearestNeighbors.GetLargestDistance())
   {
     nearestNeighbors.ReplaceFarthestNeighbor(tempId, tempDistance);
@@ -292,7 +483,8 @@ KdTree<TSample>::NearestNeighborSearchLoop(const KdTreeNodeType *        node,
     // search the other node, if necessary
     tempValue = lowerBound[partitionDimension];
     lowerBound[partitionDimension] = partitionValue;
-    if (this->BoundsOverlapBall(query, lowerBound, upperBound, nearestNeighbors.GetLargestDistance()))
+    if (this->BoundsOverlapBall(
+          query, lowerBound, upperBound, nearestNeighbors.GetLargestDistance() + this->m_MaximumSampleDisplacement))
     {
       this->NearestNeighborSearchLoop(node->Right(), query, lowerBound, upperBound, nearestNeighbors);
     }
@@ -312,7 +504,8 @@ KdTree<TSample>::NearestNeighborSearchLoop(const KdTreeNodeType *        node,
     // search the other node, if necessary
     tempValue = upperBound[partitionDimension];
     upperBound[partitionDimension] = partitionValue;
-    if (this->BoundsOverlapBall(query, lowerBound, upperBound, nearestNeighbors.GetLargestDistance()))
+    if (this->BoundsOverlapBall(
+          query, lowerBound, upperBound, nearestNeighbors.GetLargestDistance() + this->m_MaximumSampleDisplacement))
     {
       this->NearestNeighborSearchLoop(node->Left(), query, lowerBound, upperBound, nearestNeighbors);
     }
@@ -320,7 +513,8 @@ KdTree<TSample>::NearestNeighborSearchLoop(const KdTreeNodeType *        node,
   }
 
   // stop or continue search
-  if (this->BallWithinBounds(query, lowerBound, upperBound, nearestNeighbors.GetLargestDistance()))
+  if (this->BallWithinBounds(
+        query, lowerBound, upperBound, nearestNeighbors.GetLargestDistance() + this->m_MaximumSampleDisplacement))
   {
     return 1;
   }
@@ -334,20 +528,17 @@ KdTree<TSample>::Search(const MeasurementVectorType & query, double radius, Inst
 {
   MeasurementVectorType lowerBound;
   MeasurementVectorType upperBound;
+  this->InitializeSearchBounds(lowerBound, upperBound);
 
-  NumericTraits<MeasurementVectorType>::SetLength(lowerBound, this->m_MeasurementVectorSize);
-  NumericTraits<MeasurementVectorType>::SetLength(upperBound, this->m_MeasurementVectorSize);
-
-  for (unsigned int d = 0; d < this->m_MeasurementVectorSize; ++d)
+  result.clear();
+  if (!this->m_FlatNodes.empty())
   {
-    lowerBound[d] = static_cast<MeasurementType>(
-      -std::sqrt(-static_cast<double>(NumericTraits<MeasurementType>::NonpositiveMin())) / 2.0);
-    upperBound[d] =
-      static_cast<MeasurementType>(std::sqrt(static_cast<double>(NumericTraits<MeasurementType>::max()) / 2.0));
+    this->FlatSearchLoop(0, query, radius, lowerBound, upperBound, result);
+  }
+  else
+  {
+    this->SearchLoop(this->m_Root, query, radius, lowerBound, upperBound, result);
   }
-
-  result.clear();
-  this->SearchLoop(this->m_Root, query, radius, lowerBound, upperBound, result);
 }
 
 template <typename TSample>
@@ -374,14 +565,14 @@ KdTree<TSample>::SearchLoop(const KdTreeNodeType *         node,
     for (unsigned int i = 0; i < node->Size(); ++i)
     {
       tempId = node->GetInstanceIdentifier(i);
-      tempDistance = this->m_DistanceMetric->Evaluate(query, this->m_Sample->GetMeasurementVector(tempId));
+      tempDistance = this->EvaluateDistance(query, this->m_Sample->GetMeasurementVector(tempId));
       if (tempDistance <= radius)
       {
         neighbors.push_back(tempId);
       }
     }
 
-    if (this->BallWithinBounds(query, lowerBound, upperBound, radius))
+    if (this->BallWithinBounds(query, lowerBound, upperBound, radius + this->m_MaximumSampleDisplacement))
     {
       return 1;
     }
@@ -391,7 +582,7 @@ KdTree<TSample>::SearchLoop(const KdTreeNodeType *         node,
   if (node->IsTerminal() == false)
   {
     tempId = node->GetInstanceIdentifier(0);
-    tempDistance = this->m_DistanceMetric->Evaluate(query, this->m_Sample->GetMeasurementVector(tempId));
+    tempDistance = this->EvaluateDistance(query, this->m_Sample->GetMeasurementVector(tempId));
     if (tempDistance <= radius)
     {
       neighbors.push_back(tempId);
@@ -417,7 +608,7 @@ KdTree<TSample>::SearchLoop(const KdTreeNodeType *         node,
     // search the other node, if necessary
     tempValue = lowerBound[partitionDimension];
     lowerBound[partitionDimension] = partitionValue;
-    if (this->BoundsOverlapBall(query, lowerBound, upperBound, radius))
+    if (this->BoundsOverlapBall(query, lowerBound, upperBound, radius + this->m_MaximumSampleDisplacement))
     {
       this->SearchLoop(node->Right(), query, radius, lowerBound, upperBound, neighbors);
     }
@@ -437,7 +628,7 @@ KdTree<TSample>::SearchLoop(const KdTreeNodeType *         node,
     // search the other node, if necessary
     tempValue = upperBound[partitionDimension];
     upperBound[partitionDimension] = partitionValue;
-    if (this->BoundsOverlapBall(query, lowerBound, upperBound, radius))
+    if (this->BoundsOverlapBall(query, lowerBound, upperBound, radius + this->m_MaximumSampleDisplacement))
     {
       this->SearchLoop(node->Left(), query, radius, lowerBound, upperBound, neighbors);
     }
@@ -445,7 +636,219 @@ KdTree<TSample>::SearchLoop(const KdTreeNodeType *         node,
   }
 
   // stop or continue search
-  if (this->BallWithinBounds(query, lowerBound, upperBound, radius))
+  if (this->BallWithinBounds(query, lowerBound, upperBound, radius + this->m_MaximumSampleDisplacement))
+  {
+    return 1;
+  }
+
+  return 0;
+}
+
+template <typename TSample>
+inline int
+KdTree<TSample>::FlatNearestNeighborSearchLoop(SizeValueType                 nodeIndex,
+                                               const MeasurementVectorType & query,
+                                               MeasurementVectorType &       lowerBound,
+                                               MeasurementVectorType &       upperBound,
+                                               NearestNeighbors &            nearestNeighbors) const
+{
+  const FlatNode & node = this->m_FlatNodes[nodeIndex];
+  InstanceIdentifier tempId;
+  double             tempDistance;
+
+  if (node.m_Right == 0)
+  {
+    // terminal node
+    if (node.m_IsEmpty)
+    {
+      // empty node
+      return 0;
+    }
+
+    for (SizeValueType i = node.m_BeginInstance; i < node.m_EndInstance; ++i)
+    {
+      tempId = this->m_FlatInstanceIdentifiers[i];
+      tempDistance = this->EvaluateDistance(query, this->m_Sample->GetMeasurementVector(tempId));
+      if (tempDistance < nearestNeighbors.GetLargestDistance())
+      {
+        nearestNeighbors.ReplaceFarthestNeighbor(tempId, tempDistance);
+      }
+    }
+
+    if (this->BallWithinBounds(
+          query, lowerBound, upperBound, nearestNeighbors.GetLargestDistance() + this->m_MaximumSampleDisplacement))
+    {
+      return 1;
+    }
+
+    return 0;
+  }
+
+  const unsigned int    partitionDimension = node.m_PartitionDimension;
+  const MeasurementType partitionValue = node.m_PartitionValue;
+  MeasurementType       tempValue;
+
+  //
+  // Check the point associated with the nonterminal node
+  // and potentially add it to the list of nearest neighbors
+  //
+  tempId = this->m_FlatInstanceIdentifiers[node.m_BeginInstance];
+  tempDistance = this->EvaluateDistance(query, this->m_Sample->GetMeasurementVector(tempId));
+  if (tempDistance < nearestNeighbors.GetLargestDistance())
+  {
+    nearestNeighbors.ReplaceFarthestNeighbor(tempId, tempDistance);
+  }
+
+  //
+  // Now check both child sub-trees
+  //
+  if (query[partitionDimension] <= partitionValue)
+  {
+    // search the closer child node
+    tempValue = upperBound[partitionDimension];
+    upperBound[partitionDimension] = partitionValue;
+    if (this->FlatNearestNeighborSearchLoop(nodeIndex + 1, query, lowerBound, upperBound, nearestNeighbors))
+    {
+      return 1;
+    }
+    upperBound[partitionDimension] = tempValue;
+
+    // search the other node, if necessary
+    tempValue = lowerBound[partitionDimension];
+    lowerBound[partitionDimension] = partitionValue;
+    if (this->BoundsOverlapBall(
+          query, lowerBound, upperBound, nearestNeighbors.GetLargestDistance() + this->m_MaximumSampleDisplacement))
+    {
+      this->FlatNearestNeighborSearchLoop(node.m_Right, query, lowerBound, upperBound, nearestNeighbors);
+    }
+    lowerBound[partitionDimension] = tempValue;
+  }
+  else
+  {
+    // search the closer child node
+    tempValue = lowerBound[partitionDimension];
+    lowerBound[partitionDimension] = partitionValue;
+    if (this->FlatNearestNeighborSearchLoop(node.m_Right, query, lowerBound, upperBound, nearestNeighbors))
+    {
+      return 1;
+    }
+    lowerBound[partitionDimension] = tempValue;
+
+    // search the other node, if necessary
+    tempValue = upperBound[partitionDimension];
+    upperBound[partitionDimension] = partitionValue;
+    if (this->BoundsOverlapBall(
+          query, lowerBound, upperBound, nearestNeighbors.GetLargestDistance() + this->m_MaximumSampleDisplacement))
+    {
+      this->FlatNearestNeighborSearchLoop(nodeIndex + 1, query, lowerBound, upperBound, nearestNeighbors);
+    }
+    upperBound[partitionDimension] = tempValue;
+  }
+
+  // stop or continue search
+  if (this->BallWithinBounds(
+        query, lowerBound, upperBound, nearestNeighbors.GetLargestDistance() + this->m_MaximumSampleDisplacement))
+  {
+    return 1;
+  }
+
+  return 0;
+}
+
+template <typename TSample>
+inline int
+KdTree<TSample>::FlatSearchLoop(SizeValueType                  nodeIndex,
+                                const MeasurementVectorType &  query,
+                                double                         radius,
+                                MeasurementVectorType &        lowerBound,
+                                MeasurementVectorType &        upperBound,
+                                InstanceIdentifierVectorType & neighbors) const
+{
+  const FlatNode & node = this->m_FlatNodes[nodeIndex];
+  InstanceIdentifier tempId;
+  double             tempDistance;
+
+  if (node.m_Right == 0)
+  {
+    // terminal node
+    if (node.m_IsEmpty)
+    {
+      // empty node
+      return 0;
+    }
+
+    for (SizeValueType i = node.m_BeginInstance; i < node.m_EndInstance; ++i)
+    {
+      tempId = this->m_FlatInstanceIdentifiers[i];
+      tempDistance = this->EvaluateDistance(query, this->m_Sample->GetMeasurementVector(tempId));
+      if (tempDistance <= radius)
+      {
+        neighbors.push_back(tempId);
+      }
+    }
+
+    if (this->BallWithinBounds(query, lowerBound, upperBound, radius + this->m_MaximumSampleDisplacement))
+    {
+      return 1;
+    }
+
+    return 0;
+  }
+
+  tempId = this->m_FlatInstanceIdentifiers[node.m_BeginInstance];
+  tempDistance = this->EvaluateDistance(query, this->m_Sample->GetMeasurementVector(tempId));
+  if (tempDistance <= radius)
+  {
+    neighbors.push_back(tempId);
+  }
+
+  const unsigned int    partitionDimension = node.m_PartitionDimension;
+  const MeasurementType partitionValue = node.m_PartitionValue;
+  MeasurementType       tempValue;
+
+  if (query[partitionDimension] <= partitionValue)
+  {
+    // search the closer child node
+    tempValue = upperBound[partitionDimension];
+    upperBound[partitionDimension] = partitionValue;
+    if (this->FlatSearchLoop(nodeIndex + 1, query, radius, lowerBound, upperBound, neighbors))
+    {
+      return 1;
+    }
+    upperBound[partitionDimension] = tempValue;
+
+    // search the other node, if necessary
+    tempValue = lowerBound[partitionDimension];
+    lowerBound[partitionDimension] = partitionValue;
+    if (this->BoundsOverlapBall(query, lowerBound, upperBound, radius + this->m_MaximumSampleDisplacement))
+    {
+      this->FlatSearchLoop(node.m_Right, query, radius, lowerBound, upperBound, neighbors);
+    }
+    lowerBound[partitionDimension] = tempValue;
+  }
+  else
+  {
+    // search the closer child node
+    tempValue = lowerBound[partitionDimension];
+    lowerBound[partitionDimension] = partitionValue;
+    if (this->FlatSearchLoop(node.m_Right, query, radius, lowerBound, upperBound, neighbors))
+    {
+      return 1;
+    }
+    lowerBound[partitionDimension] = tempValue;
+
+    // search the other node, if necessary
+    tempValue = upperBound[partitionDimension];
+    upperBound[partitionDimension] = partitionValue;
+    if (this->BoundsOverlapBall(query, lowerBound, upperBound, radius + this->m_MaximumSampleDisplacement))
+    {
+      this->FlatSearchLoop(nodeIndex + 1, query, radius, lowerBound, upperBound, neighbors);
+    }
+    upperBound[partitionDimension] = tempValue;
+  }
+
+  // stop or continue search
+  if (this->BallWithinBounds(query, lowerBound, upperBound, radius + this->m_MaximumSampleDisplacement))
   {
     return 1;
   }
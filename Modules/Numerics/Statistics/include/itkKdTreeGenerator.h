@@ -18,6 +18,8 @@
 #ifndef itkKdTreeGenerator_h
 #define itkKdTreeGenerator_h
 
+#include <algorithm>
+#include <unordered_map>
 #include <vector>
 
 #include "itkKdTree.h"
@@ -52,6 +54,20 @@ namespace Statistics
  * Update method will run this generator. To get the resulting KdTree
  * object, call the GetOutput method.
  *
+ * The subtrees below the first levels of the tree can be generated in
+ * parallel by setting the number of work units above one with
+ * SetNumberOfWorkUnits(). The first levels are partitioned by a single
+ * thread, then each remaining subtree is generated from its own copy of
+ * the instance identifiers of its partition, so the tree is the same as
+ * the one generated by a single thread. The input sample must then support
+ * concurrent calls to GetMeasurementVector(), which is the case of
+ * ListSample but not of the image adaptors that cache the last measurement
+ * vector. The subtrees are generated by generators created with
+ * CreateAnother(), so subclasses which keep state in their node generation
+ * routine, or which do not define their own New(), must override
+ * CanGenerateSubtreesInParallel() to return false. The default is one work
+ * unit.
+ *
  * <b>Recent API changes:</b>
  * The static const macro to get the length of a measurement vector,
  * 'MeasurementVectorSize'  has been removed to allow the length of a measurement
@@ -141,6 +157,11 @@ public:
    * held in the 'sample' that is passed to this class */
   itkGetConstMacro(MeasurementVectorSize, unsigned int);
 
+  /** Set/Get the number of work units used to generate the subtrees in
+   * parallel. The default is 1. */
+  itkSetClampMacro(NumberOfWorkUnits, ThreadIdType, 1, ITK_MAX_THREADS);
+  itkGetConstMacro(NumberOfWorkUnits, ThreadIdType);
+
 protected:
   /** Constructor */
   KdTreeGenerator();
@@ -174,7 +195,36 @@ protected:
                    MeasurementVectorType & upperBound,
                    unsigned int            level);
 
+  /** Returns true if the subtrees may be generated in parallel by
+   * generators created with CreateAnother(). Subclasses for which these
+   * generators do not build the same subtrees override it to return false. */
+  virtual bool
+  CanGenerateSubtreesInParallel() const
+  {
+    return true;
+  }
+
 private:
+  /** A subtree whose generation is deferred to the parallel phase. */
+  struct SubtreeTask
+  {
+    Pointer               m_Generator;
+    MeasurementVectorType m_LowerBound;
+    MeasurementVectorType m_UpperBound;
+    unsigned int          m_Level;
+    KdTreeNodeType *      m_Placeholder;
+    KdTreeNodeType *      m_Root;
+  };
+
+  /** Generates the tree from several threads. */
+  KdTreeNodeType *
+  GenerateTreeInParallel(MeasurementVectorType & lowerBound, MeasurementVectorType & upperBound);
+
+  /** Replaces the placeholders of the deferred subtrees below node by the
+   * subtrees. */
+  void
+  LinkSubtrees(KdTreeNodeType * node, const std::unordered_map<const KdTreeNodeType *, KdTreeNodeType *> & subtrees);
+
   /** Pointer to the input (source) sample */
   TSample * m_SourceSample;
 
@@ -201,6 +251,15 @@ private:
 
   /** Length of a measurement vector */
   MeasurementVectorSizeType m_MeasurementVectorSize;
+
+  /** Number of work units used to generate the subtrees */
+  ThreadIdType m_NumberOfWorkUnits{ 1 };
+
+  /** Subtrees deferred to the parallel phase, and the largest number of
+   * instances of a deferred subtree. Only set while the first levels of
+   * the tree are generated. */
+  std::vector<SubtreeTask> * m_SubtreeTasks{ nullptr };
+  unsigned int               m_MaximumSubtreeTaskSize{ 0 };
 }; // end of class
 } // end of namespace Statistics
 } // end of namespace itk
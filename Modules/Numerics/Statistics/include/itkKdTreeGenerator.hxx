@@ -18,6 +18,7 @@
 #ifndef itkKdTreeGenerator_hxx
 #define itkKdTreeGenerator_hxx
 
+#include "itkMultiThreaderBase.h"
 
 namespace itk
 {
@@ -50,6 +51,7 @@ KdTreeGenerator<TSample>::PrintSelf(std::ostream & os, Indent indent) const
 
   os << indent << "Bucket Size: " << m_BucketSize << std::endl;
   os << indent << "MeasurementVectorSize: " << m_MeasurementVectorSize << std::endl;
+  os << indent << "NumberOfWorkUnits: " << m_NumberOfWorkUnits << std::endl;
 }
 
 template <typename TSample>
@@ -108,10 +110,123 @@ KdTreeGenerator<TSample>::GenerateData()
     upperBound[d] = NumericTraits<MeasurementType>::max();
   }
 
-  KdTreeNodeType * root = this->GenerateTreeLoop(0, m_Subsample->Size(), lowerBound, upperBound, 0);
+  KdTreeNodeType * root = nullptr;
+  if (m_NumberOfWorkUnits > 1 && this->CanGenerateSubtreesInParallel())
+  {
+    root = this->GenerateTreeInParallel(lowerBound, upperBound);
+  }
+  else
+  {
+    root = this->GenerateTreeLoop(0, m_Subsample->Size(), lowerBound, upperBound, 0);
+  }
   m_Tree->SetRoot(root);
 }
 
+template <typename TSample>
+typename KdTreeGenerator<TSample>::KdTreeNodeType *
+KdTreeGenerator<TSample>::GenerateTreeInParallel(MeasurementVectorType & lowerBound, MeasurementVectorType & upperBound)
+{
+  const unsigned int numberOfInstances = m_Subsample->Size();
+
+  // Subtrees of up to a quarter of the instances of a work unit are
+  // generated in parallel. Below that size, the partitions of the first
+  // levels are cheap compared to the subtrees.
+  m_MaximumSubtreeTaskSize = std::max(numberOfInstances / (4 * m_NumberOfWorkUnits), 1024u);
+  if (numberOfInstances <= m_MaximumSubtreeTaskSize)
+  {
+    return this->GenerateTreeLoop(0, numberOfInstances, lowerBound, upperBound, 0);
+  }
+
+  // Generate the first levels, deferring the subtrees.
+  std::vector<SubtreeTask> tasks;
+  m_SubtreeTasks = &tasks;
+  KdTreeNodeType * root = nullptr;
+  try
+  {
+    root = this->GenerateTreeLoop(0, numberOfInstances, lowerBound, upperBound, 0);
+  }
+  catch (...)
+  {
+    m_SubtreeTasks = nullptr;
+    throw;
+  }
+  m_SubtreeTasks = nullptr;
+
+  // Generate the subtrees. Each generator partitions its own subsample.
+  auto multiThreader = MultiThreaderBase::New();
+  multiThreader->SetNumberOfWorkUnits(m_NumberOfWorkUnits);
+  multiThreader->ParallelizeArray(
+    0,
+    tasks.size(),
+    [&tasks](SizeValueType t) {
+      SubtreeTask & task = tasks[t];
+      task.m_Root = task.m_Generator->GenerateTreeLoop(
+        0, task.m_Generator->m_Subsample->Size(), task.m_LowerBound, task.m_UpperBound, task.m_Level);
+    },
+    nullptr);
+
+  // Replace the placeholders by the subtrees.
+  std::unordered_map<const KdTreeNodeType *, KdTreeNodeType *> subtrees;
+  for (SubtreeTask & task : tasks)
+  {
+    subtrees[task.m_Placeholder] = task.m_Root;
+  }
+  this->LinkSubtrees(root, subtrees);
+  for (SubtreeTask & task : tasks)
+  {
+    delete task.m_Placeholder;
+  }
+  return root;
+}
+
+template <typename TSample>
+void
+KdTreeGenerator<TSample>::LinkSubtrees(
+  KdTreeNodeType *                                                     node,
+  const std::unordered_map<const KdTreeNodeType *, KdTreeNodeType *> & subtrees)
+{
+  if (node->IsTerminal())
+  {
+    return;
+  }
+
+  KdTreeNodeType * left = node->Left();
+  KdTreeNodeType * right = node->Right();
+  const auto       leftSubtree = subtrees.find(left);
+  const auto       rightSubtree = subtrees.find(right);
+  if (leftSubtree != subtrees.end() || rightSubtree != subtrees.end())
+  {
+    if (leftSubtree != subtrees.end())
+    {
+      left = leftSubtree->second;
+    }
+    if (rightSubtree != subtrees.end())
+    {
+      right = rightSubtree->second;
+    }
+    if (auto * centroidNode = dynamic_cast<KdTreeWeightedCentroidNonterminalNode<TSample> *>(node))
+    {
+      centroidNode->SetLeft(left);
+      centroidNode->SetRight(right);
+    }
+    else
+    {
+      auto * nonterminalNode = dynamic_cast<KdTreeNonterminalNode<TSample> *>(node);
+      nonterminalNode->SetLeft(left);
+      nonterminalNode->SetRight(right);
+    }
+  }
+
+  if (leftSubtree == subtrees.end())
+  {
+    this->LinkSubtrees(left, subtrees);
+  }
+  if (rightSubtree == subtrees.end())
+  {
+    this->LinkSubtrees(right, subtrees);
+  }
+}
+
 template <typename TSample>
 inline typename KdTreeGenerator<TSample>::KdTreeNodeType *
 KdTreeGenerator<TSample>::GenerateNonterminalNode(unsigned int            beginIndex,
@@ -212,6 +327,33 @@ KdTreeGenerator<TSample>::GenerateTreeLoop(unsigned int            beginIndex,
       return ptr;
     }
   }
+  else if (m_SubtreeTasks != nullptr && endIndex - beginIndex <= m_MaximumSubtreeTaskSize)
+  {
+    // defer the subtree to a generator of its own, that partitions a copy of
+    // the instance identifiers of the range
+    typename LightObject::Pointer another = this->CreateAnother();
+    SubtreeTask                   task;
+    task.m_Generator = dynamic_cast<Self *>(another.GetPointer());
+    task.m_Generator->m_SourceSample = m_SourceSample;
+    task.m_Generator->m_BucketSize = m_BucketSize;
+    task.m_Generator->m_Tree = m_Tree;
+    task.m_Generator->m_MeasurementVectorSize = m_MeasurementVectorSize;
+    NumericTraits<MeasurementVectorType>::SetLength(task.m_Generator->m_TempLowerBound, m_MeasurementVectorSize);
+    NumericTraits<MeasurementVectorType>::SetLength(task.m_Generator->m_TempUpperBound, m_MeasurementVectorSize);
+    NumericTraits<MeasurementVectorType>::SetLength(task.m_Generator->m_TempMean, m_MeasurementVectorSize);
+    task.m_Generator->m_Subsample->SetSample(m_Subsample->GetSample());
+    for (unsigned int j = beginIndex; j < endIndex; ++j)
+    {
+      task.m_Generator->m_Subsample->AddInstance(m_Subsample->GetInstanceIdentifier(j));
+    }
+    task.m_LowerBound = lowerBound;
+    task.m_UpperBound = upperBound;
+    task.m_Level = level;
+    task.m_Placeholder = new KdTreeTerminalNode<TSample>();
+    task.m_Root = nullptr;
+    m_SubtreeTasks->push_back(task);
+    return task.m_Placeholder;
+  }
   else
   {
     return this->GenerateNonterminalNode(beginIndex, endIndex, lowerBound, upperBound, level + 1);
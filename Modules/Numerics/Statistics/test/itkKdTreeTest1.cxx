@@ -20,8 +20,11 @@
 #include "itkMersenneTwisterRandomVariateGenerator.h"
 #include "itkListSample.h"
 #include "itkKdTreeGenerator.h"
+#include "itkWeightedCentroidKdTreeGenerator.h"
 #include "itkTestingMacros.h"
+#include <algorithm>
 #include <fstream>
+#include <sstream>
 
 int
 itkKdTreeTest1(int argc, char * argv[])
@@ -192,6 +195,114 @@ itkKdTreeTest1(int argc, char * argv[])
   }
 
 
+  unsigned int numberOfFailedPoints3 = 0;
+
+  //
+  // Check that batched searches return the same neighbors as the
+  // single-query searches
+  //
+  TreeType::MeasurementVectorListType queryPoints;
+  for (unsigned int j = 0; j < numberOfTestPoints; ++j)
+  {
+    queryPoint[0] = randomNumberGenerator->GetNormalVariate(0.0, 1.0);
+    queryPoint[1] = randomNumberGenerator->GetNormalVariate(0.0, 1.0);
+    queryPoints.push_back(queryPoint);
+  }
+
+  const unsigned int batchNumberOfNeighbors = std::min(3u, numberOfDataPoints);
+  const double       radius = 0.5;
+
+  TreeType::InstanceIdentifierVectorListType batchNeighbors;
+  TreeType::DistanceVectorListType           batchDistances;
+  TreeType::InstanceIdentifierVectorListType batchRadiusNeighbors;
+  tree->Search(queryPoints, batchNumberOfNeighbors, batchNeighbors, batchDistances);
+  tree->Search(queryPoints, radius, batchRadiusNeighbors);
+
+  ITK_TEST_EXPECT_EQUAL(batchNeighbors.size(), queryPoints.size());
+  ITK_TEST_EXPECT_EQUAL(batchDistances.size(), queryPoints.size());
+  ITK_TEST_EXPECT_EQUAL(batchRadiusNeighbors.size(), queryPoints.size());
+
+  for (unsigned int j = 0; j < queryPoints.size(); ++j)
+  {
+    std::vector<double> searchDistance;
+    tree->Search(queryPoints[j], batchNumberOfNeighbors, neighbors, searchDistance);
+    if (neighbors != batchNeighbors[j] || searchDistance != batchDistances[j])
+    {
+      std::cerr << "Batched k-nearest neighbor search differs for query point " << queryPoints[j] << std::endl;
+      numberOfFailedPoints3++;
+    }
+
+    tree->Search(queryPoints[j], radius, neighbors);
+    if (neighbors != batchRadiusNeighbors[j])
+    {
+      std::cerr << "Batched radius search differs for query point " << queryPoints[j] << std::endl;
+      numberOfFailedPoints3++;
+    }
+  }
+
+  ITK_TRY_EXPECT_EXCEPTION(tree->Search(queryPoints, numberOfDataPoints + 1, batchNeighbors));
+
+
+  unsigned int numberOfFailedTrees = 0;
+
+  //
+  // Check that the trees generated in parallel are the same as the trees
+  // generated by a single thread, and return the same neighbors
+  //
+  std::ostringstream serialTree;
+  tree->PrintTree(serialTree);
+
+  auto parallelTreeGenerator = TreeGeneratorType::New();
+  parallelTreeGenerator->SetSample(sample);
+  parallelTreeGenerator->SetBucketSize(bucketSize);
+  parallelTreeGenerator->SetNumberOfWorkUnits(4);
+  ITK_TEST_SET_GET_VALUE(4, parallelTreeGenerator->GetNumberOfWorkUnits());
+  parallelTreeGenerator->Update();
+
+  TreeType::Pointer  parallelTree = parallelTreeGenerator->GetOutput();
+  std::ostringstream parallelTreeOutput;
+  parallelTree->PrintTree(parallelTreeOutput);
+  if (parallelTreeOutput.str() != serialTree.str())
+  {
+    std::cerr << "The tree generated in parallel differs from the tree generated by a single thread." << std::endl;
+    numberOfFailedTrees++;
+  }
+
+  TreeType::InstanceIdentifierVectorListType parallelNeighbors;
+  TreeType::DistanceVectorListType           parallelDistances;
+  TreeType::InstanceIdentifierVectorListType parallelRadiusNeighbors;
+  parallelTree->Search(queryPoints, batchNumberOfNeighbors, parallelNeighbors, parallelDistances);
+  parallelTree->Search(queryPoints, radius, parallelRadiusNeighbors);
+  if (parallelNeighbors != batchNeighbors || parallelDistances != batchDistances ||
+      parallelRadiusNeighbors != batchRadiusNeighbors)
+  {
+    std::cerr << "The tree generated in parallel returns different neighbors." << std::endl;
+    numberOfFailedTrees++;
+  }
+
+  using CentroidTreeGeneratorType = itk::Statistics::WeightedCentroidKdTreeGenerator<SampleType>;
+  auto centroidTreeGenerator = CentroidTreeGeneratorType::New();
+  centroidTreeGenerator->SetSample(sample);
+  centroidTreeGenerator->SetBucketSize(bucketSize);
+  centroidTreeGenerator->Update();
+  std::ostringstream serialCentroidTree;
+  centroidTreeGenerator->GetOutput()->PrintTree(serialCentroidTree);
+
+  auto parallelCentroidTreeGenerator = CentroidTreeGeneratorType::New();
+  parallelCentroidTreeGenerator->SetSample(sample);
+  parallelCentroidTreeGenerator->SetBucketSize(bucketSize);
+  parallelCentroidTreeGenerator->SetNumberOfWorkUnits(4);
+  parallelCentroidTreeGenerator->Update();
+  std::ostringstream parallelCentroidTree;
+  parallelCentroidTreeGenerator->GetOutput()->PrintTree(parallelCentroidTree);
+  if (parallelCentroidTree.str() != serialCentroidTree.str())
+  {
+    std::cerr << "The weighted centroid tree generated in parallel differs from the tree generated by a single thread."
+              << std::endl;
+    numberOfFailedTrees++;
+  }
+
+
   if (argc > 4)
   {
     //
@@ -217,7 +328,19 @@ itkKdTreeTest1(int argc, char * argv[])
   }
 
 
-  if (numberOfFailedPoints1 || numberOfFailedPoints2)
+  if (numberOfFailedPoints3)
+  {
+    std::cerr << numberOfFailedPoints3 << " batched searches failed to match the single-query searches." << std::endl;
+  }
+
+
+  if (numberOfFailedTrees)
+  {
+    std::cerr << numberOfFailedTrees << " trees generated in parallel failed to match the serial trees." << std::endl;
+  }
+
+
+  if (numberOfFailedPoints1 || numberOfFailedPoints2 || numberOfFailedPoints3 || numberOfFailedTrees)
   {
     return EXIT_FAILURE;
   }
@@ -27,6 +27,8 @@
 #include "itkVectorContainer.h"
 #include "itkVectorContainerToListSampleAdaptor.h"
 
+#include <vector>
+
 namespace itk
 {
 
@@ -36,6 +38,12 @@ namespace itk
  * This class accelerates the search for the closest point to a user-provided
  * point, by using constructing a Kd-Tree structure for the PointSetContainer.
  *
+ * When the points move between calls to Initialize(), as the transformed
+ * points of a registration metric do, the Kd-Tree can be kept as long as no
+ * point moved farther than the RebuildTolerance from where it was when the
+ * tree was built. The searches then account for the displacement of the
+ * points and still return exact results.
+ *
  * \ingroup ITKRegistrationCommon
  */
 template <typename TPointsContainer = VectorContainer<IdentifierType, Point<float, 3>>>
@@ -81,12 +89,26 @@ public:
   using TreeConstPointer = typename TreeType::ConstPointer;
   using NeighborsIdentifierType = typename TreeType::InstanceIdentifierVectorType;
 
+  /** Types of the batched searches: the query points, the closest point of
+   * each of them, and their neighbors. */
+  using PointListType = std::vector<PointType>;
+  using PointIdentifierListType = std::vector<PointIdentifier>;
+  using NeighborsIdentifierListType = typename TreeType::InstanceIdentifierVectorListType;
+
   /** Set/Get the points from which the bounding box should be computed. */
   itkSetObjectMacro(Points, PointsContainer);
 
   /** Set/Get the points from which the bounding box should be computed. */
   itkGetModifiableObjectMacro(Points, PointsContainer);
 
+  /** Set/Get the largest displacement of the points for which Initialize()
+   * keeps the current kd-tree instead of building a new one. The searches
+   * widen their pruning by the actual displacement, so the tolerance should
+   * stay small compared to the distance between neighboring points. The
+   * default is 0, which builds a new kd-tree at every call. */
+  itkSetMacro(RebuildTolerance, double);
+  itkGetConstMacro(RebuildTolerance, double);
+
   /** Compute the kd-tree that will facilitate the querying the points. */
   void
   Initialize();
@@ -111,6 +133,23 @@ public:
   void
   FindPointsWithinRadius(const PointType &, double, NeighborsIdentifierType &) const;
 
+  /** Find the closest point of each query point.  The queries are processed
+   * in parallel, and the i-th point id is the closest point of the i-th query. */
+  void
+  FindClosestPoints(const PointListType &, PointIdentifierListType &) const;
+
+  /** Find the closest point of each query point, and its distance to the query. */
+  void
+  FindClosestPoints(const PointListType &, PointIdentifierListType &, std::vector<double> &) const;
+
+  /** Find the k-nearest neighbors of each query point, in parallel. */
+  void
+  FindClosestNPoints(const PointListType &, unsigned int, NeighborsIdentifierListType &) const;
+
+  /** Find all the points within a specified radius of each query point, in parallel. */
+  void
+  FindPointsWithinRadius(const PointListType &, double, NeighborsIdentifierListType &) const;
+
 protected:
   PointsLocator();
   ~PointsLocator() override = default;
@@ -118,10 +157,13 @@ protected:
   PrintSelf(std::ostream & os, Indent indent) const override;
 
 private:
-  PointsContainerPointer m_Points;
-  SampleAdaptorPointer   m_SampleAdaptor;
-  TreeGeneratorPointer   m_KdTreeGenerator;
-  TreeConstPointer       m_Tree;
+  PointsContainerPointer     m_Points;
+  SampleAdaptorPointer       m_SampleAdaptor;
+  TreeGeneratorPointer       m_KdTreeGenerator;
+  typename TreeType::Pointer m_Tree;
+
+  double        m_RebuildTolerance{ 0.0 };
+  PointListType m_TreePoints;
 };
 
 } // end namespace itk
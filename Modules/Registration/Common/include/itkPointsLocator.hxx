@@ -18,6 +18,8 @@
 #ifndef itkPointsLocator_hxx
 #define itkPointsLocator_hxx
 
+#include <algorithm>
+
 namespace itk
 {
 
@@ -41,6 +43,26 @@ PointsLocator<TPointsContainer>::Initialize()
     itkExceptionMacro("The number of points is 0.");
   }
 
+  if (this->m_Tree && this->m_RebuildTolerance > 0.0 && this->m_TreePoints.size() == this->m_Points->Size())
+  {
+    // Keep the current tree if the points did not move too far from the
+    // positions they had when it was built.
+    double maximumDisplacement = 0.0;
+    for (PointIdentifier id = 0; id < this->m_Points->Size(); ++id)
+    {
+      maximumDisplacement =
+        std::max(maximumDisplacement,
+                 static_cast<double>(this->m_Points->ElementAt(id).EuclideanDistanceTo(this->m_TreePoints[id])));
+    }
+    if (maximumDisplacement <= this->m_RebuildTolerance)
+    {
+      // The points may have been stored in a new container.
+      this->m_SampleAdaptor->SetVectorContainer(const_cast<PointsContainer *>(this->m_Points.GetPointer()));
+      this->m_Tree->SetMaximumSampleDisplacement(maximumDisplacement);
+      return;
+    }
+  }
+
   this->m_SampleAdaptor = SampleAdaptorType::New();
   this->m_KdTreeGenerator = TreeGeneratorType::New();
 
@@ -55,6 +77,16 @@ PointsLocator<TPointsContainer>::Initialize()
   this->m_KdTreeGenerator->Update();
 
   this->m_Tree = this->m_KdTreeGenerator->GetOutput();
+
+  this->m_TreePoints.clear();
+  if (this->m_RebuildTolerance > 0.0)
+  {
+    this->m_TreePoints.reserve(this->m_Points->Size());
+    for (PointIdentifier id = 0; id < this->m_Points->Size(); ++id)
+    {
+      this->m_TreePoints.push_back(this->m_Points->ElementAt(id));
+    }
+  }
 }
 
 template <typename TPointsContainer>
@@ -119,6 +151,60 @@ PointsLocator<TPointsContainer>::FindPointsWithinRadius(const PointType &
   this->m_Tree->Search(query, radius, identifiers);
 }
 
+template <typename TPointsContainer>
+void
+PointsLocator<TPointsContainer>::FindClosestPoints(const PointListType &     queries,
+                                                   PointIdentifierListType & identifiers) const
+{
+  std::vector<double> distances;
+  this->FindClosestPoints(queries, identifiers, distances);
+}
+
+template <typename TPointsContainer>
+void
+PointsLocator<TPointsContainer>::FindClosestPoints(const PointListType &     queries,
+                                                   PointIdentifierListType & identifiers,
+                                                   std::vector<double> &     distances) const
+{
+  NeighborsIdentifierListType               neighbors;
+  typename TreeType::DistanceVectorListType neighborDistances;
+  this->m_Tree->Search(queries, 1u, neighbors, neighborDistances);
+
+  identifiers.resize(queries.size());
+  distances.resize(queries.size());
+  for (SizeValueType q = 0; q < queries.size(); ++q)
+  {
+    identifiers[q] = neighbors[q][0];
+    distances[q] = neighborDistances[q][0];
+  }
+}
+
+template <typename TPointsContainer>
+void
+PointsLocator<TPointsContainer>::FindClosestNPoints(const PointListType &         queries,
+                                                    unsigned int                  numberOfNeighborsRequested,
+                                                    NeighborsIdentifierListType & identifiers) const
+{
+  unsigned int N = numberOfNeighborsRequested;
+  if (N > this->m_Points->Size())
+  {
+    N = this->m_Points->Size();
+
+    itkWarningMacro("The number of requested neighbors is greater than the "
+                    << "total number of points.  Only returning " << N << " points.");
+  }
+  this->m_Tree->Search(queries, N, identifiers);
+}
+
+template <typename TPointsContainer>
+void
+PointsLocator<TPointsContainer>::FindPointsWithinRadius(const PointListType &         queries,
+                                                        double                        radius,
+                                                        NeighborsIdentifierListType & identifiers) const
+{
+  this->m_Tree->Search(queries, radius, identifiers);
+}
+
 /**
  * Print out internals
  */
@@ -127,6 +213,8 @@ void
 PointsLocator<TPointsContainer>::PrintSelf(std::ostream & os, Indent indent) const
 {
   Superclass::PrintSelf(os, indent);
+
+  os << indent << "RebuildTolerance: " << this->m_RebuildTolerance << std::endl;
 }
 
 } // end namespace itk
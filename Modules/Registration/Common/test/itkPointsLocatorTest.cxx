@@ -19,6 +19,58 @@
 #include "itkPointsLocator.h"
 #include "itkMapContainer.h"
 
+#include <algorithm>
+
+template <typename TPointsLocator>
+int
+testBatchedSearches(const TPointsLocator *                         pointsLocator,
+                    const typename TPointsLocator::PointListType & queries,
+                    double                                         radius)
+{
+  typename TPointsLocator::PointIdentifierListType     closestPoints;
+  typename TPointsLocator::NeighborsIdentifierListType neighborhoods;
+  typename TPointsLocator::NeighborsIdentifierType     neighborhood;
+
+  pointsLocator->FindClosestPoints(queries, closestPoints);
+  if (closestPoints.size() != queries.size())
+  {
+    std::cerr << "Error with batched FindClosestPoints()" << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (size_t q = 0; q < queries.size(); ++q)
+  {
+    if (closestPoints[q] != pointsLocator->FindClosestPoint(queries[q]))
+    {
+      std::cerr << "Error with batched FindClosestPoints() at query " << q << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  pointsLocator->FindClosestNPoints(queries, 10u, neighborhoods);
+  for (size_t q = 0; q < queries.size(); ++q)
+  {
+    pointsLocator->FindClosestNPoints(queries[q], 10u, neighborhood);
+    if (neighborhoods[q] != neighborhood)
+    {
+      std::cerr << "Error with batched FindClosestNPoints() at query " << q << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  pointsLocator->FindPointsWithinRadius(queries, radius, neighborhoods);
+  for (size_t q = 0; q < queries.size(); ++q)
+  {
+    pointsLocator->FindPointsWithinRadius(queries[q], radius, neighborhood);
+    if (neighborhoods[q] != neighborhood)
+    {
+      std::cerr << "Error with batched FindPointsWithinRadius() at query " << q << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
+
 template <typename TPointsContainer>
 int
 testPointsLocatorTest()
@@ -110,6 +162,83 @@ testPointsLocatorTest()
     return EXIT_FAILURE;
   }
 
+  /**
+   * The batched searches return the same points as the individual ones.
+   */
+  typename PointsLocatorType::PointListType queries;
+  for (unsigned int i = 0; i < 40; ++i)
+  {
+    PointType query;
+    query[0] = static_cast<float>(2.5 * i + std::sin(i));
+    query[1] = static_cast<float>(2.5 * i + std::cos(i));
+    query[2] = static_cast<float>(2.5 * i);
+    queries.push_back(query);
+  }
+
+  std::cout << "Test:  batched searches" << std::endl;
+
+  if (testBatchedSearches<PointsLocatorType>(pointsLocator, queries, radius) == EXIT_FAILURE)
+  {
+    return EXIT_FAILURE;
+  }
+
+  /**
+   * Move the points by less than the rebuild tolerance: the kd-tree is kept,
+   * and the searches still give the same results as a new locator.
+   */
+  std::cout << "Test:  RebuildTolerance" << std::endl;
+
+  pointsLocator->SetRebuildTolerance(0.75);
+  if (pointsLocator->GetRebuildTolerance() != 0.75)
+  {
+    std::cerr << "Error with Set/GetRebuildTolerance()" << std::endl;
+    return EXIT_FAILURE;
+  }
+  pointsLocator->Initialize();
+
+  for (double amplitude : { 0.5, 1.5 })
+  {
+    auto movedPoints = PointsContainerType::New();
+    for (unsigned int i = 0; i < points->Size(); ++i)
+    {
+      PointType movedPoint = points->ElementAt(i);
+      movedPoint[0] += static_cast<float>(amplitude * std::sin(3.0 * i));
+      movedPoint[1] += static_cast<float>(amplitude * std::cos(5.0 * i));
+      movedPoints->InsertElement(i, movedPoint);
+    }
+    pointsLocator->SetPoints(movedPoints);
+    pointsLocator->Initialize();
+
+    auto referenceLocator = PointsLocatorType::New();
+    referenceLocator->SetPoints(movedPoints);
+    referenceLocator->Initialize();
+
+    for (const PointType & query : queries)
+    {
+      typename PointsLocatorType::NeighborsIdentifierType referenceNeighborhood;
+      referenceLocator->FindClosestNPoints(query, 7u, referenceNeighborhood);
+      pointsLocator->FindClosestNPoints(query, 7u, neighborhood);
+      std::sort(neighborhood.begin(), neighborhood.end());
+      std::sort(referenceNeighborhood.begin(), referenceNeighborhood.end());
+      if (pointsLocator->FindClosestPoint(query) != referenceLocator->FindClosestPoint(query) ||
+          neighborhood != referenceNeighborhood)
+      {
+        std::cerr << "Error with RebuildTolerance: points moved by " << amplitude << std::endl;
+        return EXIT_FAILURE;
+      }
+
+      referenceLocator->FindPointsWithinRadius(query, radius, referenceNeighborhood);
+      pointsLocator->FindPointsWithinRadius(query, radius, neighborhood);
+      std::sort(neighborhood.begin(), neighborhood.end());
+      std::sort(referenceNeighborhood.begin(), referenceNeighborhood.end());
+      if (neighborhood != referenceNeighborhood)
+      {
+        std::cerr << "Error with RebuildTolerance: points moved by " << amplitude << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
   return EXIT_SUCCESS;
 }
 
@@ -149,7 +149,10 @@ public:
 protected:
   ANTSNeighborhoodCorrelationImageToImageMetricv4GetValueAndDerivativeThreader()
     : m_ANTSAssociate(nullptr)
-  {}
+  {
+    // ProcessVirtualPoint is overridden, so process the points one at a time
+    this->m_MapPointsInBlocks = false;
+  }
 
   /**
    * Dense threader and sparse threader invoke different in multi-threading. This class uses overloaded
@@ -29,7 +29,10 @@ CorrelationImageToImageMetricv4GetValueAndDerivativeThreader<
   TCorrelationMetric>::CorrelationImageToImageMetricv4GetValueAndDerivativeThreader()
   : m_CorrelationMetricValueDerivativePerThreadVariables(nullptr)
   , m_CorrelationAssociate(nullptr)
-{}
+{
+  // ProcessVirtualPoint is overridden, so process the points one at a time
+  this->m_MapPointsInBlocks = false;
+}
 
 
 template <typename TDomainPartitioner, typename TImageToImageMetric, typename TCorrelationMetric>
@@ -27,7 +27,10 @@ CorrelationImageToImageMetricv4HelperThreader<TDomainPartitioner, TImageToImageM
   CorrelationImageToImageMetricv4HelperThreader()
   : m_CorrelationMetricPerThreadVariables(nullptr)
   , m_CorrelationAssociate(nullptr)
-{}
+{
+  // ProcessVirtualPoint is overridden, so process the points one at a time
+  this->m_MapPointsInBlocks = false;
+}
 
 
 template <typename TDomainPartitioner, typename TImageToImageMetric, typename TCorrelationMetric>
@@ -23,6 +23,7 @@
 #include "itkObjectToObjectMetric.h"
 #include "itkInterpolateImageFunction.h"
 #include "itkSpatialObject.h"
+#include "itkImageMaskSpatialObject.h"
 #include "itkResampleImageFilter.h"
 #include "itkThreadedIndexedContainerPartitioner.h"
 #include "itkThreadedImageRegionPartitioner.h"
@@ -108,6 +109,19 @@ namespace itk
  * use a gradient image filter for it because it will only be
  * calculated once.
  *
+ * Stochastic Sampling
+ *
+ * With UseStochasticSampling, the metric draws a new virtual sampled point
+ * set at each evaluation, so that an optimizer performs stochastic gradient
+ * descent using a small fraction of the voxels at each iteration. The
+ * candidate voxels are those of the virtual domain, restricted to the fixed
+ * image mask when it is defined in the virtual index space (see
+ * GetFixedImageMaskInVirtualIndexSpace()). They are split in as many strata
+ * of consecutive voxels as there are samples, and one sample is drawn
+ * uniformly within each stratum, at a uniform position within its voxel.
+ * The points are drawn in parallel with a counter-based random number
+ * generator, so that they are reproducible for a given seed.
+ *
  * Vector Images
  *
  * To support vector images, the class must be declared using the
@@ -416,6 +430,18 @@ public:
   itkSetConstObjectMacro(FixedImageMask, FixedImageMaskType);
   itkGetConstObjectMacro(FixedImageMask, FixedImageMaskType);
 
+  using FixedImageMaskInVirtualIndexSpaceType = ImageMaskSpatialObject<VirtualImageDimension>;
+
+  /** Returns the fixed image mask if it can be tested directly in the index
+   * space of the virtual domain, or nullptr otherwise. This is the case when
+   * the mask is an ImageMaskSpatialObject (of unsigned char pixels) without
+   * transform whose image has the origin, spacing and direction of the
+   * virtual image, and the fixed transform is an IdentityTransform. A
+   * virtual point is then inside the mask if and only if the mask pixel
+   * at its virtual index is non-zero. */
+  const FixedImageMaskInVirtualIndexSpaceType *
+  GetFixedImageMaskInVirtualIndexSpace() const;
+
   /** Set/Get the fixed image domain sampling point set
    * See main documentation regarding using fixed vs virtual domain
    * for the point set. */
@@ -438,6 +464,33 @@ public:
   itkGetConstReferenceMacro(UseVirtualSampledPointSet, bool);
   itkBooleanMacro(UseVirtualSampledPointSet);
 
+  /** Set/Get flag to draw a new random subset of the virtual domain at each
+   * evaluation of the metric, for stochastic gradient descent optimization.
+   * When set, Initialize() turns on UseSampledPointSet and
+   * UseVirtualSampledPointSet, and each GetValue() or GetValueAndDerivative()
+   * replaces the virtual sampled point set by a fraction
+   * StochasticSamplingPercentage of the voxels of the virtual domain.
+   * Turning it off restores these two flags and the virtual sampled point
+   * set to their values before Initialize() turned them on. Initialize()
+   * must then be called again.
+   * See main documentation regarding stochastic sampling. */
+  virtual void
+  SetUseStochasticSampling(bool useStochasticSampling);
+  itkGetConstReferenceMacro(UseStochasticSampling, bool);
+  itkBooleanMacro(UseStochasticSampling);
+
+  /** Set/Get the fraction of the voxels of the virtual domain that are
+   * drawn at each evaluation with stochastic sampling. Valid values are
+   * in (0.0, 1.0]. Defaults to 0.01. */
+  itkSetClampMacro(StochasticSamplingPercentage, double, NumericTraits<double>::min(), 1.0);
+  itkGetConstMacro(StochasticSamplingPercentage, double);
+
+  /** Set/Get the seed of the stochastic sampling. The seed and the number
+   * of evaluations since Initialize() determine the drawn points, which do
+   * not depend on the number of threads. */
+  itkSetMacro(StochasticSamplingSeed, SizeValueType);
+  itkGetConstMacro(StochasticSamplingSeed, SizeValueType);
+
 #if !defined(ITK_LEGACY_REMOVE)
   /** UseFixedSampledPointSet is deprecated and has been replaced
    * with UseSampledPointsSet. */
@@ -646,12 +699,27 @@ protected:
                                  FixedImagePointType &    mappedFixedPoint,
                                  FixedImagePixelType &    mappedFixedPixelValue) const;
 
+  /** Evaluate a point of the FixedImage domain, already mapped from the
+   * VirtualImage domain by the fixed transform. This is the part of
+   * \c TransformAndEvaluateFixedPoint which follows the transform, used by
+   * the threaders which map the points in blocks. */
+  bool
+  EvaluateFixedPoint(const FixedImagePointType & mappedFixedPoint, FixedImagePixelType & mappedFixedPixelValue) const;
+
   /** Transform and evaluate a point from VirtualImage domain to MovingImage domain. */
   bool
   TransformAndEvaluateMovingPoint(const VirtualPointType & virtualPoint,
                                   MovingImagePointType &   mappedMovingPoint,
                                   MovingImagePixelType &   mappedMovingPixelValue) const;
 
+  /** Evaluate a point of the MovingImage domain, already mapped from the
+   * VirtualImage domain by the moving transform. This is the part of
+   * \c TransformAndEvaluateMovingPoint which follows the transform, used by
+   * the threaders which map the points in blocks. */
+  bool
+  EvaluateMovingPoint(const MovingImagePointType & mappedMovingPoint,
+                      MovingImagePixelType &       mappedMovingPixelValue) const;
+
   /** Compute image derivatives for a Fixed point. */
   virtual void
   ComputeFixedImageGradientAtPoint(const FixedImagePointType & mappedPoint, FixedImageGradientType & gradient) const;
@@ -750,6 +818,11 @@ protected:
   FixedSampledPointSet */
   bool m_UseVirtualSampledPointSet;
 
+  /** Flag to draw a new virtual sampled point set at each evaluation. */
+  bool          m_UseStochasticSampling;
+  double        m_StochasticSamplingPercentage;
+  SizeValueType m_StochasticSamplingSeed;
+
   ImageToImageMetricv4();
   ~ImageToImageMetricv4() override = default;
 
@@ -761,6 +834,15 @@ private:
   void
   MapFixedSampledPointSetToVirtual();
 
+  /** Compute the voxels from which the stochastic samples are drawn. */
+  void
+  InitializeStochasticSampling();
+
+  /** Draw the virtual sampled point set of the current evaluation with
+   * stochastic sampling. */
+  void
+  GenerateStochasticSampledPointSet() const;
+
   /** Transform a point. Avoid cast if possible */
   void
   LocalTransformPoint(const typename FixedTransformType::OutputPointType & virtualPoint,
@@ -815,6 +897,23 @@ private:
    * For informational purposes. */
   SizeValueType m_NumberOfSkippedFixedSampledPoints;
 
+  /** Voxels from which the stochastic samples are drawn. They are the runs
+   * of the fixed image mask in the virtual domain, with the number of
+   * voxels of the previous runs, or all the voxels of the virtual region
+   * when the list is empty. */
+  using StochasticSamplingRunListType = typename FixedImageMaskInVirtualIndexSpaceType::RunListType;
+  StochasticSamplingRunListType m_StochasticSamplingRuns;
+  std::vector<SizeValueType>    m_StochasticSamplingRunOffsets;
+  SizeValueType                 m_NumberOfStochasticSamplingVoxels;
+  mutable SizeValueType         m_StochasticSamplingEvaluation;
+
+  /** Sampling settings replaced by Initialize() when it turns stochastic
+   * sampling on, restored when it is turned off. */
+  bool                   m_StochasticSamplingReplacesSampling;
+  bool                   m_UseSampledPointSetBeforeStochasticSampling;
+  bool                   m_UseVirtualSampledPointSetBeforeStochasticSampling;
+  VirtualPointSetPointer m_VirtualSampledPointSetBeforeStochasticSampling;
+
   bool                m_UseFloatingPointCorrection;
   DerivativeValueType m_FloatingPointCorrectionResolution;
 
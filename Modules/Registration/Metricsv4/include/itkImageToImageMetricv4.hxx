@@ -24,6 +24,8 @@
 #include "itkLinearInterpolateImageFunction.h"
 #include "itkIdentityTransform.h"
 
+#include <algorithm>
+
 namespace itk
 {
 
@@ -66,6 +68,14 @@ ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputat
   this->m_UseMovingImageGradientFilter = true;
   this->m_UseSampledPointSet = false;
   this->m_UseVirtualSampledPointSet = false;
+  this->m_UseStochasticSampling = false;
+  this->m_StochasticSamplingPercentage = 0.01;
+  this->m_StochasticSamplingSeed = 0;
+  this->m_NumberOfStochasticSamplingVoxels = 0;
+  this->m_StochasticSamplingEvaluation = 0;
+  this->m_StochasticSamplingReplacesSampling = false;
+  this->m_UseSampledPointSetBeforeStochasticSampling = false;
+  this->m_UseVirtualSampledPointSetBeforeStochasticSampling = false;
 
   this->m_FloatingPointCorrectionResolution = 1e6;
   this->m_UseFloatingPointCorrection = false;
@@ -143,6 +153,24 @@ ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputat
    */
   Superclass::Initialize();
 
+  /* Stochastic sampling evaluates the metric over virtual sampled point
+   * sets that are drawn at each evaluation. */
+  if (this->m_UseStochasticSampling)
+  {
+    if (!this->m_StochasticSamplingReplacesSampling)
+    {
+      // Keep the sampling settings of the user, restored when stochastic
+      // sampling is turned off
+      this->m_UseSampledPointSetBeforeStochasticSampling = this->m_UseSampledPointSet;
+      this->m_UseVirtualSampledPointSetBeforeStochasticSampling = this->m_UseVirtualSampledPointSet;
+      this->m_VirtualSampledPointSetBeforeStochasticSampling = this->m_VirtualSampledPointSet;
+      this->m_StochasticSamplingReplacesSampling = true;
+    }
+    this->m_UseSampledPointSet = true;
+    this->m_UseVirtualSampledPointSet = true;
+    this->InitializeStochasticSampling();
+  }
+
   /* Map the fixed samples into the virtual domain and store in
    * a separate point set. */
   if (this->m_UseSampledPointSet && !this->m_UseVirtualSampledPointSet)
@@ -289,6 +317,16 @@ void
 ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputationValueType, TMetricTraits>::
   InitializeForIteration() const
 {
+  if (this->m_UseStochasticSampling)
+  {
+    if (this->m_NumberOfStochasticSamplingVoxels == 0)
+    {
+      itkExceptionMacro("Initialize() must be called after enabling stochastic sampling.");
+    }
+    ++this->m_StochasticSamplingEvaluation;
+    this->GenerateStochasticSampledPointSet();
+  }
+
   if (this->m_ComputeDerivative)
   {
     /* This size always comes from the active transform */
@@ -302,6 +340,47 @@ ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputat
   }
 }
 
+template <typename TFixedImage,
+          typename TMovingImage,
+          typename TVirtualImage,
+          typename TInternalComputationValueType,
+          typename TMetricTraits>
+auto
+ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputationValueType, TMetricTraits>::
+  GetFixedImageMaskInVirtualIndexSpace() const -> const FixedImageMaskInVirtualIndexSpaceType *
+{
+  using FixedIdentityTransformType = IdentityTransform<typename FixedTransformType::ScalarType, VirtualImageDimension>;
+
+  const auto * mask = dynamic_cast<const FixedImageMaskInVirtualIndexSpaceType *>(this->m_FixedImageMask.GetPointer());
+  if (mask == nullptr || mask->GetImage() == nullptr || this->GetVirtualImage() == nullptr ||
+      dynamic_cast<const FixedIdentityTransformType *>(this->m_FixedTransform.GetPointer()) == nullptr)
+  {
+    return nullptr;
+  }
+
+  const auto * maskToWorldTransform = mask->GetObjectToWorldTransform();
+  if (!maskToWorldTransform->GetMatrix().GetVnlMatrix().is_identity())
+  {
+    return nullptr;
+  }
+  for (unsigned int d = 0; d < VirtualImageDimension; ++d)
+  {
+    if (maskToWorldTransform->GetOffset()[d] != 0.0)
+    {
+      return nullptr;
+    }
+  }
+
+  const auto * maskImage = mask->GetImage();
+  const auto * virtualImage = this->GetVirtualImage();
+  if (maskImage->GetOrigin() != virtualImage->GetOrigin() || maskImage->GetSpacing() != virtualImage->GetSpacing() ||
+      maskImage->GetDirection() != virtualImage->GetDirection())
+  {
+    return nullptr;
+  }
+  return mask;
+}
+
 template <typename TFixedImage,
           typename TMovingImage,
           typename TVirtualImage,
@@ -313,12 +392,24 @@ ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputat
                                  FixedImagePointType &    mappedFixedPoint,
                                  FixedImagePixelType &    mappedFixedPixelValue) const
 {
-  bool pointIsValid = true;
-  mappedFixedPixelValue = NumericTraits<FixedImagePixelType>::ZeroValue();
-
   // map the point into fixed space
   this->LocalTransformPoint(virtualPoint, mappedFixedPoint);
 
+  return this->EvaluateFixedPoint(mappedFixedPoint, mappedFixedPixelValue);
+}
+
+template <typename TFixedImage,
+          typename TMovingImage,
+          typename TVirtualImage,
+          typename TInternalComputationValueType,
+          typename TMetricTraits>
+bool
+ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputationValueType, TMetricTraits>::
+  EvaluateFixedPoint(const FixedImagePointType & mappedFixedPoint, FixedImagePixelType & mappedFixedPixelValue) const
+{
+  bool pointIsValid = true;
+  mappedFixedPixelValue = NumericTraits<FixedImagePixelType>::ZeroValue();
+
   // check against the mask if one is assigned
   if (this->m_FixedImageMask)
   {
@@ -354,9 +445,6 @@ ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputat
                                   MovingImagePointType &   mappedMovingPoint,
                                   MovingImagePixelType &   mappedMovingPixelValue) const
 {
-  bool pointIsValid = true;
-  mappedMovingPixelValue = NumericTraits<MovingImagePixelType>::ZeroValue();
-
   // map the point into moving space
 
   // Before transforming points, we should convert their types from the ImagePointType (aka Point<double, dim>)
@@ -370,6 +458,22 @@ ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputat
   localMappedMovingPoint = this->m_MovingTransform->TransformPoint(localVirtualPoint);
   mappedMovingPoint.CastFrom(localMappedMovingPoint);
 
+  return this->EvaluateMovingPoint(mappedMovingPoint, mappedMovingPixelValue);
+}
+
+template <typename TFixedImage,
+          typename TMovingImage,
+          typename TVirtualImage,
+          typename TInternalComputationValueType,
+          typename TMetricTraits>
+bool
+ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputationValueType, TMetricTraits>::
+  EvaluateMovingPoint(const MovingImagePointType & mappedMovingPoint,
+                      MovingImagePixelType &       mappedMovingPixelValue) const
+{
+  bool pointIsValid = true;
+  mappedMovingPixelValue = NumericTraits<MovingImagePixelType>::ZeroValue();
+
   // check against the mask if one is assigned
   if (this->m_MovingImageMask)
   {
@@ -635,6 +739,168 @@ ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputat
   }
 }
 
+template <typename TFixedImage,
+          typename TMovingImage,
+          typename TVirtualImage,
+          typename TInternalComputationValueType,
+          typename TMetricTraits>
+void
+ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputationValueType, TMetricTraits>::
+  SetUseStochasticSampling(bool useStochasticSampling)
+{
+  if (this->m_UseStochasticSampling == useStochasticSampling)
+  {
+    return;
+  }
+  this->m_UseStochasticSampling = useStochasticSampling;
+
+  if (!useStochasticSampling && this->m_StochasticSamplingReplacesSampling)
+  {
+    // Restore the sampling settings replaced by Initialize()
+    this->m_UseSampledPointSet = this->m_UseSampledPointSetBeforeStochasticSampling;
+    this->m_UseVirtualSampledPointSet = this->m_UseVirtualSampledPointSetBeforeStochasticSampling;
+    this->m_VirtualSampledPointSet = this->m_VirtualSampledPointSetBeforeStochasticSampling;
+    this->m_VirtualSampledPointSetBeforeStochasticSampling = nullptr;
+    this->m_StochasticSamplingReplacesSampling = false;
+
+    this->m_StochasticSamplingRuns.clear();
+    this->m_StochasticSamplingRunOffsets.clear();
+    this->m_NumberOfStochasticSamplingVoxels = 0;
+  }
+  this->Modified();
+}
+
+template <typename TFixedImage,
+          typename TMovingImage,
+          typename TVirtualImage,
+          typename TInternalComputationValueType,
+          typename TMetricTraits>
+void
+ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputationValueType, TMetricTraits>::
+  InitializeStochasticSampling()
+{
+  const VirtualRegionType virtualRegion = this->GetVirtualRegion();
+
+  this->m_StochasticSamplingRuns.clear();
+  this->m_StochasticSamplingRunOffsets.clear();
+
+  const auto * fixedImageMask = this->GetFixedImageMaskInVirtualIndexSpace();
+  if (fixedImageMask != nullptr)
+  {
+    // Only draw the voxels of the mask, the other ones are known to be
+    // rejected by TransformAndEvaluateFixedPoint()
+    fixedImageMask->ComputeRunsInIndexSpace(virtualRegion, this->m_StochasticSamplingRuns);
+    this->m_StochasticSamplingRunOffsets.reserve(this->m_StochasticSamplingRuns.size());
+    this->m_NumberOfStochasticSamplingVoxels = 0;
+    for (const auto & run : this->m_StochasticSamplingRuns)
+    {
+      this->m_StochasticSamplingRunOffsets.push_back(this->m_NumberOfStochasticSamplingVoxels);
+      this->m_NumberOfStochasticSamplingVoxels += run.m_Length;
+    }
+  }
+  else
+  {
+    this->m_NumberOfStochasticSamplingVoxels = virtualRegion.GetNumberOfPixels();
+  }
+
+  if (this->m_NumberOfStochasticSamplingVoxels == 0)
+  {
+    itkExceptionMacro("There are no voxels of the virtual domain to draw the stochastic samples from.");
+  }
+
+  this->m_VirtualSampledPointSet = VirtualPointSetType::New();
+  this->m_VirtualSampledPointSet->Initialize();
+  this->m_VirtualSampledPointSet->SetPoints(VirtualPointSetType::PointsContainer::New());
+
+  this->m_StochasticSamplingEvaluation = 0;
+  this->GenerateStochasticSampledPointSet();
+}
+
+template <typename TFixedImage,
+          typename TMovingImage,
+          typename TVirtualImage,
+          typename TInternalComputationValueType,
+          typename TMetricTraits>
+void
+ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputationValueType, TMetricTraits>::
+  GenerateStochasticSampledPointSet() const
+{
+  using SampledPointType = typename VirtualPointSetType::PointType;
+  using ContinuousIndexType = ContinuousIndex<typename SampledPointType::ValueType, VirtualImageDimension>;
+
+  // Counter-based generator: the i-th random value of a key is the SplitMix64
+  // finalizer of the i-th state of a Weyl sequence. The values do not depend
+  // on the order in which they are drawn, and can therefore be drawn in parallel.
+  const auto random = [](uint64_t key, uint64_t counter) -> uint64_t {
+    uint64_t z = key + (counter + 1) * 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+  };
+  // Uniform in [0, 1) from the 53 high bits of a random value
+  const auto uniform = [](uint64_t value) -> double { return static_cast<double>(value >> 11) / 9007199254740992.0; };
+
+  const uint64_t numberOfVoxels = this->m_NumberOfStochasticSamplingVoxels;
+  const auto     numberOfSamples = std::max<uint64_t>(
+    1, static_cast<uint64_t>(static_cast<double>(numberOfVoxels) * this->m_StochasticSamplingPercentage));
+  const uint64_t key = random(this->m_StochasticSamplingSeed, this->m_StochasticSamplingEvaluation);
+
+  auto & points = this->m_VirtualSampledPointSet->GetPoints()->CastToSTLContainer();
+  points.resize(numberOfSamples);
+
+  const VirtualImageType * virtualImage = this->GetVirtualImage();
+  const VirtualRegionType  virtualRegion = this->GetVirtualRegion();
+  const VirtualIndexType   regionIndex = virtualRegion.GetIndex();
+  const VirtualSizeType    regionSize = virtualRegion.GetSize();
+  const auto &             runs = this->m_StochasticSamplingRuns;
+  const auto &             runOffsets = this->m_StochasticSamplingRunOffsets;
+  constexpr uint64_t       countersPerSample = VirtualImageDimension + 1;
+  constexpr SizeValueType  blockSize = 1024;
+  const SizeValueType      numberOfBlocks = (numberOfSamples + blockSize - 1) / blockSize;
+
+  const auto generateBlock = [&](SizeValueType block) {
+    const uint64_t end = std::min<uint64_t>((block + 1) * blockSize, numberOfSamples);
+    for (uint64_t sample = block * blockSize; sample < end; ++sample)
+    {
+      // One voxel is drawn within each stratum of consecutive voxels. The
+      // products fit in 64 bits since the sample count is at most the voxel count.
+      const uint64_t stratumBegin = sample * numberOfVoxels / numberOfSamples;
+      const uint64_t stratumLength = (sample + 1) * numberOfVoxels / numberOfSamples - stratumBegin;
+      const auto     offset = static_cast<uint64_t>(uniform(random(key, sample * countersPerSample)) * stratumLength);
+      const uint64_t voxel = stratumBegin + std::min(offset, stratumLength - 1);
+
+      VirtualIndexType index;
+      if (runs.empty())
+      {
+        uint64_t remainder = voxel;
+        for (unsigned int d = 0; d < VirtualImageDimension; ++d)
+        {
+          index[d] = regionIndex[d] + static_cast<IndexValueType>(remainder % regionSize[d]);
+          remainder /= regionSize[d];
+        }
+      }
+      else
+      {
+        const auto runIt = std::upper_bound(runOffsets.begin(), runOffsets.end(), voxel) - 1;
+        index = runs[runIt - runOffsets.begin()].m_Index;
+        index[0] += static_cast<IndexValueType>(voxel - *runIt);
+      }
+
+      // Uniform position within the voxel
+      ContinuousIndexType continuousIndex;
+      for (unsigned int d = 0; d < VirtualImageDimension; ++d)
+      {
+        continuousIndex[d] = index[d] + uniform(random(key, sample * countersPerSample + d + 1)) - 0.5;
+      }
+      virtualImage->TransformContinuousIndexToPhysicalPoint(continuousIndex, points[sample]);
+    }
+  };
+
+  this->m_SparseGetValueAndDerivativeThreader->GetMultiThreader()->ParallelizeArray(
+    0, numberOfBlocks, generateBlock, nullptr);
+  this->m_VirtualSampledPointSet->Modified();
+}
+
 template <typename TFixedImage,
           typename TMovingImage,
           typename TVirtualImage,
@@ -673,7 +939,10 @@ ImageToImageMetricv4<TFixedImage, TMovingImage, TVirtualImage, TInternalComputat
      << indent << "GetUseFixedImageGradientFilter: " << this->GetUseFixedImageGradientFilter() << std::endl
      << indent << "GetUseMovingImageGradientFilter: " << this->GetUseMovingImageGradientFilter() << std::endl
      << indent << "UseFloatingPointCorrection: " << this->GetUseFloatingPointCorrection() << std::endl
-     << indent << "FloatingPointCorrectionResolution: " << this->GetFloatingPointCorrectionResolution() << std::endl;
+     << indent << "FloatingPointCorrectionResolution: " << this->GetFloatingPointCorrectionResolution() << std::endl
+     << indent << "UseStochasticSampling: " << this->GetUseStochasticSampling() << std::endl
+     << indent << "StochasticSamplingPercentage: " << this->GetStochasticSamplingPercentage() << std::endl
+     << indent << "StochasticSamplingSeed: " << this->GetStochasticSamplingSeed() << std::endl;
 
   itkPrintSelfObjectMacro(FixedImage);
   itkPrintSelfObjectMacro(MovingImage);
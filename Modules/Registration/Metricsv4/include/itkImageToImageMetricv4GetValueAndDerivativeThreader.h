@@ -104,8 +104,8 @@ protected:
   /** Constructor. */
   ImageToImageMetricv4GetValueAndDerivativeThreader() = default;
 
-  /** Walk through the given virtual image domain, and call \c ProcessVirtualPoint on every
-   * point. */
+  /** Walk through the given virtual image domain, and call \c ProcessVirtualPoints on
+   * blocks of points. */
   void
   ThreadedExecution(const DomainType & imageSubRegion, const ThreadIdType threadId) override;
 
@@ -180,8 +180,8 @@ protected:
   /** Constructor. */
   ImageToImageMetricv4GetValueAndDerivativeThreader() = default;
 
-  /** Walk through the given virtual image domain, and call \c ProcessVirtualPoint on every
-   * point. */
+  /** Walk through the given virtual image domain, and call \c ProcessVirtualPoints on
+   * blocks of points. */
   void
   ThreadedExecution(const DomainType & indexSubRange, const ThreadIdType threadId) override;
 
@@ -20,6 +20,8 @@
 
 #include "itkImageRegionConstIteratorWithIndex.h"
 
+#include <array>
+
 namespace itk
 {
 
@@ -30,14 +32,47 @@ ImageToImageMetricv4GetValueAndDerivativeThreader<
   TImageToImageMetricv4>::ThreadedExecution(const DomainType & imageSubRegion, const ThreadIdType threadId)
 {
   typename VirtualImageType::ConstPointer virtualImage = this->m_Associate->GetVirtualImage();
-  using IteratorType = ImageRegionConstIteratorWithIndex<VirtualImageType>;
-  VirtualPointType virtualPoint;
-  for (IteratorType it(virtualImage, imageSubRegion); !it.IsAtEnd(); ++it)
+
+  // Gather the points in blocks, processed by ProcessVirtualPoints()
+  std::array<VirtualIndexType, Superclass::VirtualPointsBlockSize> virtualIndices;
+  std::array<VirtualPointType, Superclass::VirtualPointsBlockSize> virtualPoints;
+  SizeValueType                                                    numberOfPoints = 0;
+  const auto addVirtualIndex = [&](const VirtualIndexType & virtualIndex) {
+    virtualIndices[numberOfPoints] = virtualIndex;
+    virtualImage->TransformIndexToPhysicalPoint(virtualIndex, virtualPoints[numberOfPoints]);
+    if (++numberOfPoints == Superclass::VirtualPointsBlockSize)
+    {
+      this->ProcessVirtualPoints(virtualIndices.data(), virtualPoints.data(), numberOfPoints, threadId);
+      numberOfPoints = 0;
+    }
+  };
+
+  const auto * fixedImageMask = this->m_Associate->GetFixedImageMaskInVirtualIndexSpace();
+  if (fixedImageMask != nullptr)
+  {
+    // Only visit the runs of the mask, the other points are known to be
+    // rejected by TransformAndEvaluateFixedPoint()
+    typename AssociateType::FixedImageMaskInVirtualIndexSpaceType::RunListType runs;
+    fixedImageMask->ComputeRunsInIndexSpace(imageSubRegion, runs);
+    for (const auto & run : runs)
+    {
+      VirtualIndexType virtualIndex = run.m_Index;
+      for (SizeValueType i = 0; i < run.m_Length; ++i, ++virtualIndex[0])
+      {
+        addVirtualIndex(virtualIndex);
+      }
+    }
+  }
+  else
   {
-    const VirtualIndexType & virtualIndex = it.GetIndex();
-    virtualImage->TransformIndexToPhysicalPoint(virtualIndex, virtualPoint);
-    this->ProcessVirtualPoint(virtualIndex, virtualPoint, threadId);
+    using IteratorType = ImageRegionConstIteratorWithIndex<VirtualImageType>;
+    for (IteratorType it(virtualImage, imageSubRegion); !it.IsAtEnd(); ++it)
+    {
+      addVirtualIndex(it.GetIndex());
+    }
   }
+  this->ProcessVirtualPoints(virtualIndices.data(), virtualPoints.data(), numberOfPoints, threadId);
+
   // Finalize per thread actions
   this->m_Associate->FinalizeThread(threadId);
 }
@@ -53,12 +88,23 @@ ImageToImageMetricv4GetValueAndDerivativeThreader<ThreadedIndexedContainerPartit
   const ElementIdentifierType             begin = indexSubRange[0];
   const ElementIdentifierType             end = indexSubRange[1];
   typename VirtualImageType::ConstPointer virtualImage = this->m_Associate->GetVirtualImage();
+
+  // Gather the points in blocks, processed by ProcessVirtualPoints()
+  std::array<VirtualIndexType, Superclass::VirtualPointsBlockSize> virtualIndices;
+  std::array<VirtualPointType, Superclass::VirtualPointsBlockSize> virtualPoints;
+  SizeValueType                                                    numberOfPoints = 0;
   for (ElementIdentifierType i = begin; i <= end; ++i)
   {
-    const VirtualPointType & virtualPoint = virtualSampledPointSet->GetPoint(i);
-    const auto               virtualIndex = virtualImage->TransformPhysicalPointToIndex(virtualPoint);
-    this->ProcessVirtualPoint(virtualIndex, virtualPoint, threadId);
+    virtualPoints[numberOfPoints] = virtualSampledPointSet->GetPoint(i);
+    virtualIndices[numberOfPoints] = virtualImage->TransformPhysicalPointToIndex(virtualPoints[numberOfPoints]);
+    if (++numberOfPoints == Superclass::VirtualPointsBlockSize)
+    {
+      this->ProcessVirtualPoints(virtualIndices.data(), virtualPoints.data(), numberOfPoints, threadId);
+      numberOfPoints = 0;
+    }
   }
+  this->ProcessVirtualPoints(virtualIndices.data(), virtualPoints.data(), numberOfPoints, threadId);
+
   // Finalize per thread actions
   this->m_Associate->FinalizeThread(threadId);
 }
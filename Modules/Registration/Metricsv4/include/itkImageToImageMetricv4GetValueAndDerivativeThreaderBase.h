@@ -36,8 +36,11 @@ namespace itk
  *
  *  The \c ThreadedExecution in
  *  ImageToImageMetricv4GetValueAndDerivativeThreader calls \c
- *  ProcessVirtualPoint on every point in the virtual image domain.  \c
- *  ProcessVirtualPoint calls \c ProcessPoint on each point.
+ *  ProcessVirtualPoints on blocks of points of the virtual image domain,
+ *  which maps each block into the fixed and moving spaces with one call to
+ *  each transform, and calls \c ProcessPoint on each point. Derived classes
+ *  which override \c ProcessVirtualPoint must clear \c m_MapPointsInBlocks,
+ *  so that \c ProcessVirtualPoints calls it on every point instead.
  *
  * \ingroup ITKMetricsv4 */
 template <typename TDomainPartitioner, typename TImageToImageMetricv4>
@@ -120,6 +123,17 @@ protected:
                       const VirtualPointType & virtualPoint,
                       const ThreadIdType       threadId);
 
+  /** Method called by the threaders to process a block of virtual points.
+   * When \c m_MapPointsInBlocks is set, the points are mapped into the fixed
+   * and moving spaces with a single call to \c TransformPoints of each
+   * transform, and then processed as in \c ProcessVirtualPoint. Otherwise
+   * \c ProcessVirtualPoint is called on each point. */
+  void
+  ProcessVirtualPoints(const VirtualIndexType * virtualIndices,
+                       const VirtualPointType * virtualPoints,
+                       SizeValueType            numberOfPoints,
+                       const ThreadIdType       threadId);
+
   /** Method to calculate the metric value and derivative
    * given a point, value and image derivative for both fixed and moving
    * spaces. The provided values have been calculated from \c virtualPoint,
@@ -197,6 +211,28 @@ protected:
    *  These will only be set once threading has been started. */
   mutable NumberOfParametersType m_CachedNumberOfParameters;
   mutable NumberOfParametersType m_CachedNumberOfLocalParameters;
+
+  /** Number of virtual points gathered by the threaders before calling
+   * \c ProcessVirtualPoints. */
+  static constexpr SizeValueType VirtualPointsBlockSize = 64;
+
+  /** Map the points of a block with a single call to each transform in
+   * \c ProcessVirtualPoints, which then bypasses \c ProcessVirtualPoint.
+   * On by default. The derived classes which override \c ProcessVirtualPoint
+   * turn it off. */
+  bool m_MapPointsInBlocks{ true };
+
+private:
+  /** Implementation of \c ProcessVirtualPoint. When \c
+   * precomputedMappedFixedPoint and \c precomputedMappedMovingPoint are not
+   * null, they hold \c virtualPoint already mapped by the fixed and moving
+   * transforms, which are then not called. */
+  bool
+  ProcessVirtualPointWithMappedPoints(const VirtualIndexType &     virtualIndex,
+                                      const VirtualPointType &     virtualPoint,
+                                      const FixedImagePointType *  precomputedMappedFixedPoint,
+                                      const MovingImagePointType * precomputedMappedMovingPoint,
+                                      const ThreadIdType           threadId);
 };
 
 } // end namespace itk
@@ -20,6 +20,9 @@
 
 #include "itkNumericTraits.h"
 
+#include <algorithm>
+#include <array>
+
 namespace itk
 {
 
@@ -185,6 +188,81 @@ ImageToImageMetricv4GetValueAndDerivativeThreaderBase<TDomainPartitioner, TImage
   const VirtualIndexType & virtualIndex,
   const VirtualPointType & virtualPoint,
   const ThreadIdType       threadId)
+{
+  return this->ProcessVirtualPointWithMappedPoints(virtualIndex, virtualPoint, nullptr, nullptr, threadId);
+}
+
+template <typename TDomainPartitioner, typename TImageToImageMetricv4>
+void
+ImageToImageMetricv4GetValueAndDerivativeThreaderBase<TDomainPartitioner, TImageToImageMetricv4>::ProcessVirtualPoints(
+  const VirtualIndexType * virtualIndices,
+  const VirtualPointType * virtualPoints,
+  SizeValueType            numberOfPoints,
+  const ThreadIdType       threadId)
+{
+  if (!this->m_MapPointsInBlocks)
+  {
+    for (SizeValueType i = 0; i < numberOfPoints; ++i)
+    {
+      this->ProcessVirtualPoint(virtualIndices[i], virtualPoints[i], threadId);
+    }
+    return;
+  }
+
+  using FixedInputPointType = typename FixedTransformType::InputPointType;
+  using MovingInputPointType = typename MovingTransformType::InputPointType;
+  std::array<FixedInputPointType, VirtualPointsBlockSize>   localFixedVirtualPoints;
+  std::array<FixedOutputPointType, VirtualPointsBlockSize>  localMappedFixedPoints;
+  std::array<MovingInputPointType, VirtualPointsBlockSize>  localMovingVirtualPoints;
+  std::array<MovingOutputPointType, VirtualPointsBlockSize> localMappedMovingPoints;
+
+  for (SizeValueType blockStart = 0; blockStart < numberOfPoints; blockStart += VirtualPointsBlockSize)
+  {
+    const SizeValueType blockSize = std::min(VirtualPointsBlockSize, numberOfPoints - blockStart);
+
+    // Map the points into fixed and moving spaces with one call to each
+    // transform, as TransformAndEvaluateFixedPoint() and
+    // TransformAndEvaluateMovingPoint() do for a single point
+    for (SizeValueType i = 0; i < blockSize; ++i)
+    {
+      localFixedVirtualPoints[i].CastFrom(virtualPoints[blockStart + i]);
+      localMovingVirtualPoints[i].CastFrom(virtualPoints[blockStart + i]);
+    }
+    try
+    {
+      this->m_Associate->m_FixedTransform->TransformPoints(
+        localFixedVirtualPoints.data(), localMappedFixedPoints.data(), blockSize);
+      this->m_Associate->m_MovingTransform->TransformPoints(
+        localMovingVirtualPoints.data(), localMappedMovingPoints.data(), blockSize);
+    }
+    catch (ExceptionObject & exc)
+    {
+      std::string msg("Caught exception: \n");
+      msg += exc.what();
+      ExceptionObject err(__FILE__, __LINE__, msg);
+      throw err;
+    }
+
+    for (SizeValueType i = 0; i < blockSize; ++i)
+    {
+      FixedImagePointType mappedFixedPoint;
+      mappedFixedPoint.CastFrom(localMappedFixedPoints[i]);
+      MovingImagePointType mappedMovingPoint;
+      mappedMovingPoint.CastFrom(localMappedMovingPoints[i]);
+      this->ProcessVirtualPointWithMappedPoints(
+        virtualIndices[blockStart + i], virtualPoints[blockStart + i], &mappedFixedPoint, &mappedMovingPoint, threadId);
+    }
+  }
+}
+
+template <typename TDomainPartitioner, typename TImageToImageMetricv4>
+bool
+ImageToImageMetricv4GetValueAndDerivativeThreaderBase<TDomainPartitioner, TImageToImageMetricv4>::
+  ProcessVirtualPointWithMappedPoints(const VirtualIndexType &     virtualIndex,
+                                      const VirtualPointType &     virtualPoint,
+                                      const FixedImagePointType *  precomputedMappedFixedPoint,
+                                      const MovingImagePointType * precomputedMappedMovingPoint,
+                                      const ThreadIdType           threadId)
 {
   FixedImagePointType     mappedFixedPoint;
   FixedImagePixelType     mappedFixedPixelValue;
@@ -200,8 +278,16 @@ ImageToImageMetricv4GetValueAndDerivativeThreaderBase<TDomainPartitioner, TImage
    * then we otherwise get when exceptions are caught in MultiThreaderBase. */
   try
   {
-    pointIsValid =
-      this->m_Associate->TransformAndEvaluateFixedPoint(virtualPoint, mappedFixedPoint, mappedFixedPixelValue);
+    if (precomputedMappedFixedPoint != nullptr)
+    {
+      mappedFixedPoint = *precomputedMappedFixedPoint;
+      pointIsValid = this->m_Associate->EvaluateFixedPoint(mappedFixedPoint, mappedFixedPixelValue);
+    }
+    else
+    {
+      pointIsValid =
+        this->m_Associate->TransformAndEvaluateFixedPoint(virtualPoint, mappedFixedPoint, mappedFixedPixelValue);
+    }
     if (pointIsValid && this->m_Associate->GetComputeDerivative() &&
         this->m_Associate->GetGradientSourceIncludesFixed())
     {
@@ -223,8 +309,16 @@ ImageToImageMetricv4GetValueAndDerivativeThreaderBase<TDomainPartitioner, TImage
 
   try
   {
-    pointIsValid =
-      this->m_Associate->TransformAndEvaluateMovingPoint(virtualPoint, mappedMovingPoint, mappedMovingPixelValue);
+    if (precomputedMappedMovingPoint != nullptr)
+    {
+      mappedMovingPoint = *precomputedMappedMovingPoint;
+      pointIsValid = this->m_Associate->EvaluateMovingPoint(mappedMovingPoint, mappedMovingPixelValue);
+    }
+    else
+    {
+      pointIsValid =
+        this->m_Associate->TransformAndEvaluateMovingPoint(virtualPoint, mappedMovingPoint, mappedMovingPixelValue);
+    }
     if (pointIsValid && this->m_Associate->GetComputeDerivative() &&
         this->m_Associate->GetGradientSourceIncludesMoving())
     {
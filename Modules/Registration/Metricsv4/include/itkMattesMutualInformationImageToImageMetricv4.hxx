@@ -104,7 +104,9 @@ MattesMutualInformationImageToImageMetricv4<TFixedImage,
     //       are used for analysis of the metric, and the fixed space intensity range values
     //       will be fixed to those values identified in the sparse sampled points.
     //       The masked value items are not relevant when the sparse sampling is set.
-    if (this->m_UseSampledPointSet) // Analysis region defined by SampledPointSet
+    //       With stochastic sampling, the sampled points change at each evaluation,
+    //       so the range is that of the whole, possibly masked, fixed image.
+    if (this->m_UseSampledPointSet && !this->GetUseStochasticSampling()) // Analysis region defined by SampledPointSet
     {
       if (this->m_UseVirtualSampledPointSet) // Sparse points defined in VirtualSpace
       {
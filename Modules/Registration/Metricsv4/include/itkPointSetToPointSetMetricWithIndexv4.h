@@ -314,6 +314,18 @@ public:
   itkGetConstMacro(CalculateValueAndDerivativeInTangentSpace, bool);
   itkBooleanMacro(CalculateValueAndDerivativeInTangentSpace);
 
+  /**
+   * Largest displacement of the transformed points for which the points
+   * locators keep their kd-tree instead of building a new one when the points
+   * are transformed again, e.g. at each iteration when calculating in tangent
+   * space.  The searches stay exact, but get slower as the points move, so
+   * this should be small compared to the spacing of the points.
+   * Default = 0, i.e. always rebuild.
+   * \sa PointsLocator::SetRebuildTolerance
+   */
+  itkSetMacro(PointsLocatorRebuildTolerance, double);
+  itkGetConstMacro(PointsLocatorRebuildTolerance, double);
+
 protected:
   PointSetToPointSetMetricWithIndexv4();
   ~PointSetToPointSetMetricWithIndexv4() override = default;
@@ -466,6 +478,8 @@ private:
   // (default = true).
   bool m_StoreDerivativeAsSparseFieldForLocalSupportTransforms;
 
+  double m_PointsLocatorRebuildTolerance{ 0.0 };
+
   mutable ModifiedTimeType m_MovingTransformedPointSetTime;
   mutable ModifiedTimeType m_FixedTransformedPointSetTime;
 
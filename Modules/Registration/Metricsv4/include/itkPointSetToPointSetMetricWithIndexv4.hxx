@@ -612,6 +612,7 @@ PointSetToPointSetMetricWithIndexv4<TFixedPointSet, TMovingPointSet, TInternalCo
       this->m_FixedTransformedPointsLocator = PointsLocatorType::New();
     }
     this->m_FixedTransformedPointsLocator->SetPoints(this->m_FixedTransformedPointSet->GetPoints());
+    this->m_FixedTransformedPointsLocator->SetRebuildTolerance(this->m_PointsLocatorRebuildTolerance);
     this->m_FixedTransformedPointsLocator->Initialize();
     this->m_FixedTransformPointLocatorsNeedInitialization = false;
   }
@@ -627,6 +628,7 @@ PointSetToPointSetMetricWithIndexv4<TFixedPointSet, TMovingPointSet, TInternalCo
       this->m_MovingTransformedPointsLocator = PointsLocatorType::New();
     }
     this->m_MovingTransformedPointsLocator->SetPoints(this->m_MovingTransformedPointSet->GetPoints());
+    this->m_MovingTransformedPointsLocator->SetRebuildTolerance(this->m_PointsLocatorRebuildTolerance);
     this->m_MovingTransformedPointsLocator->Initialize();
     this->m_MovingTransformPointLocatorsNeedInitialization = false;
   }
@@ -690,6 +692,8 @@ PointSetToPointSetMetricWithIndexv4<TFixedPointSet, TMovingPointSet, TInternalCo
   {
     os << "false." << std::endl;
   }
+
+  os << indent << "Points locator rebuild tolerance = " << this->m_PointsLocatorRebuildTolerance << std::endl;
 }
 } // end namespace itk
 
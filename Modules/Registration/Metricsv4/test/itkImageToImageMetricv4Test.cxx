@@ -652,6 +652,87 @@ itkImageToImageMetricv4Test(int, char ** const)
     return EXIT_FAILURE;
   }
 
+  //
+  // Test with stochastic sampling
+  //
+  std::cout << "Testing with stochastic sampling:" << std::endl;
+  const auto sparseVirtualSampledPointSet = metric->GetVirtualSampledPointSet();
+
+  bool useStochasticSampling = true;
+  ITK_TEST_SET_GET_BOOLEAN(metric, UseStochasticSampling, useStochasticSampling);
+
+  const double stochasticSamplingPercentage = 0.5;
+  metric->SetStochasticSamplingPercentage(stochasticSamplingPercentage);
+  ITK_TEST_SET_GET_VALUE(stochasticSamplingPercentage, metric->GetStochasticSamplingPercentage());
+
+  const itk::SizeValueType stochasticSamplingSeed = 42;
+  metric->SetStochasticSamplingSeed(stochasticSamplingSeed);
+  ITK_TEST_SET_GET_VALUE(stochasticSamplingSeed, metric->GetStochasticSamplingSeed());
+
+  ITK_TRY_EXPECT_NO_EXCEPTION(metric->Initialize());
+  ITK_TEST_EXPECT_TRUE(metric->GetUseSampledPointSet());
+
+  // One point is drawn in each stratum of two consecutive voxels
+  const itk::SizeValueType numberOfSamples = imageSize * imageSize / 2;
+  ITK_TEST_EXPECT_EQUAL(metric->GetNumberOfDomainPoints(), numberOfSamples);
+
+  using StochasticPointsType = std::vector<PointType>;
+  const auto getSampledPoints = [&metric]() {
+    const auto & points = metric->GetVirtualSampledPointSet()->GetPoints()->CastToSTLConstContainer();
+    return StochasticPointsType(points.begin(), points.end());
+  };
+
+  ITK_TRY_EXPECT_NO_EXCEPTION(metric->GetValue());
+  const StochasticPointsType firstPoints = getSampledPoints();
+  for (itk::SizeValueType k = 0; k < numberOfSamples; ++k)
+  {
+    const auto sampledIndex = fixedImage->TransformPhysicalPointToIndex(firstPoints[k]);
+    const auto voxel = static_cast<itk::SizeValueType>(sampledIndex[0] + imageSize * sampledIndex[1]);
+    if (voxel / 2 != k)
+    {
+      std::cerr << "Sample " << k << " at " << firstPoints[k] << " is not in its stratum." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // A new sample is drawn at each evaluation
+  ITK_TRY_EXPECT_NO_EXCEPTION(metric->GetValueAndDerivative(truthValue, truthDerivative));
+  ITK_TEST_EXPECT_TRUE(getSampledPoints() != firstPoints);
+
+  // The samples only depend on the seed and on the number of evaluations
+  // since Initialize(), not on the number of work units
+  metric->SetMaximumNumberOfWorkUnits(1);
+  ITK_TRY_EXPECT_NO_EXCEPTION(metric->Initialize());
+  ITK_TRY_EXPECT_NO_EXCEPTION(metric->GetValue());
+  ITK_TEST_EXPECT_TRUE(getSampledPoints() == firstPoints);
+
+  metric->SetStochasticSamplingSeed(stochasticSamplingSeed + 1);
+  ITK_TRY_EXPECT_NO_EXCEPTION(metric->Initialize());
+  ITK_TRY_EXPECT_NO_EXCEPTION(metric->GetValue());
+  ITK_TEST_EXPECT_TRUE(getSampledPoints() != firstPoints);
+
+  // Turning stochastic sampling off restores the sparse sampling of the user
+  metric->UseStochasticSamplingOff();
+  ITK_TEST_EXPECT_TRUE(metric->GetUseSampledPointSet());
+  ITK_TEST_EXPECT_TRUE(!metric->GetUseVirtualSampledPointSet());
+  ITK_TEST_EXPECT_EQUAL(metric->GetVirtualSampledPointSet(), sparseVirtualSampledPointSet);
+  ImageToImageMetricv4TestComputeIdentityTruthValues(metric, fixedImage, movingImage, truthValue, truthDerivative);
+  if (ImageToImageMetricv4TestRunSingleTest(metric, truthValue, truthDerivative, imageSize * imageSize, false) !=
+      EXIT_SUCCESS)
+  {
+    return EXIT_FAILURE;
+  }
+
+  // and the dense sampling of the user
+  metric->SetUseSampledPointSet(false);
+  metric->UseStochasticSamplingOn();
+  ITK_TRY_EXPECT_NO_EXCEPTION(metric->Initialize());
+  ITK_TEST_EXPECT_EQUAL(metric->GetNumberOfDomainPoints(), numberOfSamples);
+  metric->UseStochasticSamplingOff();
+  ITK_TEST_EXPECT_TRUE(!metric->GetUseSampledPointSet());
+  ITK_TRY_EXPECT_NO_EXCEPTION(metric->Initialize());
+  ITK_TEST_EXPECT_EQUAL(metric->GetNumberOfDomainPoints(), imageSize * imageSize);
+
   // exercise methods.
   metric->SetUseFloatingPointCorrection(false);
   metric->SetFloatingPointCorrectionResolution(1);
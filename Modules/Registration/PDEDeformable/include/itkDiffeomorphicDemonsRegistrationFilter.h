@@ -21,8 +21,11 @@
 #include "itkPDEDeformableRegistrationFilter.h"
 #include "itkESMDemonsRegistrationFunction.h"
 
+#include "itkAddImageFilter.h"
 #include "itkMultiplyImageFilter.h"
 #include "itkExponentialDisplacementFieldImageFilter.h"
+#include "itkVectorLinearInterpolateNearestNeighborExtrapolateImageFunction.h"
+#include "itkWarpVectorImageFilter.h"
 
 namespace itk
 {
@@ -52,7 +52,8 @@ public:
   {
     NONE,
     REGULAR,
-    RANDOM
+    RANDOM,
+    STOCHASTIC
   };
 };
 // Define how to print enumeration
@@ -218,6 +219,7 @@ public:
   static constexpr MetricSamplingStrategyEnum NONE = MetricSamplingStrategyEnum::NONE;
   static constexpr MetricSamplingStrategyEnum REGULAR = MetricSamplingStrategyEnum::REGULAR;
   static constexpr MetricSamplingStrategyEnum RANDOM = MetricSamplingStrategyEnum::RANDOM;
+  static constexpr MetricSamplingStrategyEnum STOCHASTIC = MetricSamplingStrategyEnum::STOCHASTIC;
 #endif
 
 
@@ -303,7 +305,10 @@ public:
   itkSetObjectMacro(Metric, MetricType);
   itkGetModifiableObjectMacro(Metric, MetricType);
 
-  /** Set/Get the metric sampling strategy. */
+  /** Set/Get the metric sampling strategy. The REGULAR and RANDOM strategies
+   * sample the virtual domain once per level. With the STOCHASTIC strategy,
+   * the image metrics draw a new random sample of the virtual domain at each
+   * iteration, see ImageToImageMetricv4::SetUseStochasticSampling(). */
   itkSetEnumMacro(MetricSamplingStrategy, MetricSamplingStrategyEnum);
   itkGetEnumMacro(MetricSamplingStrategy, MetricSamplingStrategyEnum);
 
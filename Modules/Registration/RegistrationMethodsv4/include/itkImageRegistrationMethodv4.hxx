@@ -1052,24 +1052,32 @@ ImageRegistrationMethodv4<TFixedImage, TMovingImage, TTransform, TVirtualImage,
         }
         break;
       }
+      case MetricSamplingStrategyEnum::STOCHASTIC:
+      {
+        // The metric draws its own samples at each iteration
+        break;
+      }
       default:
       {
         itkExceptionMacro("Invalid sampling strategy requested.");
       }
     }
 
-    if (multiMetric)
+    ImageMetricType * imageMetric =
+      multiMetric ? dynamic_cast<ImageMetricType *>(multiMetric->GetMetricQueue()[n].GetPointer())
+                  : dynamic_cast<ImageMetricType *>(this->m_Metric.GetPointer());
+    if (this->m_MetricSamplingStrategy == MetricSamplingStrategyEnum::STOCHASTIC)
     {
-      dynamic_cast<ImageMetricType *>(multiMetric->GetMetricQueue()[n].GetPointer())
-        ->SetVirtualSampledPointSet(samplePointSet);
-      dynamic_cast<ImageMetricType *>(multiMetric->GetMetricQueue()[n].GetPointer())->UseSampledPointSetOn();
-      dynamic_cast<ImageMetricType *>(multiMetric->GetMetricQueue()[n].GetPointer())->UseVirtualSampledPointSetOn();
+      imageMetric->SetStochasticSamplingPercentage(this->m_MetricSamplingPercentagePerLevel[this->m_CurrentLevel]);
+      imageMetric->SetStochasticSamplingSeed(randomizer->GetIntegerVariate());
+      imageMetric->UseStochasticSamplingOn();
     }
     else
     {
-      dynamic_cast<ImageMetricType *>(this->m_Metric.GetPointer())->SetVirtualSampledPointSet(samplePointSet);
-      dynamic_cast<ImageMetricType *>(this->m_Metric.GetPointer())->UseSampledPointSetOn();
-      dynamic_cast<ImageMetricType *>(this->m_Metric.GetPointer())->UseVirtualSampledPointSetOn();
+      imageMetric->UseStochasticSamplingOff();
+      imageMetric->SetVirtualSampledPointSet(samplePointSet);
+      imageMetric->UseSampledPointSetOn();
+      imageMetric->UseVirtualSampledPointSetOn();
     }
   }
 }
@@ -163,6 +163,9 @@ public:
   /** Let the user control whether we compute metric derivatives in the downsampled or full-res space.
    *  The default is 'true' --- classic SyN --- but there may be advantages to the other approach.
    *  Classic SyN did not have this possibility. This implementation will let us explore the question.
+   *  When 'false', the metric evaluates the images through the composite transforms at each virtual
+   *  point, without resampling them to the virtual domain at each iteration: the images are warped
+   *  and compared in the same pass. This is the only fused warp-and-metric path of this class.
    */
   itkSetMacro(DownsampleImagesForMetricDerivatives, bool);
   itkGetConstMacro(DownsampleImagesForMetricDerivatives, bool);
@@ -226,6 +229,8 @@ protected:
                      const FixedImageMasksContainerType,
                      const MovingImageMasksContainerType,
                      MeasureType &);
+  /** Compute the metric gradient in the virtual domain. The returned field is
+   * reused, and overwritten, by the next call. */
   virtual DisplacementFieldPointer
   ComputeMetricGradientField(const FixedImagesContainerType,
                              const PointSetsContainerType,
@@ -259,6 +264,14 @@ protected:
 private:
   RealType m_GaussianSmoothingVarianceForTheUpdateField{ 3.0 };
   RealType m_GaussianSmoothingVarianceForTheTotalField{ 0.5 };
+
+  /** Identity transform of the metric when the images are resampled to the
+   * virtual domain, reused as long as the virtual domain does not change. */
+  DisplacementFieldTransformPointer m_IdentityDisplacementFieldTransform;
+
+  /** Metric gradient field, reused as long as the virtual domain does not
+   * change. */
+  DisplacementFieldPointer m_MetricGradientField;
 };
 } // end namespace itk
 
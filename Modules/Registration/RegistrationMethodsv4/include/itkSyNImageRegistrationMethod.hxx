@@ -29,6 +29,8 @@
 #include "itkVectorNeighborhoodOperatorImageFilter.h"
 #include "itkWindowConvergenceMonitoringFunction.h"
 
+#include <type_traits>
+
 namespace itk
 {
 
@@ -198,12 +200,14 @@ SyNImageRegistrationMethod<TFixedImage, TMovingImage, TOutputTransform, TVirtual
 
     if (this->m_AverageMidPointGradients)
     {
-      ImageRegionIteratorWithIndex<DisplacementFieldType> ItF(
-        fixedToMiddleSmoothUpdateField, fixedToMiddleSmoothUpdateField->GetLargestPossibleRegion());
-      for (ItF.GoToBegin(); !ItF.IsAtEnd(); ++ItF)
+      ImageRegionIterator<DisplacementFieldType> ItF(fixedToMiddleSmoothUpdateField,
+                                                     fixedToMiddleSmoothUpdateField->GetLargestPossibleRegion());
+      ImageRegionIterator<DisplacementFieldType> ItM(movingToMiddleSmoothUpdateField,
+                                                     fixedToMiddleSmoothUpdateField->GetLargestPossibleRegion());
+      for (ItF.GoToBegin(), ItM.GoToBegin(); !ItF.IsAtEnd(); ++ItF, ++ItM)
       {
-        ItF.Set(ItF.Get() - movingToMiddleSmoothUpdateField->GetPixel(ItF.GetIndex()));
-        movingToMiddleSmoothUpdateField->SetPixel(ItF.GetIndex(), -ItF.Get());
+        ItF.Set(ItF.Get() - ItM.Get());
+        ItM.Set(-ItF.Get());
       }
     }
 
@@ -572,17 +576,33 @@ typename SyNImageRegistrationMethod<TFixedImage, TMovingImage, TOutputTransform,
   if (this->m_DownsampleImagesForMetricDerivatives &&
       this->m_Metric->GetMetricCategory() != ObjectToObjectMetricBaseTemplateEnums::MetricCategory::POINT_SET_METRIC)
   {
-    const DisplacementVectorType zeroVector{};
+    // The identity field only depends on the virtual domain, so it is only
+    // rebuilt when the virtual domain changes, i.e. at each level
+    const DisplacementFieldType * identityField = nullptr;
+    if (this->m_IdentityDisplacementFieldTransform.IsNotNull())
+    {
+      identityField = this->m_IdentityDisplacementFieldTransform->GetDisplacementField();
+    }
+    if (identityField == nullptr ||
+        identityField->GetLargestPossibleRegion() != virtualDomainImage->GetLargestPossibleRegion() ||
+        identityField->GetSpacing() != virtualDomainImage->GetSpacing() ||
+        identityField->GetOrigin() != virtualDomainImage->GetOrigin() ||
+        identityField->GetDirection() != virtualDomainImage->GetDirection())
+    {
+      const DisplacementVectorType zeroVector{};
 
-    auto identityField = DisplacementFieldType::New();
-    identityField->CopyInformation(virtualDomainImage);
-    identityField->SetRegions(virtualDomainImage->GetLargestPossibleRegion());
-    identityField->Allocate();
-    identityField->FillBuffer(zeroVector);
+      auto newIdentityField = DisplacementFieldType::New();
+      newIdentityField->CopyInformation(virtualDomainImage);
+      newIdentityField->SetRegions(virtualDomainImage->GetLargestPossibleRegion());
+      newIdentityField->Allocate();
+      newIdentityField->FillBuffer(zeroVector);
 
-    DisplacementFieldTransformPointer identityDisplacementFieldTransform = DisplacementFieldTransformType::New();
-    identityDisplacementFieldTransform->SetDisplacementField(identityField);
-    identityDisplacementFieldTransform->SetInverseDisplacementField(identityField);
+      this->m_IdentityDisplacementFieldTransform = DisplacementFieldTransformType::New();
+      this->m_IdentityDisplacementFieldTransform->SetDisplacementField(newIdentityField);
+      this->m_IdentityDisplacementFieldTransform->SetInverseDisplacementField(newIdentityField);
+    }
+    DisplacementFieldTransformType * identityDisplacementFieldTransform =
+      this->m_IdentityDisplacementFieldTransform.GetPointer();
 
     if (this->m_Metric->GetMetricCategory() == ObjectToObjectMetricBaseTemplateEnums::MetricCategory::MULTI_METRIC)
     {
@@ -600,12 +620,48 @@ typename SyNImageRegistrationMethod<TFixedImage, TMovingImage, TOutputTransform,
 
   this->m_Metric->Initialize();
 
+  // we rescale the update velocity field at each time point.
+  // we first need to convert to a displacement field to look
+  // at the max norm of the field.
+
+  // The gradient field is only reallocated when the virtual domain changes,
+  // i.e. at each level
+  if (this->m_MetricGradientField.IsNull() ||
+      this->m_MetricGradientField->GetBufferedRegion() != virtualDomainImage->GetRequestedRegion() ||
+      this->m_MetricGradientField->GetLargestPossibleRegion() != virtualDomainImage->GetLargestPossibleRegion() ||
+      this->m_MetricGradientField->GetSpacing() != virtualDomainImage->GetSpacing() ||
+      this->m_MetricGradientField->GetOrigin() != virtualDomainImage->GetOrigin() ||
+      this->m_MetricGradientField->GetDirection() != virtualDomainImage->GetDirection())
+  {
+    this->m_MetricGradientField = DisplacementFieldType::New();
+    this->m_MetricGradientField->CopyInformation(virtualDomainImage);
+    this->m_MetricGradientField->SetRegions(virtualDomainImage->GetRequestedRegion());
+    this->m_MetricGradientField->Allocate();
+  }
+  DisplacementFieldType * gradientField = this->m_MetricGradientField.GetPointer();
+
   using MetricDerivativeType = typename ImageMetricType::DerivativeType;
+  using MetricDerivativeValueType = typename MetricDerivativeType::ValueType;
   const typename MetricDerivativeType::SizeValueType metricDerivativeSize =
     virtualDomainImage->GetLargestPossibleRegion().GetNumberOfPixels() * ImageDimension;
-  MetricDerivativeType metricDerivative(metricDerivativeSize);
 
-  metricDerivative.Fill(NumericTraits<typename MetricDerivativeType::ValueType>::ZeroValue());
+  // When the layouts match, the metric derivative is directly stored in the
+  // gradient field instead of being copied into it
+  MetricDerivativeType       metricDerivative;
+  MetricDerivativeValueType * gradientFieldBuffer = nullptr;
+  if (std::is_same<typename DisplacementVectorType::ValueType, MetricDerivativeValueType>::value &&
+      sizeof(DisplacementVectorType) == ImageDimension * sizeof(MetricDerivativeValueType) &&
+      gradientField->GetBufferedRegion() == virtualDomainImage->GetLargestPossibleRegion())
+  {
+    gradientFieldBuffer = reinterpret_cast<MetricDerivativeValueType *>(gradientField->GetBufferPointer());
+    metricDerivative.SetData(gradientFieldBuffer, metricDerivativeSize, false);
+  }
+  else
+  {
+    metricDerivative.SetSize(metricDerivativeSize);
+  }
+
+  metricDerivative.Fill(NumericTraits<MetricDerivativeValueType>::ZeroValue());
   this->m_Metric->GetValueAndDerivative(value, metricDerivative);
 
   // Ensure that the size of the optimizer weights is the same as the
@@ -622,26 +678,20 @@ typename SyNImageRegistrationMethod<TFixedImage, TMovingImage, TOutputTransform,
     }
   }
 
-  // we rescale the update velocity field at each time point.
-  // we first need to convert to a displacement field to look
-  // at the max norm of the field.
-
-  auto gradientField = DisplacementFieldType::New();
-  gradientField->CopyInformation(virtualDomainImage);
-  gradientField->SetRegions(virtualDomainImage->GetRequestedRegion());
-  gradientField->Allocate();
-
-  ImageRegionIterator<DisplacementFieldType> ItG(gradientField, gradientField->GetRequestedRegion());
-
-  SizeValueType count = 0;
-  for (ItG.GoToBegin(); !ItG.IsAtEnd(); ++ItG)
+  if (metricDerivative.data_block() != gradientFieldBuffer)
   {
-    DisplacementVectorType displacement;
-    for (SizeValueType d = 0; d < ImageDimension; ++d)
+    ImageRegionIterator<DisplacementFieldType> ItG(gradientField, gradientField->GetRequestedRegion());
+
+    SizeValueType count = 0;
+    for (ItG.GoToBegin(); !ItG.IsAtEnd(); ++ItG)
     {
-      displacement[d] = metricDerivative[count++];
+      DisplacementVectorType displacement;
+      for (SizeValueType d = 0; d < ImageDimension; ++d)
+      {
+        displacement[d] = metricDerivative[count++];
+      }
+      ItG.Set(displacement);
     }
-    ItG.Set(displacement);
   }
 
   return gradientField;
@@ -733,18 +783,19 @@ typename SyNImageRegistrationMethod<TFixedImage, TMovingImage, TOutputTransform,
   SyNImageRegistrationMethod<TFixedImage, TMovingImage, TOutputTransform, TVirtualImage, TPointSet>::
     GaussianSmoothDisplacementField(const DisplacementFieldType * field, const RealType variance)
 {
-  using DuplicatorType = ImageDuplicator<DisplacementFieldType>;
-  auto duplicator = DuplicatorType::New();
-  duplicator->SetInputImage(field);
-  duplicator->Update();
-
-  DisplacementFieldPointer smoothField = duplicator->GetOutput();
-
   if (variance <= 0.0)
   {
-    return smoothField;
+    using DuplicatorType = ImageDuplicator<DisplacementFieldType>;
+    auto duplicator = DuplicatorType::New();
+    duplicator->SetInputImage(field);
+    duplicator->Update();
+
+    return duplicator->GetOutput();
   }
 
+  // The first pass reads the field itself, which is not modified
+  DisplacementFieldPointer smoothField;
+
   using GaussianSmoothingOperatorType = GaussianOperator<RealType, ImageDimension>;
   GaussianSmoothingOperatorType gaussianSmoothingOperator;
 
@@ -758,12 +809,14 @@ typename SyNImageRegistrationMethod<TFixedImage, TMovingImage, TOutputTransform,
     gaussianSmoothingOperator.SetDirection(d);
     gaussianSmoothingOperator.SetVariance(variance);
     gaussianSmoothingOperator.SetMaximumError(0.001);
-    gaussianSmoothingOperator.SetMaximumKernelWidth(smoothField->GetRequestedRegion().GetSize()[d]);
+    const DisplacementFieldType * smootherInput = (d == 0) ? field : smoothField.GetPointer();
+
+    gaussianSmoothingOperator.SetMaximumKernelWidth(smootherInput->GetRequestedRegion().GetSize()[d]);
     gaussianSmoothingOperator.CreateDirectional();
 
     // todo: make sure we only smooth within the buffered region
     smoother->SetOperator(gaussianSmoothingOperator);
-    smoother->SetInput(smoothField);
+    smoother->SetInput(smootherInput);
     try
     {
       smoother->Update();
@@ -373,7 +373,8 @@ itkBSplineImageRegistrationTest(int argc, char * argv[])
   const std::set<itk::ImageRegistrationMethodv4Enums::MetricSamplingStrategy> allMetricSamplingStrategy{
     itk::ImageRegistrationMethodv4Enums::MetricSamplingStrategy::NONE,
     itk::ImageRegistrationMethodv4Enums::MetricSamplingStrategy::REGULAR,
-    itk::ImageRegistrationMethodv4Enums::MetricSamplingStrategy::RANDOM
+    itk::ImageRegistrationMethodv4Enums::MetricSamplingStrategy::RANDOM,
+    itk::ImageRegistrationMethodv4Enums::MetricSamplingStrategy::STOCHASTIC
   };
   for (const auto & ee : allMetricSamplingStrategy)
   {
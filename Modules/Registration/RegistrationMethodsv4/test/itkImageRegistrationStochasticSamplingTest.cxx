@@ -0,0 +1,126 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkImageRegistrationMethodv4.h"
+#include "itkGradientDescentOptimizerv4.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkMeanSquaresImageToImageMetricv4.h"
+#include "itkRegistrationParameterScalesFromPhysicalShift.h"
+#include "itkTestingMacros.h"
+#include "itkTranslationTransform.h"
+
+#include <cmath>
+
+/*
+ * Register two synthetic images that differ by a translation with the
+ * STOCHASTIC metric sampling strategy, which draws a new subset of the
+ * virtual domain at each iteration, and check that the registration
+ * converges to the translation.
+ */
+namespace
+{
+constexpr unsigned int Dimension = 2;
+
+using ImageType = itk::Image<float, Dimension>;
+using TransformType = itk::TranslationTransform<double, Dimension>;
+
+// Two Gaussian blobs of different sizes, shifted by the given translation
+ImageType::Pointer
+MakeImage(const TransformType::OutputVectorType & shift)
+{
+  auto image = ImageType::New();
+  image->SetRegions(itk::MakeSize(64, 64));
+  image->Allocate();
+
+  for (itk::ImageRegionIteratorWithIndex<ImageType> it(image, image->GetBufferedRegion()); !it.IsAtEnd(); ++it)
+  {
+    ImageType::PointType point;
+    image->TransformIndexToPhysicalPoint(it.GetIndex(), point);
+    const double x = point[0] - shift[0];
+    const double y = point[1] - shift[1];
+    const double blob1 = ((x - 26.0) * (x - 26.0) + (y - 30.0) * (y - 30.0)) / (2.0 * 7.0 * 7.0);
+    const double blob2 = ((x - 38.0) * (x - 38.0) + (y - 36.0) * (y - 36.0)) / (2.0 * 4.0 * 4.0);
+    it.Set(static_cast<float>(100.0 * std::exp(-blob1) + 60.0 * std::exp(-blob2)));
+  }
+  return image;
+}
+} // namespace
+
+int
+itkImageRegistrationStochasticSamplingTest(int, char *[])
+{
+  TransformType::OutputVectorType translation;
+  translation[0] = 3.5;
+  translation[1] = -2.5;
+
+  TransformType::OutputVectorType noShift;
+  noShift.Fill(0.0);
+
+  using MetricType = itk::MeanSquaresImageToImageMetricv4<ImageType, ImageType>;
+  auto metric = MetricType::New();
+
+  using ScalesEstimatorType = itk::RegistrationParameterScalesFromPhysicalShift<MetricType>;
+  auto scalesEstimator = ScalesEstimatorType::New();
+  scalesEstimator->SetMetric(metric);
+  scalesEstimator->SetTransformForward(true);
+
+  using OptimizerType = itk::GradientDescentOptimizerv4;
+  auto optimizer = OptimizerType::New();
+  optimizer->SetLearningRate(1.0);
+  optimizer->SetNumberOfIterations(150);
+  optimizer->SetScalesEstimator(scalesEstimator);
+  optimizer->SetMaximumStepSizeInPhysicalUnits(1.0);
+  optimizer->SetMinimumConvergenceValue(-1.0);
+
+  using RegistrationType = itk::ImageRegistrationMethodv4<ImageType, ImageType, TransformType>;
+  auto registration = RegistrationType::New();
+  registration->SetFixedImage(MakeImage(noShift));
+  registration->SetMovingImage(MakeImage(translation));
+  registration->SetMetric(metric);
+  registration->SetOptimizer(optimizer);
+  registration->SetNumberOfLevels(1);
+  registration->SetShrinkFactorsPerLevel(RegistrationType::ShrinkFactorsArrayType(1, 1));
+  registration->SetSmoothingSigmasPerLevel(RegistrationType::SmoothingSigmasArrayType(1, 0.0));
+  registration->SetMetricSamplingStrategy(RegistrationType::MetricSamplingStrategyEnum::STOCHASTIC);
+  registration->SetMetricSamplingPercentage(0.1);
+  registration->MetricSamplingReinitializeSeed(7);
+
+  ITK_TRY_EXPECT_NO_EXCEPTION(registration->Update());
+
+  // Each iteration evaluated a tenth of the voxels
+  ITK_TEST_EXPECT_TRUE(metric->GetUseStochasticSampling());
+  ITK_TEST_EXPECT_EQUAL(metric->GetNumberOfDomainPoints(), 64 * 64 / 10);
+  ITK_TEST_EXPECT_EQUAL(optimizer->GetCurrentIteration(), optimizer->GetNumberOfIterations());
+
+  const TransformType::ParametersType result = registration->GetTransform()->GetParameters();
+  std::cout << "Expecting close (+/- 0.1) to: " << translation << std::endl;
+  std::cout << "Parameters: " << result << std::endl;
+  for (unsigned int d = 0; d < Dimension; ++d)
+  {
+    if (std::abs(result[d] - translation[d]) > 0.1)
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "The registration did not converge to the translation " << translation << ", result: " << result
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -245,6 +245,15 @@ public:
     return ans;
   }
 
+  /** Merges the values needed to compute the time step from the global data
+   * otherGlobalData into GlobalData.  Filters that split the evaluation of
+   * ComputeUpdate over several global data use it to compute the same time
+   * step as if all the updates had been evaluated with a single one.
+   * Subclasses that store additional values in their global data must
+   * override this method. */
+  virtual void
+  MergeGlobalData(void * GlobalData, const void * otherGlobalData) const;
+
   /** This method creates the appropriate member variable operators for the
    * level-set calculations.  The argument to this function is a the radius
    * necessary for performing the level-set calculations. */
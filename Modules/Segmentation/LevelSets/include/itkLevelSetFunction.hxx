@@ -211,6 +211,18 @@ double LevelSetFunction<TImageType>::m_WaveDT = 1.0 / (2.0 * ImageDimension);
 template <typename TImageType>
 double LevelSetFunction<TImageType>::m_DT = 1.0 / (2.0 * ImageDimension);
 
+template <typename TImageType>
+void
+LevelSetFunction<TImageType>::MergeGlobalData(void * GlobalData, const void * otherGlobalData) const
+{
+  auto *       d = (GlobalDataStruct *)GlobalData;
+  const auto * other = (const GlobalDataStruct *)otherGlobalData;
+
+  d->m_MaxAdvectionChange = std::max(d->m_MaxAdvectionChange, other->m_MaxAdvectionChange);
+  d->m_MaxPropagationChange = std::max(d->m_MaxPropagationChange, other->m_MaxPropagationChange);
+  d->m_MaxCurvatureChange = std::max(d->m_MaxCurvatureChange, other->m_MaxCurvatureChange);
+}
+
 template <typename TImageType>
 auto
 LevelSetFunction<TImageType>::ComputeGlobalTimeStep(void * GlobalData) const -> TimeStepType
@@ -126,6 +126,10 @@ public:
   TimeStepType
   ComputeGlobalTimeStep(void * gd) const override;
 
+  /** Merge the global data, including the largest shape prior change. */
+  void
+  MergeGlobalData(void * gd, const void * otherGd) const override;
+
   /** A global data type used to store values needed to compute the time step.
    */
   using typename Superclass::GlobalDataStruct;
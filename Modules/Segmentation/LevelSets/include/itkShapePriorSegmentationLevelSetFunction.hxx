@@ -82,6 +82,22 @@ ShapePriorSegmentationLevelSetFunction<TImageType, TFeatureImageType>::ComputeUp
   return value;
 }
 
+/**
+ * Merge the global data.
+ */
+template <typename TImageType, typename TFeatureImageType>
+void
+ShapePriorSegmentationLevelSetFunction<TImageType, TFeatureImageType>::MergeGlobalData(void *       gd,
+                                                                                       const void * otherGd) const
+{
+  this->Superclass::MergeGlobalData(gd, otherGd);
+
+  auto *       d = (ShapePriorGlobalDataStruct *)gd;
+  const auto * other = (const ShapePriorGlobalDataStruct *)otherGd;
+
+  d->m_MaxShapePriorChange = std::max(d->m_MaxShapePriorChange, other->m_MaxShapePriorChange);
+}
+
 /**
  * Compute the global time step.
  */
@@ -332,6 +332,19 @@ public:
     this->SetInterpolateSurfaceLocation(false);
   }
 
+  /** Get/Set whether the change at the active layer nodes is computed with
+      multiple threads.  The active layer is split into blocks of a fixed
+      number of nodes which are processed concurrently, each with its own
+      global data for the difference function.  The global data of the
+      blocks are merged with LevelSetFunction::MergeGlobalData before the
+      time step is computed, so the time step and the level set are the same
+      as with a single thread.  Difference functions which are not level set
+      functions are evaluated by a single thread.  The difference function
+      must support concurrent calls to ComputeUpdate.  Off by default. */
+  itkSetMacro(ParallelCalculateChange, bool);
+  itkGetConstMacro(ParallelCalculateChange, bool);
+  itkBooleanMacro(ParallelCalculateChange);
+
 #ifdef ITK_USE_CONCEPT_CHECKING
   // Begin concept checking
   itkConceptMacro(OutputEqualityComparableCheck, (Concept::EqualityComparable<typename TOutputImage::PixelType>));
@@ -397,6 +410,15 @@ protected:
   TimeStepType
   CalculateChange() override;
 
+  /** Calculates the change at the active layer nodes in [first, last) and
+   *  stores it in the update buffer, starting at position bufferIndex. */
+  void
+  CalculateChangeForActiveLayerNodes(typename LayerType::ConstIterator first,
+                                     typename LayerType::ConstIterator last,
+                                     SizeValueType                     bufferIndex,
+                                     void *                            globalData,
+                                     ValueType                         minNorm);
+
   /** Initializes a layer of the sparse field using a previously initialized
    * layer. Builds the list of nodes in m_Layer[to] using m_Layer[from].
    * Marks values in the m_StatusImage. */
@@ -525,6 +547,9 @@ protected:
       (speed), advection, or curvature terms should turn this flag off. */
   bool m_InterpolateSurfaceLocation{ true };
 
+  /** Compute the change at the active layer nodes with multiple threads. */
+  bool m_ParallelCalculateChange{ false };
+
   const InputImageType * m_InputImage;
   OutputImageType *      m_OutputImage;
 
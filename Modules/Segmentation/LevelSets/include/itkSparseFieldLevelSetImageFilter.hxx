@@ -23,6 +23,8 @@
 #include "itkShiftScaleImageFilter.h"
 #include "itkNeighborhoodAlgorithm.h"
 #include "itkMath.h"
+#include "itkMultiThreaderBase.h"
+#include "itkLevelSetFunction.h"
 
 namespace itk
 {
@@ -847,41 +849,121 @@ template <typename TInputImage, typename TOutputImage>
 auto
 SparseFieldLevelSetImageFilter<TInputImage, TOutputImage>::CalculateChange() -> TimeStepType
 {
-  const typename Superclass::FiniteDifferenceFunctionType::Pointer   df = this->GetDifferenceFunction();
-  typename Superclass::FiniteDifferenceFunctionType::FloatOffsetType offset;
-  ValueType    norm_grad_phi_squared, dx_forward, dx_backward, forwardValue, backwardValue, centerValue;
-  unsigned int i;
-  ValueType    MIN_NORM = 1.0e-6;
+  const typename Superclass::FiniteDifferenceFunctionType::Pointer df = this->GetDifferenceFunction();
+  ValueType                                                        MIN_NORM = 1.0e-6;
   if (this->GetUseImageSpacing())
   {
     SpacePrecisionType minSpacing = NumericTraits<SpacePrecisionType>::max();
-    for (i = 0; i < ImageDimension; ++i)
+    for (unsigned int i = 0; i < ImageDimension; ++i)
     {
       minSpacing = std::min(minSpacing, this->GetInput()->GetSpacing()[i]);
     }
     MIN_NORM *= minSpacing;
   }
 
-  void * globalData = df->GetGlobalDataPointer();
+  const SizeValueType numberOfNodes = m_Layers[0]->Size();
+
+  m_UpdateBuffer.clear();
+  m_UpdateBuffer.resize(numberOfNodes);
+
+  // Number of active layer nodes processed together when the change is
+  // computed with multiple threads.  It does not depend on the number of
+  // threads, so neither do the results.
+  constexpr SizeValueType blockSize = 512;
+
+  // The global data of the blocks are merged before the time step is
+  // computed, which requires a level set function.
+  using LevelSetFunctionType = LevelSetFunction<OutputImageType>;
+  const auto * levelSetFunction = dynamic_cast<const LevelSetFunctionType *>(df.GetPointer());
+
+  if (!m_ParallelCalculateChange || levelSetFunction == nullptr || numberOfNodes <= blockSize ||
+      this->GetNumberOfWorkUnits() < 2)
+  {
+    void * globalData = df->GetGlobalDataPointer();
+
+    this->CalculateChangeForActiveLayerNodes(m_Layers[0]->Begin(), m_Layers[0]->End(), 0, globalData, MIN_NORM);
+
+    // Ask the finite difference function to compute the time step for
+    // this iteration.  We give it the global data pointer to use, then
+    // ask it to free the global data memory.
+    const TimeStepType timeStep = df->ComputeGlobalTimeStep(globalData);
+
+    df->ReleaseGlobalDataPointer(globalData);
+
+    return timeStep;
+  }
+
+  // Split the active layer into blocks of consecutive nodes.
+  std::vector<typename LayerType::ConstIterator> blockBegin;
+  blockBegin.reserve(numberOfNodes / blockSize + 2);
+  SizeValueType n = 0;
+  for (typename LayerType::ConstIterator layerIt = m_Layers[0]->Begin(); layerIt != m_Layers[0]->End(); ++layerIt, ++n)
+  {
+    if (n % blockSize == 0)
+    {
+      blockBegin.push_back(layerIt);
+    }
+  }
+  blockBegin.push_back(m_Layers[0]->End());
+
+  const SizeValueType numberOfBlocks = blockBegin.size() - 1;
+  std::vector<void *> blockGlobalData(numberOfBlocks);
+
+  MultiThreaderBase * multiThreader = this->GetMultiThreader();
+  multiThreader->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+  multiThreader->ParallelizeArray(
+    0,
+    numberOfBlocks,
+    [this, &df, &blockBegin, &blockGlobalData, MIN_NORM](SizeValueType block) {
+      blockGlobalData[block] = df->GetGlobalDataPointer();
+      this->CalculateChangeForActiveLayerNodes(
+        blockBegin[block], blockBegin[block + 1], block * blockSize, blockGlobalData[block], MIN_NORM);
+    },
+    nullptr);
+
+  // The largest changes over the blocks are the largest changes over the
+  // active layer, so the time step is the one of the single thread case.
+  void * globalData = blockGlobalData[0];
+  for (SizeValueType block = 1; block < numberOfBlocks; ++block)
+  {
+    levelSetFunction->MergeGlobalData(globalData, blockGlobalData[block]);
+    df->ReleaseGlobalDataPointer(blockGlobalData[block]);
+  }
+
+  const TimeStepType timeStep = df->ComputeGlobalTimeStep(globalData);
+
+  df->ReleaseGlobalDataPointer(globalData);
+
+  return timeStep;
+}
+
+template <typename TInputImage, typename TOutputImage>
+void
+SparseFieldLevelSetImageFilter<TInputImage, TOutputImage>::CalculateChangeForActiveLayerNodes(
+  typename LayerType::ConstIterator first,
+  typename LayerType::ConstIterator last,
+  SizeValueType                     bufferIndex,
+  void *                            globalData,
+  ValueType                         minNorm)
+{
+  const typename Superclass::FiniteDifferenceFunctionType::Pointer   df = this->GetDifferenceFunction();
+  typename Superclass::FiniteDifferenceFunctionType::FloatOffsetType offset;
+  ValueType    norm_grad_phi_squared, dx_forward, dx_backward, forwardValue, backwardValue, centerValue;
+  unsigned int i;
 
-  typename LayerType::ConstIterator     layerIt;
   NeighborhoodIterator<OutputImageType> outputIt(
     df->GetRadius(), this->m_OutputImage, this->m_OutputImage->GetRequestedRegion());
-  TimeStepType timeStep;
 
   if (m_BoundsCheckingActive == false)
   {
     outputIt.NeedToUseBoundaryConditionOff();
   }
 
-  m_UpdateBuffer.clear();
-  m_UpdateBuffer.reserve(m_Layers[0]->Size());
-
   // Calculates the update values for the active layer indices in this
   // iteration.  Iterates through the active layer index list, applying
   // the level set function to the output image (level set image) at each
   // index.  Update values are stored in the update buffer.
-  for (layerIt = m_Layers[0]->Begin(); layerIt != m_Layers[0]->End(); ++layerIt)
+  for (typename LayerType::ConstIterator layerIt = first; layerIt != last; ++layerIt, ++bufferIndex)
   {
     outputIt.SetLocation(layerIt->m_Value);
 
@@ -932,25 +1014,16 @@ SparseFieldLevelSetImageFilter<TInputImage, TOutputImage>::CalculateChange() ->
 
       for (i = 0; i < ImageDimension; ++i)
       {
-        offset[i] = (offset[i] * centerValue) / (norm_grad_phi_squared + MIN_NORM);
+        offset[i] = (offset[i] * centerValue) / (norm_grad_phi_squared + minNorm);
       }
 
-      m_UpdateBuffer.push_back(df->ComputeUpdate(outputIt, globalData, offset));
+      m_UpdateBuffer[bufferIndex] = df->ComputeUpdate(outputIt, globalData, offset);
     }
     else // Don't do interpolation
     {
-      m_UpdateBuffer.push_back(df->ComputeUpdate(outputIt, globalData));
+      m_UpdateBuffer[bufferIndex] = df->ComputeUpdate(outputIt, globalData);
     }
   }
-
-  // Ask the finite difference function to compute the time step for
-  // this iteration.  We give it the global data pointer to use, then
-  // ask it to free the global data memory.
-  timeStep = df->ComputeGlobalTimeStep(globalData);
-
-  df->ReleaseGlobalDataPointer(globalData);
-
-  return timeStep;
 }
 
 template <typename TInputImage, typename TOutputImage>
@@ -1137,7 +1210,8 @@ SparseFieldLevelSetImageFilter<TInputImage, TOutputImage>::PrintSelf(std::ostrea
   unsigned int i;
   os << indent << "m_IsoSurfaceValue: " << m_IsoSurfaceValue << std::endl;
   itkPrintSelfObjectMacro(LayerNodeStore);
-  os << indent << "m_BoundsCheckingActive: " << m_BoundsCheckingActive;
+  os << indent << "m_BoundsCheckingActive: " << m_BoundsCheckingActive << std::endl;
+  os << indent << "ParallelCalculateChange: " << (m_ParallelCalculateChange ? "On" : "Off") << std::endl;
   for (i = 0; i < m_Layers.size(); ++i)
   {
     os << indent << "m_Layers[" << i << "]: size=" << m_Layers[i]->Size() << std::endl;
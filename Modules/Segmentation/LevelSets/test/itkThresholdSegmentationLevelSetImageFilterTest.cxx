@@ -17,6 +17,8 @@
  *=========================================================================*/
 
 #include "itkThresholdSegmentationLevelSetImageFilter.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkMath.h"
 #include "itkTestingMacros.h"
 
 namespace TSIFTN
@@ -242,6 +244,66 @@ itkThresholdSegmentationLevelSetImageFilterTest(int, char *[])
 
   std::cout << "Done second trial" << std::endl;
 
+  // Compute the change at the active layer with multiple threads and check
+  // that the level set matches the one computed with a single thread. The
+  // updates of the nodes do not depend on the blocks, and the global data of
+  // the blocks are merged before the time step is computed, so the level
+  // sets must be identical.
+  ITK_TEST_SET_GET_BOOLEAN(filter, ParallelCalculateChange, false);
+
+  filter->SetNumberOfIterations(10);
+  ITK_TRY_EXPECT_NO_EXCEPTION(filter->Update());
+
+  TSIFTN::ImageType::Pointer serialOutput = filter->GetOutput();
+  serialOutput->DisconnectPipeline();
+
+  filter->ParallelCalculateChangeOn();
+  filter->SetNumberOfWorkUnits(4);
+  ITK_TRY_EXPECT_NO_EXCEPTION(filter->Update());
+
+  itk::ImageRegionConstIterator<TSIFTN::ImageType> serialIt(serialOutput, reg);
+  itk::ImageRegionConstIterator<TSIFTN::ImageType> parallelIt(filter->GetOutput(), reg);
+  itk::SizeValueType                               numberOfMismatches = 0;
+  for (; !serialIt.IsAtEnd(); ++serialIt, ++parallelIt)
+  {
+    if (itk::Math::NotExactlyEquals(serialIt.Get(), parallelIt.Get()))
+    {
+      ++numberOfMismatches;
+    }
+  }
+  if (numberOfMismatches > 0)
+  {
+    std::cerr << "Test failed!" << std::endl;
+    std::cerr << "Voxels with a different level set value with ParallelCalculateChange: " << numberOfMismatches
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Done parallel trial" << std::endl;
+
+  // The level set function adds the largest advection and propagation
+  // changes. When they are found in different blocks, the merged global data
+  // must give the time step of a single global data holding both.
+  using SegmentationFunctionType = FilterType::SegmentationFunctionType;
+  using GlobalDataType = SegmentationFunctionType::GlobalDataStruct;
+  SegmentationFunctionType * function = filter->GetSegmentationFunction();
+
+  auto * singleGlobalData = static_cast<GlobalDataType *>(function->GetGlobalDataPointer());
+  auto * firstGlobalData = static_cast<GlobalDataType *>(function->GetGlobalDataPointer());
+  auto * secondGlobalData = static_cast<GlobalDataType *>(function->GetGlobalDataPointer());
+  singleGlobalData->m_MaxAdvectionChange = firstGlobalData->m_MaxAdvectionChange = 2.0;
+  singleGlobalData->m_MaxPropagationChange = secondGlobalData->m_MaxPropagationChange = 3.0;
+  singleGlobalData->m_MaxCurvatureChange = secondGlobalData->m_MaxCurvatureChange = 0.5;
+  firstGlobalData->m_MaxCurvatureChange = 0.25;
+
+  function->MergeGlobalData(firstGlobalData, secondGlobalData);
+  const SegmentationFunctionType::TimeStepType singleTimeStep = function->ComputeGlobalTimeStep(singleGlobalData);
+  const SegmentationFunctionType::TimeStepType mergedTimeStep = function->ComputeGlobalTimeStep(firstGlobalData);
+  function->ReleaseGlobalDataPointer(singleGlobalData);
+  function->ReleaseGlobalDataPointer(firstGlobalData);
+  function->ReleaseGlobalDataPointer(secondGlobalData);
+  ITK_TEST_EXPECT_EQUAL(mergedTimeStep, singleTimeStep);
+
   // Write the output for debugging purposes
   //       itk::ImageFileWriter<TSIFTN::ImageType>::Pointer writer
   //          = itk::ImageFileWriter<TSIFTN::ImageType>::New();
@@ -139,14 +139,7 @@ public:
       , ForwardGradient("ForwardGradient")
       , BackwardGradient("BackwardGradient")
     {
-      Value.m_Value = NumericTraits<OutputType>::ZeroValue();
-      Gradient.m_Value.Fill(NumericTraits<OutputRealType>::ZeroValue());
-      Hessian.m_Value.Fill(NumericTraits<OutputRealType>::ZeroValue());
-      Laplacian.m_Value = NumericTraits<OutputRealType>::ZeroValue();
-      GradientNorm.m_Value = NumericTraits<OutputRealType>::ZeroValue();
-      MeanCurvature.m_Value = NumericTraits<OutputRealType>::ZeroValue();
-      ForwardGradient.m_Value.Fill(NumericTraits<OutputRealType>::ZeroValue());
-      BackwardGradient.m_Value.Fill(NumericTraits<OutputRealType>::ZeroValue());
+      this->Reset();
     }
 
     LevelSetDataType(const LevelSetDataType & iData)
@@ -175,6 +168,29 @@ public:
       BackwardGradient = iData.BackwardGradient;
     }
 
+    /** Mark all the characteristics as not computed, so that the structure
+     *  can be reused at another location without being reconstructed. */
+    void
+    Reset()
+    {
+      Value.m_Value = NumericTraits<OutputType>::ZeroValue();
+      Value.m_Computed = false;
+      Gradient.m_Value.Fill(NumericTraits<OutputRealType>::ZeroValue());
+      Gradient.m_Computed = false;
+      Hessian.m_Value.Fill(NumericTraits<OutputRealType>::ZeroValue());
+      Hessian.m_Computed = false;
+      Laplacian.m_Value = NumericTraits<OutputRealType>::ZeroValue();
+      Laplacian.m_Computed = false;
+      GradientNorm.m_Value = NumericTraits<OutputRealType>::ZeroValue();
+      GradientNorm.m_Computed = false;
+      MeanCurvature.m_Value = NumericTraits<OutputRealType>::ZeroValue();
+      MeanCurvature.m_Computed = false;
+      ForwardGradient.m_Value.Fill(NumericTraits<OutputRealType>::ZeroValue());
+      ForwardGradient.m_Computed = false;
+      BackwardGradient.m_Value.Fill(NumericTraits<OutputRealType>::ZeroValue());
+      BackwardGradient.m_Computed = false;
+    }
+
     /** the boolean value stores if it has already been computed */
     DataType<OutputType>     Value;
     DataType<GradientType>   Gradient;
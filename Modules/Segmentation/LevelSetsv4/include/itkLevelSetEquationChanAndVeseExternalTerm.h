@@ -101,6 +101,13 @@ public:
   void
   ComputeProductTerm(const LevelSetInputIndexType & iP, LevelSetOutputRealType & prod) override;
 
+  /** Compute the product terms at a block of locations, looking the other
+   *  level sets up once for all the consecutive locations of a same domain */
+  void
+  ComputeProductTerms(const LevelSetInputIndexType * inputIndices,
+                      SizeValueType                  numberOfIndices,
+                      LevelSetOutputRealType *       prods) override;
+
   /** Supply updates at pixels to keep the term parameters always updated */
   void
   UpdatePixel(const LevelSetInputIndexType & iP,
@@ -19,6 +19,7 @@
 #ifndef itkLevelSetEquationChanAndVeseExternalTerm_hxx
 #define itkLevelSetEquationChanAndVeseExternalTerm_hxx
 
+#include <vector>
 
 namespace itk
 {
@@ -60,8 +61,8 @@ LevelSetEquationChanAndVeseExternalTerm<TInput, TLevelSetContainer>::ComputeProd
     const LevelSetIdentifierType id = this->m_CacheImage->GetPixel(iP);
 
     using DomainMapType = typename DomainMapImageFilterType::DomainMapType;
-    const DomainMapType domainMap = this->m_DomainMapImageFilter->GetDomainMap();
-    auto                levelSetMapItr = domainMap.find(id);
+    const DomainMapType & domainMap = this->m_DomainMapImageFilter->GetDomainMap();
+    auto                  levelSetMapItr = domainMap.find(id);
 
     if (levelSetMapItr != domainMap.end())
     {
@@ -108,6 +109,89 @@ LevelSetEquationChanAndVeseExternalTerm<TInput, TLevelSetContainer>::ComputeProd
   }
 }
 
+template <typename TInput, typename TLevelSetContainer>
+void
+LevelSetEquationChanAndVeseExternalTerm<TInput, TLevelSetContainer>::ComputeProductTerms(
+  const LevelSetInputIndexType * inputIndices,
+  SizeValueType                  numberOfIndices,
+  LevelSetOutputRealType *       prods)
+{
+  // Other level sets contributing to the product at the current location
+  std::vector<LevelSetType *> levelSets;
+
+  if (this->m_LevelSetContainer->HasDomainMap())
+  {
+    if (this->m_DomainMapImageFilter == nullptr)
+    {
+      this->m_DomainMapImageFilter = this->m_LevelSetContainer->GetModifiableDomainMapFilter();
+      this->m_CacheImage = this->m_DomainMapImageFilter->GetOutput();
+    }
+
+    using DomainMapType = typename DomainMapImageFilterType::DomainMapType;
+    const DomainMapType & domainMap = this->m_DomainMapImageFilter->GetDomainMap();
+
+    bool                   hasLevelSets = false;
+    LevelSetIdentifierType levelSetsId{};
+
+    for (SizeValueType k = 0; k < numberOfIndices; ++k)
+    {
+      const LevelSetIdentifierType id = this->m_CacheImage->GetPixel(inputIndices[k]);
+
+      // Consecutive locations mostly lie in the same domain
+      if (!hasLevelSets || id != levelSetsId)
+      {
+        levelSets.clear();
+        auto levelSetMapItr = domainMap.find(id);
+        if (levelSetMapItr != domainMap.end())
+        {
+          for (const auto & listId : *(levelSetMapItr->second.GetIdList()))
+          {
+            //! \todo Fix me for string identifiers
+            const LevelSetIdentifierType kk = listId - 1;
+            if (kk != this->m_CurrentLevelSetId)
+            {
+              levelSets.push_back(this->m_LevelSetContainer->GetLevelSet(kk));
+            }
+          }
+        }
+        hasLevelSets = true;
+        levelSetsId = id;
+      }
+
+      prods[k] = -1 * NumericTraits<LevelSetOutputRealType>::OneValue();
+      for (LevelSetType * levelSet : levelSets)
+      {
+        const LevelSetOutputRealType value = levelSet->Evaluate(inputIndices[k]);
+        prods[k] *= (NumericTraits<LevelSetOutputRealType>::OneValue() - this->m_Heaviside->Evaluate(-value));
+      }
+    }
+  }
+  else
+  {
+    typename LevelSetContainerType::Iterator lsIt = this->m_LevelSetContainer->Begin();
+
+    while (lsIt != this->m_LevelSetContainer->End())
+    {
+      const LevelSetIdentifierType kk = lsIt->GetIdentifier();
+      if (kk != this->m_CurrentLevelSetId)
+      {
+        levelSets.push_back(this->m_LevelSetContainer->GetLevelSet(kk));
+      }
+      ++lsIt;
+    }
+
+    for (SizeValueType k = 0; k < numberOfIndices; ++k)
+    {
+      prods[k] = -1 * NumericTraits<LevelSetOutputRealType>::OneValue();
+      for (LevelSetType * levelSet : levelSets)
+      {
+        const LevelSetOutputRealType value = levelSet->Evaluate(inputIndices[k]);
+        prods[k] *= (NumericTraits<LevelSetOutputRealType>::OneValue() - this->m_Heaviside->Evaluate(-value));
+      }
+    }
+  }
+}
+
 template <typename TInput, typename TLevelSetContainer>
 void
 LevelSetEquationChanAndVeseExternalTerm<TInput, TLevelSetContainer>::UpdatePixel(
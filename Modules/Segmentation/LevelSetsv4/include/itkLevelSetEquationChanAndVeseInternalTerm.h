@@ -111,6 +111,13 @@ public:
   ComputeProductTerm(const LevelSetInputIndexType &, LevelSetOutputRealType &)
   {}
 
+  /** Compute the product terms at a block of numberOfIndices locations.
+   *  Each product is initialized to one before calling ComputeProductTerm(). */
+  virtual void
+  ComputeProductTerms(const LevelSetInputIndexType * inputIndices,
+                      SizeValueType                  numberOfIndices,
+                      LevelSetOutputRealType *       prods);
+
   /** Supply updates at pixels to keep the term parameters always updated */
   void
   UpdatePixel(const LevelSetInputIndexType & inputIndex,
@@ -132,6 +139,14 @@ protected:
   LevelSetOutputRealType
   Value(const LevelSetInputIndexType & inputIndex, const LevelSetDataType & data) override;
 
+  /** Returns the term contributions at a block of locations, the product
+   *  terms of the whole block being computed at once. */
+  void
+  BlockValue(const LevelSetInputIndexType * inputIndices,
+             const LevelSetDataType *       data,
+             SizeValueType                  numberOfIndices,
+             LevelSetOutputRealType *       values) override;
+
   /** Accumulate contribution to term parameters from a given pixel */
   void
   Accumulate(const InputPixelType & inputPixel, const LevelSetOutputRealType & heavisideValue);
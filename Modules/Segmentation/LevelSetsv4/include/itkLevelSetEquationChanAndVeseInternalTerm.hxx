@@ -19,6 +19,7 @@
 #ifndef itkLevelSetEquationChanAndVeseInternalTerm_hxx
 #define itkLevelSetEquationChanAndVeseInternalTerm_hxx
 
+#include <algorithm>
 
 namespace itk
 {
@@ -168,6 +169,52 @@ LevelSetEquationChanAndVeseInternalTerm<TInput, TLevelSetContainer>::Value(const
   return NumericTraits<LevelSetOutputPixelType>::ZeroValue();
 }
 
+template <typename TInput, typename TLevelSetContainer>
+void
+LevelSetEquationChanAndVeseInternalTerm<TInput, TLevelSetContainer>::BlockValue(
+  const LevelSetInputIndexType * inputIndices,
+  const LevelSetDataType *       data,
+  SizeValueType                  numberOfIndices,
+  LevelSetOutputRealType *       values)
+{
+  if (this->m_Heaviside.IsNotNull())
+  {
+    // The products are computed in place, before being weighted
+    this->ComputeProductTerms(inputIndices, numberOfIndices, values);
+
+    for (SizeValueType k = 0; k < numberOfIndices; ++k)
+    {
+      const LevelSetOutputRealType value = data[k].Value.m_Value;
+
+      const LevelSetOutputRealType d_val = this->m_Heaviside->EvaluateDerivative(-value);
+
+      const InputPixelType pixel = this->m_Input->GetPixel(inputIndices[k]);
+
+      values[k] =
+        d_val * values[k] * static_cast<LevelSetOutputRealType>((pixel - this->m_Mean) * (pixel - this->m_Mean));
+    }
+  }
+  else
+  {
+    itkWarningMacro(<< "m_Heaviside is nullptr");
+    std::fill_n(values, numberOfIndices, NumericTraits<LevelSetOutputRealType>::ZeroValue());
+  }
+}
+
+template <typename TInput, typename TLevelSetContainer>
+void
+LevelSetEquationChanAndVeseInternalTerm<TInput, TLevelSetContainer>::ComputeProductTerms(
+  const LevelSetInputIndexType * inputIndices,
+  SizeValueType                  numberOfIndices,
+  LevelSetOutputRealType *       prods)
+{
+  for (SizeValueType k = 0; k < numberOfIndices; ++k)
+  {
+    prods[k] = NumericTraits<LevelSetOutputRealType>::OneValue();
+    this->ComputeProductTerm(inputIndices[k], prods[k]);
+  }
+}
+
 template <typename TInput, typename TLevelSetContainer>
 void
 LevelSetEquationChanAndVeseInternalTerm<TInput, TLevelSetContainer>::Accumulate(
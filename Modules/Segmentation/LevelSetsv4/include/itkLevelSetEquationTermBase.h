@@ -109,6 +109,16 @@ public:
   virtual LevelSetOutputRealType
   Evaluate(const LevelSetInputIndexType & iP, const LevelSetDataType & iData);
 
+  /** Returns the weighted term contributions at a block of iNumberOfIndices
+   *  locations iP, given the data iData already computed at each of them.
+   *  oValues[k] is equal to Evaluate( iP[k], iData[k] ).
+   */
+  void
+  Evaluate(const LevelSetInputIndexType * iP,
+           const LevelSetDataType *       iData,
+           SizeValueType                  iNumberOfIndices,
+           LevelSetOutputRealType *       oValues);
+
   /** \todo to be documented. */
   virtual void
   Initialize(const LevelSetInputIndexType & iP) = 0;
@@ -159,6 +169,16 @@ protected:
   virtual LevelSetOutputRealType
   Value(const LevelSetInputIndexType & iP, const LevelSetDataType & iData) = 0;
 
+  /** Returns the term contributions at a block of locations. The default
+   *  implementation calls Value() at each location; terms may override it to
+   *  share the work that does not depend on the location within a block.
+   */
+  virtual void
+  BlockValue(const LevelSetInputIndexType * iP,
+             const LevelSetDataType *       iData,
+             SizeValueType                  iNumberOfIndices,
+             LevelSetOutputRealType *       oValues);
+
   /** Input image */
   InputImagePointer m_Input;
 
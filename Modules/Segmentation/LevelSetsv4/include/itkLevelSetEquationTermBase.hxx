@@ -21,6 +21,7 @@
 
 #include "itkNumericTraits.h"
 #include "itkMath.h"
+#include <algorithm>
 
 namespace itk
 {
@@ -94,6 +95,44 @@ LevelSetEquationTermBase<TInputImage, TLevelSetContainer>::Evaluate(const LevelS
 }
 // ----------------------------------------------------------------------------
 
+// ----------------------------------------------------------------------------
+template <typename TInputImage, typename TLevelSetContainer>
+void
+LevelSetEquationTermBase<TInputImage, TLevelSetContainer>::Evaluate(const LevelSetInputIndexType * iP,
+                                                                    const LevelSetDataType *       iData,
+                                                                    SizeValueType                  iNumberOfIndices,
+                                                                    LevelSetOutputRealType *       oValues)
+{
+  if (itk::Math::abs(this->m_Coefficient) > NumericTraits<LevelSetOutputRealType>::epsilon())
+  {
+    this->BlockValue(iP, iData, iNumberOfIndices, oValues);
+    for (SizeValueType k = 0; k < iNumberOfIndices; ++k)
+    {
+      oValues[k] = this->m_Coefficient * oValues[k];
+    }
+  }
+  else
+  {
+    std::fill_n(oValues, iNumberOfIndices, NumericTraits<LevelSetOutputRealType>::ZeroValue());
+  }
+}
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+template <typename TInputImage, typename TLevelSetContainer>
+void
+LevelSetEquationTermBase<TInputImage, TLevelSetContainer>::BlockValue(const LevelSetInputIndexType * iP,
+                                                                      const LevelSetDataType *       iData,
+                                                                      SizeValueType                  iNumberOfIndices,
+                                                                      LevelSetOutputRealType *       oValues)
+{
+  for (SizeValueType k = 0; k < iNumberOfIndices; ++k)
+  {
+    oValues[k] = this->Value(iP[k], iData[k]);
+  }
+}
+// ----------------------------------------------------------------------------
+
 // ----------------------------------------------------------------------------
 template <typename TInputImage, typename TLevelSetContainer>
 void
@@ -26,6 +26,7 @@
 #include <map>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace itk
 {
@@ -124,6 +125,16 @@ public:
   LevelSetOutputRealType
   Evaluate(const LevelSetInputIndexType & iP, const LevelSetDataType & iData);
 
+  /** Evaluate the terms at a block of iNumberOfIndices pixel locations, given
+   *  the data already computed at each of them. oValues[k] is equal to
+   *  Evaluate( iP[k], iData[k] ), but each term is called once for the whole
+   *  block and the CFL contributions are updated once per block. */
+  void
+  Evaluate(const LevelSetInputIndexType * iP,
+           const LevelSetDataType *       iData,
+           SizeValueType                  iNumberOfIndices,
+           LevelSetOutputRealType *       oValues);
+
   /** Update the term parameters at end of iteration */
   void
   Update();
@@ -135,6 +146,11 @@ public:
   void
   ComputeRequiredData(const LevelSetInputIndexType & iP, LevelSetDataType & ioData);
 
+  /** Compute the data required by the terms at a block of iNumberOfIndices
+   *  pixel locations, so that it is shared by all the terms. */
+  void
+  ComputeRequiredData(const LevelSetInputIndexType * iP, SizeValueType iNumberOfIndices, LevelSetDataType * ioData);
+
 protected:
   using MapTermContainerType = std::map<TermIdType, TermPointer>;
   using MapTermContainerIteratorType = typename MapTermContainerType::iterator;
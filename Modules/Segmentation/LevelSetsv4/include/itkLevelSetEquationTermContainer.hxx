@@ -21,6 +21,7 @@
 
 #include "itkMath.h"
 #include "itkObject.h"
+#include <algorithm>
 
 namespace itk
 {
@@ -322,6 +323,46 @@ LevelSetEquationTermContainer<TInputImage, TLevelSetContainer>::Evaluate(const L
   return oValue;
 }
 
+// ----------------------------------------------------------------------------
+template <typename TInputImage, typename TLevelSetContainer>
+void
+LevelSetEquationTermContainer<TInputImage, TLevelSetContainer>::Evaluate(const LevelSetInputIndexType * iP,
+                                                                         const LevelSetDataType * iData,
+                                                                         SizeValueType iNumberOfIndices,
+                                                                         LevelSetOutputRealType * oValues)
+{
+  std::fill_n(oValues, iNumberOfIndices, NumericTraits<LevelSetOutputRealType>::ZeroValue());
+
+  std::vector<LevelSetOutputRealType> termValues(iNumberOfIndices);
+
+  auto term_it = m_Container.begin();
+  auto term_end = m_Container.end();
+
+  auto cfl_it = m_TermContribution.begin();
+
+  while (term_it != term_end)
+  {
+    (term_it->second)->Evaluate(iP, iData, iNumberOfIndices, termValues.data());
+
+    LevelSetOutputRealType abs_max_value = NumericTraits<LevelSetOutputRealType>::ZeroValue();
+    for (SizeValueType k = 0; k < iNumberOfIndices; ++k)
+    {
+      abs_max_value = std::max(abs_max_value, itk::Math::abs(termValues[k]));
+      oValues[k] += termValues[k];
+    }
+
+    // This is a thread-safe equivalent of:
+    // cfl_it->second = std::max(abs_max_value, cfl_it->second);
+    LevelSetOutputRealType previous_value = cfl_it->second;
+    while ((abs_max_value > previous_value) && !cfl_it->second.compare_exchange_strong(previous_value, abs_max_value))
+    {
+    }
+
+    ++term_it;
+    ++cfl_it;
+  }
+}
+
 // ----------------------------------------------------------------------------
 template <typename TInputImage, typename TLevelSetContainer>
 void
@@ -422,5 +463,81 @@ LevelSetEquationTermContainer<TInputImage, TLevelSetContainer>::ComputeRequiredD
   }
 }
 
+// ----------------------------------------------------------------------------
+template <typename TInputImage, typename TLevelSetContainer>
+void
+LevelSetEquationTermContainer<TInputImage, TLevelSetContainer>::ComputeRequiredData(const LevelSetInputIndexType * iP,
+                                                                                    SizeValueType iNumberOfIndices,
+                                                                                    LevelSetDataType * ioData)
+{
+  auto tIt = m_Container.begin();
+
+  LevelSetPointer levelset = (tIt->second)->GetModifiableCurrentLevelSetPointer();
+
+  // The characteristics at a location only depend on the data of this
+  // location, so each one is computed over the whole block in turn and the
+  // names are only compared once per block.
+  for (const auto & requiredData : m_RequiredData)
+  {
+    if (requiredData == "Value")
+    {
+      for (SizeValueType k = 0; k < iNumberOfIndices; ++k)
+      {
+        levelset->Evaluate(iP[k], ioData[k]);
+      }
+    }
+    if (requiredData == "Gradient")
+    {
+      for (SizeValueType k = 0; k < iNumberOfIndices; ++k)
+      {
+        levelset->EvaluateGradient(iP[k], ioData[k]);
+      }
+    }
+    if (requiredData == "Hessian")
+    {
+      for (SizeValueType k = 0; k < iNumberOfIndices; ++k)
+      {
+        levelset->EvaluateHessian(iP[k], ioData[k]);
+      }
+    }
+    if (requiredData == "Laplacian")
+    {
+      for (SizeValueType k = 0; k < iNumberOfIndices; ++k)
+      {
+        levelset->EvaluateLaplacian(iP[k], ioData[k]);
+      }
+    }
+    if (requiredData == "GradientNorm")
+    {
+      for (SizeValueType k = 0; k < iNumberOfIndices; ++k)
+      {
+        levelset->EvaluateGradientNorm(iP[k], ioData[k]);
+      }
+    }
+    if (requiredData == "MeanCurvature")
+    {
+      for (SizeValueType k = 0; k < iNumberOfIndices; ++k)
+      {
+        levelset->EvaluateMeanCurvature(iP[k], ioData[k]);
+      }
+    }
+    if (requiredData == "ForwardGradient")
+    {
+      for (SizeValueType k = 0; k < iNumberOfIndices; ++k)
+      {
+        levelset->EvaluateForwardGradient(iP[k], ioData[k]);
+      }
+    }
+    if (requiredData == "BackwardGradient")
+    {
+      for (SizeValueType k = 0; k < iNumberOfIndices; ++k)
+      {
+        levelset->EvaluateBackwardGradient(iP[k], ioData[k]);
+      }
+    }
+    // here add new characteristics
+  }
+}
+
 } // namespace itk
 #endif // itkLevelSetEquationTermContainer_hxx
@@ -360,6 +360,14 @@ public:
   using UpdateLevelSetFilterType = UpdateShiSparseLevelSet<ImageDimension, EquationContainerType>;
   using UpdateLevelSetFilterPointer = typename UpdateLevelSetFilterType::Pointer;
 
+  /** Set the maximum number of threads to be used. */
+  void
+  SetNumberOfWorkUnits(const ThreadIdType numberOfWorkUnits);
+
+  /** Set the maximum number of threads to be used. */
+  ThreadIdType
+  GetNumberOfWorkUnits() const;
+
   LevelSetEvolution() = default;
   ~LevelSetEvolution() override = default;
 
@@ -371,6 +379,8 @@ protected:
   /** Update the equations at the end of 1 iteration */
   void
   UpdateEquations() override;
+
+  ThreadIdType m_NumberOfWorkUnits{ MultiThreaderBase::GetGlobalDefaultNumberOfThreads() };
 };
 
 // Malcolm
@@ -439,6 +449,14 @@ public:
   using UpdateLevelSetFilterType = UpdateMalcolmSparseLevelSet<ImageDimension, EquationContainerType>;
   using UpdateLevelSetFilterPointer = typename UpdateLevelSetFilterType::Pointer;
 
+  /** Set the maximum number of threads to be used. */
+  void
+  SetNumberOfWorkUnits(const ThreadIdType numberOfWorkUnits);
+
+  /** Set the maximum number of threads to be used. */
+  ThreadIdType
+  GetNumberOfWorkUnits() const;
+
   LevelSetEvolution() = default;
   ~LevelSetEvolution() override = default;
 
@@ -447,6 +465,8 @@ protected:
   UpdateLevelSets() override;
   void
   UpdateEquations() override;
+
+  ThreadIdType m_NumberOfWorkUnits{ MultiThreaderBase::GetGlobalDefaultNumberOfThreads() };
 };
 } // namespace itk
 
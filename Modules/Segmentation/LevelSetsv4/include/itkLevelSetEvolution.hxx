@@ -274,7 +274,7 @@ LevelSetEvolution<TEquationContainer, WhitakerSparseLevelSetImage<TOutput, VDime
   {
     typename LevelSetType::ConstPointer levelSet =
       this->m_LevelSetContainerIteratorToProcessWhenThreading->GetLevelSet();
-    const LevelSetLayerType                           zeroLayer = levelSet->GetLayer(0);
+    const LevelSetLayerType &                         zeroLayer = levelSet->GetLayer(0);
     auto                                              layerBegin = zeroLayer.begin();
     auto                                              layerEnd = zeroLayer.end();
     typename SplitLevelSetPartitionerType::DomainType completeDomain(layerBegin, layerEnd);
@@ -354,6 +354,21 @@ LevelSetEvolution<TEquationContainer, WhitakerSparseLevelSetImage<TOutput, VDime
 
 // Shi
 
+template <typename TEquationContainer, unsigned int VDimension>
+void
+LevelSetEvolution<TEquationContainer, ShiSparseLevelSetImage<VDimension>>::SetNumberOfWorkUnits(
+  const ThreadIdType numberOfWorkUnits)
+{
+  this->m_NumberOfWorkUnits = numberOfWorkUnits;
+}
+
+template <typename TEquationContainer, unsigned int VDimension>
+ThreadIdType
+LevelSetEvolution<TEquationContainer, ShiSparseLevelSetImage<VDimension>>::GetNumberOfWorkUnits() const
+{
+  return this->m_NumberOfWorkUnits;
+}
+
 template <typename TEquationContainer, unsigned int VDimension>
 void
 LevelSetEvolution<TEquationContainer, ShiSparseLevelSetImage<VDimension>>::UpdateLevelSets()
@@ -368,6 +383,7 @@ LevelSetEvolution<TEquationContainer, ShiSparseLevelSetImage<VDimension>>::Updat
     updateLevelSet->SetInputLevelSet(levelSet);
     updateLevelSet->SetCurrentLevelSetId(it->GetIdentifier());
     updateLevelSet->SetEquationContainer(this->m_EquationContainer);
+    updateLevelSet->SetNumberOfWorkUnits(this->m_NumberOfWorkUnits);
     updateLevelSet->Update();
 
     levelSet->Graft(updateLevelSet->GetOutputLevelSet());
@@ -387,6 +403,21 @@ LevelSetEvolution<TEquationContainer, ShiSparseLevelSetImage<VDimension>>::Updat
 
 // Malcolm
 
+template <typename TEquationContainer, unsigned int VDimension>
+void
+LevelSetEvolution<TEquationContainer, MalcolmSparseLevelSetImage<VDimension>>::SetNumberOfWorkUnits(
+  const ThreadIdType numberOfWorkUnits)
+{
+  this->m_NumberOfWorkUnits = numberOfWorkUnits;
+}
+
+template <typename TEquationContainer, unsigned int VDimension>
+ThreadIdType
+LevelSetEvolution<TEquationContainer, MalcolmSparseLevelSetImage<VDimension>>::GetNumberOfWorkUnits() const
+{
+  return this->m_NumberOfWorkUnits;
+}
+
 template <typename TEquationContainer, unsigned int VDimension>
 void
 LevelSetEvolution<TEquationContainer, MalcolmSparseLevelSetImage<VDimension>>::UpdateLevelSets()
@@ -402,6 +433,7 @@ LevelSetEvolution<TEquationContainer, MalcolmSparseLevelSetImage<VDimension>>::U
     updateLevelSet->SetInputLevelSet(levelSet);
     updateLevelSet->SetCurrentLevelSetId(levelSetId);
     updateLevelSet->SetEquationContainer(this->m_EquationContainer);
+    updateLevelSet->SetNumberOfWorkUnits(this->m_NumberOfWorkUnits);
     updateLevelSet->Update();
 
     levelSet->Graft(updateLevelSet->GetOutputLevelSet());
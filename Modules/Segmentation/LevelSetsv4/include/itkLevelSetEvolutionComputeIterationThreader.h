@@ -190,6 +190,7 @@ public:
   using LevelSetIdentifierType = typename LevelSetEvolutionType::LevelSetIdentifierType;
   using LevelSetInputType = typename LevelSetEvolutionType::LevelSetInputType;
   using LevelSetOutputType = typename LevelSetEvolutionType::LevelSetOutputType;
+  using LevelSetOutputRealType = typename LevelSetEvolutionType::LevelSetOutputRealType;
   using LevelSetDataType = typename LevelSetEvolutionType::LevelSetDataType;
   using TermContainerType = typename LevelSetEvolutionType::TermContainerType;
   using NodePairType = typename LevelSetEvolutionType::NodePairType;
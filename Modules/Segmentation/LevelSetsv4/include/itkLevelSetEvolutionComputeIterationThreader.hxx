@@ -21,6 +21,8 @@
 
 #include "itkImageRegionConstIteratorWithIndex.h"
 
+#include <vector>
+
 namespace itk
 {
 
@@ -44,6 +46,14 @@ LevelSetEvolutionComputeIterationThreader<LevelSetDenseImage<TImage>,
   ImageRegionConstIteratorWithIndex<LevelSetImageType> imageIt(levelSetImage, subRegion);
   imageIt.GoToBegin();
 
+  // The region is evaluated by blocks of pixels, each term being called once
+  // per block, and the data computed at a pixel being shared by all the terms
+  constexpr SizeValueType             blockSize = 64;
+  std::vector<IndexType>              levelSetIndices(blockSize);
+  std::vector<IndexType>              inputIndices(blockSize);
+  std::vector<LevelSetDataType>       characteristics(blockSize);
+  std::vector<LevelSetOutputRealType> updates(blockSize);
+
   if (this->m_Associate->m_LevelSetContainer->HasDomainMap())
   {
     const IdListType * idList = this->m_Associate->m_IdListToProcessWhenThreading;
@@ -66,16 +76,28 @@ LevelSetEvolutionComputeIterationThreader<LevelSetDenseImage<TImage>,
 
     while (!imageIt.IsAtEnd())
     {
-      const IndexType levelSetIndex = imageIt.GetIndex();
-      const IndexType inputIndex = imageIt.GetIndex() + offset;
+      SizeValueType numberOfIndices = 0;
+      while (numberOfIndices < blockSize && !imageIt.IsAtEnd())
+      {
+        levelSetIndices[numberOfIndices] = imageIt.GetIndex();
+        inputIndices[numberOfIndices] = imageIt.GetIndex() + offset;
+        ++numberOfIndices;
+        ++imageIt;
+      }
       for (idListIdx = 0; idListIdx < numberOfLevelSets; ++idListIdx)
       {
-        LevelSetDataType characteristics;
-        termContainers[idListIdx]->ComputeRequiredData(inputIndex, characteristics);
-        LevelSetOutputRealType temp_update = termContainers[idListIdx]->Evaluate(inputIndex, characteristics);
-        levelSetUpdateImages[idListIdx]->SetPixel(levelSetIndex, temp_update);
+        for (SizeValueType k = 0; k < numberOfIndices; ++k)
+        {
+          characteristics[k].Reset();
+        }
+        termContainers[idListIdx]->ComputeRequiredData(inputIndices.data(), numberOfIndices, characteristics.data());
+        termContainers[idListIdx]->Evaluate(
+          inputIndices.data(), characteristics.data(), numberOfIndices, updates.data());
+        for (SizeValueType k = 0; k < numberOfIndices; ++k)
+        {
+          levelSetUpdateImages[idListIdx]->SetPixel(levelSetIndices[k], updates[k]);
+        }
       }
-      ++imageIt;
     }
   }
   else
@@ -93,13 +115,21 @@ LevelSetEvolutionComputeIterationThreader<LevelSetDenseImage<TImage>,
     imageIt.GoToBegin();
     while (!imageIt.IsAtEnd())
     {
-      const IndexType  levelSetIndex = imageIt.GetIndex();
-      const IndexType  inputIndex = imageIt.GetIndex() + offset;
-      LevelSetDataType characteristics;
-      termContainer->ComputeRequiredData(inputIndex, characteristics);
-      LevelSetOutputRealType temp_update = termContainer->Evaluate(inputIndex, characteristics);
-      levelSetUpdateImage->SetPixel(levelSetIndex, temp_update);
-      ++imageIt;
+      SizeValueType numberOfIndices = 0;
+      while (numberOfIndices < blockSize && !imageIt.IsAtEnd())
+      {
+        levelSetIndices[numberOfIndices] = imageIt.GetIndex();
+        inputIndices[numberOfIndices] = imageIt.GetIndex() + offset;
+        characteristics[numberOfIndices].Reset();
+        ++numberOfIndices;
+        ++imageIt;
+      }
+      termContainer->ComputeRequiredData(inputIndices.data(), numberOfIndices, characteristics.data());
+      termContainer->Evaluate(inputIndices.data(), characteristics.data(), numberOfIndices, updates.data());
+      for (SizeValueType k = 0; k < numberOfIndices; ++k)
+      {
+        levelSetUpdateImage->SetPixel(levelSetIndices[k], updates[k]);
+      }
     }
   }
 }
@@ -179,22 +209,37 @@ LevelSetEvolutionComputeIterationThreader<
 
   typename TermContainerType::Pointer termContainer = this->m_Associate->m_EquationContainer->GetEquation(levelSetId);
 
+  // The layer is evaluated by blocks of nodes, each term being called once per
+  // block, and the data computed at a node being shared by all the terms
+  constexpr SizeValueType             blockSize = 64;
+  std::vector<LevelSetInputType>      inputIndices(blockSize);
+  std::vector<LevelSetDataType>       characteristics(blockSize);
+  std::vector<LevelSetOutputRealType> updates(blockSize);
+
   typename LevelSetType::LayerConstIterator listIt = iteratorSubRange.Begin();
+  typename LevelSetType::LayerConstIterator blockIt = listIt;
 
   while (listIt != iteratorSubRange.End())
   {
-    const LevelSetInputType levelsetIndex = listIt->first;
-    LevelSetInputType       inputIndex = listIt->first + offset;
-
-    LevelSetDataType characteristics;
-
-    termContainer->ComputeRequiredData(inputIndex, characteristics);
+    SizeValueType numberOfIndices = 0;
+    while (numberOfIndices < blockSize && listIt != iteratorSubRange.End())
+    {
+      inputIndices[numberOfIndices] = listIt->first + offset;
+      characteristics[numberOfIndices].Reset();
+      ++numberOfIndices;
+      ++listIt;
+    }
 
-    const auto temp_update = static_cast<LevelSetOutputType>(termContainer->Evaluate(inputIndex, characteristics));
+    termContainer->ComputeRequiredData(inputIndices.data(), numberOfIndices, characteristics.data());
+    termContainer->Evaluate(inputIndices.data(), characteristics.data(), numberOfIndices, updates.data());
 
-    this->m_NodePairsPerThread[threadId].push_back(NodePairType(levelsetIndex, temp_update));
+    for (SizeValueType k = 0; k < numberOfIndices; ++k, ++blockIt)
+    {
+      const LevelSetInputType levelsetIndex = blockIt->first;
+      const auto              temp_update = static_cast<LevelSetOutputType>(updates[k]);
 
-    ++listIt;
+      this->m_NodePairsPerThread[threadId].push_back(NodePairType(levelsetIndex, temp_update));
+    }
   }
 }
 
@@ -210,13 +255,15 @@ LevelSetEvolutionComputeIterationThreader<
   typename LevelSetEvolutionType::LevelSetLayerType * levelSetLayerUpdateBuffer =
     this->m_Associate->m_UpdateBuffer[levelSetId];
 
+  // The work units process consecutive ranges of the sorted layer, so the
+  // pairs are sorted and each one is inserted at the end in constant time
   const ThreadIdType numberOfWorkUnits = this->GetNumberOfWorkUnitsUsed();
   for (ThreadIdType ii = 0; ii < numberOfWorkUnits; ++ii)
   {
     typename std::vector<NodePairType>::const_iterator pairIt = this->m_NodePairsPerThread[ii].begin();
     while (pairIt != this->m_NodePairsPerThread[ii].end())
     {
-      levelSetLayerUpdateBuffer->insert(*pairIt);
+      levelSetLayerUpdateBuffer->insert(levelSetLayerUpdateBuffer->end(), *pairIt);
       ++pairIt;
     }
   }
@@ -27,6 +27,7 @@
 #include "itkNeighborhoodAlgorithm.h"
 #include "itkLabelMapToLabelImageFilter.h"
 #include "itkLabelImageToLabelMapFilter.h"
+#include "itkMultiThreaderBase.h"
 
 namespace itk
 {
@@ -105,6 +106,11 @@ public:
   itkSetMacro(CurrentLevelSetId, IdentifierType);
   itkGetMacro(CurrentLevelSetId, IdentifierType);
 
+  /** Set/Get the number of work units used to evaluate the equation on the
+   * nodes of the zero layer */
+  itkSetClampMacro(NumberOfWorkUnits, ThreadIdType, 1, ITK_MAX_THREADS);
+  itkGetConstMacro(NumberOfWorkUnits, ThreadIdType);
+
 protected:
   UpdateMalcolmSparseLevelSet();
   ~UpdateMalcolmSparseLevelSet() override = default;
@@ -117,6 +123,9 @@ protected:
   IdentifierType           m_CurrentLevelSetId;
   LevelSetOutputRealType   m_RMSChangeAccumulator;
   EquationContainerPointer m_EquationContainer;
+  ThreadIdType             m_NumberOfWorkUnits;
+
+  MultiThreaderBase::Pointer m_MultiThreader;
 
   using LabelImageType = Image<int8_t, ImageDimension>;
   using LabelImagePointer = typename LabelImageType::Pointer;
@@ -127,7 +136,8 @@ protected:
 
   bool m_IsUsingUnPhasedPropagation{ true };
 
-  /** Compute the updates for all points in the 0 layer and store in UpdateContainer */
+  /** Compute the updates for all points in the 0 layer and store in UpdateContainer.
+   * The points are evaluated in parallel. */
   void
   FillUpdateContainer();
 
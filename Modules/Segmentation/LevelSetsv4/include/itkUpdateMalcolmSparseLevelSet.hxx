@@ -22,6 +22,8 @@
 #include "itkConnectedImageNeighborhoodShape.h"
 #include "itkMath.h"
 
+#include <vector>
+
 
 namespace itk
 {
@@ -30,10 +32,11 @@ template <unsigned int VDimension, typename TEquationContainer>
 UpdateMalcolmSparseLevelSet<VDimension, TEquationContainer>::UpdateMalcolmSparseLevelSet()
   : m_CurrentLevelSetId(NumericTraits<IdentifierType>::ZeroValue())
   , m_RMSChangeAccumulator(NumericTraits<LevelSetOutputRealType>::ZeroValue())
-
+  , m_NumberOfWorkUnits(MultiThreaderBase::GetGlobalDefaultNumberOfThreads())
 {
   this->m_Offset.Fill(0);
   this->m_OutputLevelSet = LevelSetType::New();
+  this->m_MultiThreader = MultiThreaderBase::New();
 }
 
 template <unsigned int VDimension, typename TEquationContainer>
@@ -126,35 +129,44 @@ template <unsigned int VDimension, typename TEquationContainer>
 void
 UpdateMalcolmSparseLevelSet<VDimension, TEquationContainer>::FillUpdateContainer()
 {
-  LevelSetLayerType levelZero = this->m_OutputLevelSet->GetLayer(LevelSetType::ZeroLayer());
-
-  auto nodeIt = levelZero.begin();
-  auto nodeEnd = levelZero.end();
+  const LevelSetLayerType & levelZero = this->m_OutputLevelSet->GetLayer(LevelSetType::ZeroLayer());
 
   TermContainerPointer termContainer = this->m_EquationContainer->GetEquation(this->m_CurrentLevelSetId);
 
-  LevelSetInputType inputIndex;
-  while (nodeIt != nodeEnd)
+  // Flat copy of the layer, sorted as the layer, to be split among the work units
+  std::vector<LevelSetInputType> nodes;
+  nodes.reserve(levelZero.size());
+  for (const auto & node : levelZero)
   {
-    const LevelSetInputType currentIndex = nodeIt->first;
-    inputIndex = currentIndex + this->m_Offset;
+    nodes.push_back(node.first);
+  }
+  std::vector<LevelSetOutputType> values(nodes.size());
 
-    const LevelSetOutputRealType update = termContainer->Evaluate(inputIndex);
+  this->m_MultiThreader->SetNumberOfWorkUnits(this->m_NumberOfWorkUnits);
+  this->m_MultiThreader->ParallelizeArray(
+    0,
+    nodes.size(),
+    [&](SizeValueType i) {
+      const LevelSetOutputRealType update = termContainer->Evaluate(nodes[i] + this->m_Offset);
 
-    LevelSetOutputType value = NumericTraits<LevelSetOutputType>::ZeroValue();
+      LevelSetOutputType value = NumericTraits<LevelSetOutputType>::ZeroValue();
 
-    if (update > NumericTraits<LevelSetOutputRealType>::ZeroValue())
-    {
-      value = NumericTraits<LevelSetOutputType>::OneValue();
-    }
-    if (update < NumericTraits<LevelSetOutputRealType>::ZeroValue())
-    {
-      value = -NumericTraits<LevelSetOutputType>::OneValue();
-    }
-
-    this->m_Update.insert(NodePairType(currentIndex, value));
+      if (update > NumericTraits<LevelSetOutputRealType>::ZeroValue())
+      {
+        value = NumericTraits<LevelSetOutputType>::OneValue();
+      }
+      if (update < NumericTraits<LevelSetOutputRealType>::ZeroValue())
+      {
+        value = -NumericTraits<LevelSetOutputType>::OneValue();
+      }
+      values[i] = value;
+    },
+    nullptr);
 
-    ++nodeIt;
+  // The nodes are sorted, so each one is inserted at the end in constant time
+  for (SizeValueType i = 0; i < nodes.size(); ++i)
+  {
+    this->m_Update.insert(this->m_Update.end(), NodePairType(nodes[i], values[i]));
   }
 }
 
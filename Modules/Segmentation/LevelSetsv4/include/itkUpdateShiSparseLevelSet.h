@@ -27,6 +27,9 @@
 #include "itkNeighborhoodAlgorithm.h"
 #include "itkLabelMapToLabelImageFilter.h"
 #include "itkLabelImageToLabelMapFilter.h"
+#include "itkMultiThreaderBase.h"
+
+#include <vector>
 
 namespace itk
 {
@@ -105,6 +108,11 @@ public:
   itkSetMacro(CurrentLevelSetId, IdentifierType);
   itkGetMacro(CurrentLevelSetId, IdentifierType);
 
+  /** Set/Get the number of work units used to evaluate the equation on the
+   * nodes of the layers */
+  itkSetClampMacro(NumberOfWorkUnits, ThreadIdType, 1, ITK_MAX_THREADS);
+  itkGetConstMacro(NumberOfWorkUnits, ThreadIdType);
+
 protected:
   UpdateShiSparseLevelSet();
   ~UpdateShiSparseLevelSet() override = default;
@@ -115,6 +123,9 @@ protected:
   IdentifierType           m_CurrentLevelSetId;
   LevelSetOutputRealType   m_RMSChangeAccumulator;
   EquationContainerPointer m_EquationContainer;
+  ThreadIdType             m_NumberOfWorkUnits;
+
+  MultiThreaderBase::Pointer m_MultiThreader;
 
   using LabelImageType = Image<int8_t, ImageDimension>;
   using LabelImagePointer = typename LabelImageType::Pointer;
@@ -140,6 +151,16 @@ protected:
       const LevelSetOutputType &     currentStatus,
       const LevelSetOutputRealType & currentUpdate) const;
 
+  /** Find the nodes of the +1 (resp. -1) layer which move to the -1 (resp.
+   * +1) layer. The equation is evaluated on the nodes in parallel, and
+   * isMoving holds one flag per node in the order of the layer. Neither the
+   * layers nor the internal image are modified, the nodes are moved by the
+   * caller once all of them have been visited. */
+  void
+  FindNodesMovingToOppositeLayer(const LevelSetLayerType &    layer,
+                                 const LevelSetOutputType &   status,
+                                 std::vector<unsigned char> & isMoving) const;
+
 private:
   // input
   LevelSetPointer    m_InputLevelSet;
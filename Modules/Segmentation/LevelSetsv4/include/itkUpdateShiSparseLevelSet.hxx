@@ -28,9 +28,11 @@ template <unsigned int VDimension, typename TEquationContainer>
 UpdateShiSparseLevelSet<VDimension, TEquationContainer>::UpdateShiSparseLevelSet()
   : m_CurrentLevelSetId(NumericTraits<IdentifierType>::ZeroValue())
   , m_RMSChangeAccumulator(NumericTraits<LevelSetOutputRealType>::ZeroValue())
+  , m_NumberOfWorkUnits(MultiThreaderBase::GetGlobalDefaultNumberOfThreads())
 {
   this->m_Offset.Fill(0);
   this->m_OutputLevelSet = LevelSetType::New();
+  this->m_MultiThreader = MultiThreaderBase::New();
 }
 
 template <unsigned int VDimension, typename TEquationContainer>
@@ -196,50 +198,41 @@ UpdateShiSparseLevelSet<VDimension, TEquationContainer>::UpdateLayerPlusOne()
   LevelSetLayerType insertListIn;
   LevelSetLayerType insertListOut;
 
+  std::vector<unsigned char> isMoving;
+  this->FindNodesMovingToOppositeLayer(listOut, LevelSetType::PlusOneLayer(), isMoving);
+
   auto nodeIt = listOut.begin();
   auto nodeEnd = listOut.end();
 
-  LevelSetInputType inputIndex;
-
   // for each point in Lz
-  while (nodeIt != nodeEnd)
+  for (auto movingIt = isMoving.begin(); nodeIt != nodeEnd; ++movingIt)
   {
-    bool                     erased = false;
-    const LevelSetInputType  currentIndex = nodeIt->first;
-    const LevelSetOutputType currentValue = nodeIt->second;
-    inputIndex = currentIndex + this->m_Offset;
-
-    // update the level set
-    LevelSetOutputRealType update = termContainer->Evaluate(inputIndex);
+    const LevelSetInputType currentIndex = nodeIt->first;
 
-    if (update < NumericTraits<LevelSetOutputRealType>::ZeroValue())
+    if (*movingIt)
     {
-      if (Con(currentIndex, currentValue, update))
-      {
-        // CheckIn
-        insertListIn.insert(NodePairType(currentIndex, LevelSetType::MinusOneLayer()));
+      // CheckIn
+      insertListIn.insert(NodePairType(currentIndex, LevelSetType::MinusOneLayer()));
+
+      auto tempIt = nodeIt;
+      ++nodeIt;
+      listOut.erase(tempIt);
 
-        auto tempIt = nodeIt;
-        ++nodeIt;
-        listOut.erase(tempIt);
-        erased = true;
+      neighIt.SetLocation(currentIndex);
 
-        neighIt.SetLocation(currentIndex);
+      for (typename NeighborhoodIteratorType::Iterator i = neighIt.Begin(); !i.IsAtEnd(); ++i)
+      {
+        LevelSetOutputType tempValue = i.Get();
 
-        for (typename NeighborhoodIteratorType::Iterator i = neighIt.Begin(); !i.IsAtEnd(); ++i)
+        if (tempValue == LevelSetType::PlusThreeLayer())
         {
-          LevelSetOutputType tempValue = i.Get();
-
-          if (tempValue == LevelSetType::PlusThreeLayer())
-          {
-            LevelSetInputType tempIndex = neighIt.GetIndex(i.GetNeighborhoodOffset());
+          LevelSetInputType tempIndex = neighIt.GetIndex(i.GetNeighborhoodOffset());
 
-            insertListOut.insert(NodePairType(tempIndex, LevelSetType::PlusOneLayer()));
-          }
+          insertListOut.insert(NodePairType(tempIndex, LevelSetType::PlusOneLayer()));
         }
       }
     }
-    if (!erased)
+    else
     {
       ++nodeIt;
     }
@@ -296,49 +289,41 @@ UpdateShiSparseLevelSet<VDimension, TEquationContainer>::UpdateLayerMinusOne()
   LevelSetLayerType insertListIn;
   LevelSetLayerType insertListOut;
 
+  std::vector<unsigned char> isMoving;
+  this->FindNodesMovingToOppositeLayer(listIn, LevelSetType::MinusOneLayer(), isMoving);
+
   auto nodeIt = listIn.begin();
   auto nodeEnd = listIn.end();
 
   // for each point in Lz
-  while (nodeIt != nodeEnd)
+  for (auto movingIt = isMoving.begin(); nodeIt != nodeEnd; ++movingIt)
   {
-    bool                     erased = false;
-    const LevelSetInputType  currentIndex = nodeIt->first;
-    const LevelSetOutputType currentValue = nodeIt->second;
-    const LevelSetInputType  inputIndex = currentIndex + this->m_Offset;
-
-    // update for the current level set
-    LevelSetOutputRealType update = termContainer->Evaluate(inputIndex);
+    const LevelSetInputType currentIndex = nodeIt->first;
 
-    if (update > NumericTraits<LevelSetOutputRealType>::ZeroValue())
+    if (*movingIt)
     {
-      if (Con(currentIndex, currentValue, update))
-      {
-        // CheckOut
-        insertListOut.insert(NodePairType(currentIndex, LevelSetType::PlusOneLayer()));
+      // CheckOut
+      insertListOut.insert(NodePairType(currentIndex, LevelSetType::PlusOneLayer()));
 
-        auto tempIt = nodeIt;
-        ++nodeIt;
-        listIn.erase(tempIt);
+      auto tempIt = nodeIt;
+      ++nodeIt;
+      listIn.erase(tempIt);
 
-        erased = true;
+      neighIt.SetLocation(currentIndex);
 
-        neighIt.SetLocation(currentIndex);
+      for (typename NeighborhoodIteratorType::Iterator i = neighIt.Begin(); !i.IsAtEnd(); ++i)
+      {
+        LevelSetOutputType tempValue = i.Get();
 
-        for (typename NeighborhoodIteratorType::Iterator i = neighIt.Begin(); !i.IsAtEnd(); ++i)
+        if (tempValue == LevelSetType::MinusThreeLayer())
         {
-          LevelSetOutputType tempValue = i.Get();
-
-          if (tempValue == LevelSetType::MinusThreeLayer())
-          {
-            LevelSetInputType tempIndex = neighIt.GetIndex(i.GetNeighborhoodOffset());
+          LevelSetInputType tempIndex = neighIt.GetIndex(i.GetNeighborhoodOffset());
 
-            insertListIn.insert(NodePairType(tempIndex, LevelSetType::MinusOneLayer()));
-          }
+          insertListIn.insert(NodePairType(tempIndex, LevelSetType::MinusOneLayer()));
         }
       }
     }
-    if (!erased)
+    else
     {
       ++nodeIt;
     }
@@ -413,6 +398,44 @@ UpdateShiSparseLevelSet<VDimension, TEquationContainer>::Con(const LevelSetInput
   return false;
 }
 
+template <unsigned int VDimension, typename TEquationContainer>
+void
+UpdateShiSparseLevelSet<VDimension, TEquationContainer>::FindNodesMovingToOppositeLayer(
+  const LevelSetLayerType &    layer,
+  const LevelSetOutputType &   status,
+  std::vector<unsigned char> & isMoving) const
+{
+  TermContainerPointer termContainer = this->m_EquationContainer->GetEquation(this->m_CurrentLevelSetId);
+
+  // Flat copy of the layer, sorted as the layer, to be split among the work units
+  std::vector<const typename LevelSetLayerType::value_type *> nodes;
+  nodes.reserve(layer.size());
+  for (const auto & node : layer)
+  {
+    nodes.push_back(&node);
+  }
+  isMoving.assign(nodes.size(), 0);
+
+  this->m_MultiThreader->SetNumberOfWorkUnits(this->m_NumberOfWorkUnits);
+  this->m_MultiThreader->ParallelizeArray(
+    0,
+    nodes.size(),
+    [&](SizeValueType i) {
+      const LevelSetInputType &    currentIndex = nodes[i]->first;
+      const LevelSetOutputType &   currentValue = nodes[i]->second;
+      const LevelSetOutputRealType update = termContainer->Evaluate(currentIndex + this->m_Offset);
+
+      // Nodes of the +1 layer move in for a negative update, nodes of the -1
+      // layer move out for a positive update
+      const bool isMovingInDirection = (status == LevelSetType::PlusOneLayer())
+                                         ? (update < NumericTraits<LevelSetOutputRealType>::ZeroValue())
+                                         : (update > NumericTraits<LevelSetOutputRealType>::ZeroValue());
+
+      isMoving[i] = isMovingInDirection && this->Con(currentIndex, currentValue, update);
+    },
+    nullptr);
+}
+
 } // end namespace itk
 
 #endif // itkUpdateShiSparseLevelSet_hxx
@@ -25,15 +25,8 @@
 #include "itkTestingMacros.h"
 
 int
-itkLevelSetEquationTermContainerTest(int argc, char * argv[])
+itkLevelSetEquationTermContainerTest(int, char *[])
 {
-  if (argc < 2)
-  {
-    std::cerr << "Missing Arguments" << std::endl;
-    std::cerr << "Program " << itkNameOfTestExecutableMacro(argv) << std::endl;
-    return EXIT_FAILURE;
-  }
-
   constexpr unsigned int Dimension = 2;
 
   using InputPixelType = unsigned short;
@@ -165,5 +158,44 @@ itkLevelSetEquationTermContainerTest(int argc, char * argv[])
 
   std::cout << "Term container 0 created" << std::endl;
 
+  termContainer0->InitializeParameters();
+  InputIteratorType it(binary, binary->GetLargestPossibleRegion());
+  for (it.GoToBegin(); !it.IsAtEnd(); ++it)
+  {
+    termContainer0->Initialize(it.GetIndex());
+  }
+  termContainer0->Update();
+
+  // Evaluating a block of locations gives the same values as evaluating them
+  // one after the other
+  using LevelSetInputIndexType = TermContainerType::LevelSetInputIndexType;
+  using LevelSetDataType = TermContainerType::LevelSetDataType;
+
+  std::vector<LevelSetInputIndexType> indices;
+  for (const auto & node : level_set->GetLayer(SparseLevelSetType::ZeroLayer()))
+  {
+    indices.push_back(node.first);
+  }
+
+  std::vector<LevelSetDataType>       data(indices.size());
+  std::vector<LevelSetOutputRealType> values(indices.size());
+  termContainer0->ComputeRequiredData(indices.data(), indices.size(), data.data());
+  termContainer0->Evaluate(indices.data(), data.data(), indices.size(), values.data());
+
+  for (size_t k = 0; k < indices.size(); ++k)
+  {
+    LevelSetDataType characteristics;
+    termContainer0->ComputeRequiredData(indices[k], characteristics);
+    const LevelSetOutputRealType value = termContainer0->Evaluate(indices[k], characteristics);
+
+    if (itk::Math::NotExactlyEquals(values[k], value))
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "Error in block evaluation at " << indices[k] << std::endl;
+      std::cerr << "Expected value " << value << ", but got " << values[k] << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
   return EXIT_SUCCESS;
 }
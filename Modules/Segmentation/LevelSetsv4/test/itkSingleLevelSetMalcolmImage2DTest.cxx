@@ -172,6 +172,10 @@ itkSingleLevelSetMalcolmImage2DTest(int argc, char * argv[])
 
   evolution->SetLevelSetContainer(lscontainer);
 
+  const itk::ThreadIdType numberOfWorkUnits = itk::MultiThreaderBase::GetGlobalDefaultNumberOfThreads();
+  evolution->SetNumberOfWorkUnits(numberOfWorkUnits);
+  ITK_TEST_SET_GET_VALUE(numberOfWorkUnits, evolution->GetNumberOfWorkUnits());
+
   try
   {
     evolution->Update();
@@ -161,6 +161,28 @@ public:
   itkGetConstReferenceMacro(MarkWatershedLine, bool);
   itkBooleanMacro(MarkWatershedLine);
 
+  /**
+   * Set/Get whether the hierarchical queue stores the gray levels in an
+   * array of buckets instead of an ordered map. Buckets are only used for
+   * integer pixel types, when the range of values in the input image does
+   * not exceed its number of pixels. The output does not depend on this
+   * setting. Default is true.
+   */
+  itkSetMacro(UseBucketQueue, bool);
+  itkGetConstReferenceMacro(UseBucketQueue, bool);
+  itkBooleanMacro(UseBucketQueue);
+
+  /**
+   * Set/Get the number of buckets into which floating point gray levels are
+   * quantized when UseBucketQueue is true. The values of a bucket are
+   * flooded as a single level, so the segmentation may differ from the one
+   * computed with exact values, where watershed lines are drawn between
+   * close gray levels. Ignored for integer pixel types. Default is 0, which
+   * disables the quantization and keeps exact floating point levels.
+   */
+  itkSetMacro(NumberOfQuantizationLevels, SizeValueType);
+  itkGetConstMacro(NumberOfQuantizationLevels, SizeValueType);
+
 protected:
   MorphologicalWatershedFromMarkersImageFilter();
   ~MorphologicalWatershedFromMarkersImageFilter() override = default;
@@ -187,6 +209,10 @@ private:
   bool m_FullyConnected{ false };
 
   bool m_MarkWatershedLine{ true };
+
+  bool m_UseBucketQueue{ true };
+
+  SizeValueType m_NumberOfQuantizationLevels{ 0 };
 }; // end of class
 } // end namespace itk
 
@@ -19,8 +19,8 @@
 #define itkMorphologicalWatershedFromMarkersImageFilter_hxx
 
 #include <algorithm>
-#include <queue>
-#include <list>
+#include <type_traits>
+#include "itkMorphologicalWatershedHierarchicalQueue.h"
 #include "itkProgressReporter.h"
 #include "itkImageRegionIterator.h"
 #include "itkImageRegionConstIteratorWithIndex.h"
@@ -113,9 +113,35 @@ MorphologicalWatershedFromMarkersImageFilter<TInputImage, TLabelImage>::Generate
   }
 
   // FAH (in french: File d'Attente Hierarchique)
-  using QueueType = std::queue<IndexType>;
-  using MapType = std::map<InputImagePixelType, QueueType>;
-  MapType fah;
+  using HierarchicalQueueType = MorphologicalWatershedHierarchicalQueue<InputImagePixelType, IndexType>;
+  using QueueType = typename HierarchicalQueueType::LevelQueueType;
+  HierarchicalQueueType fah;
+
+  // the gray levels can be stored in buckets if their range does not exceed
+  // the number of pixels, or if the floating point levels are quantized
+  InputImagePixelType minimum = NumericTraits<InputImagePixelType>::ZeroValue();
+  InputImagePixelType maximum = NumericTraits<InputImagePixelType>::ZeroValue();
+  const bool          useBuckets =
+    m_UseBucketQueue && (std::is_integral<InputImagePixelType>::value || m_NumberOfQuantizationLevels > 0);
+  if (useBuckets)
+  {
+    ImageRegionConstIterator<InputImageType> it(inputImage, inputImage->GetRequestedRegion());
+    minimum = NumericTraits<InputImagePixelType>::max();
+    maximum = NumericTraits<InputImagePixelType>::NonpositiveMin();
+    for (; !it.IsAtEnd(); ++it)
+    {
+      const InputImagePixelType value = it.Get();
+      minimum = std::min(minimum, value);
+      maximum = std::max(maximum, value);
+    }
+  }
+  fah.Initialize(minimum,
+                 maximum,
+                 useBuckets,
+                 inputImage->GetRequestedRegion().GetNumberOfPixels(),
+                 m_NumberOfQuantizationLevels);
+  QueueType           currentQueue;
+  InputImagePixelType currentValue = NumericTraits<InputImagePixelType>::ZeroValue();
 
   // the radius which will be used for all the shaped iterators
   Size<ImageDimension> radius;
@@ -214,7 +240,7 @@ MorphologicalWatershedFromMarkersImageFilter<TInputImage, TLabelImage>::Generate
           {
             // this neighbor is a background pixel and is not already
             // processed; add its index to fah
-            fah[niIt.Get()].push(markerIt.GetIndex() + nmIt.GetNeighborhoodOffset());
+            fah.Push(niIt.Get(), markerIt.GetIndex() + nmIt.GetNeighborhoodOffset());
             // mark it as already in the fah to avoid adding it several times
             nsIt.Set(true);
           }
@@ -244,18 +270,15 @@ MorphologicalWatershedFromMarkersImageFilter<TInputImage, TLabelImage>::Generate
     inputIt.GoToBegin();
 
     // and start flooding
-    while (!fah.empty())
+    while (!fah.Empty())
     {
-      // store the current vars
-      InputImagePixelType currentValue = fah.begin()->first;
-      QueueType           currentQueue = fah.begin()->second;
-      // and remove them from the fah
-      fah.erase(fah.begin());
+      // get the current vars and remove them from the fah
+      fah.PopLevel(currentValue, currentQueue);
 
-      while (!currentQueue.empty())
+      // the queue grows while it is processed, so it is traversed by position
+      for (SizeValueType head = 0; head < currentQueue.size(); ++head)
       {
-        IndexType idx = currentQueue.front();
-        currentQueue.pop();
+        const IndexType idx = currentQueue[head];
 
         // move the iterators to the right place
         OffsetType shift = idx - outputIt.GetIndex();
@@ -294,13 +317,13 @@ MorphologicalWatershedFromMarkersImageFilter<TInputImage, TLabelImage>::Generate
             {
               // the pixel is not yet processed. add it to the fah
               InputImagePixelType GrayVal = niIt.Get();
-              if (GrayVal <= currentValue)
+              if (fah.IsAtOrBelowLevel(GrayVal, currentValue))
               {
-                currentQueue.push(inputIt.GetIndex() + niIt.GetNeighborhoodOffset());
+                currentQueue.push_back(inputIt.GetIndex() + niIt.GetNeighborhoodOffset());
               }
               else
               {
-                fah[GrayVal].push(inputIt.GetIndex() + niIt.GetNeighborhoodOffset());
+                fah.Push(GrayVal, inputIt.GetIndex() + niIt.GetNeighborhoodOffset());
               }
               // mark it as already in the fah
               nsIt.Set(true);
@@ -354,7 +377,7 @@ MorphologicalWatershedFromMarkersImageFilter<TInputImage, TLabelImage>::Generate
         if (haveBgNeighbor)
         {
           // there is a background pixel in the neighborhood; add to fah
-          fah[inputIt.GetCenterPixel()].push(markerIt.GetIndex());
+          fah.Push(inputIt.GetCenterPixel(), markerIt.GetIndex());
         }
         else
         {
@@ -377,18 +400,15 @@ MorphologicalWatershedFromMarkersImageFilter<TInputImage, TLabelImage>::Generate
     inputIt.GoToBegin();
 
     // and start flooding
-    while (!fah.empty())
+    while (!fah.Empty())
     {
-      // store the current vars
-      InputImagePixelType currentValue = fah.begin()->first;
-      QueueType           currentQueue = fah.begin()->second;
-      // and remove them from the fah
-      fah.erase(fah.begin());
+      // get the current vars and remove them from the fah
+      fah.PopLevel(currentValue, currentQueue);
 
-      while (!currentQueue.empty())
+      // the queue grows while it is processed, so it is traversed by position
+      for (SizeValueType head = 0; head < currentQueue.size(); ++head)
       {
-        IndexType idx = currentQueue.front();
-        currentQueue.pop();
+        const IndexType idx = currentQueue[head];
 
         // move the iterators to the right place
         OffsetType shift = idx - outputIt.GetIndex();
@@ -406,13 +426,13 @@ MorphologicalWatershedFromMarkersImageFilter<TInputImage, TLabelImage>::Generate
             // current label
             noIt.Set(currentMarker);
             InputImagePixelType GrayVal = niIt.Get();
-            if (GrayVal <= currentValue)
+            if (fah.IsAtOrBelowLevel(GrayVal, currentValue))
             {
-              currentQueue.push(inputIt.GetIndex() + noIt.GetNeighborhoodOffset());
+              currentQueue.push_back(inputIt.GetIndex() + noIt.GetNeighborhoodOffset());
             }
             else
             {
-              fah[GrayVal].push(inputIt.GetIndex() + noIt.GetNeighborhoodOffset());
+              fah.Push(GrayVal, inputIt.GetIndex() + noIt.GetNeighborhoodOffset());
             }
             progress.CompletedPixel();
           }
@@ -432,6 +452,8 @@ MorphologicalWatershedFromMarkersImageFilter<TInputImage, TLabelImage>::PrintSel
 
   os << indent << "FullyConnected: " << m_FullyConnected << std::endl;
   os << indent << "MarkWatershedLine: " << m_MarkWatershedLine << std::endl;
+  os << indent << "UseBucketQueue: " << m_UseBucketQueue << std::endl;
+  os << indent << "NumberOfQuantizationLevels: " << m_NumberOfQuantizationLevels << std::endl;
 }
 
 } // end namespace itk
@@ -0,0 +1,213 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkMorphologicalWatershedHierarchicalQueue_h
+#define itkMorphologicalWatershedHierarchicalQueue_h
+
+#include "itkIntTypes.h"
+#include <algorithm>
+#include <map>
+#include <type_traits>
+#include <vector>
+
+namespace itk
+{
+/**
+ *\class MorphologicalWatershedHierarchicalQueue
+ *
+ * \brief Hierarchical queue (FAH) used by the morphological watershed filters.
+ *
+ * The queue stores indexes by gray level. Levels are retrieved in increasing
+ * order, all the indexes of a level at once, in the order they were pushed.
+ *
+ * For integer pixel types whose range of values in the image is small
+ * enough, the levels are stored in a vector of buckets indexed by gray
+ * level, and the next level is found by moving a cursor forward. Otherwise
+ * the levels are stored in a std::map. Both modes retrieve the indexes in
+ * the same order.
+ *
+ * Floating point gray levels can optionally be quantized into a given number
+ * of buckets spanning [minimum, maximum]. The values of a bucket then form a
+ * single level, so the order in which the indexes are retrieved, and the
+ * segmentation, may differ from the one given by exact values.
+ *
+ * \ingroup ITKWatersheds
+ */
+template <typename TPixel, typename TIndex>
+class MorphologicalWatershedHierarchicalQueue
+{
+public:
+  using PixelType = TPixel;
+  using IndexType = TIndex;
+
+  /** Indexes of one gray level, in first in, first out order. */
+  using LevelQueueType = std::vector<IndexType>;
+
+  /** Prepare the queue for gray levels in [minimum, maximum]. Buckets are
+   * used if useBuckets is true, the pixel type is an integer type and there
+   * are at most maximumNumberOfBuckets levels in the range. If useBuckets is
+   * true, the pixel type is not an integer type and numberOfQuantizationLevels
+   * is not zero, the gray levels are quantized into that number of buckets. */
+  void
+  Initialize(const PixelType & minimum,
+             const PixelType & maximum,
+             bool              useBuckets,
+             SizeValueType     maximumNumberOfBuckets,
+             SizeValueType     numberOfQuantizationLevels = 0)
+  {
+    m_Map.clear();
+    m_Buckets.clear();
+    m_Minimum = minimum;
+    m_Current = 0;
+    m_Size = 0;
+    m_Quantize = false;
+    m_QuantizationScale = 0.0;
+
+    if (!useBuckets || maximum < minimum)
+    {
+      m_UseBuckets = false;
+    }
+    else if (std::is_integral<PixelType>::value)
+    {
+      const double numberOfLevels = static_cast<double>(maximum) - static_cast<double>(minimum) + 1.0;
+      m_UseBuckets = numberOfLevels <= static_cast<double>(maximumNumberOfBuckets);
+      if (m_UseBuckets)
+      {
+        m_Buckets.resize(static_cast<SizeValueType>(numberOfLevels));
+      }
+    }
+    else
+    {
+      m_UseBuckets = numberOfQuantizationLevels > 0;
+      m_Quantize = m_UseBuckets;
+      if (m_Quantize)
+      {
+        const double range = static_cast<double>(maximum) - static_cast<double>(minimum);
+        if (range > 0.0)
+        {
+          m_QuantizationScale = static_cast<double>(numberOfQuantizationLevels - 1) / range;
+        }
+        m_Buckets.resize(numberOfQuantizationLevels);
+      }
+    }
+  }
+
+  /** Returns true if buckets are used to store the levels. */
+  bool
+  GetUseBuckets() const
+  {
+    return m_UseBuckets;
+  }
+
+  bool
+  Empty() const
+  {
+    return m_UseBuckets ? (m_Size == 0) : m_Map.empty();
+  }
+
+  /** Add an index at the given gray level. */
+  void
+  Push(const PixelType & value, const IndexType & index)
+  {
+    if (m_UseBuckets)
+    {
+      const SizeValueType level = this->GetLevel(value);
+      m_Buckets[level].push_back(index);
+      if (level < m_Current)
+      {
+        m_Current = level;
+      }
+      ++m_Size;
+    }
+    else
+    {
+      m_Map[value].push_back(index);
+    }
+  }
+
+  /** Returns true if value is not above the level last removed with
+   * PopLevel(), whose value was currentValue. With quantization, the values
+   * are compared by bucket. */
+  bool
+  IsAtOrBelowLevel(const PixelType & value, const PixelType & currentValue) const
+  {
+    if (m_Quantize)
+    {
+      return this->GetLevel(value) <= m_Current;
+    }
+    return value <= currentValue;
+  }
+
+  /** Remove the lowest gray level from the queue. Its value is stored in
+   * value and its indexes in levelQueue, whose previous content is
+   * discarded. The queue must not be empty. */
+  void
+  PopLevel(PixelType & value, LevelQueueType & levelQueue)
+  {
+    levelQueue.clear();
+    if (m_UseBuckets)
+    {
+      while (m_Buckets[m_Current].empty())
+      {
+        ++m_Current;
+      }
+      if (m_Quantize)
+      {
+        // lower bound of the values of the bucket
+        value = (m_QuantizationScale > 0.0) ? static_cast<PixelType>(m_Minimum + m_Current / m_QuantizationScale)
+                                            : m_Minimum;
+      }
+      else
+      {
+        value = static_cast<PixelType>(m_Minimum + m_Current);
+      }
+      levelQueue.swap(m_Buckets[m_Current]);
+      m_Size -= levelQueue.size();
+    }
+    else
+    {
+      auto first = m_Map.begin();
+      value = first->first;
+      levelQueue.swap(first->second);
+      m_Map.erase(first);
+    }
+  }
+
+private:
+  SizeValueType
+  GetLevel(const PixelType & value) const
+  {
+    if (m_Quantize)
+    {
+      const double level = (static_cast<double>(value) - static_cast<double>(m_Minimum)) * m_QuantizationScale;
+      return std::min(static_cast<SizeValueType>(std::max(level, 0.0)), static_cast<SizeValueType>(m_Buckets.size() - 1));
+    }
+    return static_cast<SizeValueType>(value - m_Minimum);
+  }
+
+  bool                                m_UseBuckets{ false };
+  bool                                m_Quantize{ false };
+  double                              m_QuantizationScale{ 0.0 };
+  PixelType                           m_Minimum{};
+  SizeValueType                       m_Current{ 0 };
+  SizeValueType                       m_Size{ 0 };
+  std::vector<LevelQueueType>         m_Buckets;
+  std::map<PixelType, LevelQueueType> m_Map;
+};
+} // end namespace itk
+
+#endif
@@ -109,6 +109,23 @@ public:
   itkSetMacro(Level, InputImagePixelType);
   itkGetConstMacro(Level, InputImagePixelType);
 
+  /**
+   * Set/Get whether the flooding uses a hierarchical queue of buckets
+   * instead of an ordered map for integer pixel types.
+   * \sa MorphologicalWatershedFromMarkersImageFilter::SetUseBucketQueue()
+   */
+  itkSetMacro(UseBucketQueue, bool);
+  itkGetConstReferenceMacro(UseBucketQueue, bool);
+  itkBooleanMacro(UseBucketQueue);
+
+  /**
+   * Set/Get the number of buckets into which floating point gray levels are
+   * quantized during the flooding.
+   * \sa MorphologicalWatershedFromMarkersImageFilter::SetNumberOfQuantizationLevels()
+   */
+  itkSetMacro(NumberOfQuantizationLevels, SizeValueType);
+  itkGetConstMacro(NumberOfQuantizationLevels, SizeValueType);
+
 protected:
   MorphologicalWatershedImageFilter();
   ~MorphologicalWatershedImageFilter() override = default;
@@ -135,6 +152,10 @@ private:
 
   bool m_MarkWatershedLine{ true };
 
+  bool m_UseBucketQueue{ true };
+
+  SizeValueType m_NumberOfQuantizationLevels{ 0 };
+
   InputImagePixelType m_Level;
 }; // end of class
 } // end namespace itk
@@ -98,6 +98,8 @@ MorphologicalWatershedImageFilter<TInputImage, TOutputImage>::GenerateData()
   wshed->SetMarkerImage(label->GetOutput());
   wshed->SetFullyConnected(m_FullyConnected);
   wshed->SetMarkWatershedLine(m_MarkWatershedLine);
+  wshed->SetUseBucketQueue(m_UseBucketQueue);
+  wshed->SetNumberOfQuantizationLevels(m_NumberOfQuantizationLevels);
 
   if (m_Level != NumericTraits<InputImagePixelType>::ZeroValue())
   {
@@ -145,6 +147,8 @@ MorphologicalWatershedImageFilter<TInputImage, TOutputImage>::PrintSelf(std::ost
 
   os << indent << "FullyConnected: " << m_FullyConnected << std::endl;
   os << indent << "MarkWatershedLine: " << m_MarkWatershedLine << std::endl;
+  os << indent << "UseBucketQueue: " << m_UseBucketQueue << std::endl;
+  os << indent << "NumberOfQuantizationLevels: " << m_NumberOfQuantizationLevels << std::endl;
   os << indent << "Level: " << static_cast<typename NumericTraits<InputImagePixelType>::PrintType>(m_Level)
      << std::endl;
 }
@@ -16,11 +16,14 @@
  *
  *=========================================================================*/
 
+#include "itkCastImageFilter.h"
 #include "itkImageFileReader.h"
 #include "itkImageFileWriter.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
 #include "itkSimpleFilterWatcher.h"
 #include "itkMorphologicalWatershedFromMarkersImageFilter.h"
 #include "itkLabelOverlayImageFilter.h"
+#include "itkMinimumMaximumImageCalculator.h"
 #include "itkTestingMacros.h"
 
 
@@ -65,6 +68,8 @@ itkMorphologicalWatershedFromMarkersImageFilterTest(int argc, char * argv[])
   bool fullyConnected = std::stoi(argv[5]);
   ITK_TEST_SET_GET_BOOLEAN(filter, FullyConnected, fullyConnected);
 
+  ITK_TEST_SET_GET_BOOLEAN(filter, UseBucketQueue, true);
+
 
   filter->SetInput(reader->GetOutput());
 
@@ -105,6 +110,62 @@ itkMorphologicalWatershedFromMarkersImageFilterTest(int argc, char * argv[])
 
   ITK_TRY_EXPECT_NO_EXCEPTION(filter->Update());
 
+  // The output must not depend on the way the hierarchical queue stores the
+  // gray levels
+  ImageType::Pointer bucketOutput = filter->GetOutput();
+  bucketOutput->DisconnectPipeline();
+
+  filter->UseBucketQueueOff();
+  ITK_TRY_EXPECT_NO_EXCEPTION(filter->Update());
+
+  itk::ImageRegionConstIteratorWithIndex<ImageType> bucketIt(bucketOutput, bucketOutput->GetBufferedRegion());
+  itk::ImageRegionConstIterator<ImageType>          mapIt(filter->GetOutput(), bucketOutput->GetBufferedRegion());
+  for (; !bucketIt.IsAtEnd(); ++bucketIt, ++mapIt)
+  {
+    if (bucketIt.Get() != mapIt.Get())
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "Output differs with UseBucketQueue at index " << bucketIt.GetIndex() << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Quantizing float gray levels into one bucket per integer value of the
+  // input range floods the same levels as the integer image
+  using FloatImageType = itk::Image<float, Dimension>;
+  using CastFilterType = itk::CastImageFilter<ImageType, FloatImageType>;
+  auto caster = CastFilterType::New();
+  caster->SetInput(reader->GetOutput());
+
+  using MinMaxCalculatorType = itk::MinimumMaximumImageCalculator<ImageType>;
+  auto minMaxCalculator = MinMaxCalculatorType::New();
+  minMaxCalculator->SetImage(reader->GetOutput());
+  minMaxCalculator->Compute();
+
+  using FloatFilterType = itk::MorphologicalWatershedFromMarkersImageFilter<FloatImageType, ImageType>;
+  auto floatFilter = FloatFilterType::New();
+  floatFilter->SetInput(caster->GetOutput());
+  floatFilter->SetMarkerImage(markerImage);
+  floatFilter->SetMarkWatershedLine(markWatershedLine);
+  floatFilter->SetFullyConnected(fullyConnected);
+
+  const itk::SizeValueType numberOfQuantizationLevels =
+    static_cast<itk::SizeValueType>(minMaxCalculator->GetMaximum() - minMaxCalculator->GetMinimum()) + 1;
+  floatFilter->SetNumberOfQuantizationLevels(numberOfQuantizationLevels);
+  ITK_TEST_SET_GET_VALUE(numberOfQuantizationLevels, floatFilter->GetNumberOfQuantizationLevels());
+  ITK_TRY_EXPECT_NO_EXCEPTION(floatFilter->Update());
+
+  itk::ImageRegionConstIterator<ImageType> quantizedIt(floatFilter->GetOutput(), bucketOutput->GetBufferedRegion());
+  for (bucketIt.GoToBegin(); !bucketIt.IsAtEnd(); ++bucketIt, ++quantizedIt)
+  {
+    if (bucketIt.Get() != quantizedIt.Get())
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "Output differs with NumberOfQuantizationLevels at index " << bucketIt.GetIndex() << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
 
   // Write output image
   using WriterType = itk::ImageFileWriter<ImageType>;